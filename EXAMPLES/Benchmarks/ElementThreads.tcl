@@ -0,0 +1,131 @@
+# Element thread pool benchmark
+#
+# Times a pushover of a frame of fiber forceBeamColumn elements standing
+# on a block of quad elements for several sizes of the pool given to
+# "analysis Static -threads n". The elements of both kinds are thread
+# safe, so with n > 0 the Domain updates and commits them, and the
+# integrator forms them, on the pool; n = 0 is the serial loop. The
+# column bases are tied to the block by equalDOF under the Transformation
+# handler, so the elements are formed through TransformationFEs; their T
+# is constant, and they go to the pool as well. The final load factor is
+# printed so that the runs can be compared: the elements are assembled in
+# the order of their colours whether or not there is a pool, so it is the
+# same, bit for bit, for every n.
+#
+#   OpenSees ElementThreads.tcl ?-bays n? ?-stories n? ?-steps n? ?-threads {0 1 2 4}?
+#
+set nBays    8
+set nStories 8
+set nSteps   20
+set threads  {0 1 2 4}
+foreach {key val} $argv {
+  switch -- $key {
+    -bays    {set nBays $val}
+    -stories {set nStories $val}
+    -steps   {set nSteps $val}
+    -threads {set threads $val}
+  }
+}
+
+set H    3000.0
+set B    6000.0
+set nQx  [expr 4*$nBays]
+set nQy  4
+
+puts [format "%8s %12s %12s %12s %12s %23s" threads "total (s)" "update (s)" "commit (s)" "form (s)" "load factor"]
+
+foreach n $threads {
+  # foundation block of quads; the frame columns stand on its top edge
+  model basic -ndm 2 -ndf 2
+  nDMaterial ElasticIsotropic 10 30000.0 0.2
+  set dx [expr $nBays*$B/$nQx]
+  for {set j 0} {$j <= $nQy} {incr j} {
+    for {set i 0} {$i <= $nQx} {incr i} {
+      node [expr 100000 + $j*($nQx+1) + $i] [expr $i*$dx] [expr ($j-$nQy)*$dx]
+    }
+  }
+  for {set i 0} {$i <= $nQx} {incr i} {
+    fix [expr 100000 + $i] 1 1
+  }
+  set e 100000
+  for {set j 0} {$j < $nQy} {incr j} {
+    for {set i 0} {$i < $nQx} {incr i} {
+      set n1 [expr 100000 + $j*($nQx+1) + $i]
+      set n3 [expr $n1 + $nQx + 2]
+      element quad [incr e] $n1 [expr $n1+1] $n3 [expr $n3-1] 500.0 PlaneStrain 10
+    }
+  }
+
+  # the frame
+  model basic -ndm 2 -ndf 3
+  uniaxialMaterial Concrete02 1 -30.0 -0.002 -6.0 -0.006 0.1 3.0 1500.0
+  uniaxialMaterial Steel02    2 420.0 200000.0 0.01 18 0.925 0.15
+  section Fiber 1 {
+    patch rect 1 10 10 -250.0 -250.0 250.0 250.0
+    layer straight 2 4 500.0 -200.0 -200.0 -200.0 200.0
+    layer straight 2 4 500.0  200.0 -200.0  200.0 200.0
+  }
+  geomTransf PDelta 1
+  geomTransf Linear 2
+
+  for {set j 0} {$j <= $nStories} {incr j} {
+    for {set i 0} {$i <= $nBays} {incr i} {
+      node [expr $j*100 + $i + 1] [expr $i*$B] [expr $j*$H]
+    }
+  }
+  # tie the column bases to the top of the block
+  for {set i 0} {$i <= $nBays} {incr i} {
+    equalDOF [expr 100000 + $nQy*($nQx+1) + 4*$i] [expr $i+1] 1 2
+  }
+  fix 1 0 0 1
+
+  set e 0
+  for {set j 0} {$j < $nStories} {incr j} {
+    for {set i 0} {$i <= $nBays} {incr i} {
+      set iNode [expr $j*100 + $i + 1]
+      element forceBeamColumn [incr e] $iNode [expr $iNode + 100] 5 1 1
+    }
+    for {set i 0} {$i < $nBays} {incr i} {
+      set iNode [expr ($j+1)*100 + $i + 1]
+      element forceBeamColumn [incr e] $iNode [expr $iNode + 1] 5 1 2
+    }
+  }
+
+  set roof [expr $nStories*100 + 1]
+  pattern Plain 1 Linear {
+    for {set j 1} {$j <= $nStories} {incr j} {
+      load [expr $j*100 + 1] [expr 1.0*$j] 0.0 0.0
+    }
+  }
+
+  constraints Transformation
+  numberer RCM
+  system UmfPack
+  test NormDispIncr 1.0e-8 20
+  algorithm Newton
+  integrator DisplacementControl $roof 1 [expr 0.005*$nStories*$H/$nSteps]
+  analysis Static -threads $n
+
+  profile start
+  set start [clock microseconds]
+  analyze $nSteps
+  set time [expr ([clock microseconds] - $start)*1.0e-6]
+  set prof [profile]
+  profile stop
+
+  set update 0.0
+  set commit 0.0
+  set form   0.0
+  dict for {phase t} [dict get $prof time] {
+    switch -- $phase {
+      update        {set update $t}
+      commit        {set commit $t}
+      formTangent   -
+      formUnbalance {set form [expr $form + $t]}
+    }
+  }
+
+  puts [format "%8d %12.4f %12.4f %12.4f %12.4f %23.16e" $n $time $update $commit $form [getTime]]
+
+  wipe
+}
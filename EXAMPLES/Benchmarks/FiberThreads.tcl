@@ -0,0 +1,88 @@
+# Fiber section benchmark
+#
+# Times the state determination of a fiber section as a function of the
+# number of fibers. Run it with a serial build and with a build configured
+# with -DN_FIBER_THREADS=<n>; the fiber count at which the threaded times
+# drop below the serial ones is the crossover that FIBER_THREAD_THRESHOLD
+# in SRC/material/section/FiberThreads.h should be set to.
+#
+#   OpenSees FiberThreads.tcl ?-ndm 2|3? ?-steps n?
+#
+set ndm    3
+set nSteps 50
+foreach {key val} $argv {
+  switch -- $key {
+    -ndm   {set ndm $val}
+    -steps {set nSteps $val}
+  }
+}
+
+set L   100.0
+set b    10.0
+set d    20.0
+set E 29000.0
+set Fy   50.0
+set nIP     5
+set nIter   4
+
+puts [format "%8s %12s %14s" fibers "total (s)" "per fiber (ns)"]
+
+foreach nFibers {8 16 32 48 64 96 128 192 256 384 512 1024 2048} {
+
+  if {$ndm == 3} {
+    model basic -ndm 3 -ndf 6
+    node 1 0.0 0.0 0.0
+    node 2  $L 0.0 0.0
+    fix 1 1 1 1 1 1 1
+    uniaxialMaterial Elastic 2 1.0e6
+  } else {
+    model basic -ndm 2 -ndf 3
+    node 1 0.0 0.0
+    node 2  $L 0.0
+    fix 1 1 1 1
+  }
+
+  uniaxialMaterial Steel01 1 $Fy $E 0.02
+
+  # a single layer of nFibers fibers through the depth
+  if {$ndm == 3} {
+    section Fiber 1 -torsion 2 {
+      patch rect 1 $nFibers 1 [expr -$d/2] [expr -$b/2] [expr $d/2] [expr $b/2]
+    }
+    geomTransf Linear 1 0 0 1
+  } else {
+    section Fiber 1 {
+      patch rect 1 $nFibers 1 [expr -$d/2] [expr -$b/2] [expr $d/2] [expr $b/2]
+    }
+    geomTransf Linear 1
+  }
+  element dispBeamColumn 1 1 2 $nIP 1 1
+
+  pattern Plain 1 Linear {
+    if {$ndm == 3} {
+      load 2 0.0 1.0 1.0 0.0 0.0 0.0
+    } else {
+      load 2 0.0 1.0 0.0
+    }
+  }
+
+  # push well past first yield so the fibers follow the nonlinear branch
+  set dU [expr 4.0*$Fy/$E*$L*$L/$d/$nSteps]
+  integrator DisplacementControl 2 2 $dU
+  test FixedNumIter $nIter
+  algorithm Newton
+  constraints Plain
+  numberer Plain
+  system BandGeneral
+  analysis Static
+
+  set start [clock microseconds]
+  analyze $nSteps
+  set time [expr ([clock microseconds] - $start)*1.0e-6]
+
+  # state determinations: one per iteration plus the one ending each step
+  set calls [expr $nSteps*($nIter + 1)*$nIP]
+  puts [format "%8d %12.4f %14.2f" $nFibers $time [expr $time*1.0e9/($calls*$nFibers)]]
+
+  wipe
+}
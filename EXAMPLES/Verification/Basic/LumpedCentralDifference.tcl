@@ -0,0 +1,97 @@
+# LumpedCentralDifference.tcl
+#
+# A chain of three masses on springs is analyzed with the matrix free
+# LumpedCentralDifference and with CentralDifference, which solves the same
+# lumped mass scheme with a LinearSOE. The displacements of the masses are
+# compared at every step for a load at the top, for a displacement prescribed
+# at the first mass by an sp command, and for an imposed ground motion at that
+# mass. The constraints are handled by Transformation, which imposes the
+# prescribed displacements.
+
+puts "LumpedCentralDifference.tcl: LumpedCentralDifference against CentralDifference"
+
+set numSteps 200
+set dt 0.01
+set tol 1.0e-10
+
+proc solveChain {integrator loading} {
+    global numSteps dt
+
+    wipe
+    model Basic -ndm 1 -ndf 1
+    node 1 0.
+    node 2 0. -mass 1.0
+    node 3 0. -mass 2.0
+    node 4 0. -mass 0.5
+    fix 1 1
+
+    uniaxialMaterial Elastic 1 400.0
+    uniaxialMaterial Elastic 2 250.0
+    element zeroLength 1 1 2 -mat 1 -dir 1
+    element zeroLength 2 2 3 -mat 2 -dir 1
+    element zeroLength 3 3 4 -mat 2 -dir 1
+
+    timeSeries Sine 1 0.0 10.0 0.4
+    switch $loading {
+	load {
+	    pattern Plain 1 1 {
+		load 4 10.0
+	    }
+	}
+	sp {
+	    pattern Plain 1 1 {
+		sp 2 1 0.01
+	    }
+	}
+	imposedMotion {
+	    pattern MultipleSupport 1 {
+		groundMotion 1 Plain -disp {Sine 0.0 10.0 0.4 -factor 0.01}
+		imposedMotion 2 1 1
+	    }
+	}
+    }
+
+    constraints Transformation
+    numberer Plain
+    system FullGeneral
+    algorithm Linear
+    integrator $integrator
+    analysis Transient
+
+    set result {}
+    for {set i 0} {$i < $numSteps} {incr i} {
+	analyze 1 $dt
+	foreach node {2 3 4} {
+	    lappend result [nodeDisp $node 1]
+	}
+    }
+    return $result
+}
+
+set testOK 0
+foreach loading {load sp imposedMotion} {
+    set exact [solveChain CentralDifference $loading]
+    set result [solveChain LumpedCentralDifference $loading]
+    set largest 0.0
+    set error 0.0
+    foreach u $result uExact $exact {
+	set largest [expr max($largest, abs($uExact))]
+	set error [expr max($error, abs($u - $uExact))]
+    }
+    set error [expr $error/$largest]
+    puts [format "%15s  largest displacement %12.5e  relative difference %10.3e" $loading $largest $error]
+    if {$largest == 0.0 || $error > $tol} {
+	set testOK -1
+	puts "failed-> $error $tol"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test LumpedCentralDifference.tcl \n\n"
+    puts $results "| PASSED |  LumpedCentralDifference.tcl"
+} else {
+    puts "FAILED Verification Test LumpedCentralDifference.tcl \n\n"
+    puts $results "FAILED : LumpedCentralDifference.tcl"
+}
+close $results
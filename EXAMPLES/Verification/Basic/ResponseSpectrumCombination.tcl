@@ -0,0 +1,134 @@
+# ResponseSpectrumCombination.tcl
+#
+# A 2 dof shear building, its second story a light and soft one so that the
+# two modes are close, is analyzed by responseSpectrum with each of the SRSS,
+# CQC and ABS combinations. The combined displacements of the two floors are
+# compared with those computed here from the closed form modes of the 2x2
+# problem, the modal displacement of each being phi*Gamma*Sa(T)/w^2 and the
+# CQC correlation that of Der Kiureghian.
+
+puts "ResponseSpectrumCombination.tcl: SRSS, CQC and ABS for a 2 dof building"
+
+set m1 1.0
+set m2 0.1
+set k1 40.0
+set k2 3.5
+set zeta 0.05
+set Tn {0.0 0.5 1.0 1.5 3.0}
+set Sa {100.0 250.0 200.0 120.0 60.0}
+set tol 1.0e-10
+
+# the linear interpolation of the spectrum responseSpectrum uses
+proc spectrum {T} {
+    global Tn Sa
+    if {$T <= [lindex $Tn 0]} {return [lindex $Sa 0]}
+    for {set i 1} {$i < [llength $Tn]} {incr i} {
+	set t0 [lindex $Tn [expr $i-1]]
+	set t1 [lindex $Tn $i]
+	if {$T <= $t1} {
+	    set s0 [lindex $Sa [expr $i-1]]
+	    set s1 [lindex $Sa $i]
+	    return [expr $s0 + ($T - $t0)/($t1 - $t0)*($s1 - $s0)]
+	}
+    }
+    return [lindex $Sa end]
+}
+
+# the correlation of two modes of the same damping ratio
+proc rho {wi wj zeta} {
+    set r [expr $wj/$wi]
+    set z2 [expr $zeta*$zeta]
+    return [expr 8.0*$z2*(1.0 + $r)*$r*sqrt($r)/((1.0 - $r*$r)**2 + 4.0*$z2*$r*(1.0 + $r)**2)]
+}
+
+#
+# the modal displacements of the floors, by hand
+#
+
+# m1*m2*w^4 - (m1*k2 + m2*(k1 + k2))*w^2 + k1*k2 = 0
+set b [expr $m1*$k2 + $m2*($k1 + $k2)]
+set d [expr sqrt($b*$b - 4.0*$m1*$m2*$k1*$k2)]
+set lambdas [list [expr ($b - $d)/(2.0*$m1*$m2)] [expr ($b + $d)/(2.0*$m1*$m2)]]
+
+set omega {}
+set modal {}
+foreach lambda $lambdas {
+    # phi = {1, a}, from the first row of (K - lambda M) phi = 0
+    set a [expr ($k1 + $k2 - $lambda*$m1)/$k2]
+    set gamma [expr ($m1 + $m2*$a)/($m1 + $m2*$a*$a)]
+    set w [expr sqrt($lambda)]
+    set SaT [spectrum [expr 2.0*acos(-1.0)/$w]]
+    set u [expr $gamma*$SaT/$lambda]
+    lappend omega $w
+    lappend modal [list $u [expr $a*$u]]
+}
+
+set rho12 [rho [lindex $omega 0] [lindex $omega 1] $zeta]
+puts [format "periods %.4f %.4f, rho12 %.4f" \
+	  [expr 2.0*acos(-1.0)/[lindex $omega 0]] [expr 2.0*acos(-1.0)/[lindex $omega 1]] $rho12]
+
+set exact(SRSS) {}
+set exact(CQC) {}
+set exact(ABS) {}
+foreach dof {0 1} {
+    set r1 [lindex $modal 0 $dof]
+    set r2 [lindex $modal 1 $dof]
+    lappend exact(SRSS) [expr sqrt($r1*$r1 + $r2*$r2)]
+    lappend exact(CQC) [expr sqrt($r1*$r1 + $r2*$r2 + 2.0*$rho12*$r1*$r2)]
+    lappend exact(ABS) [expr abs($r1) + abs($r2)]
+}
+
+#
+# the same by responseSpectrum
+#
+
+# in 2d, as modalProperties needs ndm 2 or 3, with only the floors moving
+wipe
+model Basic -ndm 2 -ndf 3
+node 1 0. 0.
+node 2 0. 0. -mass $m1 0. 0.
+node 3 0. 0. -mass $m2 0. 0.
+fix 1 1 1 1
+fix 2 0 1 1
+fix 3 0 1 1
+
+uniaxialMaterial Elastic 1 $k1
+uniaxialMaterial Elastic 2 $k2
+element zeroLength 1 1 2 -mat 1 -dir 1
+element zeroLength 2 2 3 -mat 2 -dir 1
+
+constraints Plain
+numberer Plain
+system FullGeneral
+algorithm Linear
+integrator LoadControl 0.0
+analysis Static
+
+eigen -fullGenLapack 2
+modalProperties
+
+set testOK 0
+foreach rule {SRSS CQC ABS} {
+    set result [responseSpectrum 1 -Tn $Tn -Sa $Sa -combine $rule -damp $zeta -node {2 3}]
+    set error 0.0
+    # the lateral displacement, the first of the dofs of each node
+    foreach u [list [lindex $result 0 0] [lindex $result 1 0]] uExact $exact($rule) {
+	set error [expr max($error, abs($u - $uExact)/abs($uExact))]
+    }
+    puts [format "%6s  floors %12.6f %12.6f  exact %12.6f %12.6f  relative difference %10.3e" $rule \
+	      [lindex $result 0 0] [lindex $result 1 0] {*}$exact($rule) $error]
+    if {[llength $result] != 2 || $error > $tol} {
+	set testOK -1
+	puts "failed-> $error $tol"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ResponseSpectrumCombination.tcl \n\n"
+    puts $results "| PASSED |  ResponseSpectrumCombination.tcl"
+} else {
+    puts "FAILED Verification Test ResponseSpectrumCombination.tcl \n\n"
+    puts $results "FAILED : ResponseSpectrumCombination.tcl"
+}
+close $results
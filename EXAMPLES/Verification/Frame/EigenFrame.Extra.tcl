@@ -165,7 +165,7 @@ foreach eleType $eleTypes {
 
 
 
-set solverTypes {-genBandArpack -fullGenLapack -UmfPack -SuperLU -ProfileSPD}
+set solverTypes {-genBandArpack -fullGenLapack -lanczos -UmfPack -SuperLU -ProfileSPD}
 
 foreach solverType $solverTypes {
 
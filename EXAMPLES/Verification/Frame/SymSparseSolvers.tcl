@@ -0,0 +1,123 @@
+# SymSparseSolvers.tcl
+#
+# A 2d frame of 10 bays and 9 floors, its floors tied by equalDOF under the
+# Transformation handler and with PDelta columns, is pushed by a lateral load
+# in 5 Newton steps and then shaken by a transient in 10 Newmark steps. The
+# lateral displacements of the floors at the end of each analysis with the
+# SymSparseLinSOE solvers, the original one and the supernodal Cholesky on 1
+# and 2 threads, are compared with those of ProfileSPD and UmfPack.
+
+puts "SymSparseSolvers.tcl: the SparseSYM solvers against ProfileSPD and UmfPack"
+
+proc solveFrame {system} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+
+    set numBay   10
+    set numFloor 9
+    set bayWidth 20.0
+    set storyHeight 10.0
+
+    for {set floor 0} {$floor <= $numFloor} {incr floor} {
+	for {set bay 0} {$bay <= $numBay} {incr bay} {
+	    set nodeTag [expr 100*$floor + $bay + 1]
+	    node $nodeTag [expr $bay*$bayWidth] [expr $floor*$storyHeight]
+	    if {$floor == 0} {
+		fix $nodeTag 1 1 1
+	    } else {
+		mass $nodeTag 1.0 1.0 0.0
+	    }
+	}
+	if {$floor > 0} {
+	    for {set bay 1} {$bay <= $numBay} {incr bay} {
+		equalDOF [expr 100*$floor + 1] [expr 100*$floor + $bay + 1] 1
+	    }
+	}
+    }
+
+    geomTransf PDelta 1
+    geomTransf Linear 2
+    set eleTag 1
+    for {set floor 0} {$floor < $numFloor} {incr floor} {
+	for {set bay 0} {$bay <= $numBay} {incr bay} {
+	    set iNode [expr 100*$floor + $bay + 1]
+	    element elasticBeamColumn $eleTag $iNode [expr $iNode + 100] 3.0 432000.0 [expr 1.0 + 0.1*$bay] 1
+	    incr eleTag
+	}
+	for {set bay 0} {$bay < $numBay} {incr bay} {
+	    set iNode [expr 100*($floor+1) + $bay + 1]
+	    element elasticBeamColumn $eleTag $iNode [expr $iNode + 1] 3.0 432000.0 2.0 2
+	    incr eleTag
+	}
+    }
+
+    pattern Plain 1 Linear {
+	for {set floor 1} {$floor <= $numFloor} {incr floor} {
+	    load [expr 100*$floor + 1] [expr 10.0*$floor] 0.0 0.0
+	    for {set bay 0} {$bay <= $numBay} {incr bay} {
+		load [expr 100*$floor + $bay + 1] 0.0 -50.0 0.0
+	    }
+	}
+    }
+
+    constraints Transformation
+    numberer RCM
+    eval system $system
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator LoadControl 0.2
+    analysis Static
+    analyze 5
+
+    set result {}
+    for {set floor 1} {$floor <= $numFloor} {incr floor} {
+	lappend result [nodeDisp [expr 100*$floor + 1] 1]
+    }
+
+    loadConst -time 0.0
+    timeSeries Sine 2 0.0 1.0 0.5
+    pattern UniformExcitation 2 1 -accel 2 -fact 100.0
+    wipeAnalysis
+    constraints Transformation
+    numberer RCM
+    eval system $system
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    analyze 10 0.02
+
+    for {set floor 1} {$floor <= $numFloor} {incr floor} {
+	lappend result [nodeDisp [expr 100*$floor + 1] 1]
+    }
+    return $result
+}
+
+set testOK 0
+set exact [solveFrame ProfileSPD]
+set other [solveFrame UmfPack]
+foreach system {SparseSYM {SparseSYM -supernodal} {SparseSYM -supernodal -threads 2}} {
+    set result [solveFrame $system]
+    set error 0.0
+    foreach u $result uExact $exact uOther $other {
+	set scale [expr abs($uExact) > 1.0e-12 ? abs($uExact) : 1.0]
+	foreach v [list $uExact $uOther] {
+	    set error [expr max($error, abs($u - $v)/$scale)]
+	}
+    }
+    puts [format "%40s  largest relative difference %12.3e" "system $system" $error]
+    if {$error > 1.0e-8} {
+	set testOK -1
+	puts "failed-> $error 1.0e-8"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test SymSparseSolvers.tcl \n\n"
+    puts $results "| PASSED |  SymSparseSolvers.tcl"
+} else {
+    puts "FAILED Verification Test SymSparseSolvers.tcl \n\n"
+    puts $results "FAILED : SymSparseSolvers.tcl"
+}
+close $results
@@ -11,6 +11,8 @@ source sdofTransient.tcl
 source SmallEigen.tcl
 source NewmarkIntegrator.tcl
 source mdofModal.tcl
+source ResponseSpectrumCombination.tcl
+source LumpedCentralDifference.tcl
 cd ..
 
 source Truss/PlanarTruss.tcl
@@ -20,6 +22,7 @@ source Frame/PortalFrame2d.tcl
 source Frame/EigenFrame.tcl
 source Frame/EigenFrame.Extra.tcl
 source Frame/AISC25.tcl
+source Frame/SymSparseSolvers.tcl
 
 source Plane/PlaneStrain.tcl
 source Plane/QuadBending.tcl
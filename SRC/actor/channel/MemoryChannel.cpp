@@ -0,0 +1,251 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of MemoryChannel.
+//
+#include <MemoryChannel.h>
+#include <MovableObject.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Stream.h>
+#include <cstring>
+
+namespace {
+  enum {
+    MEMORY_MESSAGE,
+    MEMORY_MATRIX,
+    MEMORY_VECTOR,
+    MEMORY_ID
+  };
+
+  struct Header {
+    int         kind;
+    std::size_t size;
+  };
+}
+
+MemoryChannel::MemoryChannel()
+:numBytes(0)
+{
+
+}
+
+MemoryChannel::~MemoryChannel()
+{
+
+}
+
+void
+MemoryChannel::rewind(void)
+{
+  for (auto &stream : streams)
+    stream.second.readLoc = 0;
+}
+
+void
+MemoryChannel::clear(void)
+{
+  streams.clear();
+  numBytes = 0;
+}
+
+std::size_t
+MemoryChannel::getSize(void) const
+{
+  return numBytes;
+}
+
+char *
+MemoryChannel::addToProgram(void)
+{
+  return nullptr;
+}
+
+int
+MemoryChannel::setUpConnection(void)
+{
+  return 0;
+}
+
+int
+MemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  return 0;
+}
+
+ChannelAddress *
+MemoryChannel::getLastSendersAddress(void)
+{
+  return nullptr;
+}
+
+void
+MemoryChannel::put(int dbTag, int commitTag, int kind, const void *data, std::size_t size)
+{
+  std::vector<char> &buffer = streams[std::make_pair(dbTag, commitTag)].buffer;
+
+  Header header{kind, size};
+  const std::size_t loc = buffer.size();
+  buffer.resize(loc + sizeof(Header) + size);
+  std::memcpy(&buffer[loc], &header, sizeof(Header));
+  if (size != 0)
+    std::memcpy(&buffer[loc + sizeof(Header)], data, size);
+
+  numBytes += sizeof(Header) + size;
+}
+
+//
+// Returns the bytes of the next record with the tags, which must be of the
+// given kind and size, or a null pointer, leaving the stream where it was.
+//
+const char *
+MemoryChannel::get(int dbTag, int commitTag, int kind, std::size_t size, const char *where)
+{
+  auto found = streams.find(std::make_pair(dbTag, commitTag));
+  if (found == streams.end()
+      || found->second.readLoc + sizeof(Header) > found->second.buffer.size()) {
+    opserr << "MemoryChannel::" << where << " - nothing left to receive\n";
+    return nullptr;
+  }
+
+  Stream &stream = found->second;
+  Header header;
+  std::memcpy(&header, &stream.buffer[stream.readLoc], sizeof(Header));
+
+  if (header.kind != kind || header.size != size) {
+    opserr << "MemoryChannel::" << where
+           << " - the object received does not match the one sent\n";
+    return nullptr;
+  }
+
+  const char *data = &stream.buffer[stream.readLoc + sizeof(Header)];
+  stream.readLoc += sizeof(Header) + size;
+  return data;
+}
+
+int
+MemoryChannel::sendObj(int commitTag, MovableObject &theObject, ChannelAddress *theAddress)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+int
+MemoryChannel::recvObj(int commitTag, MovableObject &theObject,
+                       FEM_ObjectBroker &theBroker, ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+int
+MemoryChannel::sendMsg(int dbTag, int commitTag, const Message &theMessage,
+                       ChannelAddress *theAddress)
+{
+  this->put(dbTag, commitTag, MEMORY_MESSAGE, theMessage.data, theMessage.length);
+  return 0;
+}
+
+int
+MemoryChannel::recvMsg(int dbTag, int commitTag, Message &theMessage,
+                       ChannelAddress *theAddress)
+{
+  const char *data = this->get(dbTag, commitTag, MEMORY_MESSAGE, theMessage.length, "recvMsg()");
+  if (data == nullptr)
+    return -1;
+
+  std::memcpy(theMessage.data, data, theMessage.length);
+  return 0;
+}
+
+int
+MemoryChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix,
+                          ChannelAddress *theAddress)
+{
+  const int numRows = theMatrix.noRows();
+  const int numCols = theMatrix.noCols();
+  std::vector<double> data(numRows*numCols);
+  for (int j = 0; j < numCols; j++)
+    for (int i = 0; i < numRows; i++)
+      data[j*numRows + i] = theMatrix(i, j);
+
+  this->put(dbTag, commitTag, MEMORY_MATRIX, data.data(), data.size()*sizeof(double));
+  return 0;
+}
+
+int
+MemoryChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix,
+                          ChannelAddress *theAddress)
+{
+  const int numRows = theMatrix.noRows();
+  const int numCols = theMatrix.noCols();
+  const char *data = this->get(dbTag, commitTag, MEMORY_MATRIX, std::size_t(numRows)*numCols*sizeof(double),
+                               "recvMatrix()");
+  if (data == nullptr)
+    return -1;
+
+  for (int j = 0; j < numCols; j++)
+    for (int i = 0; i < numRows; i++)
+      std::memcpy(&theMatrix(i, j), data + (j*numRows + i)*sizeof(double), sizeof(double));
+
+  return 0;
+}
+
+int
+MemoryChannel::sendVector(int dbTag, int commitTag, const Vector &theVector,
+                          ChannelAddress *theAddress)
+{
+  const int size = theVector.Size();
+  std::vector<double> data(size);
+  for (int i = 0; i < size; i++)
+    data[i] = theVector(i);
+
+  this->put(dbTag, commitTag, MEMORY_VECTOR, data.data(), data.size()*sizeof(double));
+  return 0;
+}
+
+int
+MemoryChannel::recvVector(int dbTag, int commitTag, Vector &theVector,
+                          ChannelAddress *theAddress)
+{
+  const int size = theVector.Size();
+  const char *data = this->get(dbTag, commitTag, MEMORY_VECTOR, std::size_t(size)*sizeof(double), "recvVector()");
+  if (data == nullptr)
+    return -1;
+
+  if (size != 0)
+    std::memcpy(&theVector(0), data, size*sizeof(double));
+
+  return 0;
+}
+
+int
+MemoryChannel::sendID(int dbTag, int commitTag, const ID &theID,
+                      ChannelAddress *theAddress)
+{
+  const int size = theID.Size();
+  std::vector<int> data(size);
+  for (int i = 0; i < size; i++)
+    data[i] = theID(i);
+
+  this->put(dbTag, commitTag, MEMORY_ID, data.data(), data.size()*sizeof(int));
+  return 0;
+}
+
+int
+MemoryChannel::recvID(int dbTag, int commitTag, ID &theID,
+                      ChannelAddress *theAddress)
+{
+  const int size = theID.Size();
+  const char *data = this->get(dbTag, commitTag, MEMORY_ID, std::size_t(size)*sizeof(int), "recvID()");
+  if (data == nullptr)
+    return -1;
+
+  if (size != 0)
+    std::memcpy(&theID(0), data, size*sizeof(int));
+
+  return 0;
+}
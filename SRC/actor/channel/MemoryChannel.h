@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: MemoryChannel is a Channel that keeps what is sent to it in
+// buffers in memory, so that it can be received again within the process.
+// It is used to copy a Domain, or any other MovableObject:
+//
+//     MemoryChannel theChannel;
+//     theDomain.sendSelf(0, theChannel);
+//     theCopy.recvSelf(0, theChannel, theBroker);
+//
+// What is sent with each pair of database and commit tags is received in
+// the order it was sent, as from the other end of a TCP_Socket, but
+// independently of what is sent with other tags, as from a database; a
+// Domain sends the IDs that describe its components, under its geometry
+// tag, before the components, but receives each of them just before the
+// components it describes.
+//
+// rewind() starts the reading over, so that the same buffers can be
+// received into any number of copies. The channel gives out no database
+// tags, so the objects sent through it are left as they were.
+//
+#ifndef MemoryChannel_h
+#define MemoryChannel_h
+
+#include <Channel.h>
+#include <map>
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+class MemoryChannel : public Channel
+{
+  public:
+    MemoryChannel();
+    ~MemoryChannel();
+
+    // start receiving from the first object sent, or discard all sent
+    void rewind(void);
+    void clear(void);
+    std::size_t getSize(void) const;
+
+    char *addToProgram(void);
+    int setUpConnection(void);
+    int setNextAddress(const ChannelAddress &theAddress);
+    ChannelAddress *getLastSendersAddress(void);
+
+    int sendObj(int commitTag,
+                MovableObject &theObject,
+                ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+                MovableObject &theObject,
+                FEM_ObjectBroker &theBroker,
+                ChannelAddress *theAddress =0);
+
+    int sendMsg(int dbTag, int commitTag,
+                const Message &theMessage,
+                ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+                Message &theMessage,
+                ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+                   const Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+                   Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+                   const Vector &theVector,
+                   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+                   Vector &theVector,
+                   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+               const ID &theID,
+               ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+               ID &theID,
+               ChannelAddress *theAddress =0);
+
+  private:
+    // each send is a record of its kind, its number of bytes and then
+    // the bytes themselves, added to the stream of its tags
+    struct Stream {
+      std::vector<char> buffer;
+      std::size_t       readLoc = 0;
+    };
+
+    void  put(int dbTag, int commitTag, int kind, const void *data, std::size_t size);
+    const char *get(int dbTag, int commitTag, int kind, std::size_t size, const char *where);
+
+    std::map<std::pair<int,int>, Stream> streams;
+    std::size_t numBytes;
+};
+
+#endif
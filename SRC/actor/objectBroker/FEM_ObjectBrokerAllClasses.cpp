@@ -644,6 +644,7 @@
 #include "TrapezoidalTimeSeriesIntegrator.h"
 
 #include "eigenSOE/ArpackSOE.h"
+#include "eigenSOE/LanczosSOE.h"
 
 #ifdef _PETSC
 #include "PetscSOE.h"
@@ -2955,6 +2956,10 @@ FEM_ObjectBrokerAllClasses::getNewEigenSOE(int classTagSOE)
 	  theSOE = new ArpackSOE();
 	  return theSOE;
 
+	case EigenSOE_TAGS_LanczosSOE:  
+	  theSOE = new LanczosSOE();
+	  return theSOE;
+
 	default:
 	  opserr << "FEM_ObjectBrokerAllClasses::getNewEigenSOE - ";
 	  opserr << " - no EigenSOE type exists for class tag ";
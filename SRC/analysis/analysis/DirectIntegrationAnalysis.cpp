@@ -203,13 +203,15 @@ DirectIntegrationAnalysis::analyzeStep(double dT)
     return -2;
   }
   
-  result = theAlgorithm->solveCurrentStep();
-  if (result < 0) {
-    opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
-    opserr << " at time " << theDomain->getCurrentTime() << endln;
-    theDomain->revertToLastCommit();	    
-    theIntegrator->revertToLastStep();
-    return -3;
+  if (!theIntegrator->isMatrixFree()) {
+    result = theAlgorithm->solveCurrentStep();
+    if (result < 0) {
+      opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
+      opserr << " at time " << theDomain->getCurrentTime() << endln;
+      theDomain->revertToLastCommit();
+      theIntegrator->revertToLastStep();
+      return -3;
+    }
   }
   
   // AddingSensitivity:BEGIN ////////////////////////////////////
@@ -392,17 +394,18 @@ DirectIntegrationAnalysis::domainChanged(void)
 
     // we invoke setGraph() on the LinearSOE which
     // causes that object to determine its size
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
-
-    int result = theSOE->setSize(theGraph);
-    if (result < 0) {
+    int result = 0;
+    if (!theIntegrator->isMatrixFree()) {
+      result = theSOE->setSize(theAnalysisModel->getDOFCSRGraph());
+      if (result < 0) {
 	opserr << "DirectIntegrationAnalysis::handle() - ";
 	opserr << "LinearSOE::setSize() failed";
 	return -3;
-    }	    
+      }
+    }
 
     if (theEigenSOE != 0) {
-      result = theEigenSOE->setSize(theGraph);
+      result = theEigenSOE->setSize(theAnalysisModel->getDOFGraph());
       if (result < 0) {
 	opserr << "DirectIntegrationAnalysis::handle() - ";
 	opserr << "EigenSOE::setSize() failed";
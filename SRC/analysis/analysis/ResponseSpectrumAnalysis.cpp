@@ -38,6 +38,8 @@
 #include <elementAPI.h>
 #include <Node.h>
 #include <NodeIter.h>
+#include <ResponseHandle.h>
+#include <threads/thread_pool.hpp>
 #include <vector>
 #include <algorithm>
 #include <cmath>
@@ -51,10 +53,56 @@
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
+extern "C" void DSYMM(char* side, char* uplo, int* m, int* n, double* alpha,
+	double* A, int* lda, double* B, int* ldb, double* beta, double* C, int* ldc);
+#define dsymm_ DSYMM
+#else
+extern "C" void dsymm_(char* side, char* uplo, int* m, int* n, double* alpha,
+	double* A, int* lda, double* B, int* ldb, double* beta, double* C, int* ldc);
 #endif
 
 namespace {
 
+	// whether dof i of a node with node_ndf dofs takes part in the modal
+	// response of a model with ndf dofs per node (U and R)
+	inline bool is_modal_dof(int ndf, int node_ndf, int i) {
+		// exclude any dof >= node_ndf (if ndf > node_ndf... in case node is U-only)
+		// exclude any dof >= ndf (if node_ndf > ndf... in case the node has more DOFs than U and R)
+		if (i >= std::min(node_ndf, ndf))
+			return false;
+		// we also need to exclude pressure dofs... easy in 3D because node_ndf is 4,
+		// but in 2D it is 3, as in U-R...
+		if (ndf == 6 && node_ndf == 4 && i == 3)
+			return false;
+		return true;
+	}
+
+	// call f(i) for i in [0, n), on the threads of the pool if there is one
+	template <typename F>
+	void for_each_index(OpenSees::thread_pool* pool, int n, F&& f) {
+		if (pool != nullptr && n > 1)
+			pool->submit_loop<int>(0, n, f).wait();
+		else
+			for (int i = 0; i < n; ++i)
+				f(i);
+	}
+
+	// the CQC correlation coefficient of two modes with the same damping
+	// ratio (Der Kiureghian, 1981). Equal frequencies are fully correlated,
+	// which is also the limit of the formula; a mode of zero frequency (a
+	// rigid body mode) is correlated with none other.
+	inline double cqc_rho(double wi, double wj, double zeta) {
+		if (wi == wj)
+			return 1.0;
+		if (wi <= 0.0 || wj <= 0.0)
+			return 0.0;
+		double r = wj / wi;
+		double z2 = zeta * zeta;
+		double num = 8.0 * z2 * (1.0 + r) * r * std::sqrt(r);
+		double den = (1.0 - r * r) * (1.0 - r * r) + 4.0 * z2 * r * (1.0 + r) * (1.0 + r);
+		return num / den;
+	}
+
 	bool string_to_list_of_doubles(const std::string& text, char sep, std::vector<double>& out) {
 		auto to_double = [](const std::string& text, double& num) -> bool {
 			num = 0.0;
@@ -123,6 +171,12 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 	std::vector<double> Sa;
 	int mode_id = 0;
 	bool single_mode = false;
+	bool combine = false;
+	ResponseSpectrumAnalysis::CombinationRule rule = ResponseSpectrumAnalysis::SRSS;
+	double damping = 0.05;
+	std::vector<int> node_tags;
+	std::vector<int> ele_tags;
+	std::vector<const char*> ele_args;
 
 	// make sure eigenvalue and modal properties have been called before
 	DomainModalProperties modal_props;
@@ -135,9 +189,11 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 	// parse
 	int nargs = OPS_GetNumRemainingInputArgs();
 	if (nargs < 2) {
-		opserr << "ResponseSpectrumAnalysis $tsTag $dir <-scale $scale> <-damp $damp>\n"
+		opserr << "ResponseSpectrumAnalysis $tsTag $dir <-scale $scale> <-mode $mode>\n"
 			<< "or\n"
-			<< "ResponseSpectrumAnalysis $dir -Tn $TnValues -fn $fnValues -Sa $SaValues <-scale $scale> <-damp $damp>\n"
+			<< "ResponseSpectrumAnalysis $dir -Tn $TnValues -fn $fnValues -Sa $SaValues <-scale $scale> <-mode $mode>\n"
+			<< "with the combination options\n"
+			<< "<-combine SRSS|CQC|ABS> <-damp $damp> <-node $nodeTags> <-ele $eleTags $responseArgs...>\n"
 			"Error: at least 2 arguments should be provided.\n";
 		return -1;
 	}
@@ -247,6 +303,70 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 				}
 			}
 		}
+		else if (strcmp(value, "-combine") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1) {
+				opserr << "ResponseSpectrumAnalysis Error: combination rule requested but not provided.\n";
+				return -1;
+			}
+			const char* name = OPS_GetString();
+			if (strcmp(name, "SRSS") == 0 || strcmp(name, "srss") == 0)
+				rule = ResponseSpectrumAnalysis::SRSS;
+			else if (strcmp(name, "CQC") == 0 || strcmp(name, "cqc") == 0)
+				rule = ResponseSpectrumAnalysis::CQC;
+			else if (strcmp(name, "ABS") == 0 || strcmp(name, "abs") == 0)
+				rule = ResponseSpectrumAnalysis::ABS;
+			else {
+				opserr << "ResponseSpectrumAnalysis Error: unknown combination rule " << name << " (SRSS, CQC or ABS).\n";
+				return -1;
+			}
+			combine = true;
+		}
+		else if (strcmp(value, "-damp") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDouble(&numData, &damping) < 0) {
+				opserr << "ResponseSpectrumAnalysis Error: Failed to get the damping ratio.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-node") == 0 || strcmp(value, "-ele") == 0 || strcmp(value, "-element") == 0) {
+			// tags as an expanded list, or as a Tcl list
+			bool is_node = strcmp(value, "-node") == 0;
+			std::vector<int>& tags = is_node ? node_tags : ele_tags;
+			std::size_t num_tags = tags.size();
+			while (OPS_GetNumRemainingInputArgs() > 0) {
+				int item;
+				auto old_num_rem = OPS_GetNumRemainingInputArgs();
+				if (OPS_GetIntInput(&numData, &item) < 0) {
+					auto new_num_rem = OPS_GetNumRemainingInputArgs();
+					if (new_num_rem < old_num_rem)
+						OPS_ResetCurrentInputArg(-1);
+					break;
+				}
+				tags.push_back(item);
+			}
+			if (tags.size() == num_tags && OPS_GetNumRemainingInputArgs() > 0) {
+				std::vector<double> list;
+				if (!string_to_list_of_doubles(OPS_GetString(), ' ', list)) {
+					opserr << "ResponseSpectrumAnalysis Error: cannot parse the " << value << " tags.\n";
+					return -1;
+				}
+				for (double item : list)
+					tags.push_back(static_cast<int>(item));
+			}
+			if (tags.size() == num_tags) {
+				opserr << "ResponseSpectrumAnalysis Error: " << value << " requested but no tags provided.\n";
+				return -1;
+			}
+			// the element response takes the remaining arguments
+			if (!is_node) {
+				while (OPS_GetNumRemainingInputArgs() > 0)
+					ele_args.push_back(OPS_GetString());
+				if (ele_args.empty()) {
+					opserr << "ResponseSpectrumAnalysis Error: " << value << " requested but no response provided.\n";
+					return -1;
+				}
+			}
+			combine = true;
+		}
 		else if (strcmp(value, "-Sa") == 0) {
 			// first try expanded list like {*}$the_list,
 			// also used in python like *the_list
@@ -302,11 +422,31 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 		}
 	}
 
+	if (combine && single_mode) {
+		opserr << "ResponseSpectrumAnalysis Error: -mode cannot be used with a modal combination.\n";
+		return -1;
+	}
+
 	// ok, create the response spectrum analysis and run it here... 
 	// no need to store it
 	ResponseSpectrumAnalysis rsa(theAnalysisModel, ts, Tn, Sa, dir, scale);
 	int result;
-	if (single_mode)
+	if (combine) {
+		if (node_tags.size() > 0 && rsa.addNodes(node_tags) < 0)
+			return -1;
+		if (ele_tags.size() > 0 && rsa.addElementResponse(ele_tags, ele_args.data(), (int)ele_args.size()) < 0)
+			return -1;
+		std::vector<std::vector<double>> values;
+		result = rsa.analyze(rule, damping, values);
+		// return the combined values of the requested quantities
+		if (result == 0 && (node_tags.size() > 0 || ele_tags.size() > 0)) {
+			if (OPS_SetDoubleListsOutput(values) < 0) {
+				opserr << "ResponseSpectrumAnalysis Error: failed to set the combined values.\n";
+				return -1;
+			}
+		}
+	}
+	else if (single_mode)
 		result = rsa.analyze(mode_id);
 	else
 		result = rsa.analyze();
@@ -429,6 +569,241 @@ int ResponseSpectrumAnalysis::analyze(int mode_id)
 	return 0;
 }
 
+int ResponseSpectrumAnalysis::addNodes(const std::vector<int>& tags)
+{
+	Domain* domain = m_model->getDomainPtr();
+	for (int tag : tags) {
+		if (domain->getNode(tag) == nullptr) {
+			opserr << "ResponseSpectrumAnalysis::addNodes() - no node with tag " << tag << "\n";
+			return -1;
+		}
+		m_nodes.push_back(tag);
+	}
+	return 0;
+}
+
+int ResponseSpectrumAnalysis::addElementResponse(const std::vector<int>& tags, const char** argv, int argc)
+{
+	if (m_element_responses == nullptr)
+		m_element_responses.reset(new ResponseHandle(*m_model->getDomainPtr()));
+	for (int tag : tags) {
+		if (m_element_responses->addElementResponse(tag, argv, argc) < 0) {
+			opserr << "ResponseSpectrumAnalysis::addElementResponse() - no such response for element " << tag << "\n";
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int ResponseSpectrumAnalysis::analyze(CombinationRule rule, double damping, std::vector<std::vector<double>>& result)
+{
+	// get the domain
+	Domain* domain = m_model->getDomainPtr();
+	OpenSees::thread_pool* pool = domain->getThreadPool();
+
+	// get the modal properties
+	DomainModalProperties mp;
+	if (domain->getModalProperties(mp) < 0) {
+		opserr << "ResponseSpectrumAnalysis::analyze(rule) - failed to get modal properties" << endln;
+		return -1;
+	}
+
+	// check consistency
+	int error_code;
+	error_code = check();
+	if (error_code < 0) return error_code;
+	if (rule == CQC && damping <= 0.0) {
+		opserr << "ResponseSpectrumAnalysis::analyze(rule) - CQC requires a positive damping ratio\n";
+		return -1;
+	}
+
+	// size info
+	int num_eigen = domain->getEigenvalues().Size();
+	int ndf = mp.totalMass().Size();
+
+	// the circular frequency and the modal displacement per unit eigenvector
+	// component of each mode
+	std::vector<double> omega(num_eigen);
+	std::vector<double> amplitude(num_eigen);
+	for (int i = 0; i < num_eigen; ++i) {
+		omega[i] = std::sqrt(std::max(mp.eigenvalues()(i), 0.0));
+		amplitude[i] = getModalAmplitude(mp, i);
+	}
+
+	// the node dofs to combine: those of the requested nodes or, if no
+	// quantity was requested, of all nodes
+	bool record = m_nodes.empty() && m_element_responses == nullptr;
+	std::vector<Node*> nodes;
+	if (record) {
+		Node* node;
+		NodeIter& theNodes = domain->getNodes();
+		while ((node = theNodes()) != 0)
+			nodes.push_back(node);
+	}
+	else {
+		for (int tag : m_nodes) {
+			Node* node = domain->getNode(tag);
+			if (node == nullptr) {
+				opserr << "ResponseSpectrumAnalysis::analyze(rule) - no node with tag " << tag << "\n";
+				return -1;
+			}
+			nodes.push_back(node);
+		}
+	}
+	std::vector<std::pair<Node*, int>> dofs;
+	std::vector<int> sizes;
+	for (Node* node : nodes) {
+		int node_ndf = node->getEigenvectors().noRows();
+		std::size_t num_dofs = dofs.size();
+		for (int i = 0; i < node_ndf; ++i)
+			if (is_modal_dof(ndf, node_ndf, i))
+				dofs.emplace_back(node, i);
+		sizes.push_back((int)(dofs.size() - num_dofs));
+	}
+	int num_dofs = (int)dofs.size();
+
+	// the element responses of each mode. each needs the domain to be
+	// updated with the modal displacements, so that the modes are done one
+	// after the other (the elements of each are updated on the threads of
+	// the domain). the domain is then reverted to the last committed state.
+	std::vector<double> element_values;
+	int num_element_values = 0;
+	if (m_element_responses != nullptr) {
+		std::vector<Node*> all_nodes;
+		Node* node;
+		NodeIter& theNodes = domain->getNodes();
+		while ((node = theNodes()) != 0)
+			all_nodes.push_back(node);
+
+		for (int mode = 0; mode < num_eigen; ++mode) {
+			for_each_index(pool, (int)all_nodes.size(), [&](int k) {
+				Node* node = all_nodes[k];
+				const Matrix& node_evec = node->getEigenvectors();
+				int node_ndf = node_evec.noRows();
+				for (int i = 0; i < node_ndf; ++i)
+					if (is_modal_dof(ndf, node_ndf, i))
+						node->setTrialDisp(node_evec(i, mode) * amplitude[mode], i);
+			});
+			if (m_model->updateDomain() < 0) {
+				opserr << "ResponseSpectrumAnalysis::analyze(rule) - the AnalysisModel failed in updateDomain"
+					" at mode " << mode << "\n";
+				m_model->revertDomainToLastCommit();
+				return -1;
+			}
+			if (m_element_responses->fetch() < 0) {
+				opserr << "ResponseSpectrumAnalysis::analyze(rule) - failed to get the element responses"
+					" at mode " << mode << "\n";
+				m_model->revertDomainToLastCommit();
+				return -1;
+			}
+			if (mode == 0) {
+				num_element_values = m_element_responses->getNumValues();
+				element_values.resize((std::size_t)num_element_values * num_eigen);
+				const std::vector<int>& offsets = m_element_responses->getOffsets();
+				for (std::size_t k = 1; k < offsets.size(); ++k)
+					sizes.push_back(offsets[k] - offsets[k - 1]);
+			}
+			else if (m_element_responses->getNumValues() != num_element_values) {
+				opserr << "ResponseSpectrumAnalysis::analyze(rule) - the size of the element responses changed"
+					" at mode " << mode << "\n";
+				m_model->revertDomainToLastCommit();
+				return -1;
+			}
+			const double* values = m_element_responses->getValues();
+			for (int j = 0; j < num_element_values; ++j)
+				element_values[(std::size_t)j * num_eigen + mode] = values[j];
+		}
+		m_model->revertDomainToLastCommit();
+	}
+
+	// the modal values of all quantities, those of quantity j in column j:
+	// first the node dofs, computed directly from the eigenvectors, then the
+	// element responses
+	int num_values = num_dofs + num_element_values;
+	std::vector<double> R((std::size_t)num_values * num_eigen);
+	for_each_index(pool, num_dofs, [&](int j) {
+		const Matrix& node_evec = dofs[j].first->getEigenvectors();
+		int i = dofs[j].second;
+		double* column = &R[(std::size_t)j * num_eigen];
+		for (int mode = 0; mode < num_eigen; ++mode)
+			column[mode] = node_evec(i, mode) * amplitude[mode];
+	});
+	std::copy(element_values.begin(), element_values.end(), R.begin() + (std::size_t)num_dofs * num_eigen);
+
+	// combine the modal values of each quantity
+	std::vector<double> combined(num_values, 0.0);
+	switch (rule) {
+	case SRSS:
+		for_each_index(pool, num_values, [&](int j) {
+			const double* column = &R[(std::size_t)j * num_eigen];
+			double sum = 0.0;
+			for (int mode = 0; mode < num_eigen; ++mode)
+				sum += column[mode] * column[mode];
+			combined[j] = std::sqrt(sum);
+		});
+		break;
+	case ABS:
+		for_each_index(pool, num_values, [&](int j) {
+			const double* column = &R[(std::size_t)j * num_eigen];
+			double sum = 0.0;
+			for (int mode = 0; mode < num_eigen; ++mode)
+				sum += std::abs(column[mode]);
+			combined[j] = sum;
+		});
+		break;
+	case CQC: {
+		// the correlation matrix of the modes, rho, and then for each
+		// quantity r^T rho r, with rho applied to a block of columns at a time
+		std::vector<double> rho((std::size_t)num_eigen * num_eigen);
+		for (int i = 0; i < num_eigen; ++i)
+			for (int k = 0; k < num_eigen; ++k)
+				rho[(std::size_t)k * num_eigen + i] = cqc_rho(omega[i], omega[k], damping);
+		std::vector<double> Y(R.size());
+		const int block_size = 64;
+		int num_blocks = (num_values + block_size - 1) / block_size;
+		for_each_index(pool, num_blocks, [&](int b) {
+			int start = b * block_size;
+			int m = num_eigen;
+			int n = std::min(block_size, num_values - start);
+			char side = 'L', uplo = 'L';
+			double one = 1.0, zero = 0.0;
+			double* Rb = &R[(std::size_t)start * num_eigen];
+			double* Yb = &Y[(std::size_t)start * num_eigen];
+			dsymm_(&side, &uplo, &m, &n, &one, rho.data(), &m, Rb, &m, &zero, Yb, &m);
+			for (int j = 0; j < n; ++j) {
+				double sum = 0.0;
+				for (int mode = 0; mode < num_eigen; ++mode)
+					sum += Rb[(std::size_t)j * num_eigen + mode] * Yb[(std::size_t)j * num_eigen + mode];
+				combined[start + j] = std::sqrt(std::max(sum, 0.0));
+			}
+		});
+		break;
+	}
+	}
+
+	// one list of combined values for each node and element
+	result.clear();
+	std::size_t start = 0;
+	for (int size : sizes) {
+		result.emplace_back(combined.begin() + start, combined.begin() + start + size);
+		start += size;
+	}
+
+	// without requested quantities, the combined displacements of all nodes
+	// are recorded as a single step
+	if (record) {
+		m_current_mode = num_eigen - 1;
+		error_code = beginMode();
+		if (error_code < 0) return error_code;
+		for (int j = 0; j < num_dofs; ++j)
+			dofs[j].first->setTrialDisp(combined[j], dofs[j].second);
+		error_code = endMode();
+		if (error_code < 0) return error_code;
+	}
+
+	return 0;
+}
+
 int ResponseSpectrumAnalysis::check()
 {
 	// get the domain
@@ -520,21 +895,9 @@ int ResponseSpectrumAnalysis::solveMode()
 	// size info
 	int ndf = mp.totalMass().Size();
 
-	// excited DOF.
-	// Note: now we assume that a RS acts along one of the global directions, so we need
-	// to consider only the associated column of the modal participation factors.
-	// in future versions we can implement a general direction vector.
-	int exdof = m_direction - 1; // make it 0-based
-
-	// compute modal acceleration for this mode using the 
-	// provided response spectrum function (time series)
-	double lambda = mp.eigenvalues()(m_current_mode);
-	double omega = std::sqrt(lambda);
-	double freq = omega / 2.0 / M_PI;
-	double period = 1.0 / freq;
-	double mga = getSa(period);
-	double Vscale = mp.eigenVectorScaleFactors()(m_current_mode);
-	double MPF = mp.modalParticipationFactors()(m_current_mode, exdof);
+	// compute the modal displacement per unit eigenvector component for
+	// this mode using the provided response spectrum function (time series)
+	double amplitude = getModalAmplitude(mp, m_current_mode);
 
 	// loop over all nodes and compute the modal displacements
 	Node* node;
@@ -542,25 +905,16 @@ int ResponseSpectrumAnalysis::solveMode()
 	while ((node = theNodes()) != 0) {
 
 		// get the nodal eigenvector, according to the ndf of modal properties
-		// and its scaling
 		const Matrix& node_evec = node->getEigenvectors();
 		int node_ndf = node_evec.noRows();
 
 		// for each DOF...
-		for (int i = 0; i < std::min(node_ndf, ndf); ++i) {
-			// exclude any dof >= node_ndf (if ndf > node_ndf... in case node is U-only)
-			// exclude any dof >= ndf (if node_ndf > ndf... in case the node has more DOFs than U and R)
-
-			// we also need to exclude pressure dofs... easy in 3D because node_ndf is 4,
-			// but in 2D it is 3, as in U-R...
-			if (ndf == 6 && node_ndf == 4 && i == 3)
+		for (int i = 0; i < node_ndf; ++i) {
+			if (!is_modal_dof(ndf, node_ndf, i))
 				continue;
 
-			// eigenvector
-			double V = node_evec(i, m_current_mode) * Vscale;
-
 			// compute modal displacements for the i-th DOF
-			double u_modal = V * MPF * mga / lambda;
+			double u_modal = node_evec(i, m_current_mode) * amplitude;
 
 			// save this displacement at the i-th dof as new trial displacement
 			node->setTrialDisp(u_modal, i);
@@ -571,6 +925,27 @@ int ResponseSpectrumAnalysis::solveMode()
 	return 0;
 }
 
+double ResponseSpectrumAnalysis::getModalAmplitude(const DomainModalProperties& mp, int mode) const
+{
+	// excited DOF.
+	// Note: now we assume that a RS acts along one of the global directions, so we need
+	// to consider only the associated column of the modal participation factors.
+	// in future versions we can implement a general direction vector.
+	int exdof = m_direction - 1; // make it 0-based
+
+	// the spectral displacement of the mode, times its participation factor
+	// and the scaling of its eigenvector
+	double lambda = mp.eigenvalues()(mode);
+	double omega = std::sqrt(lambda);
+	double freq = omega / 2.0 / M_PI;
+	double period = 1.0 / freq;
+	double mga = getSa(period) * m_scale;
+	double Vscale = mp.eigenVectorScaleFactors()(mode);
+	double MPF = mp.modalParticipationFactors()(mode, exdof);
+
+	return Vscale * MPF * mga / lambda;
+}
+
 double ResponseSpectrumAnalysis::getSa(double T) const
 {
 	// use the time series if provided
@@ -34,8 +34,11 @@
 #define ResponseSpectrumAnalysis_h
 
 #include <vector>
+#include <memory>
 class AnalysisModel;
 class TimeSeries;
+class DomainModalProperties;
+class ResponseHandle;
 
 class ResponseSpectrumAnalysis
 {
@@ -50,16 +53,38 @@ public:
 	);
 	~ResponseSpectrumAnalysis();
 
+public:
+	// modal combination rules of the combined analysis
+	enum CombinationRule {
+		SRSS,
+		CQC,
+		ABS
+	};
+
 public:
 	int analyze();
 	int analyze(int mode_id);
 
+	// quantities combined by analyze(rule, damping, result): the
+	// displacements of the given nodes, followed by the given response of
+	// the given elements, each in the order they are added
+	int addNodes(const std::vector<int>& tags);
+	int addElementResponse(const std::vector<int>& tags, const char** argv, int argc);
+
+	// compute the response of all modes to the requested quantities and
+	// combine them with the given rule (damping is the ratio used by CQC);
+	// result has the combined values of each node and element. if no
+	// quantity was requested, the displacements of all nodes are combined
+	// and recorded as a single analysis step.
+	int analyze(CombinationRule rule, double damping, std::vector<std::vector<double>>& result);
+
 private:
 	int check();
 	int beginMode();
 	int endMode();
 	int solveMode();
 	double getSa(double T) const;
+	double getModalAmplitude(const DomainModalProperties& mp, int mode) const;
 
 private:
 	// the model
@@ -74,6 +99,9 @@ private:
 	double m_scale;
 	// current mode
 	int m_current_mode;
+	// nodes and element responses of the combined analysis
+	std::vector<int> m_nodes;
+	std::unique_ptr<ResponseHandle> m_element_responses;
 };
 
 #endif
@@ -354,9 +354,7 @@ StaticAnalysis::domainChanged(void)
 
     // we invoke setSize() on the LinearSOE which
     // causes that object to determine its size
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
-
-    result = theSOE->setSize(theGraph);
+    result = theSOE->setSize(theAnalysisModel->getDOFCSRGraph());
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "LinearSOE::setSize() failed";
@@ -364,7 +362,7 @@ StaticAnalysis::domainChanged(void)
     }	    
 
     if (theEigenSOE != nullptr) {
-      result = theEigenSOE->setSize(theGraph);
+      result = theEigenSOE->setSize(theAnalysisModel->getDOFGraph());
       if (result < 0) {
 	opserr << "StaticAnalysis::domainChanged() - ";
 	opserr << "EigenSOE::setSize() failed";
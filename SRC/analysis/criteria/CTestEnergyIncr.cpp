@@ -31,6 +31,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 
@@ -84,6 +85,8 @@ int CTestEnergyIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestEnergyIncr::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0) {
@@ -100,7 +103,7 @@ int CTestEnergyIncr::test(void)
     // determine the energy & save value in norms vector
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();
-    double product = x ^ b;
+    double product = theSOE->getProductXB();
     if (product < 0.0)
         product *= -0.5;
     else
@@ -121,8 +124,8 @@ int CTestEnergyIncr::test(void)
                << "Iter: "          << pad(currentIter)
                << ", EnergyIncr: "  << pad(product)
                << LOG_CONTINUE
-               << "Norm deltaX: "   << pad(x.pNorm(nType))
-               << ", Norm deltaR: " << pad(b.pNorm(nType))
+               << "Norm deltaX: "   << pad(theSOE->getNormX(nType))
+               << ", Norm deltaR: " << pad(theSOE->getNormB(nType))
                << LOG_CONTINUE
                << "deltaX: " << x
                << "\tdeltaR: " << b;
@@ -157,8 +160,8 @@ int CTestEnergyIncr::test(void)
                  << "failed to converge but goin on -"
                  << ", EnergyIncr: "  << pad(product)
                  << endln
-                 << ", Norm deltaX: " << pad(x.pNorm(nType))
-                 << ", Norm deltaR: " << pad(b.pNorm(nType))
+                 << ", Norm deltaX: " << pad(theSOE->getNormX(nType))
+                 << ", Norm deltaR: " << pad(theSOE->getNormB(nType))
                  << endln;
         }
         return currentIter;
@@ -173,8 +176,8 @@ int CTestEnergyIncr::test(void)
                    << "Iter: "      << pad(currentIter)
                    << ", EnergyIncr: "   << pad(product)
                    // << LOG_CONTINUE
-                   << ", Norm deltaX: "  << pad(x.pNorm(nType))
-                   << ", Norm deltaR: "  << pad(b.pNorm(nType))
+                   << ", Norm deltaX: "  << pad(theSOE->getNormX(nType))
+                   << ", Norm deltaR: "  << pad(theSOE->getNormB(nType))
                    << endln;
         }
         currentIter++;
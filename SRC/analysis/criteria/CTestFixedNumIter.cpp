@@ -29,6 +29,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 
@@ -77,6 +78,8 @@ int CTestFixedNumIter::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestFixedNumIter::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0)  {
@@ -94,7 +97,7 @@ int CTestFixedNumIter::test(void)
     // determine the energy & save value in norms vector
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();
-    double product = x ^ b;
+    double product = theSOE->getProductXB();
     if (product < 0.0)
         product *= -0.5;
     else
@@ -107,13 +110,13 @@ int CTestFixedNumIter::test(void)
     if (printFlag & ConvergenceTest::PrintTest)  {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", EnergyIncr: " << product;
-        opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+        opserr << " (Norm deltaX: " << theSOE->getNormX(nType) << ", Norm deltaR: " << theSOE->getNormB(nType) << ")\n";
     }
 
     if (printFlag & ConvergenceTest::PrintTest02)  {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", EnergyIncr: " << product;
-        opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+        opserr << " (Norm deltaX: " << theSOE->getNormX(nType) << ", Norm deltaR: " << theSOE->getNormB(nType) << ")\n";
         opserr << "\tdeltaX: " << x << "\tdeltaR: " << b;
     }
 
@@ -129,7 +132,7 @@ int CTestFixedNumIter::test(void)
         if (printFlag & ConvergenceTest::PrintSuccess)  {
             opserr << LOG_SUCCESS << "Iter: " << pad(currentIter);
             opserr << " last EnergyIncr: " << product;
-            opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+            opserr << " (Norm deltaX: " << theSOE->getNormX(nType) << ", Norm deltaR: " << theSOE->getNormB(nType) << ")\n";
         }
 
         // return the number of times test has been called
@@ -24,6 +24,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 CTestNormDispIncr::CTestNormDispIncr()
@@ -77,6 +78,8 @@ int CTestNormDispIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestNormDispIncr::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0) {
@@ -93,7 +96,7 @@ int CTestNormDispIncr::test(void)
 
     // get the X vector & determine it's norm & save the value in norms vector
     const Vector &x = theSOE->getX();
-    double norm = x.pNorm(nType);
+    double norm = theSOE->getNormX(nType);
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -102,7 +105,7 @@ int CTestNormDispIncr::test(void)
         opserr << LOG_ITERATE 
                << "Iter: "           << pad(currentIter)
                << ", Norm: "         << pad(norm) 
-               << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: "  << pad(theSOE->getNormB(nType))
                << endln;
     }
     else if (printFlag & ConvergenceTest::PrintTest02) {
@@ -111,7 +114,7 @@ int CTestNormDispIncr::test(void)
                << ", Norm: "         << pad(norm) 
                << endln;
         opserr << "\tNorm deltaX: "  << pad(norm) 
-               << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: "  << pad(theSOE->getNormB(nType))
                << endln
                << "\tdeltaX: "       << x
                << "\tdeltaR: "       << theSOE->getB();
@@ -132,7 +135,7 @@ int CTestNormDispIncr::test(void)
             opserr << LOG_SUCCESS 
                    << "Iter: "          << pad(currentIter)
                    << ", Norm: "        << pad(norm)
-                   << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+                   << ", Norm deltaR: " << pad(theSOE->getNormB(nType))
                    << endln;
         }
 
@@ -145,7 +148,7 @@ int CTestNormDispIncr::test(void)
         if (printFlag & ConvergenceTest::PrintFailure) {
             opserr << LOG_FAILURE
                    << ", Norm: " << pad(norm)  // << " (max: " << tol;
-                   << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+                   << ", Norm deltaR: " << pad(theSOE->getNormB(nType))
                    << LOG_CONTINUE
                    << "failed to converge but going on - "
                    << endln;
@@ -161,7 +164,7 @@ int CTestNormDispIncr::test(void)
                  // << LOG_CONTINUE
                  << "Iter: "             << pad(currentIter)
                  << ", Norm: "           << pad(norm)
-                 << ", Norm deltaR: "    << pad(theSOE->getB().pNorm(nType))
+                 << ", Norm deltaR: "    << pad(theSOE->getNormB(nType))
                  << endln;
         }
         currentIter++;
@@ -24,6 +24,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 #include <iostream>
 #include <fstream>
@@ -80,6 +81,8 @@ int CTestNormUnbalance::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestNormUnbalance::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == nullptr) {
@@ -96,7 +99,7 @@ int CTestNormUnbalance::test(void)
 
     // get the B vector & determine it's norm & save the value in norms vector
     const Vector &x = theSOE->getB();
-    double norm = x.pNorm(nType);
+    double norm = theSOE->getNormB(nType);
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -110,12 +113,12 @@ int CTestNormUnbalance::test(void)
     if (printFlag & ConvergenceTest::PrintTest) {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", Norm: " << pad(norm) << " (max: " << tol;
-        opserr << ", Norm deltaX: " << theSOE->getX().pNorm(nType) << ")\n";
+        opserr << ", Norm deltaX: " << theSOE->getNormX(nType) << ")\n";
     }
     if (printFlag & ConvergenceTest::PrintTest02) {
         opserr << LOG_ITERATE << "Iter: " << pad(currentIter);
         opserr << ", Norm: " << pad(norm) << " (max: " << tol << ")\n";
-        opserr << "\tNorm deltaX: " << theSOE->getX().pNorm(nType) << ", Norm deltaR: " << pad(norm) << "\n";
+        opserr << "\tNorm deltaX: " << theSOE->getNormX(nType) << ", Norm deltaR: " << pad(norm) << "\n";
         opserr << "\tdeltaX: " << theSOE->getX() << "\tdeltaR: " << x;
     }
 
@@ -155,7 +158,7 @@ int CTestNormUnbalance::test(void)
         if (printFlag & ConvergenceTest::PrintSuccess || printFlag == 7) {
             opserr << LOG_SUCCESS << "Iter: " << pad(currentIter);
             opserr << ", Norm: " << pad(norm) << " (max: " << tol;
-            opserr << ", Norm deltaX: " << theSOE->getX().pNorm(nType) << ")\n";
+            opserr << ", Norm deltaX: " << theSOE->getNormX(nType) << ")\n";
         }
 
         // return the number of times test has been called
@@ -168,7 +171,7 @@ int CTestNormUnbalance::test(void)
             opserr << LOG_FAILURE
                    //<< "criteria CTestNormUnbalance but going on -";
                    << ", Norm: " << pad(norm) 
-                   << ", Norm deltaX: " << pad(theSOE->getX().pNorm(nType))
+                   << ", Norm deltaX: " << pad(theSOE->getNormX(nType))
                    << "\n";
         }
         return currentIter;
@@ -182,7 +185,7 @@ int CTestNormUnbalance::test(void)
                    // << LOG_CONTINUE
                    << "Iter: "           << pad(currentIter)
                    << ", Norm: "         << pad(norm)
-                   << ", Norm deltaX: "  << pad(theSOE->getX().pNorm(nType)) 
+                   << ", Norm deltaX: "  << pad(theSOE->getNormX(nType)) 
                    << "\n";
         }
         currentIter++;  // we increment in case analysis does not check for convergence
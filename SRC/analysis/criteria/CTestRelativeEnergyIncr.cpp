@@ -26,6 +26,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 CTestRelativeEnergyIncr::CTestRelativeEnergyIncr()
@@ -79,6 +80,8 @@ int CTestRelativeEnergyIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestRelativeEnergyIncr::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0)  {
@@ -97,7 +100,7 @@ int CTestRelativeEnergyIncr::test(void)
     // determine the energy & save value in norms vector
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();
-    double product = x ^ b;
+    double product = theSOE->getProductXB();
     if (product < 0.0)
         product *= -0.5;
     else
@@ -127,8 +130,8 @@ int CTestRelativeEnergyIncr::test(void)
                << "Iter: "            << pad(currentIter)
                << ", dX*dR/dX1*dR1: " << pad(product)
                << endln
-               << ", Norm deltaX: "   << pad(x.pNorm(nType))
-               << ", Norm deltaR: "   << pad(b.pNorm(nType)) 
+               << ", Norm deltaX: "   << pad(theSOE->getNormX(nType))
+               << ", Norm deltaR: "   << pad(theSOE->getNormB(nType)) 
                << endln
                << "\tdeltaX: "        << x 
                << "\tdeltaR: "        << b;
@@ -162,8 +165,8 @@ int CTestRelativeEnergyIncr::test(void)
                    //<< "criteria CTestRelativeEnergyIncr but goin on -"
                    << "Iter: "            << pad(currentIter)
                    << ", dX*dR/dX1*dR1: " << pad(product)
-                   << ", Norm deltaX: "  << pad(x.pNorm(nType))
-                   << ", Norm deltaR: "  << pad(b.pNorm(nType))
+                   << ", Norm deltaX: "  << pad(theSOE->getNormX(nType))
+                   << ", Norm deltaR: "  << pad(theSOE->getNormB(nType))
                    << endln;
         }
         return currentIter;
@@ -177,9 +180,9 @@ int CTestRelativeEnergyIncr::test(void)
                    // << LOG_CONTINUE
                    << "Iter: "           << pad(currentIter)
                    << ", dX*dR/dX1*dR1: " << pad(product)
-                   << ", Norm deltaX: "  << pad(x.pNorm(nType))
+                   << ", Norm deltaX: "  << pad(theSOE->getNormX(nType))
                    // << LOG_CONTINUE
-                   <<   "Norm deltaR: "  << pad(b.pNorm(nType))
+                   <<   "Norm deltaR: "  << pad(theSOE->getNormB(nType))
                    << endln;
         }
         currentIter++;
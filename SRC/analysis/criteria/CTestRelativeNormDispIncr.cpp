@@ -24,6 +24,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 CTestRelativeNormDispIncr::CTestRelativeNormDispIncr()
@@ -78,6 +79,8 @@ int CTestRelativeNormDispIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestRelativeNormDispIncr::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == nullptr)  {
@@ -94,7 +97,7 @@ int CTestRelativeNormDispIncr::test(void)
 
     // get the X vector & determine it's norm & save the value in norms vector
     const Vector &x = theSOE->getX();
-    double norm = x.pNorm(nType);
+    double norm = theSOE->getNormX(nType);
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -120,7 +123,7 @@ int CTestRelativeNormDispIncr::test(void)
                << " |dR|/|dR1|: "   << pad(norm)
                << endln;
         opserr << "\tNorm deltaX: " << pad(norm)
-               << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: " << pad(theSOE->getNormB(nType))
                << endln;
         opserr << "\tdeltaX: " << x
                << "\tdeltaR: " << theSOE->getB();
@@ -153,7 +156,7 @@ int CTestRelativeNormDispIncr::test(void)
             opserr << LOG_FAILURE
                    << "Iter: "        << pad(currentIter)
                    << " |dR|/|dR1|: "   << pad(norm)
-                   << ", Norm deltaR: " << pad(theSOE->getB().pNorm(nType))
+                   << ", Norm deltaR: " << pad(theSOE->getNormB(nType))
                    //<< "criteria CTestRelativeNormDispIncr but going on -"
                    << endln;
         }
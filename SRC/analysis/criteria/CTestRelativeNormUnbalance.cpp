@@ -24,6 +24,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 CTestRelativeNormUnbalance::CTestRelativeNormUnbalance()
@@ -77,6 +78,8 @@ int CTestRelativeNormUnbalance::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestRelativeNormUnbalance::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0)  {
@@ -93,7 +96,7 @@ int CTestRelativeNormUnbalance::test(void)
 
     // get the B vector & determine it's norm & save the value in norms vector
     const Vector &x = theSOE->getB();
-    double norm = x.pNorm(nType);
+    double norm = theSOE->getNormB(nType);
     if (currentIter <= maxNumIter)
         norms(currentIter) = norm;
 
@@ -113,7 +116,7 @@ int CTestRelativeNormUnbalance::test(void)
                << "Iter: "     << pad(currentIter)
                << ", |dR|/|dR0|: "  << pad(norm) 
                << endln //" (max: " << tol << ")\n"
-               << "\tNorm deltaX: " << pad(theSOE->getX().pNorm(nType)) 
+               << "\tNorm deltaX: " << pad(theSOE->getNormX(nType)) 
                << ", Norm deltaR: " << pad(norm) 
                << endln
                << "\tdeltaX: "      << theSOE->getX() 
@@ -148,7 +151,7 @@ int CTestRelativeNormUnbalance::test(void)
             opserr << LOG_FAILURE 
                    //<< "criteria CTestRelativeNormUnbalance but going on -"
                    << ", dR/dR0: "       << pad(norm)
-                   << ", Norm deltaX: "  << pad(theSOE->getX().pNorm(nType)) 
+                   << ", Norm deltaX: "  << pad(theSOE->getNormX(nType)) 
                    << endln;
         }
         return currentIter;
@@ -190,8 +193,7 @@ int CTestRelativeNormUnbalance::start(void)
     norm0 = 0.0;
 
     // determine the initial norm .. the the norm of the initial unbalance
-    const Vector &x = theSOE->getB();
-    double norm = x.pNorm(nType);
+    double norm = theSOE->getNormB(nType);
 
     if (currentIter <= maxNumIter)
         norms(0) = norm;
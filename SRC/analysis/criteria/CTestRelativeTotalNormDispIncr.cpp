@@ -29,6 +29,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 CTestRelativeTotalNormDispIncr::CTestRelativeTotalNormDispIncr()
@@ -82,6 +83,8 @@ int CTestRelativeTotalNormDispIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestRelativeTotalNormDispIncr::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0)  {
@@ -98,7 +101,7 @@ int CTestRelativeTotalNormDispIncr::test(void)
 
     // get the X vector & determine it's norm & save the value in norms vector
     const Vector &x = theSOE->getX();
-    double norm = x.pNorm(nType);
+    double norm = theSOE->getNormX(nType);
     if (currentIter <= maxNumIter)
         norms(currentIter-1) = norm;
 
@@ -122,7 +125,7 @@ int CTestRelativeTotalNormDispIncr::test(void)
         opserr << ", |dR|/|dRtot|: " << pad(norm) 
                << endln;
         opserr << "\tNorm deltaX: "  << pad(norm) 
-               << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType))
+               << ", Norm deltaR: "  << pad(theSOE->getNormB(nType))
                << endln;
         opserr << "\tdeltaX: "       << x 
                << "\tdeltaR: "       << theSOE->getB();
@@ -159,7 +162,7 @@ int CTestRelativeTotalNormDispIncr::test(void)
                    << ", |dR|/|dRtot|: " << pad(norm) 
                    << endln
                    << "\tNorm deltaX: "  << pad(norm)
-                   << ", Norm deltaR: "  << pad(theSOE->getB().pNorm(nType)) 
+                   << ", Norm deltaR: "  << pad(theSOE->getNormB(nType)) 
                    << endln;
         }
         return currentIter;
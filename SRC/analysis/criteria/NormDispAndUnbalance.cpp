@@ -24,6 +24,7 @@
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
+#include <AnalysisProfile.h>
 #include <Logging.h>
 
 NormDispAndUnbalance::NormDispAndUnbalance()
@@ -83,6 +84,8 @@ int NormDispAndUnbalance::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int NormDispAndUnbalance::test(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::Test);
+
     // check to ensure the SOE has been set - this should not happen if the
     // return from start() is checked
     if (theSOE == 0) {
@@ -99,10 +102,9 @@ int NormDispAndUnbalance::test(void)
 
     // get the X vector & determine it's norm & save the value in norms vector
     const Vector &x = theSOE->getX();
-    double normX = x.pNorm(nType);
+    double normX = theSOE->getNormX(nType);
 
-    const Vector &b = theSOE->getB();
-    double normB = b.pNorm(nType);
+    double normB = theSOE->getNormB(nType);
 
     if ((currentIter>1 && norms(currentIter-2)<normX) || 
         (currentIter>1 && norms(maxNumIter+currentIter-2)<normB)) {
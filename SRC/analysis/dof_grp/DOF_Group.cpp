@@ -640,6 +640,12 @@ DOF_Group::getT(void)
     return 0;
 }
 
+bool
+DOF_Group::isConstantT(void) const
+{
+    return true;
+}
+
 
 
 void  
@@ -99,8 +99,10 @@ class DOF_Group: public TaggedObject
     virtual double getDampingBetaFactor(int mode, double ratio, double wn);
     virtual const Vector &getDampingBetaForce(int mode, double beta);
 	
-    // method added for TransformationDOF_Groups
+    // method added for TransformationDOF_Groups; isConstantT() is whether
+    // getT() stays the same until the next doneID()
     virtual Matrix *getT(void);
+    virtual bool isConstantT(void) const;
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addM_ForceSensitivity(const Vector &Udotdot, double fact = 1.0);        
@@ -863,6 +863,14 @@ TransformationDOF_Group::getT(void)
 }
 
 
+// T is only formed again by getT() if the constraint is time varying
+bool
+TransformationDOF_Group::isConstantT(void) const
+{
+    return theMP == 0 || theMP->isTimeVarying() == false;
+}
+
+
 int
 TransformationDOF_Group::doneID(void)
 {
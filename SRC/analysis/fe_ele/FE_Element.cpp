@@ -52,7 +52,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()),
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele),
-   theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr)
+   theResidual(nullptr), theTangent(nullptr), ownsStorage(false),
+   threadSafe(false), theIntegrator(nullptr)
 {
     assert(numDOF > 0);
 
@@ -90,7 +91,10 @@ FE_Element::FE_Element(int tag, Element *ele)
 
         // if Elements are not subdomains, set up pointers to
         // objects to return tangent Matrix and residual Vector.
-        if (numDOF <= MAX_NUM_DOF) {
+        // Elements that can be assembled from multiple threads
+        // need their own.
+        threadSafe = ele->isThreadSafe();
+        if (numDOF <= MAX_NUM_DOF && threadSafe == false) {
             // use class wide objects
             if (theVectors[numDOF] == nullptr) {
                 theVectors[numDOF] = new Vector(numDOF);
@@ -107,12 +111,14 @@ FE_Element::FE_Element(int tag, Element *ele)
             // create matrices and vectors for each object instance
             theResidual = new Vector(numDOF);
             theTangent  = new Matrix(numDOF, numDOF);
+            ownsStorage = true;
         }
 
     } else {
         // as subdomains have own matrix for tangent and residual don't need
         // to set matrix and vector pointers to these objects
         theResidual = new Vector(numDOF);
+        ownsStorage = true;
          // invoke setFE_ElementPtr() method on Subdomain
         Subdomain *theSub = (Subdomain *)ele;
         theSub->setFE_ElementPtr(this);
@@ -126,7 +132,8 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(nullptr),
-   myEle(nullptr), theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr)
+   myEle(nullptr), theResidual(nullptr), theTangent(nullptr), ownsStorage(false),
+   threadSafe(false), theIntegrator(nullptr)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
@@ -158,7 +165,7 @@ FE_Element::~FE_Element()
     numFEs--;
 
     // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
+    if (ownsStorage) {
         if (theTangent != nullptr)
           delete theTangent;
         if (theResidual != nullptr) 
@@ -196,6 +203,13 @@ FE_Element::getID() const
   return myID;
 }
 
+bool
+FE_Element::isThreadSafe() const
+{
+  // found once, on construction, as it is asked for on every assembly
+  return threadSafe;
+}
+
 void
 FE_Element::setAnalysisModel(AnalysisModel &theAnalysisModel)
 {
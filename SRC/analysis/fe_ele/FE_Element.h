@@ -51,6 +51,10 @@ class FE_Element: public TaggedObject
     void setAnalysisModel(AnalysisModel &theModel);
     virtual int  setID();
 
+    // true if getTangent() and getResidual() may be invoked concurrently
+    // with those of other FE_Elements that share no equation with this one
+    virtual bool isThreadSafe() const;
+
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
@@ -113,6 +117,8 @@ class FE_Element: public TaggedObject
     Element       *myEle;
     Vector        *theResidual;
     Matrix        *theTangent;
+    bool           ownsStorage;   // theTangent/theResidual not class wide
+    bool           threadSafe;    // myEle is thread safe & ownsStorage
     Integrator    *theIntegrator; // need for Subdomain
 
     //
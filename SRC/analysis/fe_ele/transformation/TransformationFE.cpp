@@ -38,25 +38,12 @@
 #include <Vector.h>
 #include <TransformationConstraintHandler.h>
 
-#define MAX_NUM_DOF 64
-
-// static variables initialisation
-Matrix **TransformationFE::modMatrices; 
-Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
-int TransformationFE::numTransFE(0);           
-int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
-double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
-int TransformationFE::sizeBuffer(0);            
-
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
 TransformationFE::TransformationFE(int tag, Element *ele)
 :FE_Element(tag, ele), theDOFs(0), numSPs(0), theSPs(0), modID(0), 
-  modTangent(0), modResidual(0), numGroups(0), numTransformedDOF(0)
+  modTangent(0), modResidual(0), response(0), numGroups(0), numTransformedDOF(0),
+  constantT(false)
 {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -91,46 +78,7 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	theDOFs[i] = theDofGroup;
     }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new one
-    if (numNodes > sizeTransformations) {
-	if (theTransformations != 0) 
-	    delete [] theTransformations;
-	
-	theTransformations = new Matrix *[numNodes];
-	if (theTransformations == 0) {
-	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
-	    opserr << "for array of pointers for Transformation matrices of size ";
-	    opserr << numNodes;
-	    exit(-1);
-	}		    
-	sizeTransformations = numNodes;
-    }	
-
-    // if this is the first element of this type create the arrays for 
-    // modified tangent and residual matrices
-    if (numTransFE == 0) {
-
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
-	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
-	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
-	    opserr << "TransformationFE::TransformationFE(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }
-
-    // increment the number of transformations
-    numTransFE++;
+    response = new Vector(numOriginalDOF);
 }
 
 
@@ -141,51 +89,18 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 TransformationFE::~TransformationFE()
 {
 
-    numTransFE--;
-    
     if (theDOFs != 0)
 	delete [] theDOFs;
     if (theSPs != 0)
 	delete [] theSPs;
-
-    int numDOF = 0;    
-    if (modID != 0)
-	numDOF = modID->Size();
-    
     if (modID != 0)
 	delete modID;
-
-    if (numDOF > MAX_NUM_DOF) {
-	// tangent and residual may have been  created specially
-	if (modTangent != 0) delete modTangent;
-	if (modResidual != 0) delete modResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransFE == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}
-	delete [] modMatrices;
-	delete [] modVectors;
-	delete [] theTransformations;
-	delete [] dataBuffer;
-	delete [] localKbuffer;
-	delete [] dofData;
-	modMatrices = 0;
-	modVectors = 0;
-	theTransformations = 0;
-	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
-	sizeTransformations = 0;
-	sizeBuffer = 0;
-	transCounter = 0;
-    }
+    if (modTangent != 0)
+	delete modTangent;
+    if (modResidual != 0)
+	delete modResidual;
+    if (response != 0)
+	delete response;
 }    
 
 
@@ -248,191 +163,120 @@ TransformationFE::setID(void)
 	    }		
     }
     
-    // set the pointers to the modified tangent matrix and residual vector
-    if (numTransformedDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[numTransformedDOF] == 0) {
-	    modVectors[numTransformedDOF] = new Vector(numTransformedDOF);
-	    modMatrices[numTransformedDOF] = new Matrix(numTransformedDOF,numTransformedDOF);
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	    if (modResidual == 0 || modResidual->Size() != numTransformedDOF ||	
-		modTangent == 0 || modTangent->noCols() != numTransformedDOF)	{  
-		opserr << "TransformationFE::setID() ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numTransformedDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
+    // create the modified tangent matrix and residual vector; each object
+    // has its own so that the elements can be formed concurrently
+    if (modTangent == 0 || modTangent->noRows() != numTransformedDOF) {
+	if (modTangent != 0)
+	    delete modTangent;
+	if (modResidual != 0)
+	    delete modResidual;
 	modResidual = new Vector(numTransformedDOF);
 	modTangent = new Matrix(numTransformedDOF, numTransformedDOF);
-	if (modResidual == 0 || modResidual->Size() ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "TransformationFE::setID() ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << numTransformedDOF << endln;
-	    exit(-1);
+    }
+
+    return this->formTransformation();
+}
+
+
+bool
+TransformationFE::isThreadSafe() const
+{
+    // a T that is not constant is formed by its DOF_Group on each use
+    return constantT && this->FE_Element::isThreadSafe();
+}
+
+
+//
+// Collect the nonzero terms of T from the DOF_Groups; a DOF_Group without
+// a T contributes the identity.
+//
+int
+TransformationFE::formTransformation(void)
+{
+    theTerms.clear();
+    constantT = true;
+
+    int startRowOriginal = 0;
+    int startRowTransformed = 0;
+    for (int i=0; i<numGroups; i++) {
+	const Matrix *Ti = theDOFs[i]->getT();
+	constantT = constantT && theDOFs[i]->isConstantT();
+	if (Ti != 0) {
+	    int noRows = Ti->noRows();
+	    int noCols = Ti->noCols();
+	    for (int k=0; k<noRows; k++)
+		for (int j=0; j<noCols; j++)
+		    if ((*Ti)(k,j) != 0.0)
+			theTerms.push_back({startRowOriginal+k, startRowTransformed+j, (*Ti)(k,j)});
+	    startRowOriginal += noRows;
+	    startRowTransformed += noCols;
+	} else {
+	    int numDOF = theDOFs[i]->getNumDOF();
+	    for (int k=0; k<numDOF; k++)
+		theTerms.push_back({startRowOriginal+k, startRowTransformed+k, 1.0});
+	    startRowOriginal += numDOF;
+	    startRowTransformed += numDOF;
 	}
-    }     
+    }
+
+    if (startRowOriginal != numOriginalDOF || startRowTransformed != numTransformedDOF) {
+	opserr << "WARNING TransformationFE::formTransformation() - T does not match";
+	opserr << " the number of dof at the element and DOF_Groups\n";
+	return -2;
+    }
 
     return 0;
 }
 
+
+//
+// Form T^T K T in modTangent from the nonzero terms of T; most of them are
+// those of identity blocks, where this reduces to copying K.
+//
 const Matrix &
-TransformationFE::getTangent(Integrator *theNewIntegrator)
+TransformationFE::transformTangent(const Matrix &theTangent)
 {
-    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    if (constantT == false)
+	this->formTransformation();
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for (int a = 0; a<numNode; a++) {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if (theT != 0)
-	numDOFs[a] = theT->noRows(); // T^ 
-      else
-	numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
+    modTangent->Zero();
 
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-
-	int startCol = 0;
-	int numDOFi = numDOFs[i];	
-	int noColsOriginal = 0;
-
-	for (int j=0; j<numNode; j++) {
-
-	    const Matrix *Ti = theTransformations[i];
-	    const Matrix *Tj = theTransformations[j];
-	    int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer, numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFER	    
-	    for (int a=0; a<numDOFi; a++)
-		for (int b=0; b<numDOFj; b++)
-		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	    // now perform the matrix computation T(i)^T localK T(j)
-	    // note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-	    
-	    if (Ti != 0 && Tj != 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	    } else if (Ti == 0 && Tj != 0) {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	    } else if (Ti != 0 && Tj == 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	    } else {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
-	    }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-	    
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
+    const int numTerms = theTerms.size();
+    for (int b=0; b<numTerms; b++) {
+	const Term &Tb = theTerms[b];
+	for (int a=0; a<numTerms; a++) {
+	    const Term &Ta = theTerms[a];
+	    (*modTangent)(Ta.col, Tb.col) += Ta.value * theTangent(Ta.row, Tb.row) * Tb.value;
 	}
-
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
     }
 
     return *modTangent;
 }
 
+const Matrix &
+TransformationFE::getTangent(Integrator *theNewIntegrator)
+{
+    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+
+    // perform Tt K T -- as T is block diagonal only the terms T(i)^T K(i,j) T(j)
+    // of the nonzero entries of T contribute
+    return this->transformTangent(theTangent);
+}
+
 
 const Vector &
 TransformationFE::getResidual(Integrator *theNewIntegrator)
 
 {
     const Vector &theResidual = this->FE_Element::getResidual(theNewIntegrator);
-    // DO THE SP STUFF TO THE TANGENT
-    
-    // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRowTransformed = 0;
-    int startRowOriginal = 0;
-    int numNode = numGroups;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-	int noRows = 0;
-	int noCols = 0;
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	  noRows = Ti->noCols(); // T^
-	  noCols = Ti->noRows();
-
-	  /*
-	  Vector orig(noCols);
-	  Vector mod(noRows);
-	  for (int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-	    orig(k-startRowOriginal)= theResidual(k);
-	  mod = (*Ti)^orig;
-	  for (int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-	    (*modResidual)(k) = mod (k-startRowTransformed);
-
-	  */
-
-	  for (int j=0; j<noRows; j++) {
-	    double sum = 0.0;
-	    for (int k=0; k<noCols; k++)
-	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-	    (*modResidual)(startRowTransformed +j) = sum;
-	  }
+    if (constantT == false)
+	this->formTransformation();
 
-	} else {
-	  noCols = theDOFs[i]->getNumDOF();
-	  noRows = noCols;
-	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
-	}
-	startRowTransformed += noRows;
-	startRowOriginal += noCols;
-    }
+    // perform Tt R  -- as T is block diagonal only the nonzero
+    // entries of T contribute
+    modResidual->Zero();
+    for (const Term &term : theTerms)
+	(*modResidual)(term.col) += term.value * theResidual(term.row);
 
     return *modResidual;
 }
@@ -455,96 +299,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -570,96 +325,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   this->FE_Element::addKiToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -684,96 +350,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   this->FE_Element::addMtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -798,96 +375,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -912,8 +400,6 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -922,8 +408,8 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalD_Force(response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalD_Force(*response, fact);
 }   	 
 
 void  
@@ -932,8 +418,6 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -942,8 +426,8 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalM_Force(response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalM_Force(*response, fact);
 }   	 
 
 
@@ -974,35 +458,14 @@ int
 TransformationFE::transformResponse(const Vector &modResp, 
 				    Vector &unmodResp)
 {
-    // perform T R  -- as T is block diagonal do T(i) R(i)
-    // where blocks are of size equal to num ele dof at a node
+    if (constantT == false)
+	this->formTransformation();
 
-    int startRowOriginal = 0;
-    int startRowTransformed = 0;
-    int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
-
-    for (int i=0; i<numNode; i++) {
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	    noRows = Ti->noRows();
-	    noCols = Ti->noCols();
-	    for (int j=0; j<noRows; j++) {
-		double sum = 0.0;
-		for (int k=0; k<noCols; k++)
-		    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-		unmodResp(startRowOriginal + j) = sum;
-	    }
-	} else {
-	    noCols = theDOFs[i]->getNumDOF();
-	    noRows = noCols;
-	    for (int j=0; j<noCols; j++)
-		unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
-	}
-	startRowOriginal += noRows;
-	startRowTransformed += noCols;
-    }
+    // perform T R  -- as T is block diagonal only the nonzero
+    // entries of T contribute
+    unmodResp.Zero();
+    for (const Term &term : theTerms)
+	unmodResp(term.row) += term.value * modResp(term.col);
 
     return 0;
 }
@@ -1015,8 +478,6 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -1025,8 +486,8 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalD_ForceSensitivity(gradNumber, response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalD_ForceSensitivity(gradNumber, *response, fact);
 }   	 
 
 void  
@@ -1035,8 +496,6 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
@@ -1045,8 +504,8 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalM_ForceSensitivity(gradNumber, response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalM_ForceSensitivity(gradNumber, *response, fact);
 }   	 
 
 // AddingSensitivity:END ////////////////////////////////////
@@ -37,6 +37,7 @@
 // What: "@(#) TransformationFE.h, revA"
 
 #include <FE_Element.h>
+#include <vector>
 class SP_Constraint;
 class DOF_Group;
 class TransformationConstraintHandler;
@@ -52,6 +53,7 @@ class TransformationFE: public FE_Element
     virtual const ID &getID(void) const;
     void setAnalysisModel(AnalysisModel &theModel);
     virtual int setID(void);
+    virtual bool isThreadSafe() const;
     
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
@@ -79,6 +81,17 @@ class TransformationFE: public FE_Element
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
     
   private:
+    // the nonzero terms T(row,col) of the block diagonal transformation,
+    // with rows numbered over the dof of the element and columns over the
+    // transformed dof, found by setID() and again before each use if a
+    // DOF_Group has a T that is not constant
+    struct Term {
+      int    row;
+      int    col;
+      double value;
+    };
+    int formTransformation(void);
+    const Matrix &transformTangent(const Matrix &theTangent);
     
     // private variables - a copy for each object of the class        
     DOF_Group **theDOFs;
@@ -87,21 +100,13 @@ class TransformationFE: public FE_Element
     ID *modID;
     Matrix *modTangent;
     Vector *modResidual;
+    Vector *response;      // T times a transformed vector
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
-    
-    // static variables - single copy for all objects of the class	
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
-    static int numTransFE;     // number of objects    
-    static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
-    static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
-    static int sizeBuffer;
+
+    std::vector<Term> theTerms;
+    bool constantT;
 };
 
 #endif
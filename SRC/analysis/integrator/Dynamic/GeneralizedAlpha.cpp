@@ -38,6 +38,7 @@
 #include <FEM_ObjectBroker.h>
 
 #include <elementAPI.h>
+#include <math.h>
 #define OPS_Export 
 
 void *
@@ -436,6 +437,15 @@ int GeneralizedAlpha::commit()
     return theModel->commitDomain();
 }
 
+int
+GeneralizedAlpha::getLocalError(double &errorNorm, double &dispNorm)
+{
+  if (U == nullptr)
+    return -1;
+
+  return localError(*U, *Udotdot, *Utdotdot, beta, deltaT, errorNorm, dispNorm);
+}
+
 const Vector &
 GeneralizedAlpha::getVel()
 {
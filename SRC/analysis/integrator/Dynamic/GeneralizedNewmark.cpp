@@ -944,7 +944,7 @@ GeneralizedNewmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads
 
     const ID &id = dofPtr->getID();
     int idSize = id.Size();
-    const Vector &dispSens = dofPtr->getDispSensitivity(gradNumber);
+    const Vector &dispSens = dofPtr->getDispSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -952,7 +952,7 @@ GeneralizedNewmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads
       }
     }
 
-    const Vector &velSens = dofPtr->getVelSensitivity(gradNumber);
+    const Vector &velSens = dofPtr->getVelSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -960,7 +960,7 @@ GeneralizedNewmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads
       }
     }
 
-    const Vector &accelSens = dofPtr->getAccSensitivity(gradNumber);
+    const Vector &accelSens = dofPtr->getAccSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -1071,49 +1071,8 @@ GeneralizedNewmark::computeSensitivities(void)
   
   // Form the part of the RHS which are indepent of parameter
   this->formIndependentSensitivityRHS();
-  AnalysisModel *theModel = this->getAnalysisModel();  //Abbas 
-  Domain *theDomain=theModel->getDomainPtr();//Abbas
-  ParameterIter &paramIter = theDomain->getParameters();
 
-  Parameter *theParam;
-
-  // De-activate all parameters
-  while ((theParam = paramIter()) != 0)
-    theParam->activate(false);
-  
-  // Now, compute sensitivity wrt each parameter
-  int numGrads = theDomain->getNumParameters();
-
-  paramIter = theDomain->getParameters();
-  
-  while ((theParam = paramIter()) != 0) {
-    
-    // Activate this parameter
-    theParam->activate(true);
-    
-    // Zero the RHS vector
-    theSOE->zeroB();
-    
-    // Get the grad index for this parameter
-    int gradIndex = theParam->getGradIndex();
-    //   opserr<<"gradNumber = "<<gradIndex<<endln;
-    // Form the RHS
-    this->formSensitivityRHS(gradIndex);
-    
-    // Solve for displacement sensitivity
-    
-    theSOE->solve();
-    // Save sensitivity to nodes
-    this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-    
-
-    // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-    this->commitSensitivity(gradIndex, numGrads);
-    
-    // De-activate this parameter for next sensitivity calc
-    theParam->activate(false);
-  }
-  
-  return 0;
+  // Form, solve and save the sensitivity to each parameter
+  return this->solveSensitivities();
 }
 
@@ -35,6 +35,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <math.h>
 
 
 void *
@@ -411,6 +412,15 @@ int HHT::commit(void)
     return theModel->commitDomain();
 }
 
+int
+HHT::getLocalError(double &errorNorm, double &dispNorm)
+{
+  if (U == nullptr)
+    return -1;
+
+  return localError(*U, *Udotdot, *Utdotdot, beta, deltaT, errorNorm, dispNorm);
+}
+
 const Vector &
 HHT::getVel()
 {
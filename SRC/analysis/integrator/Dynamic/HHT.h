@@ -56,6 +56,8 @@ public:
     int update(const Vector &deltaU);
     int commit(void);
 
+    int getLocalError(double &errorNorm, double &dispNorm);
+
     const Vector &getVel(void);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
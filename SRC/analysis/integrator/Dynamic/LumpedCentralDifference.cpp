@@ -0,0 +1,437 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// LumpedCentralDifference.
+//
+#include <LumpedCentralDifference.h>
+#include <AnalysisModel.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <ID.h>
+#include <Matrix.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <AnalysisProfile.h>
+#include <threads/thread_pool.hpp>
+#include <elementAPI.h>
+#include <classTags.h>
+#include <unordered_map>
+
+
+void *
+OPS_ADD_RUNTIME_VPV(OPS_LumpedCentralDifference)
+{
+  int argc = OPS_GetNumRemainingInputArgs();
+  if (argc == 0)
+    return new LumpedCentralDifference();
+
+  double alphaM;
+  int numData = 1;
+  if (argc != 1 || OPS_GetDouble(&numData, &alphaM) != 0) {
+    opserr << "WARNING - invalid args want LumpedCentralDifference <$alphaM>\n";
+    return nullptr;
+  }
+
+  return new LumpedCentralDifference(alphaM);
+}
+
+
+LumpedCentralDifference::LumpedCentralDifference()
+  : TransientIntegrator(INTEGRATOR_TAGS_LumpedCentralDifference),
+    alphaM(0.0), deltaT(0.0)
+{
+
+}
+
+
+LumpedCentralDifference::LumpedCentralDifference(double alpha)
+  : TransientIntegrator(INTEGRATOR_TAGS_LumpedCentralDifference),
+    alphaM(alpha), deltaT(0.0)
+{
+
+}
+
+
+LumpedCentralDifference::~LumpedCentralDifference()
+{
+
+}
+
+
+int
+LumpedCentralDifference::formEleTangent(FE_Element *theEle)
+{
+  opserr << "LumpedCentralDifference::formEleTangent() - no tangent is formed\n";
+  return -1;
+}
+
+
+int
+LumpedCentralDifference::formNodTangent(DOF_Group *theDof)
+{
+  opserr << "LumpedCentralDifference::formNodTangent() - no tangent is formed\n";
+  return -1;
+}
+
+
+//
+// The node DOFs are laid out node by node in storage order, and each
+// element DOF is given a slot of the element force buffer. The slots are
+// then listed by the node DOF they add to, in element order, so that the
+// gather in formResistingForce() sums them in the order of a serial
+// assembly.
+//
+int
+LumpedCentralDifference::domainChanged(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == nullptr) {
+    opserr << "LumpedCentralDifference::domainChanged() - no AnalysisModel set\n";
+    return -1;
+  }
+  Domain *theDomain = theModel->getDomainPtr();
+
+  if (theDomain->getNumMPs() > 0) {
+    opserr << "LumpedCentralDifference::domainChanged() - multi-point constraints are not supported\n";
+    return -2;
+  }
+
+  theNodes.clear();
+  nodeStart.assign(1, 0);
+  std::unordered_map<int, int> nodeIndex;
+
+  Node *nodePtr;
+  NodeIter &theNodeIter = theDomain->getNodes();
+  while ((nodePtr = theNodeIter()) != nullptr) {
+    nodeIndex[nodePtr->getTag()] = theNodes.size();
+    theNodes.push_back(nodePtr);
+    nodeStart.push_back(nodeStart.back() + nodePtr->getNumberDOF());
+  }
+  const int numDOF = nodeStart.back();
+
+  mass.assign(numDOF, 0.0);
+  for (std::size_t i = 0; i < theNodes.size(); i++) {
+    const Matrix &M = theNodes[i]->getMass();
+    for (int j = 0; j < M.noRows(); j++)
+      mass[nodeStart[i] + j] += M(j, j);
+  }
+
+  theElements.clear();
+  safeElements.clear();
+  serialElements.clear();
+  eleStart.assign(1, 0);
+  std::vector<int> slotDOF;
+
+  Element *elePtr;
+  ElementIter &theElemIter = theDomain->getElements();
+  while ((elePtr = theElemIter()) != nullptr) {
+    const ID &nodes = elePtr->getExternalNodes();
+    for (int i = 0; i < nodes.Size(); i++) {
+      auto found = nodeIndex.find(nodes(i));
+      if (found == nodeIndex.end()) {
+        opserr << "LumpedCentralDifference::domainChanged() - element " << elePtr->getTag()
+               << " has no node " << nodes(i) << "\n";
+        return -3;
+      }
+      const int node = found->second;
+      for (int j = nodeStart[node]; j < nodeStart[node+1]; j++)
+        slotDOF.push_back(j);
+    }
+
+    const int numEleDOF = slotDOF.size() - eleStart.back();
+    if (numEleDOF != elePtr->getNumDOF()) {
+      opserr << "LumpedCentralDifference::domainChanged() - element " << elePtr->getTag()
+             << " has DOFs other than those of its nodes\n";
+      return -3;
+    }
+
+    const Matrix &M = elePtr->getMass();
+    if (M.noRows() == numEleDOF)
+      for (int j = 0; j < numEleDOF; j++)
+        mass[slotDOF[eleStart.back() + j]] += M(j, j);
+
+    if (elePtr->isThreadSafe())
+      safeElements.push_back(theElements.size());
+    else
+      serialElements.push_back(theElements.size());
+
+    theElements.push_back(elePtr);
+    eleStart.push_back(slotDOF.size());
+  }
+  eleForce.assign(slotDOF.size(), 0.0);
+
+  dofStart.assign(numDOF+1, 0);
+  for (int dof : slotDOF)
+    dofStart[dof+1]++;
+  for (int j = 0; j < numDOF; j++)
+    dofStart[j+1] += dofStart[j];
+  dofSlots.resize(slotDOF.size());
+  {
+    std::vector<int> next(dofStart.begin(), dofStart.end()-1);
+    for (std::size_t k = 0; k < slotDOF.size(); k++)
+      dofSlots[next[slotDOF[k]]++] = k;
+  }
+
+  // the constrained DOFs are not advanced; they take the response the
+  // constraint handler imposes in applyLoadDomain()
+  std::vector<bool> constrained(numDOF, false);
+  SP_Constraint *theSP;
+  SP_ConstraintIter &theSPs = theDomain->getDomainAndLoadPatternSPs();
+  while ((theSP = theSPs()) != nullptr) {
+    auto found = nodeIndex.find(theSP->getNodeTag());
+    const int dof = theSP->getDOF_Number();
+    if (found == nodeIndex.end() || dof < 0 || dof >= theNodes[found->second]->getNumberDOF())
+      continue;
+    constrained[nodeStart[found->second] + dof] = true;
+  }
+
+  invMass.assign(numDOF, 0.0);
+  for (std::size_t i = 0; i < theNodes.size(); i++)
+    for (int j = nodeStart[i]; j < nodeStart[i+1]; j++) {
+      if (constrained[j])
+        continue;
+      if (mass[j] <= 0.0) {
+        opserr << "LumpedCentralDifference::domainChanged() - no mass at dof " << j - nodeStart[i] + 1
+               << " of node " << theNodes[i]->getTag() << "\n";
+        return -4;
+      }
+      invMass[j] = 1.0/mass[j];
+    }
+
+  U.assign(numDOF, 0.0);
+  V.assign(numDOF, 0.0);
+  A.assign(numDOF, 0.0);
+  R.assign(numDOF, 0.0);
+  velocity.setData(V.data(), numDOF);
+
+  // the committed velocity is taken to be that at t - dt/2
+  this->getCommittedResponse();
+
+  return 0;
+}
+
+
+void
+LumpedCentralDifference::getCommittedResponse(void)
+{
+  for (std::size_t i = 0; i < theNodes.size(); i++) {
+    const Vector &disp = theNodes[i]->getDisp();
+    const Vector &vel  = theNodes[i]->getVel();
+    const Vector &accel = theNodes[i]->getAccel();
+    for (int j = nodeStart[i]; j < nodeStart[i+1]; j++) {
+      const int k = j - nodeStart[i];
+      U[j] = disp(k);
+      V[j] = vel(k);
+      A[j] = accel(k);
+    }
+  }
+}
+
+
+int
+LumpedCentralDifference::formResistingForce(void)
+{
+  AnalysisProfile::Scope scope(AnalysisProfile::FormUnbalance);
+
+  Domain *theDomain = this->getAnalysisModel()->getDomainPtr();
+  if (AnalysisProfile::isEnabled())
+    AnalysisProfile::addElementCalls(AnalysisProfile::FormUnbalance, theDomain->getElementClasses());
+
+  auto form = [this](int i) {
+    const Vector &force = theElements[i]->getResistingForce();
+    double *slot = &eleForce[eleStart[i]];
+    for (int j = 0; j < force.Size(); j++)
+      slot[j] = force(j);
+  };
+
+  const int numDOF = R.size();
+  auto gather = [this](int j) {
+    double sum = 0.0;
+    for (int k = dofStart[j]; k < dofStart[j+1]; k++)
+      sum += eleForce[dofSlots[k]];
+    R[j] = sum;
+  };
+
+  OpenSees::thread_pool *thePool = theDomain->getThreadPool();
+  if (thePool != nullptr) {
+    thePool->submit_loop<std::size_t>(0, safeElements.size(), [&](std::size_t i) {
+      form(safeElements[i]);
+    }).wait();
+    for (int i : serialElements)
+      form(i);
+    thePool->submit_loop<int>(0, numDOF, gather).wait();
+
+  } else {
+    for (std::size_t i = 0; i < theElements.size(); i++)
+      form(i);
+    for (int j = 0; j < numDOF; j++)
+      gather(j);
+  }
+
+  return 0;
+}
+
+
+int
+LumpedCentralDifference::newStep(double dT)
+{
+  deltaT = dT;
+  if (deltaT <= 0.0) {
+    opserr << "LumpedCentralDifference::newStep() - error in variable\n";
+    opserr << "dT = " << deltaT << "\n";
+    return -1;
+  }
+
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == nullptr || nodeStart.empty()) {
+    opserr << "LumpedCentralDifference::newStep() - domainChanged() failed or hasn't been called\n";
+    return -2;
+  }
+
+  // apply the load at t; the elements are at u(t) from the last step
+  double time = theModel->getCurrentDomainTime();
+  theModel->applyLoadDomain(time);
+
+  this->formResistingForce();
+
+  //
+  // advance the nodes; each node has its own DOFs, so they are
+  // independent of each other. a constrained DOF takes the response
+  // applyLoadDomain() left at the node, which is not zero for a
+  // non-homogeneous or imposed motion constraint
+  //
+  auto advance = [this, dT](std::size_t i) {
+    Node *theNode = theNodes[i];
+    const Vector &P = theNode->getUnbalancedLoad();
+    const Vector &disp = theNode->getTrialDisp();
+    const Vector &vel = theNode->getTrialVel();
+    const Vector &accel = theNode->getTrialAccel();
+    const int first = nodeStart[i];
+    const int n = nodeStart[i+1] - first;
+    for (int k = 0; k < n; k++) {
+      const int j = first + k;
+      if (invMass[j] == 0.0) {
+        U[j] = disp(k);
+        V[j] = vel(k);
+        A[j] = accel(k);
+        continue;
+      }
+      const double a = invMass[j]*(P(k) - R[j]) - alphaM*V[j];
+      A[j]  = a;
+      V[j] += dT*a;
+      U[j] += dT*V[j];
+    }
+    theNode->setTrialDisp(Vector(&U[first], n));
+    theNode->setTrialVel(Vector(&V[first], n));
+    theNode->setTrialAccel(Vector(&A[first], n));
+  };
+
+  OpenSees::thread_pool *thePool = theModel->getDomainPtr()->getThreadPool();
+  if (thePool != nullptr)
+    thePool->submit_loop<std::size_t>(0, theNodes.size(), advance).wait();
+  else
+    for (std::size_t i = 0; i < theNodes.size(); i++)
+      advance(i);
+
+  if (theModel->updateDomain() < 0) {
+    opserr << "LumpedCentralDifference::newStep() - failed to update the domain\n";
+    return -3;
+  }
+
+  return 0;
+}
+
+
+int
+LumpedCentralDifference::update(const Vector &)
+{
+  opserr << "LumpedCentralDifference::update() - the step is taken by newStep(); "
+            "the analysis must not call the solution algorithm\n";
+  return -1;
+}
+
+
+int
+LumpedCentralDifference::commit(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == nullptr) {
+    opserr << "WARNING LumpedCentralDifference::commit() - no AnalysisModel set\n";
+    return -1;
+  }
+
+  // update time in Domain to T + deltaT & commit the domain
+  double time = theModel->getCurrentDomainTime() + deltaT;
+  theModel->setCurrentDomainTime(time);
+
+  return theModel->commitDomain();
+}
+
+
+int
+LumpedCentralDifference::revertToLastStep(void)
+{
+  // the nodes have been reverted by the Domain
+  if (!nodeStart.empty())
+    this->getCommittedResponse();
+  return 0;
+}
+
+
+const Vector &
+LumpedCentralDifference::getVel(void)
+{
+  // indexed by node DOF, not by equation
+  return velocity;
+}
+
+
+int
+LumpedCentralDifference::sendSelf(int cTag, Channel &theChannel)
+{
+  Vector data(1);
+  data(0) = alphaM;
+
+  if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "WARNING LumpedCentralDifference::sendSelf() - could not send data\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+LumpedCentralDifference::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  Vector data(1);
+  if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "WARNING LumpedCentralDifference::recvSelf() - could not receive data\n";
+    return -1;
+  }
+
+  alphaM = data(0);
+
+  return 0;
+}
+
+
+void
+LumpedCentralDifference::Print(OPS_Stream &s, int flag)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel != nullptr) {
+    s << "LumpedCentralDifference - currentTime: " << theModel->getCurrentDomainTime() << "\n";
+    s << "  alphaM: " << alphaM << "  DOFs: " << (int)U.size() << "\n";
+  } else
+    s << "LumpedCentralDifference - no associated AnalysisModel\n";
+}
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: LumpedCentralDifference is the explicit central difference
+// (leap-frog) scheme for a diagonal, lumped mass matrix, carried out
+// without a system of equations:
+//
+//     a(t)        = M^-1 (P(t) - R(u(t)) - alphaM M v(t-dt/2))
+//     v(t+dt/2)   = v(t-dt/2) + dt a(t)
+//     u(t+dt)     = u(t) + dt v(t+dt/2)
+//
+// The inverse of the mass, the response and the resisting force are held
+// in flat arrays indexed by node DOF. The resisting forces of the elements
+// are written into a buffer with a slot for each element DOF, and are then
+// gathered DOF by DOF, so the result does not depend on the number of
+// threads. When the Domain has a pool (analysis -threads), the elements
+// that are thread safe (Element::isThreadSafe) are formed by its threads
+// and the others serially; without one, or when no element is thread
+// safe, the element loop is serial. newStep() carries out the
+// whole step, so the analysis calls neither the algorithm nor the
+// LinearSOE (isMatrixFree()).
+//
+// The mass is the diagonal of the nodal and element mass matrices, formed
+// when the domain changes. Every free DOF must have mass, and constraints
+// other than single point constraints are not supported. A constrained
+// DOF keeps the response the constraint handler gives it when the load is
+// applied, so a prescribed displacement needs a handler that imposes it
+// (Transformation). The nodes are given v(t+dt/2) as their velocity and
+// a(t) as their acceleration.
+//
+#ifndef LumpedCentralDifference_h
+#define LumpedCentralDifference_h
+
+#include <TransientIntegrator.h>
+#include <Vector.h>
+#include <vector>
+
+class Node;
+class Element;
+
+class LumpedCentralDifference : public TransientIntegrator
+{
+  public:
+    LumpedCentralDifference();
+    LumpedCentralDifference(double alphaM);
+    ~LumpedCentralDifference();
+
+    bool isMatrixFree(void) const {return true;}
+
+    // methods which define what the FE_Element and DOF_Groups add
+    // to the system of equation object; they are not used
+    int formEleTangent(FE_Element *theEle);
+    int formNodTangent(DOF_Group *theDof);
+
+    int domainChanged(void);
+    int newStep(double deltaT);
+    int update(const Vector &U);
+    int commit(void);
+    int revertToLastStep(void);
+
+    const Vector &getVel(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    int  formResistingForce(void);
+    void getCommittedResponse(void);
+
+    double alphaM;
+    double deltaT;
+
+    // the DOFs of node i are nodeStart[i] .. nodeStart[i+1]-1
+    std::vector<Node *> theNodes;
+    std::vector<int>    nodeStart;
+
+    // by node DOF; the inverse mass is 0 at constrained DOFs
+    std::vector<double> invMass;
+    std::vector<double> mass;
+    std::vector<double> U, V, A, R;
+
+    // the resisting force of element i is written to the slots
+    // eleStart[i] .. eleStart[i+1]-1 of eleForce; the slots that
+    // add to node DOF j are dofSlots[dofStart[j]] .. dofSlots[dofStart[j+1]-1]
+    std::vector<Element *> theElements;
+    std::vector<int>       eleStart;
+    std::vector<double>    eleForce;
+    std::vector<int>       dofStart;
+    std::vector<int>       dofSlots;
+    std::vector<int>       safeElements;
+    std::vector<int>       serialElements;
+
+    Vector velocity;
+};
+
+#endif
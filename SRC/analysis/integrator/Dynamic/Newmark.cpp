@@ -38,6 +38,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <string.h>
+#include <math.h>
 #include <NodeIter.h>
 #include <Domain.h>
 #include <Node.h> // for sensitivity
@@ -110,6 +111,7 @@ int Newmark::newStep(double deltaT)
         opserr << "dT = " << deltaT << endln;
         return -2;  
     }
+    this->deltaT = deltaT;
 
     // get a pointer to the AnalysisModel
     AnalysisModel *theModel = this->getAnalysisModel();
@@ -239,6 +241,15 @@ int Newmark::newStep(double deltaT)
 }
 
 
+int
+Newmark::getLocalError(double &errorNorm, double &dispNorm)
+{
+  if (U == nullptr)
+    return -1;
+
+  return localError(*U, *Udotdot, *Utdotdot, beta, deltaT, errorNorm, dispNorm);
+}
+
 const Vector &
 Newmark::getVel()
 {
@@ -816,7 +827,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
 
     const ID &id = dofPtr->getID();
     int idSize = id.Size();
-    const Vector &dispSens = dofPtr->getDispSensitivity(gradNumber);
+    const Vector &dispSens = dofPtr->getDispSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -824,7 +835,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
       }
     }
 
-    const Vector &velSens = dofPtr->getVelSensitivity(gradNumber);
+    const Vector &velSens = dofPtr->getVelSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -832,7 +843,7 @@ Newmark::saveSensitivity(const Vector & vNew,int gradNum,int numGrads)
       }
     }
 
-    const Vector &accelSens = dofPtr->getAccSensitivity(gradNumber);
+    const Vector &accelSens = dofPtr->getAccSensitivity(gradNum);
     for (i = 0; i < idSize; i++) {
       loc = id(i);
       if (loc >= 0) {
@@ -943,49 +954,8 @@ Newmark::computeSensitivities(void)
   
   // Form the part of the RHS which are indepent of parameter
   this->formIndependentSensitivityRHS();
-  AnalysisModel *theModel = this->getAnalysisModel();  //Abbas 
-  Domain *theDomain=theModel->getDomainPtr();//Abbas
-  ParameterIter &paramIter = theDomain->getParameters();
 
-  Parameter *theParam;
-
-  // De-activate all parameters
-  while ((theParam = paramIter()) != 0)
-    theParam->activate(false);
-  
-  // Now, compute sensitivity wrt each parameter
-  int numGrads = theDomain->getNumParameters();
-
-  paramIter = theDomain->getParameters();
-  
-  while ((theParam = paramIter()) != 0) {
-    
-    // Activate this parameter
-    theParam->activate(true);
-    
-    // Zero the RHS vector
-    theSOE->zeroB();
-    
-    // Get the grad index for this parameter
-    int gradIndex = theParam->getGradIndex();
-    //   opserr<<"gradNumber = "<<gradIndex<<endln;
-    // Form the RHS
-    this->formSensitivityRHS(gradIndex);
-    
-    // Solve for displacement sensitivity
-    
-    theSOE->solve();
-    // Save sensitivity to nodes
-    this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-    
-
-    // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-    this->commitSensitivity(gradIndex, numGrads);
-    
-    // De-activate this parameter for next sensitivity calc
-    theParam->activate(false);
-  }
-  
-  return 0;
+  // Form, solve and save the sensitivity to each parameter
+  return this->solveSensitivities();
 }
 
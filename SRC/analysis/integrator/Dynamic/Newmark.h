@@ -66,6 +66,8 @@ public:
 
     double getCFactor();
 
+    int getLocalError(double &errorNorm, double &dispNorm);
+
     const Vector &getVel();
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
@@ -95,6 +97,7 @@ private:
 
     double gamma;
     double beta;
+    double deltaT = 0.0;            // size of the current step
 
     double c1, c2, c3;              // some constants we need to keep
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
@@ -28,19 +28,67 @@
 #include <FE_Element.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
+#include <Domain.h>
 #include <Matrix.h>
 #include <Vector.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
+#include <threads/thread_pool.hpp>
+#include <AnalysisProfile.h>
+#include <vector>
 #include <cmath>
 
+//
+// Invoke form(theEle) on every FE_Element of the model, one colour at a
+// time. The thread safe members of a colour are handled by the pool, if
+// there is one, and the others serially afterwards. Members of a colour
+// share no equation, so each coefficient of the SOE receives its
+// contributions in the order of the colours, with or without a pool and
+// whatever its number of threads, and the result is reproducible bit for
+// bit. The FE_Elements for which form() fails are passed to report(),
+// serially.
+//
+template <typename Form, typename Report>
+static int
+formByColor(AnalysisModel &theModel, OpenSees::thread_pool *thePool,
+            Form form, Report report)
+{
+    int result = 0;
+    std::vector<int> status;
+
+    for (const std::vector<FE_Element *> &color : theModel.getFE_Colors()) {
+        const unsigned int n = color.size();
+        status.assign(n, 0);
+
+        if (thePool != nullptr)
+            thePool->submit_loop<unsigned int>(0, n, [&](unsigned int i) {
+                if (color[i]->isThreadSafe())
+                    status[i] = form(color[i]);
+            }).wait();
+
+        for (unsigned int i=0; i<n; i++) {
+            if (thePool == nullptr || !color[i]->isThreadSafe())
+                status[i] = form(color[i]);
+
+            if (status[i] < 0) {
+                report(color[i]);
+                result = status[i];
+            }
+        }
+    }
+
+    return result;
+}
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), //theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0), thePool(nullptr)
 {
   
 }
@@ -85,22 +133,19 @@ IncrementalIntegrator::formTangent(int statFlag)
     // zero the A matrix of the linearSOE
     theSOE->zeroA();
 
-    // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
-
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != nullptr)
-        if (theSOE->addA(elePtr->getTangent(this), elePtr->getID()) < 0) {
-            opserr << "WARNING IncrementalIntegrator::formTangent -";
-            opserr << " failed in addA for ID " << elePtr->getID();            
-            result = -3;
-        }
+    if (this->formElementTangent() < 0)
+        result = -3;
 
     return result;
 }
 
+void
+IncrementalIntegrator::setThreadPool(OpenSees::thread_pool *pool)
+{
+    thePool = pool;
+}
+
 int 
 IncrementalIntegrator::formTangent(int statFlag, double iFact, double cFact)
 {
@@ -116,6 +161,65 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 }
 
 
+int
+IncrementalIntegrator::solveSensitivities(void)
+{
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+    const int numGrads = theDomain->getNumParameters();
+    const int n = theSOE->getNumEqn();
+    if (numGrads == 0)
+      return 0;
+
+    // de-activate all parameters
+    Parameter *theParam;
+    ParameterIter &paramIter = theDomain->getParameters();
+    while ((theParam = paramIter()) != nullptr)
+      theParam->activate(false);
+
+    // the RHS of a parameter is formed while it alone is active, since
+    // the elements and materials keep the active parameter; each is kept
+    // as a column of X for one solve with the factorization of A
+    std::vector<Parameter *> params;
+    params.reserve(numGrads);
+    std::vector<double> X((size_t)n*numGrads);
+
+    paramIter = theDomain->getParameters();
+    while ((theParam = paramIter()) != nullptr) {
+      theParam->activate(true);
+      theSOE->zeroB();
+      this->formSensitivityRHS(theParam->getGradIndex());
+
+      const Vector &B = theSOE->getB();
+      double *col = &X[params.size()*n];
+      for (int i = 0; i < n; i++)
+        col[i] = B(i);
+
+      theParam->activate(false);
+      params.push_back(theParam);
+    }
+
+    int result = theSOE->solveBlock((int)params.size(), X.data());
+    if (result < 0) {
+      opserr << "WARNING IncrementalIntegrator::solveSensitivities() - ";
+      opserr << "the LinearSOE failed in solve\n";
+      return result;
+    }
+
+    // save the displacement sensitivities to the nodes and commit the
+    // history sensitivities, with the parameter active as they were formed
+    for (std::size_t k = 0; k < params.size(); k++) {
+      const int gradIndex = params[k]->getGradIndex();
+      params[k]->activate(true);
+      Vector dU(&X[k*n], n);
+      this->saveSensitivity(dU, gradIndex, numGrads);
+      this->commitSensitivity(gradIndex, numGrads);
+      params[k]->activate(false);
+    }
+
+    return 0;
+}
+
+
 int
 IncrementalIntegrator::getLastResponse(Vector &result, const ID &id)
 {  
@@ -220,21 +324,47 @@ IncrementalIntegrator::formNodalUnbalance(void)
 int 
 IncrementalIntegrator::formElementResidual(void)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::FormUnbalance);
+    if (AnalysisProfile::isEnabled())
+        AnalysisProfile::addElementCalls(AnalysisProfile::FormUnbalance,
+                                         theAnalysisModel->getDomainPtr()->getElementClasses());
+
     // loop through the FE_Elements and add the residual
-    FE_Element *elePtr;
+    int res = 0;
+    if (formByColor(*theAnalysisModel, thePool,
+        [this](FE_Element *theEle) {
+            return theSOE->addB(theEle->getResidual(this), theEle->getID());
+        },
+        [](FE_Element *theEle) {
+            opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+            opserr << " failed in addB for ID " << theEle->getID();
+        }) < 0)
+        res = -2;
 
-    int res = 0;    
+    return res;
+}
 
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != nullptr) {
-        if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) < 0) {
-            opserr << "WARNING IncrementalIntegrator::formElementResidual -";
-            opserr << " failed in addB for ID " << elePtr->getID();
-            res = -2;
-        }
-    }
+int 
+IncrementalIntegrator::formElementTangent(void)
+{
+    AnalysisProfile::Scope scope(AnalysisProfile::FormTangent);
+    if (AnalysisProfile::isEnabled())
+        AnalysisProfile::addElementCalls(AnalysisProfile::FormTangent,
+                                         theAnalysisModel->getDomainPtr()->getElementClasses());
 
-    return res;            
+    // loop through the FE_Elements and add the tangent
+    int res = 0;
+    if (formByColor(*theAnalysisModel, thePool,
+        [this](FE_Element *theEle) {
+            return theSOE->addA(theEle->getTangent(this), *theEle);
+        },
+        [](FE_Element *theEle) {
+            opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+            opserr << " failed in addA for ID " << theEle->getID();
+        }) < 0)
+        res = -2;
+
+    return res;
 }
 
 /*
@@ -40,6 +40,7 @@ class ConvergenceTest;
 class FE_Element;
 class DOF_Group;
 class Vector;
+namespace OpenSees { class thread_pool; }
 
 enum TangentFlag {
  CURRENT_TANGENT               =0,
@@ -79,6 +80,10 @@ class IncrementalIntegrator : public Integrator
 
     virtual double getCFactor();
 
+    // threads used to form and assemble the element contributions;
+    // the pool is not owned, nullptr (the default) assembles serially
+    void setThreadPool(OpenSees::thread_pool *thePool);
+
     virtual const Vector &getVel();
     int doMv(const Vector &v, Vector &res);
 
@@ -103,6 +108,13 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance();
     virtual int  formElementResidual();
+    virtual int  formElementTangent();
+
+    // forms the sensitivity RHS of each parameter of the domain in turn,
+    // solves them together with one LinearSOE::solveBlock() and saves and
+    // commits the sensitivities; the parameter independent part of the
+    // RHS must have been formed
+    int solveSensitivities(void);
 
     LinearSOE       *getLinearSOE() const;
     AnalysisModel   *getAnalysisModel() const;
@@ -126,6 +138,7 @@ class IncrementalIntegrator : public Integrator
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
+    OpenSees::thread_pool *thePool;
 
     // method introduced for domain decomposition
     // This is private here because it should only be called by
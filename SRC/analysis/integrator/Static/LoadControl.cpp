@@ -369,46 +369,8 @@ LoadControl::computeSensitivities(void)
 
 	// Form the part of the RHS which are indepent of parameter
 	this->formIndependentSensitivityRHS();
-	AnalysisModel *theModel = this->getAnalysisModel();  
-	Domain *theDomain=theModel->getDomainPtr();
-	ParameterIter &paramIter = theDomain->getParameters();
-	
-	Parameter *theParam;
-	// De-activate all parameters
-	while ((theParam = paramIter()) != nullptr)
-	  theParam->activate(false);
-	
-	// Now, compute sensitivity wrt each parameter
-	int numGrads = theDomain->getNumParameters();
-	paramIter = theDomain->getParameters();
-	
-	while ((theParam = paramIter()) != nullptr) {
-
-	  // Activate this parameter
-	  theParam->activate(true);
-
-	  // Zero the RHS vector
-	  theSOE->zeroB();
-
-	  // Get the grad index for this parameter
-	  int gradIndex = theParam->getGradIndex();
-
-	  // Form the RHS
-	  this->formSensitivityRHS(gradIndex);
-         
-	  // Solve for displacement sensitivity
-	 
-	  theSOE->solve();
-	  // Save sensitivity to nodes
-	  this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-	 
-	  // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-	  this->commitSensitivity(gradIndex, numGrads);
-	  
-	  // De-activate this parameter for next sensitivity calc
-	  theParam->activate(false);
-	}
 
-	return 0;
+	// Form, solve and save the sensitivity to each parameter
+	return this->solveSensitivities();
 }
 
@@ -37,6 +37,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <math.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -99,13 +100,9 @@ TransientIntegrator::formTangent(int statFlag)
     }    
 
     // loop through the FE_Elements getting them to add the tangent    
-    FE_EleIter &theEles2 = theModel->getFEs();    
-    FE_Element *elePtr;    
-    while((elePtr = theEles2()) != 0) {
-	if (theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
-	    result = -2;
-	}
+    if (this->formElementTangent() < 0) {
+	opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
+	result = -2;
     }
     return result;
 }
@@ -162,3 +159,22 @@ TransientIntegrator::formNodUnbalance(DOF_Group *theDof)
   return 0;
 }    
 
+int
+TransientIntegrator::localError(const Vector &U,
+                                const Vector &accel, const Vector &accelPrev,
+                                double beta, double deltaT,
+                                double &errorNorm, double &dispNorm)
+{
+  if (deltaT == 0.0)
+    return -1;
+
+  double sum = 0.0;
+  for (int i = 0; i < U.Size(); i++) {
+    double da = accel(i) - accelPrev(i);
+    sum += da*da;
+  }
+
+  errorNorm = fabs(beta - 1.0/6.0)*deltaT*deltaT*sqrt(sum);
+  dispNorm  = U.Norm();
+  return 0;
+}
@@ -63,10 +63,27 @@ class TransientIntegrator : public IncrementalIntegrator
 
 
     virtual const Vector& getVel(void) = 0; // For modal damping  
+
+    // an integrator that takes the whole step in newStep(), without
+    // forming or solving a system of equations, returns true; the
+    // analysis then uses neither the algorithm nor the LinearSOE
+    virtual bool isMatrixFree(void) const {return false;}
+
+    // an estimate of the local truncation error in the displacements over
+    // the step that has been solved but not yet committed, and the norm of
+    // the displacements it is relative to; an integrator that cannot give
+    // one returns -1
+    virtual int getLocalError(double &errorNorm, double &dispNorm) {return -1;}
     virtual int initialize(void) {return 0;};
 
 
   protected:
+    // the local error estimate of a Newmark-type step, Zienkiewicz & Xie
+    // (1991): e = |beta - 1/6| dt^2 |a_{n+1} - a_n|
+    static int localError(const Vector &U,
+                          const Vector &accel, const Vector &accelPrev,
+                          double beta, double deltaT,
+                          double &errorNorm, double &dispNorm);
     
   private:
 };
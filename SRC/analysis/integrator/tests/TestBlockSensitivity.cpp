@@ -0,0 +1,248 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file is a driver to test the DDM sensitivities that
+// IncrementalIntegrator::solveSensitivities() solves with one block solve.
+// A braced truss under lateral loads is analyzed with LoadControl, with
+// the areas of three bars and the modulus of a fourth as parameters. The
+// displacement sensitivities computeSensitivities() gives are compared
+// with those of the loop it replaced, which forms, solves and saves one
+// parameter at a time, for the solvers with a block solve and for one
+// without.
+//
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Truss.h>
+#include <ElasticMaterial.h>
+#include <SP_Constraint.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <NodalLoad.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
+#include <Vector.h>
+
+#include <AnalysisModel.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <Linear.h>
+#include <LoadControl.h>
+#include <StaticAnalysis.h>
+
+#include <FullGenLinSOE.h>
+#include <FullGenLinLapackSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+thread_local Element *ops_TheActiveElement = 0;
+
+static const int numBays = 3;
+static const int numStories = 3;
+
+static int
+nodeTag(int i, int j)
+{
+  return 1 + j*(numBays+1) + i;
+}
+
+// a truss braced both ways in each panel, so that it is indeterminate,
+// with a lateral load at each level
+static void
+buildTruss(Domain &theDomain)
+{
+  for (int j = 0; j <= numStories; j++)
+    for (int i = 0; i <= numBays; i++)
+      theDomain.addNode(new Node(nodeTag(i,j), 2, 100.0*i, 80.0*j));
+
+  for (int i = 0; i <= numBays; i++) {
+    theDomain.addSP_Constraint(new SP_Constraint(nodeTag(i,0), 0, 0.0, true));
+    theDomain.addSP_Constraint(new SP_Constraint(nodeTag(i,0), 1, 0.0, true));
+  }
+
+  ElasticMaterial theMaterial(1, 29000.0, 0.0);
+  int tag = 0;
+  for (int j = 0; j < numStories; j++) {
+    for (int i = 0; i <= numBays; i++)
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i,j), nodeTag(i,j+1), theMaterial, 10.0));
+    for (int i = 0; i < numBays; i++) {
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i,j+1), nodeTag(i+1,j+1), theMaterial, 5.0));
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i,j), nodeTag(i+1,j+1), theMaterial, 2.0 + i));
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i+1,j), nodeTag(i,j+1), theMaterial, 3.0));
+    }
+  }
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries());
+  theDomain.addLoadPattern(thePattern);
+  Vector P(2);
+  for (int j = 1; j <= numStories; j++) {
+    P(0) = 10.0*j;
+    P(1) = -5.0;
+    theDomain.addNodalLoad(new NodalLoad(j, nodeTag(0,j), P), 1);
+  }
+
+  const char *area[] = {"A"};
+  const char *modulus[] = {"E"};
+  theDomain.addParameter(new Parameter(1, theDomain.getElement(1), area, 1));
+  theDomain.addParameter(new Parameter(2, theDomain.getElement(6), area, 1));
+  theDomain.addParameter(new Parameter(3, theDomain.getElement(13), area, 1));
+  theDomain.addParameter(new Parameter(4, theDomain.getElement(7), modulus, 1));
+}
+
+// the loop computeSensitivities() had before the block solve
+static int
+solveOneByOne(LoadControl &theIntegrator, LinearSOE &theSOE, Domain &theDomain)
+{
+  const int numGrads = theDomain.getNumParameters();
+
+  Parameter *theParam;
+  ParameterIter &paramIter = theDomain.getParameters();
+  while ((theParam = paramIter()) != nullptr)
+    theParam->activate(false);
+
+  paramIter = theDomain.getParameters();
+  while ((theParam = paramIter()) != nullptr) {
+    const int gradIndex = theParam->getGradIndex();
+    theParam->activate(true);
+    theSOE.zeroB();
+    theIntegrator.formSensitivityRHS(gradIndex);
+    if (theSOE.solve() < 0)
+      return -1;
+    theIntegrator.saveSensitivity(theSOE.getX(), gradIndex, numGrads);
+    theIntegrator.commitSensitivity(gradIndex, numGrads);
+    theParam->activate(false);
+  }
+  return 0;
+}
+
+// the displacement sensitivities of the free nodes to each parameter,
+// with the truss analyzed with the given SOE; empty if the analysis fails
+static std::vector<double>
+sensitivities(const std::function<LinearSOE *()> &newSOE, bool block)
+{
+  std::vector<double> result;
+
+  Domain theDomain;
+  buildTruss(theDomain);
+
+  std::unique_ptr<LinearSOE> theSOE(newSOE());
+  AnalysisModel theModel;
+  PlainHandler theHandler;
+  DOF_Numberer theNumberer(*(new RCM(false)));
+  Linear theAlgorithm;
+  LoadControl theIntegrator(1.0, 1, 1.0, 1.0);
+  StaticAnalysis theAnalysis(theDomain, theHandler, theNumberer, theModel,
+                             theAlgorithm, *theSOE, theIntegrator);
+
+  if (theAnalysis.analyze(1) < 0)
+    return result;
+
+  int ok = block ? theIntegrator.computeSensitivities()
+                 : solveOneByOne(theIntegrator, *theSOE, theDomain);
+  if (ok < 0)
+    return result;
+
+  for (int k = 0; k < theDomain.getNumParameters(); k++)
+    for (int j = 1; j <= numStories; j++)
+      for (int i = 0; i <= numBays; i++)
+        for (int dof = 1; dof <= 2; dof++)
+          result.push_back(theDomain.getNode(nodeTag(i,j))->getDispSensitivity(dof, k));
+
+  return result;
+}
+
+static int numFailed = 0;
+
+static void
+testSolver(const char *name, const std::function<LinearSOE *()> &newSOE)
+{
+  opserr << "TEST: " << name << "\n";
+
+  std::vector<double> block = sensitivities(newSOE, true);
+  std::vector<double> loop  = sensitivities(newSOE, false);
+
+  // each parameter moves the truss, and the two agree
+  const std::size_t numValues = numStories*(numBays+1)*2;
+  bool passed = !block.empty() && block.size() == loop.size();
+  double largest = 0.0, difference = 0.0;
+  for (std::size_t k = 0; passed && k < block.size(); k += numValues) {
+    double largestOfParameter = 0.0;
+    for (std::size_t i = k; i < k + numValues; i++) {
+      largestOfParameter = std::max(largestOfParameter, fabs(loop[i]));
+      difference = std::max(difference, fabs(block[i] - loop[i]));
+    }
+    passed = largestOfParameter > 0.0;
+    largest = std::max(largest, largestOfParameter);
+  }
+  passed = passed && difference <= 1.0e-10*largest;
+
+  if (passed)
+    opserr << "PASS: " << name << " block solve is the parameter loop\n\n";
+  else {
+    opserr << "FAIL: " << name << " block solve is the parameter loop, difference "
+           << difference << " of " << largest << "\n\n";
+    numFailed++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  opserr << " *******************************************************************\n";
+  opserr << "                  block sensitivity unit test\n";
+  opserr << " *******************************************************************\n\n";
+
+  testSolver("FullGeneral", [] {
+    return new FullGenLinSOE(*(new FullGenLinLapackSolver()));
+  });
+  testSolver("BandGeneral", [] {
+    return new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+  });
+  testSolver("BandSPD", [] {
+    return new BandSPDLinSOE(*(new BandSPDLinLapackSolver()));
+  });
+  testSolver("ProfileSPD", [] {
+    return new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+  });
+  testSolver("UmfPack", [] {
+    return new UmfpackGenLinSOE(*(new UmfpackGenLinSolver()));
+  });
+  // no block solve; LinearSOE::solveBlock() solves the columns in turn
+  testSolver("SparseSYM", [] {
+    return new SymSparseLinSOE(*(new SymSparseLinSolver()), 1);
+  });
+
+  if (numFailed == 0)
+    opserr << "PASSED block sensitivity unit test\n";
+  else
+    opserr << "FAILED block sensitivity unit test: " << numFailed << " failures\n";
+
+  return numFailed == 0 ? 0 : 1;
+}
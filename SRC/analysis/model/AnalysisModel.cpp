@@ -38,6 +38,7 @@
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <Node.h>
 #include <NodeIter.h>
@@ -56,7 +57,7 @@
 AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
- myDOFGraph(0), myGroupGraph(0),
+ myDOFGraph(0), myDOFCSRGraph(0), myGroupGraph(0), haveFE_Colors(false),
  numFE_Ele(0), numDOF_Grp(0), numEqn(0)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
@@ -70,7 +71,7 @@ AnalysisModel::AnalysisModel(int theClassTag)
 AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
- myDOFGraph(0), myGroupGraph(0),
+ myDOFGraph(0), myDOFCSRGraph(0), myGroupGraph(0), haveFE_Colors(false),
  numFE_Ele(0), numDOF_Grp(0), numEqn(0)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
@@ -83,7 +84,7 @@ AnalysisModel::AnalysisModel()
 AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &theDofs)
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
- myDOFGraph(0), myGroupGraph(0),
+ myDOFGraph(0), myDOFCSRGraph(0), myGroupGraph(0), haveFE_Colors(false),
  numFE_Ele(0), numDOF_Grp(0), numEqn(0)
 {
   theFEs     = &theFes;
@@ -119,6 +120,9 @@ AnalysisModel::~AnalysisModel()
   if (myDOFGraph != 0) {
     delete myDOFGraph;
   }
+
+  if (myDOFCSRGraph != 0)
+    delete myDOFCSRGraph;
 }    
 
 void
@@ -201,6 +205,9 @@ AnalysisModel::clearAll(void)
     if (myDOFGraph != 0)
         delete myDOFGraph;
 
+    if (myDOFCSRGraph != 0)
+        delete myDOFCSRGraph;
+
     if (myGroupGraph != 0)
         delete myGroupGraph;    
 
@@ -208,7 +215,10 @@ AnalysisModel::clearAll(void)
     theDOFs->clearAll();
 
     myDOFGraph = 0;
+    myDOFCSRGraph = 0;
     myGroupGraph = 0;
+    myFE_Colors.clear();
+    haveFE_Colors = false;
     
     numFE_Ele =0;
     numDOF_Grp = 0;
@@ -221,7 +231,11 @@ AnalysisModel::clearDOFGraph(void)
   if (myDOFGraph != nullptr)
     delete myDOFGraph;
 
+  if (myDOFCSRGraph != nullptr)
+    delete myDOFCSRGraph;
+
   myDOFGraph = nullptr;
+  myDOFCSRGraph = nullptr;
 }
 
 void
@@ -273,6 +287,10 @@ void
 AnalysisModel::setNumEqn(int theNumEqn)
 {
     numEqn = theNumEqn;
+
+    // a renumbering invalidates the element colouring
+    myFE_Colors.clear();
+    haveFE_Colors = false;
 }
 
 int 
@@ -282,72 +300,43 @@ AnalysisModel::getNumEqn(void) const
 }
 
 
-Graph &
-AnalysisModel::getDOFGraph(void)
+const CSRGraph &
+AnalysisModel::getDOFCSRGraph(void)
 {
-  if (myDOFGraph == 0) {
-    // int numVertex = this->getNumDOF_Groups();
-    //    myDOFGraph = new Graph(numVertex);
-    MapOfTaggedObjects *graphStorage = new MapOfTaggedObjects();
-    myDOFGraph = new Graph(*graphStorage);
+  if (myDOFCSRGraph == nullptr) {
+    myDOFCSRGraph = new CSRGraph();
 
-    //
-    // create a vertex for each dof
-    //
-    
-    DOF_Group *dofPtr =0;
+    // a vertex for each equation number of the DOF_Groups
+    int numVertex = 0;
+    DOF_Group *dofPtr;
     DOF_GrpIter &theDOFs = this->getDOFs();
-    while ((dofPtr = theDOFs()) != 0) {
+    while ((dofPtr = theDOFs()) != nullptr) {
       const ID &id = dofPtr->getID();
-      int size = id.Size();
-      for (int i=0; i<size; i++) {
-        int dofTag = id(i);
-        if (dofTag >= START_EQN_NUM) {
-          Vertex *vertexPtr = myDOFGraph->getVertexPtr(dofTag);
-          if (vertexPtr == 0) {
-            Vertex *vertexPtr = new Vertex(dofTag, dofTag);      
-            if (vertexPtr == 0) {
-              opserr << "WARNING AnalysisModel::getDOFGraph";
-              opserr << " - Not Enough Memory to create " << i+1 << "th Vertex\n";
-              return *myDOFGraph;
-            }
-            if (myDOFGraph->addVertex(vertexPtr, false) == false) {
-              opserr << "WARNING AnalysisModel::getDOFGraph - error adding vertex\n";
-              return *myDOFGraph;
-            }
-          }
-        }
-      }
+      for (int i=0; i<id.Size(); i++)
+        if (id(i) >= START_EQN_NUM && id(i)-START_EQN_NUM+1 > numVertex)
+          numVertex = id(i)-START_EQN_NUM+1;
     }
-    
-    // now add the edges, by looping over the FE_elements, getting their
-    // IDs and adding edges between DOFs for equation numbers >= START_EQN_NUM
-    
-    FE_Element *elePtr =0;
+
+    // and an edge between each two equations of an FE_Element
+    std::vector<const ID *> eleIDs;
+    eleIDs.reserve(numFE_Ele);
+    FE_Element *elePtr;
     FE_EleIter &eleIter = this->getFEs();
-    int cnt = 0;
-    
-    myDOFGraph->startAddEdge();
-    while((elePtr = eleIter()) != 0) {
-      const ID &id = elePtr->getID();
-      cnt++;
-      int size = id.Size();
-      for (int i=0; i<size; i++) {
-        int eqn1 = id(i);
-        
-        // if eqnNum of DOF is a valid eqn number add an edge
-        // to all other DOFs with valid eqn numbers.
-        if (eqn1 >=START_EQN_NUM) {
-          for (int j=i+1; j<size; j++) {
-            int eqn2 = id(j);
-            if (eqn2 >=START_EQN_NUM)
-              myDOFGraph->addEdgeFast(eqn1-START_EQN_NUM+START_VERTEX_NUM,
-                                  eqn2-START_EQN_NUM+START_VERTEX_NUM);
-          }
-        }
-      }
-    }
-  }    
+    while ((elePtr = eleIter()) != nullptr)
+      eleIDs.push_back(&elePtr->getID());
+
+    myDOFCSRGraph->build(numVertex, eleIDs);
+  }
+
+  return *myDOFCSRGraph;
+}
+
+
+Graph &
+AnalysisModel::getDOFGraph(void)
+{
+  if (myDOFGraph == nullptr)
+    myDOFGraph = new Graph(this->getDOFCSRGraph());
 
   return *myDOFGraph;
 }
@@ -369,6 +358,7 @@ AnalysisModel::getDOFGroupGraph(void)
     DOF_Group   *dofPtr;
     DOF_GrpIter &dofIter2 = this->getDOFs();
     // int count = START_VERTEX_NUM;
+    bool tagsInRange = true;
     while ((dofPtr = dofIter2()) != 0) {
         int DOF_GroupTag = dofPtr->getTag();
         int DOF_GroupNodeTag = dofPtr->getNodeTag();
@@ -376,6 +366,8 @@ AnalysisModel::getDOFGroupGraph(void)
         Vertex *vertexPtr = new Vertex(DOF_GroupTag, DOF_GroupNodeTag, 0, numDOF);
 
         myGroupGraph->addVertex(vertexPtr);
+        if (DOF_GroupTag < 0 || DOF_GroupTag >= numDOF_Grp)
+            tagsInRange = false;
     }
 
     // now add the edges, by looping over the Elements, getting their
@@ -384,6 +376,19 @@ AnalysisModel::getDOFGroupGraph(void)
     FE_Element *elePtr;
     FE_EleIter &eleIter = this->getFEs();
 
+    if (tagsInRange) {
+        // the adjacency of each vertex is formed in one go, in order
+        std::vector<const ID *> eleTags;
+        eleTags.reserve(numFE_Ele);
+        while ((elePtr = eleIter()) != 0)
+            eleTags.push_back(&elePtr->getDOFtags());
+
+        CSRGraph theEdges;
+        theEdges.build(numDOF_Grp, eleTags);
+        myGroupGraph->setEdges(theEdges);
+        return *myGroupGraph;
+    }
+
     while((elePtr = eleIter()) != 0) {
         const ID &id = elePtr->getDOFtags();
         int size = id.Size();
@@ -402,6 +407,59 @@ AnalysisModel::getDOFGroupGraph(void)
 }
 
 
+const std::vector<std::vector<FE_Element *>> &
+AnalysisModel::getFE_Colors(void)
+{
+  if (haveFE_Colors)
+    return myFE_Colors;
+
+  myFE_Colors.clear();
+
+  //
+  // greedy colouring in the order of the FE_Element storage; an element
+  // takes the lowest colour not yet used by any element sharing one of
+  // its equations, so the result depends only on the model
+  //
+  std::vector<std::vector<int>> eqnColors(numEqn);
+  std::vector<int> mark;
+  int stamp = 0;
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = this->getFEs();
+  while ((elePtr = theEles()) != nullptr) {
+    const ID &id = elePtr->getID();
+    const int size = id.Size();
+
+    stamp++;
+    for (int i=0; i<size; i++) {
+      int eqn = id(i);
+      if (eqn >= 0 && eqn < numEqn)
+        for (int color : eqnColors[eqn])
+          mark[color] = stamp;
+    }
+
+    int color = 0;
+    while (color < (int)mark.size() && mark[color] == stamp)
+      color++;
+
+    if (color == (int)myFE_Colors.size()) {
+      myFE_Colors.emplace_back();
+      mark.push_back(0);
+    }
+    myFE_Colors[color].push_back(elePtr);
+
+    for (int i=0; i<size; i++) {
+      int eqn = id(i);
+      if (eqn >= 0 && eqn < numEqn)
+        eqnColors[eqn].push_back(color);
+    }
+  }
+
+  haveFE_Colors = true;
+  return myFE_Colors;
+}
+
+
 
 
 void 
@@ -33,6 +33,7 @@
 #define AnalysisModel_h
 
 #include <MovableObject.h>
+#include <vector>
 #define VIRTUAL
 
 class TaggedObjectStorage;
@@ -40,6 +41,7 @@ class Domain;
 class FE_EleIter;
 class DOF_GrpIter;
 class Graph;
+class CSRGraph;
 class FE_Element;
 class DOF_Group;
 class Vector;
@@ -71,8 +73,13 @@ class AnalysisModel: public MovableObject
     // method to access the connectivity for SysOfEqn to size itself
     VIRTUAL void   setNumEqn(int) ;	
     VIRTUAL int    getNumEqn(void) const ; 
+    VIRTUAL const CSRGraph &getDOFCSRGraph(void);
     VIRTUAL Graph &getDOFGraph(void);
     VIRTUAL Graph &getDOFGroupGraph(void);
+
+    // partition of the FE_Elements into groups (colours) whose members
+    // share no equation, used to assemble the SOE from multiple threads
+    VIRTUAL const std::vector<std::vector<FE_Element *>> &getFE_Colors(void);
     
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new nodal trial response quantities.
@@ -124,7 +131,10 @@ class AnalysisModel: public MovableObject
     ConstraintHandler *myHandler;
 
     Graph *myDOFGraph;
+    CSRGraph *myDOFCSRGraph;
     Graph *myGroupGraph;    
+    std::vector<std::vector<FE_Element *>> myFE_Colors;
+    bool haveFE_Colors;
     
     int numFE_Ele;             // number of FE_Elements objects added
     int numDOF_Grp;            // number of DOF_Group objects added
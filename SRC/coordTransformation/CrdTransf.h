@@ -77,6 +77,10 @@ public:
     virtual int revertToLastCommit() = 0;
     virtual int revertToStart() = 0;
 
+    // true if distinct instances may be updated and asked for their basic
+    // and global quantities from several threads at once
+    virtual bool isThreadSafe() const {return false;}
+
     virtual const Vector &getBasicTrialDisp() = 0;
     virtual const Vector &getBasicIncrDisp() = 0;
     virtual const Vector &getBasicIncrDeltaDisp() = 0;
@@ -30,7 +30,7 @@ using OpenSees::Matrix3D;
 using OpenSees::MatrixND;
 
 // initialize static variables
-Matrix LinearFrameTransf3d::kg(12, 12);
+thread_local Matrix LinearFrameTransf3d::kg(12, 12);
 
 
 static inline void 
@@ -210,9 +210,9 @@ LinearFrameTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
   if ((error = this->computeElemtLengthAndOrient()))
     return error;
 
-  static Vector XAxis(3);
-  static Vector YAxis(3);
-  static Vector ZAxis(3);
+  thread_local Vector XAxis(3);
+  thread_local Vector YAxis(3);
+  thread_local Vector ZAxis(3);
 
   // fill 3by3 rotation matrix, R
   if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -231,7 +231,7 @@ int
 LinearFrameTransf3d::computeElemtLengthAndOrient()
 {
   // element projection
-  static Vector dx(3);
+  thread_local Vector dx(3);
 
   const Vector &ndICoords = nodeIPtr->getCrds();
   const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -305,12 +305,12 @@ LinearFrameTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
   // Compute y = v cross x
   // Note: v(i) is stored in R[2][i]
-  static Vector vAxis(3);
+  thread_local Vector vAxis(3);
   vAxis(0) = R[2][0];
   vAxis(1) = R[2][1];
   vAxis(2) = R[2][2];
 
-  static Vector xAxis(3);
+  thread_local Vector xAxis(3);
   xAxis(0) = R[0][0];
   xAxis(1) = R[0][1];
   xAxis(2) = R[0][2];
@@ -318,7 +318,7 @@ LinearFrameTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
   XAxis(1) = xAxis(1);
   XAxis(2) = xAxis(2);
 
-  static Vector yAxis(3);
+  thread_local Vector yAxis(3);
   yAxis(0) = vAxis(1) * xAxis(2) - vAxis(2) * xAxis(1);
   yAxis(1) = vAxis(2) * xAxis(0) - vAxis(0) * xAxis(2);
   yAxis(2) = vAxis(0) * xAxis(1) - vAxis(1) * xAxis(0);
@@ -338,7 +338,7 @@ LinearFrameTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
   YAxis(2) = yAxis(2);
 
   // Compute z = x cross y
-  static Vector zAxis(3);
+  thread_local Vector zAxis(3);
 
   zAxis(0) = xAxis(1) * yAxis(2) - xAxis(2) * yAxis(1);
   zAxis(1) = xAxis(2) * yAxis(0) - xAxis(0) * yAxis(2);
@@ -377,7 +377,7 @@ static inline VectorND<6>
 getBasic(double ug[12], double R[3][3], double nodeIOffset[], double nodeJOffset[], double oneOverL)
 {
   VectorND<6> ub;
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -437,7 +437,7 @@ LinearFrameTransf3d::getBasicTrialDisp()
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -455,8 +455,8 @@ LinearFrameTransf3d::getBasicTrialDisp()
 
   double oneOverL = 1.0 / L;
 
-  static VectorND<6> ub;
-  static Vector wrapper(ub);
+  thread_local VectorND<6> ub;
+  thread_local Vector wrapper(ub);
 
   ub = getBasic(ug, R, nodeIOffset, nodeJOffset, oneOverL);
   return wrapper;
@@ -469,7 +469,7 @@ LinearFrameTransf3d::getBasicIncrDisp()
   const Vector &disp1 = nodeIPtr->getIncrDisp();
   const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -477,8 +477,8 @@ LinearFrameTransf3d::getBasicIncrDisp()
 
   double oneOverL = 1.0 / L;
 
-  static VectorND<6> ub;
-  static Vector wrapper(ub);
+  thread_local VectorND<6> ub;
+  thread_local Vector wrapper(ub);
 
   ub = getBasic(ug, R, nodeIOffset, nodeJOffset, oneOverL);
 
@@ -492,7 +492,7 @@ LinearFrameTransf3d::getBasicIncrDeltaDisp()
   const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
   const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -500,8 +500,8 @@ LinearFrameTransf3d::getBasicIncrDeltaDisp()
 
   double oneOverL = 1.0 / L;
 
-  static VectorND<6> ub;
-  static Vector wrapper(ub);
+  thread_local VectorND<6> ub;
+  thread_local Vector wrapper(ub);
 
   ub = getBasic(ug, R, nodeIOffset, nodeJOffset, oneOverL);
   return wrapper;
@@ -518,7 +518,7 @@ LinearFrameTransf3d::getBasicTrialVel()
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[12];
+  thread_local double vg[12];
   for (int i = 0; i < 6; i++) {
     vg[i]     = vel1(i);
     vg[i + 6] = vel2(i);
@@ -526,8 +526,8 @@ LinearFrameTransf3d::getBasicTrialVel()
 
   double oneOverL = 1.0 / L;
 
-  static VectorND<6> ub;
-  static Vector wrapper(ub);
+  thread_local VectorND<6> ub;
+  thread_local Vector wrapper(ub);
   ub = getBasic(vg, R, nodeIOffset, nodeJOffset, oneOverL);
   return wrapper;
 }
@@ -539,7 +539,7 @@ LinearFrameTransf3d::getBasicTrialAccel()
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[12];
+  thread_local double ag[12];
   for (int i = 0; i < 6; i++) {
     ag[i]     = accel1(i);
     ag[i + 6] = accel2(i);
@@ -547,8 +547,8 @@ LinearFrameTransf3d::getBasicTrialAccel()
 
   double oneOverL = 1.0 / L;
 
-  static VectorND<6> ub;
-  static Vector wrapper(ub);
+  thread_local VectorND<6> ub;
+  thread_local Vector wrapper(ub);
   ub = getBasic(ag, R, nodeIOffset, nodeJOffset, oneOverL);
   return wrapper;
 
@@ -612,7 +612,7 @@ LinearFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
 
   MatrixND<12,12> kg;
 #if 0
-  static double RWI[3][3];
+  thread_local double RWI[3][3];
 
   if (nodeIOffset) {
     // Compute RWI
@@ -629,7 +629,7 @@ LinearFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
     RWI[2][2] = -R[2][0] * nodeIOffset[1] + R[2][1] * nodeIOffset[0];
   }
 
-  static double RWJ[3][3];
+  thread_local double RWJ[3][3];
 
   if (nodeJOffset) {
     // Compute RWJ
@@ -649,7 +649,7 @@ LinearFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
 
   // Transform local stiffness to global system
   // First compute kl*T_{lg}
-  static double tmp[12][12];  // Temporary storage
+  thread_local double tmp[12][12];  // Temporary storage
   for (int m = 0; m < 12; m++) {
     tmp[m][0] = kl(m, 0) * R[0][0] + kl(m, 1) * R[1][0] + kl(m, 2) * R[2][0];
     tmp[m][1] = kl(m, 0) * R[0][1] + kl(m, 1) * R[1][1] + kl(m, 2) * R[2][1];
@@ -720,7 +720,7 @@ const Vector &
 LinearFrameTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static VectorND<12> pl;
+  thread_local VectorND<12> pl;
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -751,8 +751,8 @@ LinearFrameTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
   pl[2] += p0[3];
   pl[8] += p0[4];
 
-  static VectorND<12> pg;
-  static Vector wrapper(pg);
+  thread_local VectorND<12> pg;
+  thread_local Vector wrapper(pg);
 
   pg  = pushResponse(pl);
 
@@ -763,9 +763,9 @@ LinearFrameTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 LinearFrameTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-  static double kb[6][6];     // Basic stiffness
-  static MatrixND<12,12> kl;  // Local stiffness
-  static double tmp[12][12];  // Temporary storage
+  thread_local double kb[6][6];     // Basic stiffness
+  thread_local MatrixND<12,12> kl;  // Local stiffness
+  thread_local double tmp[12][12];  // Temporary storage
   const  double oneOverL = 1.0 / L;
 
   for (int i = 0; i < 6; i++)
@@ -806,8 +806,8 @@ LinearFrameTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
   }
 
 
-  static MatrixND<12,12> Kg;
-  static Matrix wrapper(Kg);
+  thread_local MatrixND<12,12> Kg;
+  thread_local Matrix wrapper(Kg);
   Kg = pushConstant(kl);
   return wrapper;
 
@@ -816,9 +816,9 @@ LinearFrameTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 const Matrix &
 LinearFrameTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-  static double kb[6][6];     // Basic stiffness
-  static MatrixND<12,12> kl;  // Local stiffness
-  static double tmp[12][12];  // Temporary storage
+  thread_local double kb[6][6];     // Basic stiffness
+  thread_local MatrixND<12,12> kl;  // Local stiffness
+  thread_local double tmp[12][12];  // Temporary storage
   double oneOverL = 1.0 / L;
 
   for (int i = 0; i < 6; i++)
@@ -858,8 +858,8 @@ LinearFrameTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
     kl(11, i) = tmp[2][i];
   }
 
-  static MatrixND<12,12> kg;
-  static Matrix M(kg);
+  thread_local MatrixND<12,12> kg;
+  thread_local Matrix M(kg);
 
   kg = pushConstant(kl);
 
@@ -873,7 +873,7 @@ LinearFrameTransf3d::getCopy()
 
   LinearFrameTransf3d *theCopy = nullptr;
 
-  static Vector xz(3);
+  thread_local Vector xz(3);
   xz(0) = R[2][0];
   xz(1) = R[2][1];
   xz(2) = R[2][2];
@@ -910,7 +910,7 @@ LinearFrameTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(23);
+  thread_local Vector data(23);
   data(0) = this->getTag();
   data(1) = L;
 
@@ -986,7 +986,7 @@ LinearFrameTransf3d::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(23);
+  thread_local Vector data(23);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -1075,7 +1075,7 @@ LinearFrameTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 LinearFrameTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-  static Vector xg(3);
+  thread_local Vector xg(3);
 
   //xg = nodeIPtr->getCrds() + nodeIOffset;
   xg = nodeIPtr->getCrds();
@@ -1108,7 +1108,7 @@ LinearFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -1128,7 +1128,7 @@ LinearFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   // transform global end displacements to local coordinates
   //  ul = Tlg *  ug;
 
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -1137,7 +1137,7 @@ LinearFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   ul[7] = R[1][0] * ug[6] + R[1][1] * ug[7] + R[1][2] * ug[8];
   ul[8] = R[2][0] * ug[6] + R[2][1] * ug[7] + R[2][2] * ug[8];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] =  nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -1158,8 +1158,8 @@ LinearFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static double uxl[3];
-  static Vector uxg(3);
+  thread_local double uxl[3];
+  thread_local Vector uxg(3);
 
   uxl[0] = uxb(0) + ul[0];
   uxl[1] = uxb(1) + (1 - xi) * ul[1] + xi * ul[7];
@@ -1182,7 +1182,7 @@ LinearFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -1203,7 +1203,7 @@ LinearFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   //  ul = Tlg * ug;
   //
 
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -1212,7 +1212,7 @@ LinearFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   ul[7] = R[1][0] * ug[6] + R[1][1] * ug[7] + R[1][2] * ug[8];
   ul[8] = R[2][0] * ug[6] + R[2][1] * ug[7] + R[2][2] * ug[8];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -1233,7 +1233,7 @@ LinearFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static Vector uxl(3);
+  thread_local Vector uxl(3);
 
   uxl(0) = uxb(0) + ul[0];
   uxl(1) = uxb(1) + (1 - xi) * ul[1] + xi * ul[7];
@@ -1277,7 +1277,7 @@ const Vector &
 LinearFrameTransf3d::getBasicDisplSensitivity(int gradNumber)
 {
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = nodeIPtr->getDispSensitivity((i + 1), gradNumber);
     ug[i + 6] = nodeJPtr->getDispSensitivity((i + 1), gradNumber);
@@ -1285,9 +1285,9 @@ LinearFrameTransf3d::getBasicDisplSensitivity(int gradNumber)
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  thread_local Vector ub(6);
 
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -1305,7 +1305,7 @@ LinearFrameTransf3d::getBasicDisplSensitivity(int gradNumber)
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
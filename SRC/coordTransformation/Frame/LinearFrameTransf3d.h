@@ -44,6 +44,7 @@ public:
     virtual int commitState() override final;
     virtual int revertToLastCommit() override final;
     virtual int revertToStart() override final;
+    virtual bool isThreadSafe() const override final {return true;}
     
     virtual const Vector &getBasicTrialDisp() override;
     virtual const Vector &getBasicIncrDisp();
@@ -125,7 +126,7 @@ private:
     double L;        // undeformed element length
 
 //  static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
+    static thread_local Matrix kg;  // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
@@ -25,7 +25,6 @@
 
 using OpenSees::Matrix3D;
 
-#define THREAD_LOCAL static
 
 // constructor:
 PDeltaFrameTransf3d::PDeltaFrameTransf3d(int tag, const Vector &vecInLocXZPlane)
@@ -167,9 +166,9 @@ PDeltaFrameTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
   if ((error = this->computeElemtLengthAndOrient()))
     return error;
 
-  static Vector XAxis(3);
-  static Vector YAxis(3);
-  static Vector ZAxis(3);
+  thread_local Vector XAxis(3);
+  thread_local Vector YAxis(3);
+  thread_local Vector ZAxis(3);
 
   // get 3by3 rotation matrix
   if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -184,7 +183,7 @@ PDeltaFrameTransf3d::update()
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -207,7 +206,7 @@ PDeltaFrameTransf3d::update()
   double ul7 = R[1][0] * ug[6] + R[1][1] * ug[7] + R[1][2] * ug[8];
   double ul8 = R[2][0] * ug[6] + R[2][1] * ug[7] + R[2][2] * ug[8];
 
-  static double Wu[3];
+  thread_local double Wu[3];
 
   if (nodeIOffset) {
     Wu[0] =  nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
@@ -237,7 +236,7 @@ int
 PDeltaFrameTransf3d::computeElemtLengthAndOrient()
 {
   // element projection
-  static Vector dx(3);
+  thread_local Vector dx(3);
 
   const Vector &ndICoords = nodeIPtr->getCrds();
   const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -309,12 +308,12 @@ PDeltaFrameTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
   // Compute y = v cross x
   // Note: v(i) is stored in R[2][i]
-  static Vector vAxis(3);
+  thread_local Vector vAxis(3);
   vAxis(0) = R[2][0];
   vAxis(1) = R[2][1];
   vAxis(2) = R[2][2];
 
-  static Vector xAxis(3);
+  thread_local Vector xAxis(3);
   xAxis(0) = R[0][0];
   xAxis(1) = R[0][1];
   xAxis(2) = R[0][2];
@@ -322,7 +321,7 @@ PDeltaFrameTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
   XAxis(1) = xAxis(1);
   XAxis(2) = xAxis(2);
 
-  static Vector yAxis(3);
+  thread_local Vector yAxis(3);
 
   yAxis(0) = vAxis(1) * xAxis(2) - vAxis(2) * xAxis(1);
   yAxis(1) = vAxis(2) * xAxis(0) - vAxis(0) * xAxis(2);
@@ -343,7 +342,7 @@ PDeltaFrameTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
   YAxis(2) = yAxis(2);
 
   // Compute z = x cross y
-  static Vector zAxis(3);
+  thread_local Vector zAxis(3);
 
   zAxis(0) = xAxis(1) * yAxis(2) - xAxis(2) * yAxis(1);
   zAxis(1) = xAxis(2) * yAxis(0) - xAxis(0) * yAxis(2);
@@ -383,7 +382,7 @@ PDeltaFrameTransf3d::getBasicTrialDisp()
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -401,9 +400,9 @@ PDeltaFrameTransf3d::getBasicTrialDisp()
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  thread_local Vector ub(6);
 
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -421,7 +420,7 @@ PDeltaFrameTransf3d::getBasicTrialDisp()
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -462,7 +461,7 @@ PDeltaFrameTransf3d::getBasicIncrDisp()
   const Vector &disp1 = nodeIPtr->getIncrDisp();
   const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -470,9 +469,9 @@ PDeltaFrameTransf3d::getBasicIncrDisp()
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  thread_local Vector ub(6);
 
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -490,7 +489,7 @@ PDeltaFrameTransf3d::getBasicIncrDisp()
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -531,7 +530,7 @@ PDeltaFrameTransf3d::getBasicIncrDeltaDisp()
   const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
   const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -539,9 +538,9 @@ PDeltaFrameTransf3d::getBasicIncrDeltaDisp()
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  thread_local Vector ub(6);
 
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -559,7 +558,7 @@ PDeltaFrameTransf3d::getBasicIncrDeltaDisp()
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -600,7 +599,7 @@ PDeltaFrameTransf3d::getBasicTrialVel()
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[12];
+  thread_local double vg[12];
   for (int i = 0; i < 6; i++) {
     vg[i]     = vel1(i);
     vg[i + 6] = vel2(i);
@@ -608,9 +607,9 @@ PDeltaFrameTransf3d::getBasicTrialVel()
 
   double oneOverL = 1.0 / L;
 
-  static Vector vb(6);
+  thread_local Vector vb(6);
 
-  static double vl[12];
+  thread_local double vl[12];
 
   vl[0] = R[0][0] * vg[0] + R[0][1] * vg[1] + R[0][2] * vg[2];
   vl[1] = R[1][0] * vg[0] + R[1][1] * vg[1] + R[1][2] * vg[2];
@@ -628,7 +627,7 @@ PDeltaFrameTransf3d::getBasicTrialVel()
   vl[10] = R[1][0] * vg[9] + R[1][1] * vg[10] + R[1][2] * vg[11];
   vl[11] = R[2][0] * vg[9] + R[2][1] * vg[10] + R[2][2] * vg[11];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * vg[4] - nodeIOffset[1] * vg[5];
     Wu[1] = -nodeIOffset[2] * vg[3] + nodeIOffset[0] * vg[5];
@@ -669,7 +668,7 @@ PDeltaFrameTransf3d::getBasicTrialAccel()
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[12];
+  thread_local double ag[12];
   for (int i = 0; i < 6; i++) {
     ag[i]     = accel1(i);
     ag[i + 6] = accel2(i);
@@ -677,9 +676,9 @@ PDeltaFrameTransf3d::getBasicTrialAccel()
 
   double oneOverL = 1.0 / L;
 
-  static Vector ab(6);
+  thread_local Vector ab(6);
 
-  static double al[12];
+  thread_local double al[12];
 
   al[0] = R[0][0] * ag[0] + R[0][1] * ag[1] + R[0][2] * ag[2];
   al[1] = R[1][0] * ag[0] + R[1][1] * ag[1] + R[1][2] * ag[2];
@@ -697,7 +696,7 @@ PDeltaFrameTransf3d::getBasicTrialAccel()
   al[10] = R[1][0] * ag[9] + R[1][1] * ag[10] + R[1][2] * ag[11];
   al[11] = R[2][0] * ag[9] + R[2][1] * ag[10] + R[2][2] * ag[11];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ag[4] - nodeIOffset[1] * ag[5];
     Wu[1] = -nodeIOffset[2] * ag[3] + nodeIOffset[0] * ag[5];
@@ -735,7 +734,7 @@ const Vector &
 PDeltaFrameTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static VectorND<12> pl;
+  thread_local VectorND<12> pl;
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -759,7 +758,7 @@ PDeltaFrameTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
   pl[10] = q4;
   pl[11] = q2;
 
-  static VectorND<12> pg;
+  thread_local VectorND<12> pg;
   pg  = pushResponse(pl);
 
   pl.zero();
@@ -771,7 +770,7 @@ PDeltaFrameTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 
   pg += pushConstant(pl);
   
-  static Vector wrapper(pg);
+  thread_local Vector wrapper(pg);
   return wrapper;
 }
 
@@ -839,9 +838,9 @@ PDeltaFrameTransf3d::pushConstant(const VectorND<12>&pl) const
 const Matrix &
 PDeltaFrameTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-  static double kb[6][6];     // Basic stiffness
-  static MatrixND<12,12> kl;  // Local stiffness
-  static double tmp[12][12];  // Temporary storage
+  thread_local double kb[6][6];     // Basic stiffness
+  thread_local MatrixND<12,12> kl;  // Local stiffness
+  thread_local double tmp[12][12];  // Temporary storage
   double oneOverL = 1.0 / L;
 
   for (int i = 0; i < 6; i++)
@@ -889,10 +888,10 @@ PDeltaFrameTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
      0, 0, 0, 0, 0, 0, pb[0], 0
   };
 
-  static MatrixND<12,12> Kg;
+  thread_local MatrixND<12,12> Kg;
   Kg = pushResponse(kl, pl);
 
-  static Matrix Wrapper(Kg);
+  thread_local Matrix Wrapper(Kg);
   return Wrapper;
 }
 
@@ -921,7 +920,7 @@ PDeltaFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
 
   MatrixND<12,12> kg;
 
-  static double RWI[3][3];
+  thread_local double RWI[3][3];
 
   if (nodeIOffset) {
     // Compute RWI
@@ -938,7 +937,7 @@ PDeltaFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
     RWI[2][2] = -R[2][0] * nodeIOffset[1] + R[2][1] * nodeIOffset[0];
   }
 
-  THREAD_LOCAL double RWJ[3][3];
+  thread_local double RWJ[3][3];
 
   if (nodeJOffset) {
     // Compute RWJ
@@ -957,7 +956,7 @@ PDeltaFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
 
   // Transform local stiffness to global system
   // First compute kl*T_{lg}
-  THREAD_LOCAL double tmp[12][12];  // Temporary storage
+  thread_local double tmp[12][12];  // Temporary storage
   for (int m = 0; m < 12; m++) {
     tmp[m][0] = kl(m, 0) * R[0][0] + kl(m, 1) * R[1][0] + kl(m, 2) * R[2][0];
     tmp[m][1] = kl(m, 0) * R[0][1] + kl(m, 1) * R[1][1] + kl(m, 2) * R[2][1];
@@ -1025,9 +1024,9 @@ PDeltaFrameTransf3d::pushConstant(const MatrixND<12,12>& kl)
 const Matrix &
 PDeltaFrameTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-  static double kb[6][6];     // Basic stiffness
-  static MatrixND<12,12> kl;  // Local stiffness
-  static double tmp[12][12];  // Temporary storage
+  thread_local double kb[6][6];     // Basic stiffness
+  thread_local MatrixND<12,12> kl;  // Local stiffness
+  thread_local double tmp[12][12];  // Temporary storage
   double oneOverL = 1.0 / L;
 
   int i, j;
@@ -1068,8 +1067,8 @@ PDeltaFrameTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
     kl(11, i) =  tmp[2][i];
   }
 
-  static MatrixND<12,12> kg;
-  static Matrix Wrapper(kg);
+  thread_local MatrixND<12,12> kg;
+  thread_local Matrix Wrapper(kg);
 
   kg = pushConstant(kl);
 
@@ -1084,7 +1083,7 @@ PDeltaFrameTransf3d::getCopy()
 
   PDeltaFrameTransf3d *theCopy;
 
-  static Vector xz(3);
+  thread_local Vector xz(3);
   xz(0) = R[2][0];
   xz(1) = R[2][1];
   xz(2) = R[2][2];
@@ -1123,7 +1122,7 @@ PDeltaFrameTransf3d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(23);
+  thread_local Vector data(23);
   data(0) = this->getTag();
   data(1) = L;
 
@@ -1198,7 +1197,7 @@ PDeltaFrameTransf3d::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(23);
+  thread_local Vector data(23);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -1271,8 +1270,8 @@ PDeltaFrameTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 //this->compTransfMatrixLocalGlobal(Tlg);
 //kg.addMatrixTripleProduct(0.0, Tlg, ml, 1.0);
 
-  THREAD_LOCAL MatrixND<12,12> kg;
-  THREAD_LOCAL Matrix wrapper(kg);
+  thread_local MatrixND<12,12> kg;
+  thread_local Matrix wrapper(kg);
   blk3x12x3(Rm, ml, kg);
 
   return wrapper;
@@ -1281,7 +1280,7 @@ PDeltaFrameTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 PDeltaFrameTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-  static Vector xg(3);
+  thread_local Vector xg(3);
 
   //xg = nodeIPtr->getCrds() + nodeIOffset;
   xg = nodeIPtr->getCrds();
@@ -1307,7 +1306,7 @@ PDeltaFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -1325,7 +1324,7 @@ PDeltaFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 
   // transform global end displacements to local coordinates
   //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -1334,7 +1333,7 @@ PDeltaFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   ul[7] = R[1][0] * ug[6] + R[1][1] * ug[7] + R[1][2] * ug[8];
   ul[8] = R[2][0] * ug[6] + R[2][1] * ug[7] + R[2][2] * ug[8];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -1355,8 +1354,8 @@ PDeltaFrameTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static double uxl[3];
-  static Vector uxg(3);
+  thread_local double uxl[3];
+  thread_local Vector uxg(3);
 
   uxl[0] = uxb(0) + ul[0];
   uxl[1] = uxb(1) + (1 - xi) * ul[1] + xi * ul[7];
@@ -1379,7 +1378,7 @@ PDeltaFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -1397,7 +1396,7 @@ PDeltaFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
 
   // transform global end displacements to local coordinates
   //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-  static double ul[12];
+  thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -1406,7 +1405,7 @@ PDeltaFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   ul[7] = R[1][0] * ug[6] + R[1][1] * ug[7] + R[1][2] * ug[8];
   ul[8] = R[2][0] * ug[6] + R[2][1] * ug[7] + R[2][2] * ug[8];
 
-  static double Wu[3];
+  thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -1427,7 +1426,7 @@ PDeltaFrameTransf3d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static Vector uxl(3);
+  thread_local Vector uxl(3);
 
   uxl(0) = uxb(0) + ul[0];
   uxl(1) = uxb(1) + (1 - xi) * ul[1] + xi * ul[7];
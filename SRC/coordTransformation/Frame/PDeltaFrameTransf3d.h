@@ -40,6 +40,7 @@ public:
     virtual int commitState();
     virtual int revertToLastCommit();        
     virtual int revertToStart();
+    virtual bool isThreadSafe() const {return true;}
     
     const Vector &getBasicTrialDisp();
     const Vector &getBasicIncrDisp();
@@ -39,8 +39,8 @@
 #include <Logging.h>
 
 // initialize static variables
-Matrix PDeltaCrdTransf2d::Tlg(6, 6);
-Matrix PDeltaCrdTransf2d::kg(6, 6);
+thread_local Matrix PDeltaCrdTransf2d::Tlg(6, 6);
+thread_local Matrix PDeltaCrdTransf2d::kg(6, 6);
 
 // constructor:
 PDeltaCrdTransf2d::PDeltaCrdTransf2d(int tag)
@@ -170,8 +170,8 @@ PDeltaCrdTransf2d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 int
 PDeltaCrdTransf2d::update()
 {
-  static Vector nodeIDisp(3);
-  static Vector nodeJDisp(3);
+  thread_local Vector nodeIDisp(3);
+  thread_local Vector nodeJDisp(3);
   nodeIDisp = nodeIPtr->getTrialDisp();
   nodeJDisp = nodeJPtr->getTrialDisp();
 
@@ -210,7 +210,7 @@ int
 PDeltaCrdTransf2d::computeElemtLengthAndOrient()
 {
   // element projection
-  static Vector dx(2);
+  thread_local Vector dx(2);
 
   const Vector &ndICoords = nodeIPtr->getCrds();
   const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -286,7 +286,7 @@ PDeltaCrdTransf2d::getBasicTrialDisp()
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[6];
+  thread_local double ug[6];
   for (int i = 0; i < 3; i++) {
     ug[i]     = disp1(i);
     ug[i + 3] = disp2(i);
@@ -302,7 +302,7 @@ PDeltaCrdTransf2d::getBasicTrialDisp()
       ug[j + 3] -= nodeJInitialDisp[j];
   }
 
-  static Vector ub(3);
+  thread_local Vector ub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -339,13 +339,13 @@ PDeltaCrdTransf2d::getBasicIncrDisp()
   const Vector &disp1 = nodeIPtr->getIncrDisp();
   const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-  static double dug[6];
+  thread_local double dug[6];
   for (int i = 0; i < 3; i++) {
     dug[i]     = disp1(i);
     dug[i + 3] = disp2(i);
   }
 
-  static Vector dub(3);
+  thread_local Vector dub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -382,13 +382,13 @@ PDeltaCrdTransf2d::getBasicIncrDeltaDisp()
   const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
   const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-  static double Dug[6];
+  thread_local double Dug[6];
   for (int i = 0; i < 3; i++) {
     Dug[i]     = disp1(i);
     Dug[i + 3] = disp2(i);
   }
 
-  static Vector Dub(3);
+  thread_local Vector Dub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -425,13 +425,13 @@ PDeltaCrdTransf2d::getBasicTrialVel()
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[6];
+  thread_local double vg[6];
   for (int i = 0; i < 3; i++) {
     vg[i]     = vel1(i);
     vg[i + 3] = vel2(i);
   }
 
-  static Vector vb(3);
+  thread_local Vector vb(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -468,13 +468,13 @@ PDeltaCrdTransf2d::getBasicTrialAccel()
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[6];
+  thread_local double ag[6];
   for (int i = 0; i < 3; i++) {
     ag[i]     = accel1(i);
     ag[i + 3] = accel2(i);
   }
 
-  static Vector ab(3);
+  thread_local Vector ab(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -508,7 +508,7 @@ const Vector &
 PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static double pl[6];
+  thread_local double pl[6];
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -535,7 +535,7 @@ PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
   pl[4] -= NoverL;
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(6);
+  thread_local Vector pg(6);
 
   pg(0) = cosTheta * pl[0] - sinTheta * pl[1];
   pg(1) = sinTheta * pl[0] + cosTheta * pl[1];
@@ -566,8 +566,8 @@ PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 PDeltaCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-  static double kl[6][6];
-  static double tmp[6][6];
+  thread_local double kl[6][6];
+  thread_local double tmp[6][6];
   double oneOverL = 1.0 / L;
 
   // Basic stiffness
@@ -775,7 +775,7 @@ PDeltaCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 PDeltaCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-  static double tmp[6][6];
+  thread_local double tmp[6][6];
   double oneOverL = 1.0 / L;
   double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
 
@@ -935,7 +935,7 @@ PDeltaCrdTransf2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(12);
+  thread_local Vector data(12);
   data(0) = this->getTag();
   data(1) = L;
   if (nodeIOffset != 0) {
@@ -989,7 +989,7 @@ PDeltaCrdTransf2d::recvSelf(int cTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(12);
+  thread_local Vector data(12);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -1067,7 +1067,7 @@ PDeltaCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 PDeltaCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-  static Vector xg(2);
+  thread_local Vector xg(2);
 
   const Vector &nodeICoords = nodeIPtr->getCrds();
   xg(0)                     = nodeICoords(0);
@@ -1092,7 +1092,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector ug(6);
+  thread_local Vector ug(6);
   for (int i = 0; i < 3; i++) {
     ug(i)     = disp1(i);
     ug(i + 3) = disp2(i);
@@ -1109,7 +1109,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // transform global end displacements to local coordinates
-  static Vector ul(6); // total displacements
+  thread_local Vector ul(6); // total displacements
 
   ul(0) = cosTheta * ug(0) + sinTheta * ug(1);
   ul(1) = -sinTheta * ug(0) + cosTheta * ug(1);
@@ -1135,7 +1135,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static Vector uxl(2), uxg(2);
+  thread_local Vector uxl(2), uxg(2);
 
   uxl(0) = uxb(0) + ul(0);
   uxl(1) = uxb(1) + (1 - xi) * ul(1) + xi * ul(4);
@@ -1155,7 +1155,7 @@ PDeltaCrdTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static Vector ug(6);
+  thread_local Vector ug(6);
   for (int i = 0; i < 3; i++) {
     ug(i)     = disp1(i);
     ug(i + 3) = disp2(i);
@@ -1172,7 +1172,7 @@ PDeltaCrdTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // transform global end displacements to local coordinates
-  static Vector ul(6); // total displacements
+  thread_local Vector ul(6); // total displacements
 
   ul(0) = cosTheta * ug(0) + sinTheta * ug(1);
   ul(1) = -sinTheta * ug(0) + cosTheta * ug(1);
@@ -1198,7 +1198,7 @@ PDeltaCrdTransf2d::getPointLocalDisplFromBasic(double xi, const Vector &uxb)
   }
 
   // compute displacements at point xi, in local coordinates
-  static Vector uxl(2);
+  thread_local Vector uxl(2);
 
   uxl(0) = uxb(0) + ul(0);
   uxl(1) = uxb(1) + (1 - xi) * ul(1) + xi * ul(4);
@@ -50,6 +50,7 @@
 
 #include <MapOfTaggedObjects.h>
 #include <MapOfTaggedObjectsIter.h>
+#include <DenseOfTaggedObjects.h>
 
 #include <SingleDomEleIter.h>
 #include <SingleDomNodIter.h>
@@ -63,6 +64,7 @@
 #include <Vertex.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <RCM.h>
 #include <Recorder.h>
 #include <MeshRegion.h>
 #include <Analysis.h>
@@ -70,6 +72,29 @@
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <threads/thread_pool.hpp>
+#include <AnalysisProfile.h>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+//
+// Invoke action() on every member of list from the threads of the pool
+// and return the sum of the results; the members must be independent
+//
+template <typename T, typename F>
+static int
+forEachOnPool(OpenSees::thread_pool &thePool, const std::vector<T *> &list, F action)
+{
+  std::atomic<int> result(0);
+  thePool.submit_loop<std::size_t>(0, list.size(), [&](std::size_t i) {
+    int ok = action(list[i]);
+    if (ok != 0)
+      result += ok;
+  }).wait();
+  return result;
+}
 
 //
 // global variables
@@ -96,11 +121,11 @@ Domain::Domain()
 {
   
     // initialize the arrays for storing the domain components
-    theElements     = new MapOfTaggedObjects();
-    theNodes        = new MapOfTaggedObjects();
-    theSPs          = new MapOfTaggedObjects();
+    theElements     = new DenseOfTaggedObjects();
+    theNodes        = new DenseOfTaggedObjects();
+    theSPs          = new DenseOfTaggedObjects();
     thePCs          = new MapOfTaggedObjects();
-    theMPs          = new MapOfTaggedObjects();    
+    theMPs          = new DenseOfTaggedObjects();    
     theLoadPatterns = new MapOfTaggedObjects();
     theParameters   = new MapOfTaggedObjects();
 
@@ -138,11 +163,11 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
 {
     // init the arrays for storing the domain components
-    theElements     = new MapOfTaggedObjects();
-    theNodes        = new MapOfTaggedObjects();
-    theSPs          = new MapOfTaggedObjects();
+    theElements     = new DenseOfTaggedObjects();
+    theNodes        = new DenseOfTaggedObjects();
+    theSPs          = new DenseOfTaggedObjects();
     thePCs          = new MapOfTaggedObjects();
-    theMPs          = new MapOfTaggedObjects();    
+    theMPs          = new DenseOfTaggedObjects();    
     theLoadPatterns = new MapOfTaggedObjects();
     theParameters   = new MapOfTaggedObjects();
     
@@ -277,6 +302,9 @@ Domain::~Domain()
   // delete the objects in the domain
   this->Domain::clearAll();
 
+  if (thePool != nullptr)
+    delete thePool;
+
   // delete all the storage objects
   // SEGMENT FAULT WILL OCCUR IF THESE OBJECTS WERE NOT CONSTRUCTED
   // USING NEW
@@ -989,6 +1017,12 @@ Domain::clearAll(void) {
   if (theElementGraph != nullptr)
     delete theElementGraph;
   theElementGraph = nullptr;
+
+  threadNodes.clear();
+  threadSafeElements.clear();
+  serialElements.clear();
+  elementClasses.clear();
+  threadListsBuilt = false;
   
   // dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; dbMPs =0; dbLPs = 0; dbParam = 0;
 }
@@ -1740,6 +1774,74 @@ Domain::clearNodeGraph(void) {
 }
 
 
+//
+// The nodes are put in reverse Cuthill-McKee order on the node graph, and
+// the elements in the order of the first of their nodes in that order, so
+// that the loops over the nodes and elements move through the model from
+// one side to the other rather than in the order it was built.
+//
+int
+Domain::reorderComponents(void)
+{
+    DenseOfTaggedObjects *theDenseNodes = dynamic_cast<DenseOfTaggedObjects *>(theNodes);
+    DenseOfTaggedObjects *theDenseElements = dynamic_cast<DenseOfTaggedObjects *>(theElements);
+    if (theDenseNodes == nullptr || theDenseElements == nullptr) {
+      opserr << "Domain::reorderComponents() - the nodes and elements are not held in a DenseOfTaggedObjects\n";
+      return -1;
+    }
+
+    int numNodes = theNodes->getNumComponents();
+    if (numNodes == 0)
+      return 0;
+
+    Graph &theGraph = this->getNodeGraph();
+    RCM theRCM;
+    const ID &vertexOrder = theRCM.number(theGraph);
+
+    ID nodeOrder(numNodes);
+    std::unordered_map<int, int> nodePosition;
+    for (int i = 0; i < numNodes; i++) {
+      int nodeTag = theGraph.getVertexPtr(vertexOrder(i))->getRef();
+      nodeOrder(i) = nodeTag;
+      nodePosition[nodeTag] = i;
+    }
+
+    std::vector<std::pair<int, int>> elementPosition;
+    elementPosition.reserve(theElements->getNumComponents());
+    Element *elePtr;
+    ElementIter &theEleIter = this->getElements();
+    while ((elePtr = theEleIter()) != nullptr) {
+      const ID &nodes = elePtr->getExternalNodes();
+      int first = numNodes;
+      for (int i = 0; i < nodes.Size(); i++) {
+        auto entry = nodePosition.find(nodes(i));
+        if (entry != nodePosition.end() && entry->second < first)
+          first = entry->second;
+      }
+      elementPosition.emplace_back(first, elePtr->getTag());
+    }
+    std::stable_sort(elementPosition.begin(), elementPosition.end(),
+                     [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+                       return a.first < b.first;
+                     });
+
+    ID elementOrder(int(elementPosition.size()));
+    for (int i = 0; i < elementOrder.Size(); i++)
+      elementOrder(i) = elementPosition[i].second;
+
+    if (theDenseNodes->reorder(nodeOrder) < 0 || theDenseElements->reorder(elementOrder) < 0) {
+      opserr << "Domain::reorderComponents() - failed to reorder the nodes and elements\n";
+      return -1;
+    }
+
+    // the analysis is to be set up again for the new order
+    this->domainChange();
+    this->clearNodeGraph();
+    this->clearElementGraph();
+    return 0;
+}
+
+
 
 void
 Domain::setCommitTag(int newTag)
@@ -1776,6 +1878,7 @@ Domain::getCreep(void) const
 void
 Domain::applyLoad(double scale)
 {
+    AnalysisProfile::Scope scope(AnalysisProfile::ApplyLoad);
 
     // set the current pseudo time in the domain to be newTime
     currentTime = scale;
@@ -1889,6 +1992,7 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
+  AnalysisProfile::Scope scope(AnalysisProfile::Record);
   int res = 0;
 
   // invoke record on all recorders
@@ -1905,19 +2009,40 @@ Domain::record(bool fromAnalysis)
 int
 Domain::commit(void)
 {
-    // 
-    // first invoke commit on all nodes and elements in the domain
-    //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != nullptr) {
-      nodePtr->commitState();
-    }
+    {
+      AnalysisProfile::Scope scope(AnalysisProfile::Commit);
+
+      // 
+      // first invoke commit on all nodes and elements in the domain
+      //
+      if (thePool != nullptr) {
+        this->buildThreadLists();
+
+        forEachOnPool(*thePool, threadNodes, [](Node *theNode) {
+          return theNode->commitState();
+        });
+        forEachOnPool(*thePool, threadSafeElements, [](Element *theEle) {
+          return theEle->commitState();
+        });
+        for (Element *elePtr : serialElements)
+          elePtr->commitState();
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != nullptr) {
-      elePtr->commitState();
+      } else {
+        Node *nodePtr;
+        NodeIter &theNodeIter = this->getNodes();
+        while ((nodePtr = theNodeIter()) != nullptr) {
+          nodePtr->commitState();
+        }
+
+        Element *elePtr;
+        ElementIter &theElemIter = this->getElements();    
+        while ((elePtr = theElemIter()) != nullptr) {
+          elePtr->commitState();
+        }
+      }
+
+      if (AnalysisProfile::isEnabled())
+        AnalysisProfile::addElementCalls(AnalysisProfile::Commit, this->getElementClasses());
     }
 
     // set the new committed time in the domain
@@ -1925,6 +2050,7 @@ Domain::commit(void)
     dT = 0.0;
 
     // invoke record on all recorders
+    AnalysisProfile::Scope scope(AnalysisProfile::Record);
     for (int i=0; i<numRecorders; i++)
       if (theRecorders[i] != 0)
 	theRecorders[i]->record(commitTag, currentTime);
@@ -1940,15 +2066,29 @@ Domain::revertToLastCommit(void)
     // 
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     // 
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != nullptr)
+    if (thePool != nullptr) {
+      this->buildThreadLists();
+
+      forEachOnPool(*thePool, threadNodes, [](Node *theNode) {
+        return theNode->revertToLastCommit();
+      });
+      forEachOnPool(*thePool, threadSafeElements, [](Element *theEle) {
+        return theEle->revertToLastCommit();
+      });
+      for (Element *elePtr : serialElements)
+        elePtr->revertToLastCommit();
+
+    } else {
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != nullptr)
 	nodePtr->revertToLastCommit();
     
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != nullptr) {
+      Element *elePtr;
+      ElementIter &theElemIter = this->getElements();    
+      while ((elePtr = theElemIter()) != nullptr) {
 	elePtr->revertToLastCommit();
+      }
     }
 
     // set the current time and load factor in the domain to last committed
@@ -2006,7 +2146,26 @@ Domain::update(void)
 
   int ok = 0;
 
+  AnalysisProfile::Scope scope(AnalysisProfile::Update);
+  if (AnalysisProfile::isEnabled())
+    AnalysisProfile::addElementCalls(AnalysisProfile::Update, this->getElementClasses());
+
   // invoke update on all the ele's
+  if (thePool != nullptr) {
+    this->buildThreadLists();
+
+    ok += forEachOnPool(*thePool, threadSafeElements, [](Element *theEle) {
+      ops_TheActiveElement = theEle;
+      return theEle->update();
+    });
+
+    for (Element *theEle : serialElements) {
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
+    return ok;
+  }
+
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
@@ -2018,6 +2177,72 @@ Domain::update(void)
   return ok;
 }
 
+int
+Domain::setNumThreads(int numThreads)
+{
+  if (thePool != nullptr) {
+    if ((int)thePool->get_thread_count() == numThreads)
+      return 0;
+    delete thePool;
+    thePool = nullptr;
+  }
+
+  if (numThreads > 0)
+    thePool = new OpenSees::thread_pool(numThreads);
+
+  return 0;
+}
+
+OpenSees::thread_pool *
+Domain::getThreadPool(void) const
+{
+  return thePool;
+}
+
+void
+Domain::buildThreadLists(void)
+{
+  if (threadListsBuilt)
+    return;
+
+  threadNodes.clear();
+  threadSafeElements.clear();
+  serialElements.clear();
+
+  Node *nodePtr;
+  NodeIter &theNodeIter = this->getNodes();
+  while ((nodePtr = theNodeIter()) != nullptr)
+    threadNodes.push_back(nodePtr);
+
+  std::map<std::string, std::pair<const char *, int>> classes;
+  Element *elePtr;
+  ElementIter &theElemIter = this->getElements();
+  while ((elePtr = theElemIter()) != nullptr) {
+    if (elePtr->isThreadSafe())
+      threadSafeElements.push_back(elePtr);
+    else
+      serialElements.push_back(elePtr);
+
+    // the class type names live as long as the program
+    auto &entry = classes[elePtr->getClassType()];
+    entry.first = elePtr->getClassType();
+    entry.second++;
+  }
+
+  elementClasses.clear();
+  for (const auto &entry : classes)
+    elementClasses.push_back(entry.second);
+
+  threadListsBuilt = true;
+}
+
+const std::vector<std::pair<const char *, int>> &
+Domain::getElementClasses(void)
+{
+  this->buildThreadLists();
+  return elementClasses;
+}
+
 
 int
 Domain::update(double newTime, double dT)
@@ -2201,6 +2426,7 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    threadListsBuilt = false;
 }
 
 
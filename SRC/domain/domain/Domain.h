@@ -32,6 +32,8 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <vector>
+#include <utility>
 
 enum class NodeData: int;
 class Element;
@@ -69,6 +71,7 @@ class Channel;
 class FEM_ObjectBroker;
 
 class TaggedObjectStorage;
+namespace OpenSees { class thread_pool; }
 
 class DomainModalProperties;
 
@@ -169,6 +172,10 @@ class Domain
     virtual  void   clearElementGraph(void);
     virtual  void   clearNodeGraph(void);
 
+    // iterate the nodes and elements in an order that follows the mesh;
+    // requires them to be held in a DenseOfTaggedObjects (the default)
+    virtual  int    reorderComponents(void);
+
     // methods to update the domain
     virtual  void setCommitTag(int newTag);    	
     virtual  void setCurrentTime(double newTime);
@@ -187,6 +194,16 @@ class Domain
     virtual  int  update(double newTime, double dT);
     virtual  int  updateParameter(int tag, int value);
     virtual  int  updateParameter(int tag, double value);    
+
+    // threads used for the node and element loops of update(), commit()
+    // and revertToLastCommit(); the pool is shared with the analysis.
+    // 0 (the default) runs the loops serially
+    virtual  int  setNumThreads(int numThreads);
+    OpenSees::thread_pool *getThreadPool(void) const;
+
+    // the class type of the elements in the domain, with the number of
+    // elements of each class
+    const std::vector<std::pair<const char *, int>> &getElementClasses(void);
     
     virtual  int  analysisStep(double dT);
     virtual  int  eigenAnalysis(int numMode, bool generalized, bool findSmallest);
@@ -245,6 +262,7 @@ class Domain
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    void buildThreadLists(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -306,6 +324,16 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // the nodes and elements in storage order for the threaded loops;
+    // elements that are not thread safe are kept apart. The element
+    // classes are counted at the same time
+    OpenSees::thread_pool *thePool = nullptr;
+    std::vector<Node *>    threadNodes;
+    std::vector<Element *> threadSafeElements;
+    std::vector<Element *> serialElements;
+    std::vector<std::pair<const char *, int>> elementClasses;
+    bool threadListsBuilt = false;
 };
 
 #endif
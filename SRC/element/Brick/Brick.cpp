@@ -84,11 +84,11 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Brick)
 #endif
 
 //static data
-double  Brick::xl[3][8] ;
+thread_local double  Brick::xl[3][8] ;
 
-Matrix  Brick::stiff(24,24) ;
-Vector  Brick::resid(24) ;
-Matrix  Brick::mass(24,24) ;
+thread_local Matrix  Brick::stiff(24,24) ;
+thread_local Vector  Brick::resid(24) ;
+thread_local Matrix  Brick::mass(24,24) ;
 
     
 //quadrature data
@@ -102,7 +102,7 @@ const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0,
                               1.0, 1.0, 1.0, 1.0  } ;
 
   
-static Matrix B(6,3) ;
+static thread_local Matrix B(6,3) ;
 
 //null constructor
 Brick::Brick( ) 
@@ -265,6 +265,16 @@ int  Brick::revertToStart( )
   return success ;
 }
 
+//the element is thread safe when its materials are
+bool  Brick::isThreadSafe( ) const
+{
+  for ( int i=0; i<8; i++ ) 
+    if ( !materialPointers[i]->isThreadSafe( ) )
+      return false ;
+
+  return true ;
+}
+
 //print out element data
 void  Brick::Print(OPS_Stream &s, int flag)
 {
@@ -387,26 +397,26 @@ const Matrix&  Brick::getInitialStiff( )
   int jj, kk ;
 
   
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  thread_local double volume ;
+  thread_local double xsj ;  // determinant jacaobian matrix 
+  thread_local double dvol[numberGauss] ; //volume element
+  thread_local double gaussPoint[ndm] ;
+  thread_local Vector strain(nstress) ;  //strain
+  thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -623,7 +633,7 @@ const Vector&  Brick::getResistingForce( )
 //get residual with inertia terms
 const Vector&  Brick::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  thread_local Vector res(24);
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -667,13 +677,13 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  thread_local double gaussPoint[ndm] ;
 
-  static Vector momentum(ndf) ;
+  thread_local Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -807,26 +817,26 @@ Brick::update(void)
   int i, j, k, p, q ;
   int success ;
   
-  static double volume ;
+  thread_local double volume ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  thread_local double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  thread_local double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
   //---------B-matrices------------------------------------
 
-  static Matrix BJ(nstress,ndf) ;      // B matrix node J
-  static Matrix BJtran(ndf,nstress) ;
-  static Matrix BK(nstress,ndf) ;      // B matrix node k
-  static Matrix BJtranD(ndf,nstress) ;
+  thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
+  thread_local Matrix BJtran(ndf,nstress) ;
+  thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
+  thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -971,36 +981,36 @@ void  Brick::formResidAndTangent( int tang_flag )
   int i, j, k, p, q ;
 
 
-  static double volume ;
+  thread_local double volume ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  thread_local double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  thread_local double gaussPoint[ndm] ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  thread_local Vector residJ(ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress
+  thread_local Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1264,7 +1274,7 @@ Brick::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(26);
+  thread_local ID idData(26);
 
   idData(24) = this->getTag();
   if (alphaM != 0 || betaK != 0 || betaK0 != 0 || betaKc != 0) 
@@ -1336,7 +1346,7 @@ int  Brick::recvSelf (int commitTag,
   
   int dataTag = this->getDbTag();
 
-  static ID idData(26);
+  thread_local ID idData(26);
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "WARNING Brick::recvSelf() - " << this->getTag() << " failed to receive ID\n";
@@ -90,6 +90,7 @@ class Brick : public Element {
     
     //revert to start 
     int revertToStart( ) ;
+    bool isThreadSafe( ) const ;
 
     // update
     int update(void);
@@ -149,9 +150,9 @@ class Brick : public Element {
     // static attributes
     //
 
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
     static Matrix damping ;
 
     //quadrature data
@@ -161,7 +162,7 @@ class Brick : public Element {
     static const double wg[8] ;
   
     //local nodal coordinates, three coordinates for each of four nodes
-    static double xl[3][8] ; 
+    static thread_local double xl[3][8] ; 
 
     //
     // private methods
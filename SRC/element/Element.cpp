@@ -39,12 +39,34 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element *ops_TheActiveElement = nullptr;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+#include <memory>
+
+namespace {
+//
+// Work areas used to compute/return the damping matrix & residual
+// force; one set for each element size is kept per thread so that
+// elements can be formed concurrently
+//
+struct ElementWork {
+  ElementWork(int numDOF) : M(numDOF, numDOF), V1(numDOF), V2(numDOF) {}
+  Matrix M;
+  Vector V1, V2;
+};
+
+static ElementWork &
+elementWork(int numDOF)
+{
+  static thread_local std::vector<std::unique_ptr<ElementWork>> theWork;
+  for (auto &work : theWork)
+    if (work->M.noRows() == numDOF)
+      return *work;
+
+  theWork.emplace_back(new ElementWork(numDOF));
+  return *theWork.back();
+}
+}
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -115,59 +137,10 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
-  // check that memory has been allocated to store compute/return
+  // note the size of the work areas used to compute/return the
   // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-
-      for (int j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (int j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
+  if (index == -1)
+    index = this->getNumDOF();
 
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
@@ -191,7 +164,7 @@ Element::getDamp()
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &elementWork(index).M; 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -214,7 +187,7 @@ Element::getMass(void)
   }
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &elementWork(index).M; 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -226,9 +199,9 @@ Element::getResistingForceIncInertia(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &elementWork(index).M; 
+  Vector *theVector = &elementWork(index).V2;
+  Vector *theVector2 = &elementWork(index).V1;
 
   //
   // perform: R = P(U) - Pext(t);
@@ -293,9 +266,9 @@ Element::getRayleighDampingForces(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &elementWork(index).M; 
+  Vector *theVector = &elementWork(index).V2;
+  Vector *theVector2 = &elementWork(index).V1;
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -389,6 +362,12 @@ Element::isSubdomain(void)
     return false;
 }
 
+bool
+Element::isThreadSafe(void) const
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -486,7 +465,7 @@ Element::getResistingForceSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = &elementWork(index).V1;
   theVector->Zero();
 
   return *theVector;
@@ -505,7 +484,7 @@ Element::getTangentStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &elementWork(index).M;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -525,7 +504,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &elementWork(index).M;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -544,7 +523,7 @@ Element::getCommittedStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &elementWork(index).M;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -557,7 +536,7 @@ Element::getMassSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &elementWork(index).M;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -588,7 +567,7 @@ Element::getDampSensitivity(int gradIndex)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &elementWork(index).M; 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
@@ -749,7 +728,7 @@ Element::getGeometricTangentStiff()
 	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
     }
     
-    Matrix *theMatrix = theMatrices[index];
+    Matrix *theMatrix = &elementWork(index).M;
     theMatrix->Zero();
     
     return *theMatrix;
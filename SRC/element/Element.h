@@ -60,6 +60,11 @@ class Element : public DomainComponent
     virtual int  revertToStart();
     virtual int  update();
     virtual bool isSubdomain();
+
+    // true if the state, tangent and resisting force methods of this
+    // object may be invoked concurrently with those of other elements,
+    // i.e. they write only to memory owned by this object (or thread_local)
+    virtual bool isThreadSafe() const;
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -118,11 +123,7 @@ private:
 //  std::vector<Node*> nodes;
     bool is_this_element_active;
 
-    int index, nodeIndex;
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    int index, nodeIndex;   // index holds the size of the work areas
 };
 
 
@@ -46,8 +46,8 @@
 
 #include <map>
 
-Matrix ElasticBeam2d::K(6,6);
-Vector ElasticBeam2d::P(6);
+thread_local Matrix ElasticBeam2d::K(6,6);
+thread_local Vector ElasticBeam2d::P(6);
 // Matrix ElasticBeam2d::kb(3,3);
 
 void *OPS_DECL_RUNTIME_VPID(OPS_ElasticBeam2d, const ID &info) {
@@ -544,6 +544,12 @@ ElasticBeam2d::update()
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam2d::isThreadSafe() const
+{
+  return theCoordTransf != nullptr && theCoordTransf->isThreadSafe();
+}
+
 const Matrix &
 ElasticBeam2d::getTangentStiff()
 {
@@ -633,7 +639,7 @@ ElasticBeam2d::getMass()
 
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            thread_local Matrix ml(6,6);
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -845,7 +851,7 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -887,7 +893,7 @@ ElasticBeam2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -952,7 +958,7 @@ ElasticBeam2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-    static Vector data(17);
+    thread_local Vector data(17);
     
     data(0) = A;
     data(1) = E; 
@@ -1004,7 +1010,7 @@ ElasticBeam2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBrok
 {
     int res = 0;
         
-    static Vector data(17);
+    thread_local Vector data(17);
 
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
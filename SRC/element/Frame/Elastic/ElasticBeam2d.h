@@ -58,6 +58,7 @@ class ElasticBeam2d : public Element
     ~ElasticBeam2d();
 
     const char *getClassType() const {return "ElasticBeam2d";};
+    bool isThreadSafe() const;
     static constexpr const char* class_name = "ElasticBeam2d";
 
     int getNumExternalNodes() const;
@@ -117,8 +118,8 @@ class ElasticBeam2d : public Element
 
     CrdTransf *theCoordTransf;
     
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
 };
 
 #endif
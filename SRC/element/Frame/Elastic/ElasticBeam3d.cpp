@@ -41,9 +41,9 @@
 #include <stdlib.h>
 #include <string>
 
-Matrix ElasticBeam3d::K(12,12);
-Vector ElasticBeam3d::P(12);
-Matrix ElasticBeam3d::kb(6,6);
+thread_local Matrix ElasticBeam3d::K(12,12);
+thread_local Vector ElasticBeam3d::P(12);
+thread_local Matrix ElasticBeam3d::kb(6,6);
 
 
 ElasticBeam3d::ElasticBeam3d()
@@ -301,6 +301,12 @@ ElasticBeam3d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam3d::isThreadSafe(void) const
+{
+  return theCoordTransf != nullptr && theCoordTransf->isThreadSafe();
+}
+
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
@@ -439,7 +445,7 @@ ElasticBeam3d::getMass(void)
             K(8,8) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(12,12);
+            thread_local Matrix ml(12,12);
             double m = rho*L/420.0;
             ml(0,0) = ml(6,6) = m*140.0;
             ml(0,6) = ml(6,0) = m*70.0;
@@ -671,7 +677,7 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m * Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -714,7 +720,7 @@ ElasticBeam3d::getResistingForceIncInertia()
     P(8) += m * accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -804,7 +810,7 @@ ElasticBeam3d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(19);
+    thread_local Vector data(19);
     
     data(0) = A;
     data(1) = E; 
@@ -857,7 +863,7 @@ int
 ElasticBeam3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(19);
+  thread_local Vector data(19);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -959,9 +965,9 @@ ElasticBeam3d::Print(OPS_Stream &s, int flag)
 	else if (flag == 2) {
 		this->getResistingForce(); // in case linear algo
 
-		static Vector xAxis(3);
-		static Vector yAxis(3);
-		static Vector zAxis(3);
+		thread_local Vector xAxis(3);
+		thread_local Vector yAxis(3);
+		thread_local Vector zAxis(3);
 
 		theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1153,9 +1159,9 @@ ElasticBeam3d::getResponse (int responseID, Information &eleInfo)
   double N, V, M1, M2, T;
   double L = theCoordTransf->getInitialLength();
   double oneOverL = 1.0/L;
-  static Vector Res(12);
+  thread_local Vector Res(12);
   Res = this->getResistingForce();
-  static Vector s(6);
+  thread_local Vector s(6);
   
   switch (responseID) {
   case 1: // stiffness
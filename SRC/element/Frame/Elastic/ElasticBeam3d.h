@@ -55,6 +55,7 @@ class ElasticBeam3d : public Element
     ~ElasticBeam3d();
 
     const char *getClassType(void) const {return "ElasticBeam3d";};
+    bool isThreadSafe(void) const;
 
     int getNumExternalNodes(void) const;
     const ID &getExternalNodes(void);
@@ -99,11 +100,11 @@ class ElasticBeam3d : public Element
     int releasez; // moment release for bending about z-axis 0=none, 1=I, 2=J, 3=I,J
     int releasey; // same for y-axis
     
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     Vector Q;
     
-    static Matrix kb;
+    static thread_local Matrix kb;
     Vector q;
     double q0[5];  // Fixed end forces in basic system (no torsion)
     double p0[5];  // Reactions in basic system (no torsion)
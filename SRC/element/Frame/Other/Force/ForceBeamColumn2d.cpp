@@ -81,13 +81,13 @@
 #include <VectorND.h>
 using namespace OpenSees;
 
-Matrix ForceBeamColumn2d::theMatrix(6,6);
-Vector ForceBeamColumn2d::theVector(6);
-double ForceBeamColumn2d::workArea[200];
+thread_local Matrix ForceBeamColumn2d::theMatrix(6,6);
+thread_local Vector ForceBeamColumn2d::theVector(6);
+thread_local double ForceBeamColumn2d::workArea[200];
 
-Vector ForceBeamColumn2d::vsSubdivide[MaxNumSections];
-Matrix ForceBeamColumn2d::fsSubdivide[MaxNumSections];
-Vector ForceBeamColumn2d::SsrSubdivide[MaxNumSections];
+thread_local Vector ForceBeamColumn2d::vsSubdivide[MaxNumSections];
+thread_local Matrix ForceBeamColumn2d::fsSubdivide[MaxNumSections];
+thread_local Vector ForceBeamColumn2d::SsrSubdivide[MaxNumSections];
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ForceBeamColumn2d)
 {
@@ -663,6 +663,19 @@ int ForceBeamColumn2d::revertToLastCommit()
   return err;
 }
 
+bool
+ForceBeamColumn2d::isThreadSafe(void) const
+{
+  if (crdTransf == nullptr || !crdTransf->isThreadSafe())
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (!sections[i]->isThreadSafe())
+      return false;
+
+  return true;
+}
+
 int ForceBeamColumn2d::revertToStart()
 {
   // revert the sections state to start
@@ -704,12 +717,12 @@ ForceBeamColumn2d::getInitialStiff(void)
   if (Ki != nullptr)
     return *Ki;
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   // form stiffness matrix
   int code;
-  static Matrix kvInit(NEBD, NEBD);
+  thread_local Matrix kvInit(NEBD, NEBD);
   if ((code = f.Invert(kvInit)) < 0)
     opserr << "ForceBeamColumn2d::getInitialStiff -- could not invert flexibility, "
            << "got code " << code <<"\n";
@@ -911,14 +924,14 @@ ForceBeamColumn2d::update()
   double wt[MaxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  thread_local Vector vr(NEBD);       // element residual displacements
+  thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  thread_local Vector dSe(NEBD);
+  thread_local Vector SeTrial(NEBD);
+  thread_local Matrix kvTrial(NEBD, NEBD);
   OPS_STATIC VectorND<NEBD> dvTrial;
   OPS_STATIC VectorND<NEBD> dvToDo;
 
@@ -998,10 +1011,10 @@ ForceBeamColumn2d::update()
             int order      = sections[i]->getOrder();
             const ID &code = sections[i]->getType();
 
-            static Vector Ss;
-            static Vector dSs;
-            static Vector dvs;
-            static Matrix fb;
+            thread_local Vector Ss;
+            thread_local Vector dSs;
+            thread_local Vector dvs;
+            thread_local Matrix fb;
             
             Ss.setData(workArea, order);
             dSs.setData(&workArea[order], order);
@@ -1696,7 +1709,7 @@ ForceBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j , k;
   int loc = 0;
 
-  static ID idData(11);  // one bigger than needed so no clash later
+  thread_local ID idData(11);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -1831,7 +1844,7 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   int dbTag = this->getDbTag();
   int i,j,k;
   
-  static ID idData(11); // one bigger than needed 
+  thread_local ID idData(11); // one bigger than needed 
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "ForceBeamColumn2d::recvSelf() - failed to recv ID data\n";
@@ -2206,7 +2219,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
     double xL1 = xL-1.0;
     double wtL = wt[i]*L;
 
-    static Vector sp;
+    thread_local Vector sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -2214,7 +2227,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    thread_local Vector e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2245,7 +2258,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -2253,7 +2266,7 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[MaxNumSections];
+   thread_local double xi_pts[MaxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2266,7 +2279,7 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   thread_local Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -2291,8 +2304,8 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   thread_local Vector xl(NDM), uxb(NDM);
+   thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -2349,8 +2362,8 @@ ForceBeamColumn2d::Print(OPS_Stream &s, int flag)
     s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << endln;
 
     // plastic hinge rotation
-    static Vector vp(3);
-    static Matrix fe(3,3);
+    thread_local Vector vp(3);
+    thread_local Matrix fe(3,3);
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2687,8 +2700,8 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(3);
-  static Matrix fe(3,3);
+  thread_local Vector vp(3);
+  thread_local Matrix fe(3,3);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2721,7 +2734,7 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
-    static Vector v0(3);
+    thread_local Vector v0(3);
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return eleInfo.setVector(vp);
@@ -2790,7 +2803,7 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     
     d3 += beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-    static Vector d(2);
+    thread_local Vector d(2);
     d(0) = d2;
     d(1) = d3;
 
@@ -2869,8 +2882,8 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     Vector dispsy(numSections);
     dispsy.addMatrixVector(0.0, ls, kappa, 1.0);
     beamIntegr->getSectionLocations(numSections, L, pts);
-    static Vector uxb(2);
-    static Vector uxg(2);
+    thread_local Vector uxb(2);
+    thread_local Vector uxg(2);
     Matrix disps(numSections,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -2907,8 +2920,8 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     // Displacement vector
     Vector dispsy(20);
     dispsy.addMatrixVector(0.0, ls, kappa, 1.0);
-    static Vector uxb(2);
-    static Vector uxg(2);
+    thread_local Vector uxb(2);
+    thread_local Vector uxg(2);
     Matrix disps(20,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < 20; i++) {
@@ -2950,7 +2963,7 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(3);
+    thread_local Vector dqdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -2975,7 +2988,7 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC2d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(3);
+    thread_local Vector dqdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -3053,20 +3066,20 @@ ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(3);
+    thread_local Vector dvpdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
     dvpdh = dvdh;
 
-    static Matrix fe(3,3);
+    thread_local Matrix fe(3,3);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
 
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
 
-    static Matrix fek(3,3);
+    thread_local Matrix fek(3,3);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3212,7 +3225,7 @@ ForceBeamColumn2d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(3);
+  thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3220,7 +3233,7 @@ ForceBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(6);
+  thread_local Vector P(6);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3258,7 +3271,7 @@ ForceBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(3);
+  thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3357,7 +3370,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(3);
+  thread_local Vector dvdh(3);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3452,7 +3465,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(3,3);
+  thread_local Matrix dfedh(3,3);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3460,7 +3473,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(3);
+  thread_local Vector dqdh(3);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3471,7 +3484,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn2d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(3,3);
+  thread_local Matrix dfedh(3,3);
 
   dfedh.Zero();
 
@@ -79,13 +79,13 @@
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3d::theMatrix(12,12);
-Vector ForceBeamColumn3d::theVector(12);
-double ForceBeamColumn3d::workArea[200];
+thread_local Matrix ForceBeamColumn3d::theMatrix(12,12);
+thread_local Vector ForceBeamColumn3d::theVector(12);
+thread_local double ForceBeamColumn3d::workArea[200];
 
-Vector ForceBeamColumn3d::vsSubdivide[maxNumSections];
-Matrix ForceBeamColumn3d::fsSubdivide[maxNumSections];
-Vector ForceBeamColumn3d::SsrSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumn3d::vsSubdivide[maxNumSections];
+thread_local Matrix ForceBeamColumn3d::fsSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumn3d::SsrSubdivide[maxNumSections];
 
 #if 0
 #include <elementAPI.h>
@@ -429,6 +429,19 @@ ForceBeamColumn3d::revertToLastCommit()
   return err;
 }
 
+bool
+ForceBeamColumn3d::isThreadSafe(void) const
+{
+  if (crdTransf == nullptr || !crdTransf->isThreadSafe())
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (!sections[i]->isThreadSafe())
+      return false;
+
+  return true;
+}
+
 int
 ForceBeamColumn3d::revertToStart()
 {
@@ -470,11 +483,11 @@ ForceBeamColumn3d::getInitialStiff(void)
   if (Ki != 0)
     return *Ki;
 
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix  
+  thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
     
   // calculate element stiffness matrix
-  static Matrix kvInit(NEBD, NEBD);
+  thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Invert(kvInit) < 0)
     opserr << "ForceBeamColumn3d::getInitialStiff -- could not invert flexibility";
 
@@ -674,13 +687,13 @@ ForceBeamColumn3d::update()
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    thread_local Vector dv(NEBD);
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    thread_local Vector vin(NEBD);
     vin = v;
     vin -= dv;
 
@@ -693,18 +706,18 @@ ForceBeamColumn3d::update()
     double wt[maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    thread_local Vector vr(NEBD);       // element residual displacements
+    thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
     double dW;                    // section strain energy (work) norm 
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    thread_local Vector dSe(NEBD);
+    thread_local Vector dvToDo(NEBD);
+    thread_local Vector dvTrial(NEBD);
+    thread_local Vector SeTrial(NEBD);
+    thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo  = dv;
     dvTrial = dvToDo;
@@ -787,10 +800,10 @@ ForceBeamColumn3d::update()
               int order      = sections[i]->getOrder();
               const ID &code = sections[i]->getType();
               
-              static Vector Ss;
-              static Vector dSs;
-              static Vector dvs;
-              static Matrix fb;
+              thread_local Vector Ss;
+              thread_local Vector dSs;
+              thread_local Vector dvs;
+              thread_local Matrix fb;
               
               Ss.setData(workArea, order);
               dSs.setData(&workArea[order], order);
@@ -1664,7 +1677,7 @@ ForceBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
     int i, j , k;
     int loc = 0;
 
-    static ID idData(11);  
+    thread_local ID idData(11);  
     idData(0) = this->getTag();
     idData(1) = connectedExternalNodes(0);
     idData(2) = connectedExternalNodes(1);
@@ -1801,7 +1814,7 @@ ForceBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
     int dbTag = this->getDbTag();
     int i,j,k;
 
-    static ID idData(11); // one bigger than needed 
+    thread_local ID idData(11); // one bigger than needed 
 
     if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
       opserr << "ForceBeamColumn3d::recvSelf() - failed to recv ID data\n";
@@ -2214,7 +2227,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
       double xL1 = xL - 1.0;
       double wtL = wt[i] * L;
 
-      static Vector sp;
+      thread_local Vector sp;
       sp.setData(workArea, order);
       sp.Zero();
 
@@ -2222,7 +2235,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
       const Matrix &fse = sections[i]->getInitialFlexibility();
 
-      static Vector e;
+      thread_local Vector e;
       e.setData(&workArea[order], order);
 
       e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2262,13 +2275,13 @@ ForceBeamColumn3d::compSectionDisplacements(Vector sectionCoords[],
                                             Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
 
    // get integration point positions and weights
-   static double pts[maxNumSections];
+   thread_local double pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2282,7 +2295,7 @@ ForceBeamColumn3d::compSectionDisplacements(Vector sectionCoords[],
    // get section curvatures
    Vector kappa_y(numSections);  // curvature
    Vector kappa_z(numSections);  // curvature
-   static Vector vs;             // section deformations 
+   thread_local Vector vs;             // section deformations 
 
    for (i=0; i<numSections; i++) {
        // THIS IS VERY INEFFICIENT ... CAN CHANGE IF RUNS TOO SLOW
@@ -2314,8 +2327,8 @@ ForceBeamColumn3d::compSectionDisplacements(Vector sectionCoords[],
    }
 
    Vector v(numSections), w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   thread_local Vector xl(NDM), uxb(NDM);
+   thread_local Vector xg(NDM), uxg(NDM); 
    // double theta;                             // angle of twist of the sections
 
    // v = ls * kappa_z;  
@@ -2389,9 +2402,9 @@ ForceBeamColumn3d::Print(OPS_Stream &s, int flag)
 
   // flag set to 2 used to print everything .. used for viewing data for UCSD renderer  
   else if (flag == 2) {
-     static Vector xAxis(3);
-     static Vector yAxis(3);
-     static Vector zAxis(3);
+     thread_local Vector xAxis(3);
+     thread_local Vector yAxis(3);
+     thread_local Vector zAxis(3);
 
      crdTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -2435,8 +2448,8 @@ ForceBeamColumn3d::Print(OPS_Stream &s, int flag)
        << T << ' ' << MY2 << ' '  <<  MZ2 << endln;
 
      // plastic hinge rotation
-     static Vector vp(6);
-     static Matrix fe(6,6);
+     thread_local Vector vp(6);
+     thread_local Matrix fe(6,6);
      this->getInitialFlexibility(fe);
      vp = crdTransf->getBasicTrialDisp();
      vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2536,8 +2549,8 @@ OPS_Stream &operator<<(OPS_Stream &s, ForceBeamColumn3d &E)
 int
 ForceBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char** displayModes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  thread_local Vector v1(3);
+  thread_local Vector v2(3);
 
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -2787,8 +2800,8 @@ ForceBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
+  thread_local Vector vp(6);
+  thread_local Matrix fe(6,6);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2907,8 +2920,8 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     dispsy.addMatrixVector(0.0, ls, kappaz,  1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);    
     beamIntegr->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    thread_local Vector uxb(3);
+    thread_local Vector uxg(3);
     Matrix disps(numSections,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -2955,8 +2968,8 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     Vector dispsz(20); // along local z    
     dispsy.addMatrixVector(0.0, ls, kappaz,  1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);    
-    static Vector uxb(3);
-    static Vector uxg(3);
+    thread_local Vector uxb(3);
+    thread_local Vector uxg(3);
     Matrix disps(20,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < 20; i++) {
@@ -2976,7 +2989,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    thread_local Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -3066,7 +3079,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static Vector d(4);
+    thread_local Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -3181,7 +3194,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
         indata.close();
       }
 
-      static Vector result8(2);
+      thread_local Vector result8(2);
       result8(0) = value;
       result8(1) = checkvalue1;      
       
@@ -3217,7 +3230,7 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    thread_local Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -3242,7 +3255,7 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC3d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(6);
+    thread_local Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
@@ -3335,14 +3348,14 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(6);
+    thread_local Vector dvpdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(6,6);
+    thread_local Matrix fe(6,6);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -3350,7 +3363,7 @@ ForceBeamColumn3d::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(6,6);
+    thread_local Matrix fek(6,6);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3507,7 +3520,7 @@ ForceBeamColumn3d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumn3d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(6);
+  thread_local Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3517,7 +3530,7 @@ ForceBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 6);
 
-  static Vector P(12);
+  thread_local Vector P(12);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3555,7 +3568,7 @@ ForceBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(6);
+  thread_local Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3669,7 +3682,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(6);
+  thread_local Vector dvdh(6);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3800,7 +3813,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(6,6);
+  thread_local Matrix dfedh(6,6);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3808,7 +3821,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(6);
+  thread_local Vector dqdh(6);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3819,7 +3832,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn3d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(6,6);
+  thread_local Matrix dfedh(6,6);
 
   dfedh.Zero();
 
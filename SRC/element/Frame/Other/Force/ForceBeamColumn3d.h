@@ -97,6 +97,7 @@ class ForceBeamColumn3d: public Element
   int commitState(void);
   int revertToLastCommit(void);        
   int revertToStart(void);
+  bool isThreadSafe(void) const;
   int update(void);    
   
   const Matrix &getTangentStiff(void);
@@ -194,18 +195,18 @@ class ForceBeamColumn3d: public Element
 
   bool isTorsion;
 
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
   
   enum {maxNumSections = 10};
   
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   
-  static Vector vsSubdivide[];
-  static Vector SsrSubdivide[];
-  static Matrix fsSubdivide[];
+  static thread_local Vector vsSubdivide[];
+  static thread_local Vector SsrSubdivide[];
+  static thread_local Matrix fsSubdivide[];
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
   int parameterID;
@@ -43,10 +43,10 @@
 using namespace OpenSees;
 
 
-double FourNodeQuad::matrixData[64];
-Matrix FourNodeQuad::K(matrixData, 8, 8);
-Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
+thread_local double FourNodeQuad::matrixData[64];
+thread_local Matrix FourNodeQuad::K(matrixData, 8, 8);
+thread_local Vector FourNodeQuad::P(8);
+thread_local double FourNodeQuad::shp[3][4];
 
 FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
                            NDMaterial &m, const char *type, double t,
@@ -227,6 +227,16 @@ FourNodeQuad::revertToStart()
     return retVal;
 }
 
+bool
+FourNodeQuad::isThreadSafe(void) const
+{
+    for (int i = 0; i < 4; i++)
+      if (!theMaterial[i]->isThreadSafe())
+        return false;
+
+    return true;
+}
+
 
 int
 FourNodeQuad::update()
@@ -391,7 +401,7 @@ FourNodeQuad::getMass()
     K.Zero();
 
     int i;
-    static double rhoi[4];
+    thread_local double rhoi[4];
     double sum = 0.0;
     for (i = 0; i < nip; i++) {
       if (rho == 0)
@@ -461,7 +471,7 @@ FourNodeQuad::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
-  static double rhoi[4];
+  thread_local double rhoi[4];
   double sum = 0.0;
   for (int i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -483,7 +493,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
   
-  static double ra[8];
+  thread_local double ra[8];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -558,7 +568,7 @@ const Vector&
 FourNodeQuad::getResistingForceIncInertia()
 {
     int i;
-    static double rhoi[4];
+    thread_local double rhoi[4];
     double sum = 0.0;
     for (int i = 0; i < 4; i++) {
       rhoi[i] = theMaterial[i]->getRho();
@@ -44,14 +44,6 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix Truss::trussM2(2,2);
-Matrix Truss::trussM4(4,4);
-Matrix Truss::trussM6(6,6);
-Matrix Truss::trussM12(12,12);
-Vector Truss::trussV2(2);
-Vector Truss::trussV4(4);
-Vector Truss::trussV6(6);
-Vector Truss::trussV12(12);
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -254,6 +246,10 @@ Truss::~Truss()
 	delete theLoadSens;
     if (initialDisp != 0)
       delete [] initialDisp;
+    if (theMatrix != 0)
+      delete theMatrix;
+    if (theVector != 0)
+      delete theVector;
 }
 
 
@@ -316,8 +312,7 @@ Truss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
+      this->setWorkArea();
 
       return;
     }
@@ -333,8 +328,7 @@ Truss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
+      this->setWorkArea();
 	
       return;
     }	
@@ -345,39 +339,30 @@ Truss::setDomain(Domain *theDomain)
     // now set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &trussM2;
-	theVector = &trussV2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &trussM4;
-	theVector = &trussV4;	
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;		
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;			
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &trussM12;
-	theVector = &trussV12;			
     }
     else {
       opserr <<"WARNING Truss::setDomain cannot handle " << dimension << " dofs at nodes in " << 
 	dofNd1  << " problem\n";
 
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
+      this->setWorkArea();
       return;
     }
 
+    this->setWorkArea();
+
     // create the load vector
     if (theLoad == 0)
       theLoad = new Vector(numDOF);
@@ -1112,6 +1097,29 @@ Truss::Print(OPS_Stream &s, int flag)
 	}
 }
 
+void
+Truss::setWorkArea(void)
+{
+    // each object holds its own matrix & vector so that trusses
+    // can be formed concurrently
+    if (theMatrix != 0 && theMatrix->noRows() == numDOF)
+      return;
+
+    if (theMatrix != 0)
+      delete theMatrix;
+    if (theVector != 0)
+      delete theVector;
+
+    theMatrix = new Matrix(numDOF, numDOF);
+    theVector = new Vector(numDOF);
+}
+
+bool
+Truss::isThreadSafe(void) const
+{
+    return theMaterial != 0 && theMaterial->isThreadSafe();
+}
+
 double
 Truss::computeCurrentStrain(void) const
 {
@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of CSRGraph.
+//
+#include <CSRGraph.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <ID.h>
+#include <algorithm>
+
+CSRGraph::CSRGraph()
+:numVertex(0), start(1, 0)
+{
+
+}
+
+//
+// The cliques are first listed by vertex; the neighbours of a vertex are
+// then the entries of its cliques, with the repeats skipped by marking
+// each neighbour with the vertex. The rows are counted in one sweep so
+// that the adjacency is allocated once, and filled in a second.
+//
+void
+CSRGraph::build(int n, const std::vector<const ID *> &cliques)
+{
+    numVertex = n;
+    const int numCliques = cliques.size();
+
+    std::vector<int> cliqueStart(n+1, 0);
+    for (const ID *clique : cliques)
+      for (int i = 0; i < clique->Size(); i++) {
+        const int v = (*clique)(i);
+        if (v >= 0 && v < n)
+          cliqueStart[v+1]++;
+      }
+    for (int v = 0; v < n; v++)
+      cliqueStart[v+1] += cliqueStart[v];
+
+    std::vector<int> vertexCliques(cliqueStart[n]);
+    {
+      std::vector<int> next(cliqueStart.begin(), cliqueStart.end()-1);
+      for (int c = 0; c < numCliques; c++)
+        for (int i = 0; i < cliques[c]->Size(); i++) {
+          const int v = (*cliques[c])(i);
+          if (v >= 0 && v < n)
+            vertexCliques[next[v]++] = c;
+        }
+    }
+
+    std::vector<int> mark(n, -1);
+    start.assign(n+1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+      std::fill(mark.begin(), mark.end(), -1);
+      for (int v = 0; v < n; v++) {
+        mark[v] = v;
+        int next = start[v];
+        for (int k = cliqueStart[v]; k < cliqueStart[v+1]; k++) {
+          const ID &clique = *cliques[vertexCliques[k]];
+          for (int i = 0; i < clique.Size(); i++) {
+            const int w = clique(i);
+            if (w >= 0 && w < n && mark[w] != v) {
+              mark[w] = v;
+              if (pass == 0)
+                start[v+1]++;
+              else
+                adjacency[next++] = w;
+            }
+          }
+        }
+        if (pass == 1)
+          std::sort(adjacency.begin() + start[v], adjacency.begin() + start[v+1]);
+      }
+
+      if (pass == 0) {
+        for (int v = 0; v < n; v++)
+          start[v+1] += start[v];
+        adjacency.assign(start[n], 0);
+      }
+    }
+}
+
+int
+CSRGraph::build(Graph &theGraph)
+{
+    const int n = theGraph.getNumVertex();
+
+    std::vector<const ID *> rows(n, nullptr);
+    Vertex *vertexPtr;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((vertexPtr = theVertices()) != nullptr) {
+      const int v = vertexPtr->getTag();
+      if (v < 0 || v >= n) {
+        numVertex = 0;
+        start.assign(1, 0);
+        adjacency.clear();
+        return -1;
+      }
+      rows[v] = &vertexPtr->getAdjacency();
+    }
+
+    numVertex = n;
+    start.assign(n+1, 0);
+    for (int v = 0; v < n; v++)
+      start[v+1] = start[v] + (rows[v] != nullptr ? rows[v]->Size() : 0);
+
+    adjacency.resize(start[n]);
+    for (int v = 0; v < n; v++) {
+      if (rows[v] == nullptr)
+        continue;
+      for (int i = 0; i < rows[v]->Size(); i++)
+        adjacency[start[v] + i] = (*rows[v])(i);
+      std::sort(adjacency.begin() + start[v], adjacency.begin() + start[v+1]);
+    }
+    return 0;
+}
+
+int
+CSRGraph::getNumVertex(void) const
+{
+    return numVertex;
+}
+
+long
+CSRGraph::getNumEdge(void) const
+{
+    return adjacency.size()/2;
+}
+
+const int *
+CSRGraph::getStart(void) const
+{
+    return start.data();
+}
+
+const int *
+CSRGraph::getAdjacency(void) const
+{
+    return adjacency.data();
+}
+
+int
+CSRGraph::getDegree(int vertex) const
+{
+    return start[vertex+1] - start[vertex];
+}
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: CSRGraph is an undirected graph on the vertices 0 .. n-1
+// stored in compressed sparse row form: the neighbours of vertex v, in
+// ascending order and without v itself, are
+//
+//     getAdjacency()[getStart()[v]] .. getAdjacency()[getStart()[v+1]-1]
+//
+// It is built from the equation IDs of the FE_Elements, each of which
+// joins all its equations to each other, without the Vertex objects and
+// sorted inserts of a Graph, and it is what LinearSOE::setSize() works
+// from. A Graph can be converted to and from a CSRGraph when either is
+// needed.
+//
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+#include <vector>
+
+class ID;
+class Graph;
+
+class CSRGraph
+{
+  public:
+    CSRGraph();
+
+    // the graph on numVertex vertices in which the entries of each ID in
+    // [0, numVertex) are joined to each other; other entries are ignored
+    void build(int numVertex, const std::vector<const ID *> &cliques);
+
+    // the graph of a Graph whose vertices are tagged 0 .. n-1; returns -1,
+    // leaving the graph empty, if they are not
+    int  build(Graph &theGraph);
+
+    int  getNumVertex(void) const;
+    long getNumEdge(void) const;
+
+    const int *getStart(void) const;
+    const int *getAdjacency(void) const;
+    int  getDegree(int vertex) const;
+
+  private:
+    int numVertex;
+    std::vector<int> start;
+    std::vector<int> adjacency;
+};
+
+#endif
@@ -28,6 +28,8 @@
 
 #include <Graph.h>
 #include <Vertex.h>
+#include <CSRGraph.h>
+#include <ID.h>
 #include <VertexIter.h>
 #include <MapOfTaggedObjects.h>
 #include <Channel.h>
@@ -103,6 +105,20 @@ Graph::Graph(Graph &other)
   }
 }
 
+// the vertices are tagged 0 .. n-1
+Graph::Graph(const CSRGraph &other)
+  :myVertices(0), theVertexIter(0), numEdge(0), nextFreeTag(START_VERTEX_NUM),
+  vertices()
+{
+  myVertices = new MapOfTaggedObjects();
+  theVertexIter = new VertexIter(myVertices);
+
+  for (int v = 0; v < other.getNumVertex(); v++)
+    this->addVertex(new Vertex(v, v), false);
+
+  this->setEdges(other);
+}
+
 Graph::~Graph()
 {
     // invoke delete on the Vertices
@@ -270,6 +286,29 @@ Graph::addEdgeFast(int vertexTag, int otherVertexTag)
     return result;
 }
 
+// the adjacency of each vertex is copied as it is, already in order,
+// in place of the sorted inserts of addEdge()
+int
+Graph::setEdges(const CSRGraph &theEdges)
+{
+    const int *start = theEdges.getStart();
+    const int *adjacency = theEdges.getAdjacency();
+    for (int v = 0; v < theEdges.getNumVertex(); v++) {
+      Vertex *vertexPtr = this->getVertexPtr(v);
+      if (vertexPtr == 0) {
+	opserr << "WARNING Graph::setEdges() - vertex " << v << " not in Graph\n";
+	return -1;
+      }
+      ID theAdjacency(start[v+1] - start[v]);
+      for (int i = start[v]; i < start[v+1]; i++)
+	theAdjacency(i - start[v]) = adjacency[i];
+      vertexPtr->setAdjacency(theAdjacency);
+    }
+
+    numEdge = theEdges.getNumEdge();
+    return 0;
+}
+
 Vertex *
 Graph::getVertexPtr(int vertexTag)
 {
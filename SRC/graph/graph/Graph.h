@@ -40,6 +40,7 @@ class VertexIter;
 class TaggedObjectStorage;
 class Channel;
 class FEM_ObjectBroker;
+class CSRGraph;
 
 class Graph
 {
@@ -48,12 +49,15 @@ class Graph
     Graph(int numVertices);    
     Graph(TaggedObjectStorage &theVerticesStorage);
     Graph(Graph &other);
+    Graph(const CSRGraph &other);
     virtual ~Graph();
 
     virtual bool addVertex(Vertex *vertexPtr, bool checkAdjacency = true);
     virtual int addEdge(int vertexTag, int otherVertexTag);
     virtual void startAddEdge();
     virtual int addEdgeFast(int vertexTag, int otherVertexTag);
+    // sets the edges of the vertices tagged 0 .. n-1 to those of a CSRGraph
+    virtual int setEdges(const CSRGraph &theEdges);
     
     virtual Vertex *getVertexPtr(int vertexTag);
     virtual VertexIter &getVertices(void);
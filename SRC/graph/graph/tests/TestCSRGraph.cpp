@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file is a driver to test CSRGraph. A graph is built
+// from random cliques, some of whose entries repeat or fall outside the
+// vertices, and compared with the Graph the edges of the same cliques give
+// through Graph::addEdge(); then each is converted to the other and
+// compared again, and a Graph whose vertices are not tagged 0 .. n-1 is
+// checked to be refused.
+//
+#include <stdlib.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Domain.h>
+#include <ID.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <CSRGraph.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+thread_local Element *ops_TheActiveElement = 0;
+
+static const int numVertex = 200;
+static const int numCliques = 300;
+
+// whether row v of the CSRGraph is the adjacency of vertex v of the Graph
+static bool
+sameGraph(const CSRGraph &theCSR, Graph &theGraph)
+{
+  if (theCSR.getNumVertex() != theGraph.getNumVertex()
+      || theCSR.getNumEdge() != theGraph.getNumEdge())
+    return false;
+
+  const int *start = theCSR.getStart();
+  const int *adjacency = theCSR.getAdjacency();
+  for (int v = 0; v < theCSR.getNumVertex(); v++) {
+    Vertex *vertexPtr = theGraph.getVertexPtr(v);
+    if (vertexPtr == nullptr)
+      return false;
+
+    const ID &theAdjacency = vertexPtr->getAdjacency();
+    std::vector<int> row(theAdjacency.Size());
+    for (int i = 0; i < theAdjacency.Size(); i++)
+      row[i] = theAdjacency(i);
+    std::sort(row.begin(), row.end());
+
+    if (theCSR.getDegree(v) != int(row.size())
+        || !std::equal(row.begin(), row.end(), adjacency + start[v]))
+      return false;
+  }
+  return true;
+}
+
+static int numFailed = 0;
+
+static void
+report(const char *test, bool passed)
+{
+  if (passed)
+    opserr << "PASS: " << test << "\n\n";
+  else {
+    opserr << "FAIL: " << test << "\n\n";
+    numFailed++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  opserr << " *******************************************************************\n";
+  opserr << "                  CSRGraph unit test\n";
+  opserr << " *******************************************************************\n\n";
+
+  //
+  // random cliques of 1 to 8 entries in [-2, numVertex+2)
+  //
+
+  std::mt19937 generator(12345);
+  std::uniform_int_distribution<int> cliqueSize(1, 8);
+  std::uniform_int_distribution<int> entry(-2, numVertex + 1);
+
+  std::vector<ID> theIDs;
+  for (int c = 0; c < numCliques; c++) {
+    ID clique(cliqueSize(generator));
+    for (int i = 0; i < clique.Size(); i++)
+      clique(i) = entry(generator);
+    theIDs.push_back(clique);
+  }
+  std::vector<const ID *> cliques;
+  for (const ID &clique : theIDs)
+    cliques.push_back(&clique);
+
+  // the Graph of the same edges, one at a time
+  Graph theGraph(numVertex);
+  for (int v = 0; v < numVertex; v++)
+    theGraph.addVertex(new Vertex(v, v), false);
+  for (const ID &clique : theIDs)
+    for (int i = 0; i < clique.Size(); i++)
+      for (int j = 0; j < clique.Size(); j++) {
+        int v = clique(i), w = clique(j);
+        if (v >= 0 && v < numVertex && w >= 0 && w < numVertex && v < w)
+          theGraph.addEdge(v, w);
+      }
+
+  opserr << "TEST: " << numCliques << " cliques on " << numVertex << " vertices\n";
+  CSRGraph theCSR;
+  theCSR.build(numVertex, cliques);
+  report("CSRGraph from the cliques is the Graph from addEdge()", sameGraph(theCSR, theGraph));
+
+  //
+  // conversions
+  //
+
+  opserr << "TEST: conversions\n";
+  {
+    CSRGraph fromGraph;
+    bool passed = fromGraph.build(theGraph) == 0 && sameGraph(fromGraph, theGraph);
+    report("CSRGraph from a Graph", passed);
+
+    Graph fromCSR(theCSR);
+    report("Graph from a CSRGraph", sameGraph(theCSR, fromCSR));
+  }
+
+  //
+  // a Graph whose vertices are not tagged 0 .. n-1
+  //
+
+  opserr << "TEST: a Graph not tagged 0 .. n-1\n";
+  {
+    Graph otherGraph(3);
+    otherGraph.addVertex(new Vertex(0, 0), false);
+    otherGraph.addVertex(new Vertex(1, 1), false);
+    otherGraph.addVertex(new Vertex(5, 5), false);
+    otherGraph.addEdge(0, 5);
+
+    CSRGraph fromGraph;
+    report("build() fails and leaves the graph empty",
+           fromGraph.build(otherGraph) < 0 && fromGraph.getNumVertex() == 0
+           && fromGraph.getStart()[0] == 0);
+  }
+
+  //
+  // no vertices
+  //
+
+  opserr << "TEST: an empty graph\n";
+  {
+    CSRGraph empty;
+    empty.build(0, cliques);
+    report("no vertices, no edges", empty.getNumVertex() == 0 && empty.getNumEdge() == 0
+           && empty.getStart()[0] == 0);
+  }
+
+  if (numFailed == 0)
+    opserr << "PASSED CSRGraph unit test\n";
+  else
+    opserr << "FAILED CSRGraph unit test: " << numFailed << " failures\n";
+
+  return numFailed == 0 ? 0 : 1;
+}
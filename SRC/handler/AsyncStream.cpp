@@ -0,0 +1,501 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of AsyncStream.
+//
+#include <AsyncStream.h>
+#include <Vector.h>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+//
+// The writer thread is started with the first AsyncStream and stopped,
+// once it has emptied the buffer, when the last one is deleted.
+//
+class Writer
+{
+ public:
+  struct Record {
+    OPS_Stream *target;
+    std::size_t offset;
+    int size;
+  };
+
+  struct Buffer {
+    std::vector<Record> records;
+    std::vector<double> values;
+  };
+
+  void push(OPS_Stream *target, Vector &data)
+  {
+    const std::size_t n = data.Size();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    space.wait(lock, [&] {
+      return front.records.empty() || front.values.size() + n <= capacity;
+    });
+
+    front.records.push_back({target, front.values.size(), int(n)});
+    if (n > 0)
+      front.values.insert(front.values.end(), &data(0), &data(0) + n);
+    pending[target]++;
+    ready.notify_one();
+  }
+
+  // wait until the records of all streams have been written
+  void drain(void)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [&] { return front.records.empty() && !busy; });
+  }
+
+  // wait until the records of target have been written; those of the
+  // other streams may still be pending
+  void drain(OPS_Stream *target)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [&] { return pending.find(target) == pending.end(); });
+  }
+
+  void start(void)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = false;
+    thread = std::thread(&Writer::run, this);
+  }
+
+  void finish(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    ready.notify_one();
+    thread.join();
+  }
+
+  std::size_t capacity = 1 << 20;
+
+ private:
+  void run(void)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      ready.wait(lock, [&] { return stop || !front.records.empty(); });
+      if (front.records.empty())
+        break;
+
+      std::swap(front, back);
+      busy = true;
+      lock.unlock();
+      space.notify_all();
+
+      for (const Record &record : back.records) {
+        Vector data(back.values.data() + record.offset, record.size);
+        record.target->write(data);
+      }
+
+      lock.lock();
+      for (const Record &record : back.records) {
+        auto count = pending.find(record.target);
+        if (--count->second == 0)
+          pending.erase(count);
+      }
+      back.records.clear();
+      back.values.clear();
+      busy = false;
+      idle.notify_all();
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable ready, space, idle;
+  Buffer front, back;
+  // the number of records of each stream not yet written
+  std::unordered_map<OPS_Stream *, std::size_t> pending;
+  bool busy = false;
+  bool stop = false;
+  std::thread thread;
+};
+
+std::mutex writerMutex;
+Writer *theWriter = nullptr;
+int numStreams = 0;
+std::size_t bufferSize = 1 << 20;
+
+// write out what is pending if the program exits with streams still open
+void
+drainAtExit(void)
+{
+  AsyncStream::drain();
+}
+
+} // namespace
+
+
+AsyncStream::AsyncStream(OPS_Stream *stream)
+:OPS_Stream(stream->getClassTag()), theStream(stream)
+{
+  static bool registered = false;
+
+  std::lock_guard<std::mutex> lock(writerMutex);
+  if (numStreams++ == 0) {
+    theWriter = new Writer();
+    theWriter->capacity = bufferSize;
+    theWriter->start();
+  }
+  if (!registered) {
+    std::atexit(drainAtExit);
+    registered = true;
+  }
+}
+
+AsyncStream::~AsyncStream()
+{
+  this->sync();
+  delete theStream;
+
+  std::lock_guard<std::mutex> lock(writerMutex);
+  if (--numStreams == 0) {
+    theWriter->finish();
+    delete theWriter;
+    theWriter = nullptr;
+  }
+}
+
+void
+AsyncStream::setBufferSize(int numValues)
+{
+  std::lock_guard<std::mutex> lock(writerMutex);
+  bufferSize = numValues > 0 ? numValues : 1;
+  if (theWriter != nullptr)
+    theWriter->capacity = bufferSize;
+}
+
+void
+AsyncStream::drain(void)
+{
+  std::lock_guard<std::mutex> lock(writerMutex);
+  if (theWriter != nullptr)
+    theWriter->drain();
+}
+
+void
+AsyncStream::sync(void)
+{
+  // the writer exists as long as this stream does
+  theWriter->drain(theStream);
+}
+
+bool
+AsyncStream::isWriting(void)
+{
+  std::lock_guard<std::mutex> lock(writerMutex);
+  return theWriter != nullptr;
+}
+
+
+int
+AsyncStream::write(Vector &data)
+{
+  theWriter->push(theStream, data);
+  return 0;
+}
+
+int
+AsyncStream::flush()
+{
+  this->sync();
+  return theStream->flush();
+}
+
+int
+AsyncStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  this->sync();
+  return theStream->setFile(fileName, mode, echo);
+}
+
+int
+AsyncStream::setPrecision(int prec)
+{
+  this->sync();
+  return theStream->setPrecision(prec);
+}
+
+int
+AsyncStream::setFloatField(Float field)
+{
+  this->sync();
+  return theStream->setFloatField(field);
+}
+
+int
+AsyncStream::precision(int prec)
+{
+  this->sync();
+  return theStream->precision(prec);
+}
+
+int
+AsyncStream::width(int w)
+{
+  this->sync();
+  return theStream->width(w);
+}
+
+int
+AsyncStream::tag(const char *name)
+{
+  this->sync();
+  return theStream->tag(name);
+}
+
+int
+AsyncStream::tag(const char *name, const char *value)
+{
+  this->sync();
+  return theStream->tag(name, value);
+}
+
+int
+AsyncStream::endTag()
+{
+  this->sync();
+  return theStream->endTag();
+}
+
+int
+AsyncStream::attr(const char *name, int value)
+{
+  this->sync();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, double value)
+{
+  this->sync();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, const char *value)
+{
+  this->sync();
+  return theStream->attr(name, value);
+}
+
+OPS_Stream &
+AsyncStream::write(const char *s, int n)
+{
+  this->sync();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const unsigned char *s, int n)
+{
+  this->sync();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const signed char *s, int n)
+{
+  this->sync();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const void *s, int n)
+{
+  this->sync();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const double *s, int n)
+{
+  this->sync();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(char c)
+{
+  this->sync();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned char c)
+{
+  this->sync();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(signed char c)
+{
+  this->sync();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const char *s)
+{
+  this->sync();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const unsigned char *s)
+{
+  this->sync();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const signed char *s)
+{
+  this->sync();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const void *p)
+{
+  this->sync();
+  *theStream << p;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(int n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned int n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(long n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned long n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(short n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned short n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(bool b)
+{
+  this->sync();
+  *theStream << b;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(double n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(float n)
+{
+  this->sync();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(std::string const &s)
+{
+  this->sync();
+  *theStream << s;
+  return *this;
+}
+
+void
+AsyncStream::setAddCommon(int flag)
+{
+  this->sync();
+  theStream->setAddCommon(flag);
+}
+
+int
+AsyncStream::setOrder(const ID &order)
+{
+  this->sync();
+  return theStream->setOrder(order);
+}
+
+int
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  this->sync();
+  return theStream->sendSelf(commitTag, theChannel);
+}
+
+int
+AsyncStream::recvSelf(int commitTag, Channel &theChannel,
+                      FEM_ObjectBroker &theBroker)
+{
+  this->sync();
+  return theStream->recvSelf(commitTag, theChannel, theBroker);
+}
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: AsyncStream wraps another OPS_Stream so that the Vectors
+// written by a recorder are only copied, on the analysis thread, into a
+// bounded buffer shared by all AsyncStreams; a single writer thread then
+// passes them on to the wrapped streams, which do the formatting and the
+// file I/O. The buffer is double-buffered: while the writer empties one
+// half, records are added to the other, and a recorder only waits when the
+// half it is filling is full.
+//
+// Every other operation on the stream (tags, attributes, text, flush) is
+// carried out on the calling thread once the pending records of that
+// stream have been written, so that its output is in the same order as
+// without the wrapper; the records of the other streams are not waited for. Deleting an
+// AsyncStream, as a recorder does on wipe or remove recorders, writes its
+// pending records and then deletes the wrapped stream.
+//
+#ifndef AsyncStream_h
+#define AsyncStream_h
+
+#include <OPS_Stream.h>
+
+class AsyncStream : public OPS_Stream
+{
+ public:
+  // takes ownership of theStream
+  AsyncStream(OPS_Stream *theStream);
+  ~AsyncStream();
+
+  // the number of values the buffer holds in each half, for all streams
+  static void setBufferSize(int numValues);
+  // wait until all the records written so far have been passed on
+  static void drain(void);
+  // whether the writer thread is running, that is, any AsyncStream exists
+  static bool isWriting(void);
+
+  int setFile(const char *fileName, openMode mode = openMode::OVERWRITE, bool echo = false);
+  int setPrecision(int precision);
+  int setFloatField(Float);
+  int precision(int precision);
+  int width(int width);
+
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+  int flush();
+
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+  OPS_Stream& operator<<(std::string const &s);
+
+  void setAddCommon(int);
+  int setOrder(const ID &order);
+
+  // the wrapped stream is sent, so the receiving side writes synchronously
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+               FEM_ObjectBroker &theBroker);
+
+ private:
+  // wait until the records of this stream have been passed on
+  void sync(void);
+
+  OPS_Stream *theStream;
+};
+
+#endif
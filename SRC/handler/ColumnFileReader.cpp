@@ -0,0 +1,250 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of ColumnFileReader.
+//
+#include <ColumnFileReader.h>
+#include <ColumnFileStream.h>
+#include <OPS_Globals.h>
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef _WIN32
+#  include <fstream>
+#  include <iterator>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+ColumnFileReader::ColumnFileReader()
+:data(nullptr), size(0), numColumns(0), numRows(0), firstChunk(0)
+{
+
+}
+
+ColumnFileReader::~ColumnFileReader()
+{
+  this->close();
+}
+
+int
+ColumnFileReader::open(const char *fileName)
+{
+  this->close();
+
+#ifdef _WIN32
+  std::ifstream theFile(fileName, std::ios::in | std::ios::binary);
+  if (!theFile.is_open()) {
+    opserr << "WARNING ColumnFileReader::open() - could not open file " << fileName << "\n";
+    return -1;
+  }
+  contents.assign(std::istreambuf_iterator<char>(theFile), std::istreambuf_iterator<char>());
+  data = contents.data();
+  size = contents.size();
+#else
+  int fd = ::open(fileName, O_RDONLY);
+  struct stat info;
+  if (fd < 0 || fstat(fd, &info) != 0) {
+    opserr << "WARNING ColumnFileReader::open() - could not open file " << fileName << "\n";
+    if (fd >= 0)
+      ::close(fd);
+    return -1;
+  }
+  size = info.st_size;
+  if (size > 0) {
+    void *map = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    data = (map == MAP_FAILED) ? nullptr : (const char *)map;
+  }
+  ::close(fd);
+#endif
+
+  if (data == nullptr || size < 16 || memcmp(data, ColumnFile::Magic, 8) != 0) {
+    opserr << "WARNING ColumnFileReader::open() - " << fileName << " is not a column file\n";
+    this->close();
+    return -1;
+  }
+
+  // the header; each column takes at least the two lengths of its names
+  std::size_t position = 8;
+  uint32_t columns = *(const uint32_t *)(data + position);
+  position += 8;
+  if (columns > (size - position)/8) {
+    opserr << "WARNING ColumnFileReader::open() - " << fileName << " has a truncated header\n";
+    this->close();
+    return -1;
+  }
+  numColumns = columns;
+  labels.resize(numColumns);
+  sources.resize(numColumns);
+  for (int i = 0; i < numColumns; i++) {
+    for (std::string *text : {&labels[i], &sources[i]}) {
+      uint32_t length;
+      if (position + 4 > size ||
+          position + 4 + (length = *(const uint32_t *)(data + position)) > size) {
+        opserr << "WARNING ColumnFileReader::open() - " << fileName << " has a truncated header\n";
+        this->close();
+        return -1;
+      }
+      text->assign(data + position + 4, length);
+      position += 4 + length;
+    }
+  }
+  firstChunk = (position + 7)/8*8;
+
+  return this->readIndex();
+}
+
+void
+ColumnFileReader::close(void)
+{
+#ifdef _WIN32
+  contents.clear();
+#else
+  if (data != nullptr)
+    munmap((void *)data, size);
+#endif
+  data = nullptr;
+  size = 0;
+  numColumns = 0;
+  numRows = 0;
+  labels.clear();
+  sources.clear();
+  chunks.clear();
+}
+
+//
+// Whether the values of a chunk of rows rows starting at offset lie in the
+// file past the header; the product is not formed, so it cannot overflow.
+//
+bool
+ColumnFileReader::chunkFits(uint64_t offset, uint64_t rows) const
+{
+  if (offset < firstChunk || offset > size || offset % 8 != 0)
+    return false;
+  return numColumns == 0 || rows <= (size - offset)/(sizeof(double)*numColumns);
+}
+
+//
+// The chunks are taken from the index when the file was closed; otherwise,
+// or if an entry of the index does not fit the file, they are found by
+// stepping from the header of one chunk to the next.
+//
+int
+ColumnFileReader::readIndex(void)
+{
+  chunks.clear();
+  numRows = 0;
+
+  if (size >= firstChunk + 16 && memcmp(data + size - 8, ColumnFile::End, 8) == 0) {
+    uint64_t indexOffset = *(const uint64_t *)(data + size - 16);
+    if (indexOffset >= firstChunk && indexOffset + 8 <= size - 16
+        && memcmp(data + indexOffset, ColumnFile::Index, 4) == 0) {
+      uint32_t numChunks = *(const uint32_t *)(data + indexOffset + 4);
+      const uint64_t *entries = (const uint64_t *)(data + indexOffset + 8);
+      if (numChunks <= (size - 16 - indexOffset - 8)/16) {
+        bool valid = true;
+        for (uint32_t i = 0; i < numChunks && valid; i++) {
+          valid = this->chunkFits(entries[2*i], entries[2*i+1]);
+          if (valid) {
+            chunks.emplace_back(entries[2*i], long(entries[2*i+1]));
+            numRows += entries[2*i+1];
+          }
+        }
+        if (valid)
+          return 0;
+
+        opserr << "WARNING ColumnFileReader::open() - the index does not match the file; "
+                  "the chunks are read from their headers\n";
+        chunks.clear();
+        numRows = 0;
+      }
+    }
+  }
+
+  std::size_t position = firstChunk;
+  while (position + 8 <= size && memcmp(data + position, ColumnFile::Chunk, 4) == 0) {
+    uint32_t rows = *(const uint32_t *)(data + position + 4);
+    if (!this->chunkFits(position + 8, rows))
+      break;
+    chunks.emplace_back(position + 8, long(rows));
+    numRows += rows;
+    position += 8 + sizeof(double)*rows*numColumns;
+  }
+  return 0;
+}
+
+
+int
+ColumnFileReader::getNumColumns(void) const
+{
+  return numColumns;
+}
+
+long
+ColumnFileReader::getNumRows(void) const
+{
+  return numRows;
+}
+
+const std::string &
+ColumnFileReader::getLabel(int column) const
+{
+  assert(column >= 0 && column < numColumns);
+  return labels[column];
+}
+
+const std::string &
+ColumnFileReader::getSource(int column) const
+{
+  assert(column >= 0 && column < numColumns);
+  return sources[column];
+}
+
+int
+ColumnFileReader::findColumn(const char *label, const char *source) const
+{
+  for (int i = 0; i < numColumns; i++)
+    if (labels[i] == label && (source == nullptr || sources[i] == source))
+      return i;
+  return -1;
+}
+
+int
+ColumnFileReader::getNumChunks(void) const
+{
+  return chunks.size();
+}
+
+long
+ColumnFileReader::getChunkRows(int chunk) const
+{
+  assert(chunk >= 0 && chunk < (int)chunks.size());
+  return chunks[chunk].second;
+}
+
+const double *
+ColumnFileReader::getChunk(int chunk) const
+{
+  assert(chunk >= 0 && chunk < (int)chunks.size());
+  return (const double *)(data + chunks[chunk].first);
+}
+
+int
+ColumnFileReader::getColumn(int column, double *values) const
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+
+  for (const auto &chunk : chunks) {
+    const double *from = (const double *)(data + chunk.first) + column*chunk.second;
+    memcpy(values, from, chunk.second*sizeof(double));
+    values += chunk.second;
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: ColumnFileReader maps a file written by a ColumnFileStream
+// into memory and gives access to its columns. A chunk is returned in
+// place, as numColumns x numRows doubles, one column after the other, so
+// the values of a column over all the steps are found by visiting each
+// chunk once, without reading the rest of the file.
+//
+#ifndef ColumnFileReader_h
+#define ColumnFileReader_h
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class ColumnFileReader
+{
+ public:
+  ColumnFileReader();
+  ~ColumnFileReader();
+
+  int  open(const char *fileName);
+  void close(void);
+
+  int  getNumColumns(void) const;
+  long getNumRows(void) const;
+  // column is from 0 to getNumColumns()-1
+  const std::string &getLabel(int column) const;
+  const std::string &getSource(int column) const;
+
+  // the first column with this label, and source if given; -1 if none
+  int findColumn(const char *label, const char *source = nullptr) const;
+
+  // chunk is from 0 to getNumChunks()-1
+  int  getNumChunks(void) const;
+  long getChunkRows(int chunk) const;
+  const double *getChunk(int chunk) const;
+
+  // copies the values of a column over all the rows into values
+  int getColumn(int column, double *values) const;
+
+ private:
+  int  readIndex(void);
+  bool chunkFits(uint64_t offset, uint64_t rows) const;
+
+  const char *data;
+  std::size_t size;
+#ifdef _WIN32
+  std::vector<char> contents;
+#endif
+
+  int numColumns;
+  long numRows;
+  std::size_t firstChunk;
+  std::vector<std::string> labels;
+  std::vector<std::string> sources;
+  std::vector<std::pair<std::size_t, long>> chunks;
+};
+
+#endif
@@ -0,0 +1,252 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of ColumnFileStream.
+//
+#include <ColumnFileStream.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+ColumnFileStream::ColumnFileStream(const char *name, openMode mode)
+:OPS_Stream(OPS_STREAM_TAGS_ColumnFileStream),
+ fileName(name), theOpenMode(mode), fileOpen(false), headerDone(false),
+ numColumns(0)
+{
+
+}
+
+ColumnFileStream::~ColumnFileStream()
+{
+  this->close();
+}
+
+int
+ColumnFileStream::setFile(const char *name, openMode mode, bool echo)
+{
+  this->close();
+  fileName = name;
+  theOpenMode = mode;
+  return 0;
+}
+
+//
+// The index at the end of the file is rewritten on close, so a file is
+// always written from the start; APPEND is treated as OVERWRITE.
+//
+int
+ColumnFileStream::open(void)
+{
+  if (fileOpen)
+    return 0;
+
+  theFile.open(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING ColumnFileStream::open() - could not open file " << fileName.c_str() << "\n";
+    return -1;
+  }
+
+  fileOpen   = true;
+  headerDone = false;
+  index.clear();
+  rows.clear();
+  return 0;
+}
+
+int
+ColumnFileStream::close(void)
+{
+  if (!fileOpen)
+    return 0;
+
+  if (!headerDone)
+    this->writeHeader(int(labels.size()));
+  this->writeChunk();
+
+  uint64_t indexOffset = theFile.tellp();
+  uint32_t numChunks = index.size();
+  theFile.write(ColumnFile::Index, 4);
+  theFile.write((const char *)&numChunks, 4);
+  for (const auto &entry : index) {
+    uint64_t offset = entry.first, numRows = entry.second;
+    theFile.write((const char *)&offset, 8);
+    theFile.write((const char *)&numRows, 8);
+  }
+  theFile.write((const char *)&indexOffset, 8);
+  theFile.write(ColumnFile::End, 8);
+
+  theFile.close();
+  fileOpen = false;
+  return 0;
+}
+
+int
+ColumnFileStream::flush()
+{
+  if (!fileOpen || !headerDone)
+    return 0;
+
+  this->writeChunk();
+  theFile.flush();
+  return 0;
+}
+
+
+int
+ColumnFileStream::tag(const char *name)
+{
+  openTags.push_back(name);
+  return 0;
+}
+
+int
+ColumnFileStream::tag(const char *name, const char *value)
+{
+  if (strcmp(name, "ResponseType") != 0)
+    return 0;
+
+  std::string source;
+  for (const std::string &openTag : openTags)
+    if (!openTag.empty())
+      source += (source.empty() ? "" : "; ") + openTag;
+
+  labels.push_back(value);
+  sources.push_back(source);
+  return 0;
+}
+
+int
+ColumnFileStream::endTag()
+{
+  if (!openTags.empty())
+    openTags.pop_back();
+  return 0;
+}
+
+int
+ColumnFileStream::attr(const char *name, int value)
+{
+  return this->attr(name, std::to_string(value).c_str());
+}
+
+int
+ColumnFileStream::attr(const char *name, double value)
+{
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.17g", value);
+  return this->attr(name, buffer);
+}
+
+int
+ColumnFileStream::attr(const char *name, const char *value)
+{
+  if (openTags.empty())
+    openTags.push_back(std::string());
+
+  std::string &attributes = openTags.back();
+  if (!attributes.empty())
+    attributes += " ";
+  attributes += std::string(name) + "=" + value;
+  return 0;
+}
+
+
+int
+ColumnFileStream::write(Vector &data)
+{
+  if (!fileOpen && this->open() < 0)
+    return -1;
+
+  if (!headerDone && this->writeHeader(data.Size()) < 0)
+    return -1;
+
+  // a row that does not match the header is cut short or padded with zeros
+  const int n = data.Size() < numColumns ? data.Size() : numColumns;
+  for (int i = 0; i < n; i++)
+    rows.push_back(data(i));
+  for (int i = n; i < numColumns; i++)
+    rows.push_back(0.0);
+
+  if (numColumns > 0 && int(rows.size()/numColumns) == ColumnFile::ChunkRows)
+    return this->writeChunk();
+
+  return 0;
+}
+
+
+int
+ColumnFileStream::writeHeader(int numValues)
+{
+  if (!fileOpen && this->open() < 0)
+    return -1;
+
+  if (int(labels.size()) + 1 == numValues) {
+    labels.insert(labels.begin(), "time");
+    sources.insert(sources.begin(), "");
+  }
+  numColumns = numValues;
+  labels.resize(numColumns);
+  sources.resize(numColumns);
+
+  uint32_t header[2] = {uint32_t(numColumns), 0};
+  theFile.write(ColumnFile::Magic, 8);
+  theFile.write((const char *)header, 8);
+  for (int i = 0; i < numColumns; i++) {
+    for (const std::string *text : {&labels[i], &sources[i]}) {
+      uint32_t length = text->size();
+      theFile.write((const char *)&length, 4);
+      theFile.write(text->data(), length);
+    }
+  }
+
+  static const char zeros[8] = {0};
+  long position = theFile.tellp();
+  if (position % 8 != 0)
+    theFile.write(zeros, 8 - position % 8);
+
+  headerDone = true;
+  return theFile.bad() ? -1 : 0;
+}
+
+int
+ColumnFileStream::writeChunk(void)
+{
+  if (numColumns == 0 || rows.empty())
+    return 0;
+
+  const uint32_t numRows = rows.size()/numColumns;
+  chunk.resize(rows.size());
+  for (uint32_t r = 0; r < numRows; r++)
+    for (int c = 0; c < numColumns; c++)
+      chunk[c*numRows + r] = rows[r*numColumns + c];
+
+  theFile.write(ColumnFile::Chunk, 4);
+  theFile.write((const char *)&numRows, 4);
+  index.emplace_back(uint64_t(theFile.tellp()), numRows);
+  theFile.write((const char *)chunk.data(), chunk.size()*sizeof(double));
+
+  rows.clear();
+  return theFile.bad() ? -1 : 0;
+}
+
+
+int
+ColumnFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "ColumnFileStream::sendSelf() - not supported in parallel\n";
+  return -1;
+}
+
+int
+ColumnFileStream::recvSelf(int commitTag, Channel &theChannel,
+                           FEM_ObjectBroker &theBroker)
+{
+  opserr << "ColumnFileStream::recvSelf() - not supported in parallel\n";
+  return -1;
+}
@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: ColumnFileStream writes the rows of a recorder to a binary
+// file in column-major chunks, together with a header that names each
+// column, so that a ColumnFileReader can pull any column over all steps
+// by visiting each chunk once rather than reading the whole file.
+//
+// The columns are named from the ResponseType tags a recorder writes while
+// it describes its output, and the source of each gives the tags that
+// enclose it with their attributes, outermost first and separated by "; ",
+// e.g. "NodeOutput nodeTag=3 coord1=0 coord2=0 coord3=0" for "UX", or
+// "ElementOutput eleTag=1 ...; GaussPoint number=1 ...; ..." for a
+// section response. A leading column without a ResponseType tag, as
+// written by a recorder with -time, is named "time".
+//
+// Layout (native byte order; every block starts on an 8 byte boundary):
+//
+//   header   "OPSCOL01"  u32 numColumns  u32 0
+//            per column: u32 length, label; u32 length, source
+//            padding to 8 bytes
+//   chunk    "CHNK"  u32 numRows
+//            numColumns x numRows doubles, one column after the other
+//   ...
+//   index    "INDX"  u32 numChunks  per chunk: u64 offset  u64 numRows
+//   trailer  u64 offset of index  "OPSCEND\0"
+//
+// The index is written when the stream is closed; a reader of a file that
+// was not closed finds the chunks from their headers.
+//
+#ifndef ColumnFileStream_h
+#define ColumnFileStream_h
+
+#include <OPS_Stream.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ColumnFile {
+  constexpr char Magic[8]   = {'O','P','S','C','O','L','0','1'};
+  constexpr char Chunk[4]   = {'C','H','N','K'};
+  constexpr char Index[4]   = {'I','N','D','X'};
+  constexpr char End[8]     = {'O','P','S','C','E','N','D','\0'};
+  constexpr int  ChunkRows  = 1024;
+}
+
+class ColumnFileStream : public OPS_Stream
+{
+ public:
+  ColumnFileStream(const char *fileName, openMode mode = openMode::OVERWRITE);
+  ~ColumnFileStream();
+
+  int setFile(const char *fileName, openMode mode = openMode::OVERWRITE, bool echo = false);
+  int open(void);
+  int close(void);
+  int flush();
+
+  // xml stuff, from which the columns are named
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+               FEM_ObjectBroker &theBroker);
+
+ private:
+  int writeHeader(int numValues);
+  int writeChunk(void);
+
+  std::ofstream theFile;
+  std::string fileName;
+  openMode theOpenMode;
+  bool fileOpen;
+  bool headerDone;
+
+  // the open tags, each its name followed by its attributes, and the
+  // columns named so far
+  std::vector<std::string> openTags;
+  std::vector<std::string> labels;
+  std::vector<std::string> sources;
+
+  int numColumns;
+  std::vector<double> rows;    // the rows of the current chunk, row by row
+  std::vector<double> chunk;   // the same, column by column
+  std::vector<std::pair<unsigned long long, unsigned long long>> index;
+};
+
+#endif
@@ -0,0 +1,202 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file is a driver to test ColumnFileStream and
+// ColumnFileReader. A file of three columns and 2500 rows (three chunks)
+// is written as a recorder would write it and read back; then copies of
+// it are read with the trailer and half of the last chunk cut off, with
+// an index entry that points past the end of the file, and with a header
+// that claims more columns than the file can hold.
+//
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <Domain.h>
+#include <Vector.h>
+#include <StandardStream.h>
+#include <ColumnFileStream.h>
+#include <ColumnFileReader.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+thread_local Element *ops_TheActiveElement = 0;
+
+static const int numRows = 2500;
+
+static double
+value(int row, int column)
+{
+  return column == 0 ? 0.01*row : (column == 1 ? 1.0 : -1.0)*row*row;
+}
+
+static std::vector<char>
+readBytes(const char *fileName)
+{
+  std::ifstream theFile(fileName, std::ios::in | std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(theFile), std::istreambuf_iterator<char>());
+}
+
+static void
+writeBytes(const char *fileName, const std::vector<char> &bytes, std::size_t size)
+{
+  std::ofstream theFile(fileName, std::ios::out | std::ios::trunc | std::ios::binary);
+  theFile.write(bytes.data(), size);
+}
+
+// whether the reader holds the first rows rows of the file written below
+static bool
+checkValues(const ColumnFileReader &theReader, long rows)
+{
+  if (theReader.getNumColumns() != 3 || theReader.getNumRows() != rows)
+    return false;
+
+  std::vector<double> values(rows);
+  for (int c = 0; c < 3; c++) {
+    if (theReader.getColumn(c, values.data()) != 0)
+      return false;
+    for (long r = 0; r < rows; r++)
+      if (values[r] != value(r, c))
+        return false;
+  }
+  return true;
+}
+
+static int numFailed = 0;
+
+static void
+report(const char *test, bool passed)
+{
+  if (passed)
+    opserr << "PASS: " << test << "\n\n";
+  else {
+    opserr << "FAIL: " << test << "\n\n";
+    numFailed++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *fileName = "UnitTestColumnFile";
+  const char *copyName = "UnitTestColumnFile.copy";
+
+  opserr << " *******************************************************************\n";
+  opserr << "                  ColumnFileStream/ColumnFileReader unit test\n";
+  opserr << " *******************************************************************\n\n";
+
+  //
+  // write the file as a NodeRecorder with -time would
+  //
+
+  opserr << "TEST: write " << numRows << " rows of time, UX and UY of node 3\n";
+  {
+    ColumnFileStream theStream(fileName);
+    theStream.tag("OpenSees");
+    theStream.tag("TimeOutput");
+    theStream.tag("ResponseType", "time");
+    theStream.endTag();
+    theStream.tag("NodeOutput");
+    theStream.attr("nodeTag", 3);
+    theStream.tag("ResponseType", "UX");
+    theStream.tag("ResponseType", "UY");
+    theStream.endTag();
+    theStream.tag("Data");
+
+    Vector row(3);
+    for (int r = 0; r < numRows; r++) {
+      for (int c = 0; c < 3; c++)
+        row(c) = value(r, c);
+      theStream.write(row);
+    }
+    theStream.endTag();
+    theStream.endTag();
+  }
+
+  ColumnFileReader theReader;
+  bool passed = theReader.open(fileName) == 0
+             && checkValues(theReader, numRows)
+             && theReader.getNumChunks() == (numRows + ColumnFile::ChunkRows - 1)/ColumnFile::ChunkRows;
+  report("round trip of the values", passed);
+
+  opserr << "TEST: the column names\n";
+  passed = passed
+        && theReader.getLabel(0) == "time" && theReader.getSource(0) == "OpenSees; TimeOutput"
+        && theReader.getLabel(1) == "UX"   && theReader.getSource(1) == "OpenSees; NodeOutput nodeTag=3"
+        && theReader.findColumn("UY") == 2
+        && theReader.findColumn("UY", "OpenSees; NodeOutput nodeTag=3") == 2
+        && theReader.findColumn("UY", "OpenSees; NodeOutput nodeTag=4") == -1;
+  report("labels and sources", passed);
+
+  theReader.close();
+  std::vector<char> bytes = readBytes(fileName);
+
+  //
+  // a file that was not closed: the trailer and half of the last chunk
+  // are missing, so only the complete chunks are read
+  //
+
+  opserr << "TEST: a truncated file\n";
+  {
+    // the offset of the values of the last chunk, from the index
+    uint64_t indexOffset;
+    memcpy(&indexOffset, bytes.data() + bytes.size() - 16, 8);
+    uint32_t numChunks;
+    memcpy(&numChunks, bytes.data() + indexOffset + 4, 4);
+    uint64_t offset;
+    memcpy(&offset, bytes.data() + indexOffset + 8 + 16*(numChunks - 1), 8);
+
+    writeBytes(copyName, bytes, offset + 3*sizeof(double)*100);
+    const long rows = long(numChunks - 1)*ColumnFile::ChunkRows;
+    report("truncated file reads the complete chunks",
+           theReader.open(copyName) == 0 && checkValues(theReader, rows));
+    theReader.close();
+
+    //
+    // an index entry with more rows than the file holds
+    //
+    opserr << "TEST: an index that does not fit the file\n";
+    std::vector<char> corrupt = bytes;
+    uint64_t rows0 = uint64_t(1) << 60;
+    memcpy(corrupt.data() + indexOffset + 8 + 8, &rows0, 8);
+    writeBytes(copyName, corrupt, corrupt.size());
+    report("bad index falls back to the chunk headers",
+           theReader.open(copyName) == 0 && checkValues(theReader, numRows));
+    theReader.close();
+  }
+
+  //
+  // a header that claims more columns than the file can hold
+  //
+
+  opserr << "TEST: a header with too many columns\n";
+  {
+    std::vector<char> header(64, 0);
+    memcpy(header.data(), ColumnFile::Magic, 8);
+    uint32_t columns = 0x7fffffff;
+    memcpy(header.data() + 8, &columns, 4);
+    writeBytes(copyName, header, header.size());
+    report("open() fails", theReader.open(copyName) != 0 && theReader.getNumColumns() == 0);
+  }
+
+  remove(fileName);
+  remove(copyName);
+
+  if (numFailed == 0)
+    opserr << "PASSED ColumnFileStream unit test\n";
+  else
+    opserr << "FAILED ColumnFileStream unit test: " << numFailed << " failures\n";
+
+  return numFailed == 0 ? 0 : 1;
+}
@@ -29,8 +29,9 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 
 #include "FiberResponse.h"
 
-// #include <threads/thread_pool.hpp>
 // #define N_FIBER_THREADS 6
+#include <vector>
+#include <FiberThreads.h>
 
 ID FrameFiberSection3d::code(4);
 
@@ -52,9 +53,6 @@ FrameFiberSection3d::FrameFiberSection3d(int tag, int num, Fiber **fibers,
   FrameSection(tag, SEC_TAG_FrameFiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(eData), s(sData), ks(kData,4,4), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -114,9 +112,6 @@ FrameFiberSection3d::FrameFiberSection3d(int tag, int num, UniaxialMaterial &tor
     QzBar(0.0), QyBar(0.0), Abar(0.0), 
     yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
     theTorsion(0),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
     e(eData), s(sData)
 {
     if (sizeFibers != 0) {
@@ -144,9 +139,6 @@ FrameFiberSection3d::FrameFiberSection3d():
   FrameSection(0, SEC_TAG_FrameFiberSection3d, 0, false),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(true),
-#ifdef N_FIBER_THREADS
-  pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(eData), s(sData), theTorsion(0)
 {
   eData.zero();
@@ -307,8 +299,6 @@ FrameFiberSection3d::addFiber(UniaxialMaterial &theMat,
 }
 
 
-#ifdef N_FIBER_THREADS
-#include <mutex>
 int
 FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 {
@@ -322,113 +312,80 @@ FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
                e2 = deforms(2),
                e3 = deforms(3);
 
-  int res = 0;
-  std::mutex resp_mutex;
-
-  ((OpenSees::thread_pool*)pool)->submit_loop<unsigned int>(0, numFibers,
-  [&,e0,e1,e2](int i){
-    int res = 0;
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    const double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    const double EA = tangent * A;
-
-    const std::lock_guard<std::mutex> lock(resp_mutex);
-    kData[ 0] +=     EA;
-    kData[ 1] +=  -y*EA;
-    kData[ 2] +=   z*EA;
-
-    kData[ 5] +=  y*y*EA;
-    kData[10] +=  z*z*EA; 
-    kData[ 6] += -y*z*EA;
-
-    double fs0 = stress * A;
-    sData[ 0] +=    fs0;  // N
-    sData[ 1] += -y*fs0;  // Mz
-    sData[ 2] +=  z*fs0;  // My
+  // contribution of fibers [start, end) to the sums
+  //   EA, -yEA, zEA, yyEA, zzEA, -yzEA, N, Mz, My
+  auto fibers = [&](int start, int end, double *sum) -> int {
+    const int n = end - start;
+    const double *fiberData = &matData[3*start];
+
+    thread_local std::vector<double> work;
+    work.resize(3*n);
+    double *strain  = work.data(),
+           *stress  = strain + n,
+           *tangent = stress + n;
+
+    // determine material strains and set them in one batch
+    for (int i = 0; i < n; i++) {
+      const double y = fiberData[3*i]   - yBar;
+      const double z = fiberData[3*i+1] - zBar;
+      strain[i] = e0 - y*e1 + z*e2;
+    }
+    const int res = theMaterials[start]->setTrialBatch(&theMaterials[start], n,
+                                                       strain, stress, tangent);
+
+    for (int i = 0; i < n; i++) {
+      const double y = fiberData[3*i]   - yBar;
+      const double z = fiberData[3*i+1] - zBar;
+      const double A = fiberData[3*i+2];
+
+      const double EA = tangent[i] * A;
+      sum[0] +=      EA;
+      sum[1] +=   -y*EA;
+      sum[2] +=    z*EA;
+      sum[3] +=  y*y*EA;
+      sum[4] +=  z*z*EA;
+      sum[5] += -y*z*EA;
+
+      const double fs0 = stress[i] * A;
+      sum[6] +=    fs0;  // N
+      sum[7] += -y*fs0;  // Mz
+      sum[8] +=  z*fs0;  // My
+    }
 
     return res;
-  }).wait();
-
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
- 
-  if (theTorsion != nullptr) {
-    double stress, tangent;
-    res += theTorsion->setTrial(e3, stress, tangent);
-    sData[ 3] = stress;
-    kData[15] = tangent;
-  }
-
-  return res;
-}
-
-#else
-
-int
-FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
-{
-  e = deforms;
- 
-  sData.zero();
-  ks.zero();
-
-  const double e0 = deforms(0), // u'
-               e1 = deforms(1),
-               e2 = deforms(2),
-               e3 = deforms(3);
+  };
 
   int res = 0;
-  for (int i = 0; i < numFibers; i++) {
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    double EA     = tangent * A;
-
-    ks( 0, 0) +=     EA;
-    ks( 0, 1) +=  -y*EA;
-    ks( 0, 2) +=   z*EA;
-//  ks( 0, 2) +=   z*EA;
-
-    ks( 1, 1) +=  y*y*EA; // 5
-    ks( 2, 2) +=  z*z*EA; // 10
-    ks( 1, 2) += -y*z*EA;
-
-    double fs0 = stress * A;
-    sData[0] +=    fs0;  // N
-    sData[1] += -y*fs0;  // Mz
-    sData[2] +=  z*fs0;  // My
-  }
-
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
+  double sum[9] = {0.0};
+#ifdef N_FIBER_THREADS
+  if (numFibers >= FIBER_THREAD_THRESHOLD
+      && OpenSees::fibers_thread_safe(theMaterials, numFibers, numFibersChecked, threadSafeFibers))
+    res += OpenSees::fiber_reduce<9>(numFibers, sum, fibers);
+  else
+#endif
+  if (numFibers > 0)
+    res += fibers(0, numFibers, sum);
+
+  ks(0,0) = sum[0];
+  ks(0,1) = ks(1,0) = sum[1];
+  ks(0,2) = ks(2,0) = sum[2];
+  ks(1,1) = sum[3];
+  ks(2,2) = sum[4];
+  ks(1,2) = ks(2,1) = sum[5];
+
+  sData[0] = sum[6];
+  sData[1] = sum[7];
+  sData[2] = sum[8];
  
   if (theTorsion != nullptr) {
     double stress, tangent;
     res += theTorsion->setTrial(e3, stress, tangent);
     sData[ 3] = stress;
-    kData[15] = tangent;
+    ks(3,3) = tangent;
   }
 
   return res;
 }
-#endif
 
 
 
@@ -498,7 +455,6 @@ FrameFiberSection3d::getFrameCopy()
   theCopy->setTag(this->getTag());
   theCopy->numFibers  = numFibers;
   theCopy->sizeFibers = numFibers;
-  theCopy->pool       = pool;
 
   if (numFibers != 0) {
     theCopy->theMaterials = new UniaxialMaterial *[numFibers];
@@ -554,9 +510,7 @@ FrameFiberSection3d::getOrder() const
 int
 FrameFiberSection3d::commitState()
 {
-  int err = 0;
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  int err = fiberState.commit(theMaterials, numFibers);
 
   if (theTorsion != 0)
     err += theTorsion->commitState();
@@ -575,6 +529,9 @@ FrameFiberSection3d::revertToLastCommit()
   kData[15] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
+  // invoke revertToLast on the materials
+  err += fiberState.revert(theMaterials, numFibers);
+
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
 
@@ -582,9 +539,6 @@ FrameFiberSection3d::revertToLastCommit()
     double z  = matData[3*i+1] - zBar;
     double A  = matData[3*i+2];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
     double tangent = theMat->getTangent();
     double stress = theMat->getStress();
 
@@ -839,6 +793,10 @@ FrameFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
     }
 
+    // the materials may have been replaced
+    numFibersChecked = -1;
+    fiberState.reset();
+
     QzBar = 0.0;
     QyBar = 0.0;
     Abar  = 0.0;
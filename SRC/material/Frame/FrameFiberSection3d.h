@@ -22,6 +22,7 @@
 #include <Matrix.h>
 #include <VectorND.h>
 #include <memory>
+#include <FiberStateBuffer.h>
 
 class Response;
 class UniaxialMaterial;
@@ -89,6 +90,9 @@ class FrameFiberSection3d : public FrameSection
   private:
     int numFibers, sizeFibers;         // number of fibers in the section
     UniaxialMaterial **theMaterials;   // array of pointers to materials
+    int  numFibersChecked = -1;        // fibers for which threadSafeFibers was found
+    bool threadSafeFibers = false;     // whether the materials may be updated concurrently
+    OpenSees::FiberStateBuffer fiberState; // trial and committed history of the fibers
     std::shared_ptr<double[]> matData; // data for the materials [yloc, zloc, and area]
     double   kData[16];                // data for ks matrix
     OpenSees::MatrixND<4,4> ks;
@@ -106,7 +110,6 @@ class FrameFiberSection3d : public FrameSection
 
     OpenSees::VectorND<4> eData, sData;
     UniaxialMaterial *theTorsion;
-    void *pool;        // thread pool
 };
 
 #endif
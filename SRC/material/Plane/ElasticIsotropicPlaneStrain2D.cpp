@@ -25,8 +25,8 @@
                                                                         
 #include <ElasticIsotropicPlaneStrain2D.h>                                                                        
 #include <Channel.h>
-Vector ElasticIsotropicPlaneStrain2D::sigma(3);
-Matrix ElasticIsotropicPlaneStrain2D::D(3,3);
+thread_local Vector ElasticIsotropicPlaneStrain2D::sigma(3);
+thread_local Matrix ElasticIsotropicPlaneStrain2D::D(3,3);
 
 ElasticIsotropicPlaneStrain2D::ElasticIsotropicPlaneStrain2D
 (int tag, double E, double nu, double rho) :
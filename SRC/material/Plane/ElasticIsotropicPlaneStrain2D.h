@@ -62,6 +62,7 @@ class ElasticIsotropicPlaneStrain2D : public ElasticIsotropicMaterial
     int commitState (void);
     int revertToLastCommit (void);
     int revertToStart (void);
+    bool isThreadSafe(void) const {return true;}
     
     NDMaterial *getCopy (void);
     const char *getType (void) const;
@@ -74,8 +75,8 @@ class ElasticIsotropicPlaneStrain2D : public ElasticIsotropicMaterial
   protected:
 
   private:
-    static Vector sigma;        // Stress vector ... class-wide for returns
-    static Matrix D;	        // Elastic constants
+    static thread_local Vector sigma;        // Stress vector ... one per thread for returns
+    static thread_local Matrix D;	        // Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strains
 };
@@ -60,6 +60,7 @@ class ElasticIsotropicThreeDimensional : public ElasticIsotropicMaterial
     int commitState (void);
     int revertToLastCommit (void);
     int revertToStart (void);
+    bool isThreadSafe(void) const {return true;}
     
     NDMaterial *getCopy (void);
     const char *getType (void) const;
@@ -75,8 +76,8 @@ class ElasticIsotropicThreeDimensional : public ElasticIsotropicMaterial
  protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... one per thread for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strain
 };
@@ -97,6 +97,12 @@ NDMaterial::getCopy(const char *type)
     return 0;
 }
 
+bool
+NDMaterial::isThreadSafe(void) const
+{
+  return false;
+}
+
 double
 NDMaterial::getRho(void)
 {
@@ -76,6 +76,11 @@ class NDMaterial : public Material
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
 
+    // Whether distinct instances may be given trial strains, committed
+    // and reverted from several threads at once; see
+    // UniaxialMaterial::isThreadSafe. The default is false.
+    virtual bool isThreadSafe(void) const;
+
     virtual NDMaterial *getCopy(void) = 0;
     virtual NDMaterial *getCopy(const char *code);
 
@@ -35,8 +35,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection2d::s(2);
-Matrix ElasticSection2d::ks(2,2);
+thread_local Vector ElasticSection2d::s(2);
+thread_local Matrix ElasticSection2d::ks(2,2);
 ID ElasticSection2d::code(2);
 
 void *
@@ -40,6 +40,7 @@ class ElasticSection2d: public FrameSection
   int commitState(void);
   int revertToLastCommit(void);
   int revertToStart(void);
+  bool isThreadSafe(void) const {return true;}
   
   const char *getClassType(void) const {return "ElasticSection2d";};
   
@@ -80,8 +81,8 @@ class ElasticSection2d: public FrameSection
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
   
   int parameterID;
@@ -34,8 +34,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection3d::s(4);
-Matrix ElasticSection3d::ks(4,4);
+thread_local Vector ElasticSection3d::s(4);
+thread_local Matrix ElasticSection3d::ks(4,4);
 ID ElasticSection3d::code(4);
 
 void *
@@ -44,6 +44,7 @@ class ElasticSection3d : public FrameSection
   int commitState(void);
   int revertToLastCommit(void);
   int revertToStart(void);
+  bool isThreadSafe(void) const {return true;}
   
   int setTrialSectionDeformation(const Vector&);
   const Vector &getSectionDeformation(void);
@@ -80,8 +81,8 @@ class ElasticSection3d : public FrameSection
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
 
   int parameterID;
@@ -40,6 +40,8 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <UniaxialMaterial.h>
 
 #include "FiberResponse.h"
+#include <vector>
+#include <FiberThreads.h>
 
 ID FiberSection2d::code(2);
 
@@ -186,28 +188,57 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   const double d0 = deforms(0),
                d1 = deforms(1);
 
+  // contribution of fibers [start, end) to the sums EA, -yEA, yyEA, N, M
+  auto fibers = [&](int start, int end, double *sum) -> int {
+    const int n = end - start;
+    const double *fiberData = &matData[2*start];
+
+    thread_local std::vector<double> work;
+    work.resize(3*n);
+    double *strain  = work.data(),
+           *stress  = strain + n,
+           *tangent = stress + n;
+
+    // determine material strains and set them in one batch
+    for (int i = 0; i < n; i++)
+      strain[i] = d0 - (fiberData[2*i] - yBar)*d1;
+
+    const int res = theMaterials[start]->setTrialBatch(&theMaterials[start], n,
+                                                       strain, stress, tangent);
+
+    for (int i = 0; i < n; i++) {
+      const double y = fiberData[2*i] - yBar;
+      const double A = fiberData[2*i+1];
+
+      double ks0 = tangent[i] * A;
+      double ks1 = ks0 * -y;
+      sum[0] += ks0;
+      sum[1] += ks1;
+      sum[2] += ks1 * -y;
+
+      double fs0 = stress[i] * A;
+      sum[3] += fs0;
+      sum[4] += fs0 * -y;
+    }
+    return res;
+  };
   
   int res = 0;
-  for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
-    const double y = matData[2*i] - yBar;
-    const double A = matData[2*i+1];
-
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
-
-    double ks0 = tangent * A;
-    double ks1 = ks0 * -y;
-    kData[0]  += ks0;
-    kData[1]  += ks1;
-    kData[3]  += ks1 * -y;
-
-    double fs0 = stress * A;
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
-  }
+  double sum[5] = {0.0};
+#ifdef N_FIBER_THREADS
+  if (numFibers >= FIBER_THREAD_THRESHOLD
+      && OpenSees::fibers_thread_safe(theMaterials, numFibers, numFibersChecked, threadSafeFibers))
+    res += OpenSees::fiber_reduce<5>(numFibers, sum, fibers);
+  else
+#endif
+  if (numFibers > 0)
+    res += fibers(0, numFibers, sum);
+
+  kData[0] = sum[0];
+  kData[1] = sum[1];
+  kData[3] = sum[2];
+  sData[0] = sum[3];
+  sData[1] = sum[4];
 
   kData[2] = kData[1];
 
@@ -223,8 +254,8 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  thread_local double kInitial[4];
+  thread_local Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
 
@@ -317,12 +348,7 @@ FiberSection2d::getOrder () const
 int
 FiberSection2d::commitState(void)
 {
-  int err = 0;
-
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
-
-  return err;
+  return fiberState.commit(theMaterials, numFibers);
 }
 
 int
@@ -333,14 +359,14 @@ FiberSection2d::revertToLastCommit(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
 
+  // invoke revertToLast on the materials
+  err += fiberState.revert(theMaterials, numFibers);
+
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
     const double y = matData[2*i] - yBar;
     const double A = matData[2*i+1];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
     // get material stress & tangent for this strain and determine ks and fs
     double tangent = theMat->getTangent();
     double stress = theMat->getStress();
@@ -360,6 +386,15 @@ FiberSection2d::revertToLastCommit(void)
   return err;
 }
 
+bool
+FiberSection2d::isThreadSafe(void) const
+{
+  for (int i = 0; i < numFibers; i++)
+    if (!theMaterials[i]->isThreadSafe())
+      return false;
+  return true;
+}
+
 int
 FiberSection2d::revertToStart(void)
 {
@@ -540,6 +575,10 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
       res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
     }
 
+    // the materials may have been replaced
+    numFibersChecked = -1;
+    fiberState.reset();
+
     QzBar = 0.0;
     ABar  = 0.0;
     double yLoc, Area;
@@ -919,7 +958,7 @@ FiberSection2d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(2);
+  thread_local Vector dummy(2);
 
   return dummy;
 }
@@ -927,7 +966,7 @@ FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(2);
+  thread_local Vector ds(2);
   
   ds.Zero();
   
@@ -985,7 +1024,7 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(2,2);
+  thread_local Matrix dksdh(2,2);
   
   dksdh.Zero();
 
@@ -33,6 +33,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <memory>
+#include <FiberStateBuffer.h>
 
 class UniaxialMaterial;
 class Response;
@@ -61,6 +62,7 @@ class FiberSection2d : public FrameSection
     int   commitState(void);
     int   revertToLastCommit(void);    
     int   revertToStart(void);
+    bool  isThreadSafe(void) const;
  
     FrameSection *getFrameCopy();
     const ID &getType(void);
@@ -94,6 +96,9 @@ class FiberSection2d : public FrameSection
     //  private:
     int numFibers, sizeFibers;         // number of fibers in the section
     UniaxialMaterial **theMaterials;   // array of pointers to materials
+    int  numFibersChecked = -1;        // fibers for which threadSafeFibers was found
+    bool threadSafeFibers = false;     // whether the materials may be updated concurrently
+    OpenSees::FiberStateBuffer fiberState; // trial and committed history of the fibers
     std::shared_ptr<double[]> matData; // data for the materials [yloc and area]
     double   kData[4];                 // data for ks matrix 
     double   sData[2];                 // data for s vector 
@@ -43,8 +43,9 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 
 #include "FiberResponse.h"
 
-// #include <threads/thread_pool.hpp>
 // #define N_FIBER_THREADS 6
+#include <vector>
+#include <FiberThreads.h>
 
 ID FiberSection3d::code(4);
 
@@ -56,9 +57,6 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers,
   FrameSection(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(eData), s(sData), ks(kData,4,4), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -115,9 +113,6 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial &torsion, bool
     numFibers(0), sizeFibers(num), theMaterials(nullptr), matData(new double [num*3]{}),
     QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
     theTorsion(0),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
     e(eData), s(sData), ks(kData, 4, 4)
 {
     if (sizeFibers != 0) {
@@ -207,9 +202,6 @@ FiberSection3d::FiberSection3d():
   FrameSection(0, SEC_TAG_FiberSection3d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(true), 
-#ifdef N_FIBER_THREADS
-  pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(eData), s(sData), ks(kData, 4,4), theTorsion(0)
 {
 //   s = new Vector(sData, 4);
@@ -353,8 +345,6 @@ FiberSection3d::addFiber(UniaxialMaterial &theMat, const double Area, const doub
 }
 
 
-#ifdef N_FIBER_THREADS
-#include <mutex>
 int
 FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 {
@@ -368,101 +358,74 @@ FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
                e2 = deforms(2),
                e3 = deforms(3);
 
-  int res = 0;
-  std::mutex resp_mutex;
-
-  ((OpenSees::thread_pool*)pool)->submit_loop<unsigned int>(0, numFibers,
-  [&,e0,e1,e2](int i){
-    int res = 0;
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    const double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    const double EA = tangent * A;
-
-    const std::lock_guard<std::mutex> lock(resp_mutex);
-    kData[ 0] +=     EA;
-    kData[ 1] +=  -y*EA;
-    kData[ 2] +=   z*EA;
-
-    kData[ 5] +=  y*y*EA;
-    kData[10] +=  z*z*EA; 
-    kData[ 6] += -y*z*EA;
-
-    double fs0 = stress * A;
-    sData[ 0] +=    fs0;  // N
-    sData[ 1] += -y*fs0;  // Mz
-    sData[ 2] +=  z*fs0;  // My
+  // contribution of fibers [start, end) to the sums
+  //   EA, -yEA, zEA, yyEA, zzEA, -yzEA, N, Mz, My
+  auto fibers = [&](int start, int end, double *sum) -> int {
+    const int n = end - start;
+    const double *fiberData = &matData[3*start];
+
+    thread_local std::vector<double> work;
+    work.resize(3*n);
+    double *strain  = work.data(),
+           *stress  = strain + n,
+           *tangent = stress + n;
+
+    // determine material strains and set them in one batch
+    for (int i = 0; i < n; i++) {
+      const double y = fiberData[3*i]   - yBar;
+      const double z = fiberData[3*i+1] - zBar;
+      strain[i] = e0 - y*e1 + z*e2;
+    }
+    const int res = theMaterials[start]->setTrialBatch(&theMaterials[start], n,
+                                                       strain, stress, tangent);
+
+    for (int i = 0; i < n; i++) {
+      const double y = fiberData[3*i]   - yBar;
+      const double z = fiberData[3*i+1] - zBar;
+      const double A = fiberData[3*i+2];
+
+      const double EA = tangent[i] * A;
+      sum[0] +=      EA;
+      sum[1] +=   -y*EA;
+      sum[2] +=    z*EA;
+      sum[3] +=  y*y*EA;
+      sum[4] +=  z*z*EA;
+      sum[5] += -y*z*EA;
+
+      const double fs0 = stress[i] * A;
+      sum[6] +=    fs0;  // N
+      sum[7] += -y*fs0;  // Mz
+      sum[8] +=  z*fs0;  // My
+    }
 
     return res;
-  }).wait();
-
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
- 
-  if (theTorsion != nullptr) {
-    double stress, tangent;
-    res += theTorsion->setTrial(e3, stress, tangent);
-    sData[ 3] = stress;
-    kData[15] = tangent;
-  }
-
-  return res;
-}
-
-#else
-
-int
-FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
-{
-  e = deforms;
- 
-  sData.zero();
-  ks.Zero();
-
-  const double e0 = deforms(0), // u'
-               e1 = deforms(1),
-               e2 = deforms(2),
-               e3 = deforms(3);
+  };
 
   int res = 0;
-  for (int i = 0; i < numFibers; i++) {
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    double EA     = tangent * A;
-
-    kData[0] +=     EA;
-    kData[1] +=  -y*EA;
-    kData[2] +=   z*EA;
+  double sum[9] = {0.0};
+#ifdef N_FIBER_THREADS
+  if (numFibers >= FIBER_THREAD_THRESHOLD
+      && OpenSees::fibers_thread_safe(theMaterials, numFibers, numFibersChecked, threadSafeFibers))
+    res += OpenSees::fiber_reduce<9>(numFibers, sum, fibers);
+  else
+#endif
+  if (numFibers > 0)
+    res += fibers(0, numFibers, sum);
 
-    kData[ 5] +=  y*y*EA;
-    kData[10] +=  z*z*EA; 
-    kData[ 6] += -y*z*EA;
-
-    double fs0 = stress * A;
-    sData[0] +=    fs0;  // N
-    sData[1] += -y*fs0;  // Mz
-    sData[2] +=  z*fs0;  // My
-  }
+  kData[ 0] = sum[0];
+  kData[ 1] = sum[1];
+  kData[ 2] = sum[2];
+  kData[ 5] = sum[3];
+  kData[10] = sum[4];
+  kData[ 6] = sum[5];
 
   kData[4] = kData[1];
   kData[8] = kData[2];
   kData[9] = kData[6];
+
+  sData[0] = sum[6];
+  sData[1] = sum[7];
+  sData[2] = sum[8];
  
   if (theTorsion != nullptr) {
     double stress, tangent;
@@ -473,15 +436,14 @@ FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 
   return res;
 }
-#endif
 
 
 
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  thread_local double kInitialData[16];
+  thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -542,7 +504,6 @@ FiberSection3d::getFrameCopy(void)
   theCopy->setTag(this->getTag());
   theCopy->numFibers  = numFibers;
   theCopy->sizeFibers = numFibers;
-  theCopy->pool       = pool;
 
   if (numFibers != 0) {
     theCopy->theMaterials = new UniaxialMaterial *[numFibers];
@@ -599,9 +560,7 @@ FiberSection3d::getOrder() const
 int
 FiberSection3d::commitState()
 {
-  int err = 0;
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  int err = fiberState.commit(theMaterials, numFibers);
 
   if (theTorsion != 0)
     err += theTorsion->commitState();
@@ -620,6 +579,9 @@ FiberSection3d::revertToLastCommit(void)
   kData[15] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
+  // invoke revertToLast on the materials
+  err += fiberState.revert(theMaterials, numFibers);
+
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
 
@@ -627,9 +589,6 @@ FiberSection3d::revertToLastCommit(void)
     double z  = matData[3*i+1] - zBar;
     double A  = matData[3*i+2];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
     double tangent = theMat->getTangent();
     double stress = theMat->getStress();
 
@@ -666,6 +625,18 @@ FiberSection3d::revertToLastCommit(void)
   return err;
 }
 
+bool
+FiberSection3d::isThreadSafe(void) const
+{
+  if (theTorsion != nullptr && !theTorsion->isThreadSafe())
+    return false;
+
+  for (int i = 0; i < numFibers; i++)
+    if (!theMaterials[i]->isThreadSafe())
+      return false;
+  return true;
+}
+
 int
 FiberSection3d::revertToStart(void)
 {
@@ -884,6 +855,10 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
     }
 
+    // the materials may have been replaced
+    numFibersChecked = -1;
+    fiberState.reset();
+
     QzBar = 0.0;
     QyBar = 0.0;
     Abar  = 0.0;
@@ -1249,7 +1224,7 @@ FiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1260,7 +1235,7 @@ FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1337,16 +1312,16 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1363,7 +1338,7 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(4,4);
+  thread_local Matrix something(4,4);
   
   something.Zero();
 
@@ -34,6 +34,7 @@
 #include <Matrix.h>
 #include <VectorND.h>
 #include <memory>
+#include <FiberStateBuffer.h>
 
 class Response;
 class UniaxialMaterial;
@@ -64,6 +65,7 @@ class FiberSection3d : public FrameSection
     int   commitState();
     int   revertToLastCommit();    
     int   revertToStart();
+    bool  isThreadSafe(void) const;
  
     FrameSection *getFrameCopy();
     const ID &getType();
@@ -99,6 +101,9 @@ class FiberSection3d : public FrameSection
   private:
     int numFibers, sizeFibers;         // number of fibers in the section
     UniaxialMaterial **theMaterials;   // array of pointers to materials
+    int  numFibersChecked = -1;        // fibers for which threadSafeFibers was found
+    bool threadSafeFibers = false;     // whether the materials may be updated concurrently
+    OpenSees::FiberStateBuffer fiberState; // trial and committed history of the fibers
     std::shared_ptr<double[]> matData; // data for the materials [yloc, zloc, and area]
     double   kData[16];                // data for ks matrix 
 
@@ -115,7 +120,6 @@ class FiberSection3d : public FrameSection
 
     OpenSees::VectorND<4> eData, sData;
     UniaxialMaterial *theTorsion;
-    void *pool;        // thread pool
 };
 
 #endif
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Contiguous trial and committed history for the fibers of a
+// section, shared by the fiber sections.
+//
+// Each fiber whose material reports a history of getStateSize() doubles is
+// given that many doubles in each of two buffers owned by the section
+// (UniaxialMaterial::setStateStorage), so that committing the section is
+// one copy of the trial buffer to the committed one, and reverting it the
+// reverse, instead of a virtual call for each fiber. The materials of the
+// other fibers are committed and reverted as before.
+//
+// The buffers are set up on the first commit or revert, and again when
+// the number of fibers changes; a section that replaces its materials
+// without changing their number (recvSelf) must call reset().
+//
+#ifndef FiberStateBuffer_h
+#define FiberStateBuffer_h
+
+#include <vector>
+#include <string.h>
+#include <UniaxialMaterial.h>
+
+namespace OpenSees {
+
+class FiberStateBuffer
+{
+  public:
+    // commit (revert) the history of the numFibers materials
+    int commit(UniaxialMaterial * const *materials, int numFibers)
+    {
+      if (numBound != numFibers)
+        this->bind(materials, numFibers);
+
+      if (!trial.empty())
+        memcpy(committed.data(), trial.data(), trial.size()*sizeof(double));
+
+      int err = 0;
+      for (int i : unbound)
+        err += materials[i]->commitState();
+      return err;
+    }
+
+    int revert(UniaxialMaterial * const *materials, int numFibers)
+    {
+      if (numBound != numFibers)
+        this->bind(materials, numFibers);
+
+      if (!trial.empty())
+        memcpy(trial.data(), committed.data(), trial.size()*sizeof(double));
+
+      int err = 0;
+      for (int i : unbound)
+        err += materials[i]->revertToLastCommit();
+      return err;
+    }
+
+    void reset(void)
+    {
+      numBound = -1;
+    }
+
+  private:
+    // move the history of the materials that have one to new buffers;
+    // the old buffers, which they may still point into, are released last
+    void bind(UniaxialMaterial * const *materials, int numFibers)
+    {
+      std::size_t size = 0;
+      for (int i = 0; i < numFibers; i++)
+        size += materials[i]->getStateSize();
+
+      std::vector<double> newTrial(size), newCommitted(size);
+      unbound.clear();
+
+      std::size_t offset = 0;
+      for (int i = 0; i < numFibers; i++) {
+        const int n = materials[i]->getStateSize();
+        if (n > 0 && materials[i]->setStateStorage(&newTrial[offset], &newCommitted[offset]) == 0)
+          offset += n;
+        else
+          unbound.push_back(i);
+      }
+
+      newTrial.resize(offset);
+      newCommitted.resize(offset);
+      trial.swap(newTrial);
+      committed.swap(newCommitted);
+      numBound = numFibers;
+    }
+
+    std::vector<double> trial;     // trial history of the bound fibers
+    std::vector<double> committed; // committed history of the bound fibers
+    std::vector<int>    unbound;   // fibers whose materials keep their own
+    int numBound = -1;             // fibers for which the buffers were set up
+};
+
+} // namespace OpenSees
+
+#endif
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Threaded fiber loop shared by the fiber sections. It is
+// compiled in when N_FIBER_THREADS is defined (to the number of threads).
+//
+// The fibers are split into chunks of FIBER_THREAD_CHUNK fibers and each
+// chunk sums its contributions into its own accumulator; the accumulators
+// are then added in chunk order by the calling thread. There is no
+// locking, and because the chunks do not depend on the number of threads
+// the section response is the same for any N_FIBER_THREADS. Sections with
+// fewer than FIBER_THREAD_THRESHOLD fibers stay on the serial loop, where
+// the cost of dispatching the chunks exceeds the work in them (see
+// EXAMPLES/Benchmarks/FiberThreads.tcl).
+//
+// The fibers are only updated concurrently when all their materials are
+// thread safe (UniaxialMaterial::isThreadSafe); otherwise the serial loop
+// is used whatever the number of fibers.
+//
+#ifndef FiberThreads_h
+#define FiberThreads_h
+
+#ifdef N_FIBER_THREADS
+#include <vector>
+#include <threads/thread_pool.hpp>
+#include <UniaxialMaterial.h>
+
+#ifndef FIBER_THREAD_THRESHOLD
+#  define FIBER_THREAD_THRESHOLD 192
+#endif
+
+#ifndef FIBER_THREAD_CHUNK
+#  define FIBER_THREAD_CHUNK 48
+#endif
+
+namespace OpenSees {
+
+// One pool for all sections; its tasks never wait, so sections may
+// be updated from several threads at once.
+inline thread_pool &
+fiber_thread_pool()
+{
+  static thread_pool pool{N_FIBER_THREADS};
+  return pool;
+}
+
+//
+// Whether the materials of the numFibers fibers are all thread safe. The
+// answer is kept in safe, with the number of fibers it was found for in
+// checked, and is only found again when the number of fibers changes.
+//
+inline bool
+fibers_thread_safe(UniaxialMaterial * const *materials, int numFibers,
+                   int &checked, bool &safe)
+{
+  if (checked != numFibers) {
+    safe = true;
+    for (int i = 0; i < numFibers && safe; i++)
+      safe = materials[i]->isThreadSafe();
+    checked = numFibers;
+  }
+  return safe;
+}
+
+//
+// Invoke fibers(start, end, sum) for each chunk [start, end) of the fibers
+// in [0, numFibers), where sum points to NumSums doubles that the chunk
+// adds its contributions to, then add the totals to result. Returns the
+// sum of the values returned by fibers().
+//
+template <int NumSums, typename F>
+int
+fiber_reduce(int numFibers, double *result, F fibers)
+{
+  const int chunk = FIBER_THREAD_CHUNK;
+  const int numChunks = (numFibers + chunk - 1)/chunk;
+
+  thread_local std::vector<double> sums;
+  thread_local std::vector<int>    status;
+  sums.assign(numChunks*NumSums, 0.0);
+  status.assign(numChunks, 0);
+
+  double *chunkSums = sums.data();
+  int *chunkStatus  = status.data();
+
+  fiber_thread_pool().submit_blocks<int>(0, numFibers, chunk,
+    [&fibers, chunkSums, chunkStatus](int b, int start, int end) {
+      chunkStatus[b] = fibers(start, end, chunkSums + b*NumSums);
+  }).wait();
+
+  int res = 0;
+  for (int b = 0; b < numChunks; b++) {
+    for (int j = 0; j < NumSums; j++)
+      result[j] += chunkSums[b*NumSums + j];
+    res += chunkStatus[b];
+  }
+  return res;
+}
+
+} // namespace OpenSees
+#endif // N_FIBER_THREADS
+
+#endif
@@ -117,6 +117,12 @@ SectionForceDeformation::getRho(void)
   return 0.0 ;
 }
 
+bool
+SectionForceDeformation::isThreadSafe(void) const
+{
+  return false;
+}
+
 Response*
 SectionForceDeformation::setResponse(const char **argv, int argc,
                                      OPS_Stream &output)
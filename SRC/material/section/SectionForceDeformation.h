@@ -94,6 +94,11 @@ class SectionForceDeformation : public TaggedObject, public MovableObject
   virtual int commitState (void) = 0;
   virtual int revertToLastCommit (void) = 0;
   virtual int revertToStart (void) = 0;
+
+  // Whether distinct instances may be given trial deformations, committed
+  // and reverted from several threads at once; see
+  // UniaxialMaterial::isThreadSafe. The default is false.
+  virtual bool isThreadSafe(void) const;
   
   virtual SectionForceDeformation *getCopy (void) = 0;
   virtual const ID &getType(void) = 0;
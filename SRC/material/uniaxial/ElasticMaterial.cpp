@@ -159,6 +159,24 @@ ElasticMaterial::setTrial(double strain, double &stress, double &tangent, double
     return 0;
 }
 
+// Materials of this class are updated with non-virtual calls; any other
+// material in the batch goes through setTrial().
+int
+ElasticMaterial::setTrialBatch(UniaxialMaterial * const *materials, int n,
+                               const double *strain, double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    if (materials[i]->getClassTag() == MAT_TAG_ElasticMaterial) {
+      ElasticMaterial *theMaterial = static_cast<ElasticMaterial *>(materials[i]);
+      res += theMaterial->ElasticMaterial::setTrial(strain[i], stress[i], tangent[i]);
+    } else
+      res += materials[i]->setTrial(strain[i], stress[i], tangent[i]);
+  }
+
+  return res;
+}
+
 
 double 
 ElasticMaterial::getStress(void)
@@ -232,7 +250,7 @@ int
 ElasticMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   data(0) = this->getTag();
   data(1) = Epos;
   data(2) = Eneg;
@@ -252,7 +270,7 @@ ElasticMaterial::recvSelf(int cTag, Channel &theChannel,
 			  FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
@@ -76,22 +76,17 @@ void * OPS_ADD_RUNTIME_VPV(OPS_ElasticPPMaterial)
 
 
 ElasticPPMaterial::ElasticPPMaterial(int tag, double e, double eyp)
-:UniaxialMaterial(tag,MAT_TAG_ElasticPPMaterial),
- ezero(0.0), E(e), ep(0.0),
- trialStrain(0.0), trialStress(0.0), trialTangent(E),
- commitStrain(0.0), commitStress(0.0), commitTangent(E)
+:ElasticPPMaterial(tag, std::make_shared<Parameters>(Parameters{e*eyp, -e*eyp, 0.0, e}))
 {
-      EnergyP = 0;      //by SAJalali
-      fyp = E*eyp;
-  fyn = -fyp;
+
 }
 
 ElasticPPMaterial::ElasticPPMaterial(int tag, double e, double eyp,
                              double eyn, double ez )
 :UniaxialMaterial(tag,MAT_TAG_ElasticPPMaterial),
- ezero(ez), E(e), ep(0.0),
- trialStrain(0.0), trialStress(0.0), trialTangent(E),
- commitStrain(0.0), commitStress(0.0), commitTangent(E)
+ params(new Parameters{0.0, 0.0, ez, e}), ep(0.0),
+ trialStrain(0.0), trialStress(0.0), trialTangent(e),
+ commitStrain(0.0), commitStress(0.0), commitTangent(e)
 {
     if (eyp < 0) {
       opserr << "ElasticPPMaterial::ElasticPPMaterial() - eyp < 0, setting > 0\n";
@@ -103,13 +98,22 @@ ElasticPPMaterial::ElasticPPMaterial(int tag, double e, double eyp,
     }    
       EnergyP = 0;      //by SAJalali
 
-    fyp = E*eyp;
-    fyn = E*eyn;
+    params->fyp = e*eyp;
+    params->fyn = e*eyn;
+}
+
+ElasticPPMaterial::ElasticPPMaterial(int tag, const std::shared_ptr<Parameters> &theParams)
+:UniaxialMaterial(tag,MAT_TAG_ElasticPPMaterial),
+ params(theParams), ep(0.0),
+ trialStrain(0.0), trialStress(0.0), trialTangent(theParams->E),
+ commitStrain(0.0), commitStress(0.0), commitTangent(theParams->E)
+{
+      EnergyP = 0;      //by SAJalali
 }
 
 ElasticPPMaterial::ElasticPPMaterial()
 :UniaxialMaterial(0,MAT_TAG_ElasticPPMaterial),
- fyp(0.0), fyn(0.0), ezero(0.0), E(0.0), ep(0.0), 
+ params(new Parameters{}), ep(0.0), 
  trialStrain(0.0), trialStress(0.0), trialTangent(0.0),
  commitStrain(0.0), commitStress(0.0), commitTangent(0.0)
 {
@@ -125,6 +129,8 @@ ElasticPPMaterial::~ElasticPPMaterial()
 int 
 ElasticPPMaterial::setTrialStrain(double strain, double strainRate)
 {
+  const Parameters p = *params;
+
   /*
     if (fabs(trialStrain - strain) < DBL_EPSILON)
       return 0;
@@ -135,7 +141,7 @@ ElasticPPMaterial::setTrialStrain(double strain, double strainRate)
     double f;            // yield function
 
     // compute trial stress
-    sigtrial = E * ( trialStrain - ezero - ep );
+    sigtrial = p.E * ( trialStrain - p.ezero - ep );
 
     //sigtrial  = E * trialStrain;
     //sigtrial -= E * ezero;
@@ -143,24 +149,24 @@ ElasticPPMaterial::setTrialStrain(double strain, double strainRate)
 
     // evaluate yield function
     if ( sigtrial >= 0.0 )
-      f =  sigtrial - fyp;
+      f =  sigtrial - p.fyp;
     else
-      f = -sigtrial + fyn;
+      f = -sigtrial + p.fyn;
 
-    double fYieldSurface = - E * DBL_EPSILON;
+    double fYieldSurface = - p.E * DBL_EPSILON;
     if ( f <= fYieldSurface ) {
 
       // elastic
       trialStress = sigtrial;
-      trialTangent = E;
+      trialTangent = p.E;
 
     } else {
 
       // plastic
       if ( sigtrial > 0.0 ) {
-      trialStress = fyp;
+      trialStress = p.fyp;
       } else {
-      trialStress = fyn;
+      trialStress = p.fyn;
       }
 
       trialTangent = 0.0;
@@ -169,6 +175,26 @@ ElasticPPMaterial::setTrialStrain(double strain, double strainRate)
     return 0;
 }
 
+// Materials of this class are updated with non-virtual calls; any other
+// material in the batch goes through setTrial().
+int
+ElasticPPMaterial::setTrialBatch(UniaxialMaterial * const *materials, int n,
+                                 const double *strain, double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    if (materials[i]->getClassTag() == MAT_TAG_ElasticPPMaterial) {
+      ElasticPPMaterial *theMaterial = static_cast<ElasticPPMaterial *>(materials[i]);
+      res += theMaterial->ElasticPPMaterial::setTrialStrain(strain[i]);
+      stress[i]  = theMaterial->trialStress;
+      tangent[i] = theMaterial->trialTangent;
+    } else
+      res += materials[i]->setTrial(strain[i], stress[i], tangent[i]);
+  }
+
+  return res;
+}
+
 double 
 ElasticPPMaterial::getStrain(void)
 {
@@ -191,25 +217,27 @@ ElasticPPMaterial::getTangent(void)
 int 
 ElasticPPMaterial::commitState(void)
 {
+    const Parameters p = *params;
+
     double sigtrial;      // trial stress
     double f;            // yield function
 
     // compute trial stress
-    sigtrial = E * ( trialStrain - ezero - ep );
+    sigtrial = p.E * ( trialStrain - p.ezero - ep );
 
     // evaluate yield function
     if ( sigtrial >= 0.0 )
-      f =  sigtrial - fyp;
+      f =  sigtrial - p.fyp;
     else
-      f = -sigtrial + fyn;
+      f = -sigtrial + p.fyn;
 
-    double fYieldSurface = - E * DBL_EPSILON;
+    double fYieldSurface = - p.E * DBL_EPSILON;
     if ( f > fYieldSurface ) {
       // plastic
       if ( sigtrial > 0.0 ) {
-      ep += f / E;
+      ep += f / p.E;
       } else {
-      ep -= f / E;
+      ep -= f / p.E;
       }
     }
 
@@ -239,7 +267,7 @@ int
 ElasticPPMaterial::revertToStart(void)
 {
   trialStrain = commitStrain = 0.0;
-  trialTangent = commitTangent = E;
+  trialTangent = commitTangent = params->E;
   trialStress = commitStress = 0.0;
 
   ep = 0.0;
@@ -252,8 +280,9 @@ ElasticPPMaterial::revertToStart(void)
 UniaxialMaterial *
 ElasticPPMaterial::getCopy(void)
 {
+  // the copy shares the parameters of this material
   ElasticPPMaterial *theCopy =
-    new ElasticPPMaterial(this->getTag(),E,fyp/E,fyn/E,ezero);
+    new ElasticPPMaterial(this->getTag(), params);
   theCopy->ep = this->ep;
   
   return theCopy;
@@ -264,13 +293,13 @@ int
 ElasticPPMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(9);
+  Vector data(9);
   data(0) = this->getTag();
   data(1) = ep;
-  data(2) = E;
-  data(3) = ezero;
-  data(4) = fyp;
-  data(5) = fyn;
+  data(2) = params->E;
+  data(3) = params->ezero;
+  data(4) = params->fyp;
+  data(5) = params->fyn;
   data(6) = commitStrain;
   data(7) = commitStress;
   data(8) = commitTangent;
@@ -287,17 +316,18 @@ ElasticPPMaterial::recvSelf(int cTag, Channel &theChannel,
                          FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(9);
+  Vector data(9);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticPPMaterial::recvSelf() - failed to recv data\n";
   else {
     this->setTag(int(data(0)));
     ep    = data(1);
-    E     = data(2);
-    ezero = data(3);
-    fyp   = data(4);
-    fyn   = data(5);  
+    params = std::make_shared<Parameters>();
+    params->E     = data(2);
+    params->ezero = data(3);
+    params->fyp   = data(4);
+    params->fyn   = data(5);  
     commitStrain=data(6);
     commitStress=data(7);
     commitTangent=data(8);
@@ -314,7 +344,7 @@ ElasticPPMaterial::Print(OPS_Stream &s, int flag)
 {
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {
         s << "ElasticPPMaterial tag: " << this->getTag() << endln;
-        s << "  E: " << E << endln;
+        s << "  E: " << params->E << endln;
         s << "  ep: " << ep << endln;
         s << "  stress: " << trialStress << " tangent: " << trialTangent << endln;
   }
@@ -323,10 +353,10 @@ ElasticPPMaterial::Print(OPS_Stream &s, int flag)
         s << "\t\t\t{";
         s << "\"name\": \"" << this->getTag() << "\", ";
         s << "\"type\": \"ElasticPPMaterial\", ";
-        s << "\"E\": " << E << ", ";
-        s << "\"epsyp\": " << fyp/E << ", ";
-        s << "\"epsyn\": " << fyn/E << ", ";
-        s << "\"eps0\": " << ezero << "}";
+        s << "\"E\": " << params->E << ", ";
+        s << "\"epsyp\": " << params->fyp/params->E << ", ";
+        s << "\"epsyn\": " << params->fyn/params->E << ", ";
+        s << "\"eps0\": " << params->ezero << "}";
   }
 }
 
@@ -335,11 +365,11 @@ int
 ElasticPPMaterial::setParameter(const char **argv, int argc, Parameter &param)
 {
   if (strcmp(argv[0],"sigmaY") == 0 || strcmp(argv[0],"fy") == 0 || strcmp(argv[0],"Fy") == 0) {
-    param.setValue(fyp);
+    param.setValue(params->fyp);
     return param.addObject(1, this);
   }
   if (strcmp(argv[0],"E") == 0) {
-    param.setValue(E);
+    param.setValue(params->E);
     return param.addObject(2, this);
   }
   if (strcmp(argv[0],"epsP") == 0 || strcmp(argv[0],"ep") == 0) {
@@ -353,16 +383,20 @@ ElasticPPMaterial::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticPPMaterial::updateParameter(int parameterID, Information &info)
 {
+  // the parameters of this material no longer match those of its copies
+  if ((parameterID == 1 || parameterID == 2) && params.use_count() > 1)
+    params = std::make_shared<Parameters>(*params);
+
   switch (parameterID) {
   case -1:
     return -1;
   case 1:
-    this->fyp = info.theDouble;
-    this->fyn = -fyp;
+    params->fyp = info.theDouble;
+    params->fyn = -params->fyp;
     break;
   case 2:
-    this->E = info.theDouble;
-    trialTangent = E;
+    params->E = info.theDouble;
+    trialTangent = params->E;
     break;
   case 3:
     this->ep = info.theDouble;
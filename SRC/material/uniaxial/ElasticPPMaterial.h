@@ -36,6 +36,7 @@
 // What: "@(#) ElasticPPMaterial.h, revA"
 
 #include <UniaxialMaterial.h>
+#include <memory>
 
 class ElasticPPMaterial : public UniaxialMaterial
 {
@@ -49,17 +50,20 @@ class ElasticPPMaterial : public UniaxialMaterial
     const char *getClassType(void) const {return "ElasticPPMaterial";};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(UniaxialMaterial * const *materials, int n,
+                      const double *strain, double *stress, double *tangent);
     double getStrain(void);          
     double getStress(void);
     double getTangent(void);
 
-    double getInitialTangent(void) {return E;};
+    double getInitialTangent(void) {return params->E;};
 
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);    
 
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) const {return true;}
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -75,9 +79,17 @@ class ElasticPPMaterial : public UniaxialMaterial
   protected:
     
   private:
-    double fyp, fyn;	// positive and negative yield stress
-    double ezero;	// initial strain
-    double E;		// elastic modulus
+    // shared by the copies of a material until updateParameter() changes
+    // them for one of them
+    struct Parameters {
+      double fyp, fyn;	// positive and negative yield stress
+      double ezero;	// initial strain
+      double E;		// elastic modulus
+    };
+    std::shared_ptr<Parameters> params;
+
+    ElasticPPMaterial(int tag, const std::shared_ptr<Parameters> &params);
+
     double ep;		// plastic strain at last commit
     double trialStrain;	     // current trial strain
     double trialStress;      // current trial stress
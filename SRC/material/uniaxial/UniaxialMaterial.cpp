@@ -103,6 +103,35 @@ UniaxialMaterial::setTrial(double strain, double temperature, double &stress, do
   return res;
 }
 
+int
+UniaxialMaterial::setTrialBatch(UniaxialMaterial * const *materials, int n,
+                                const double *strain, double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += materials[i]->setTrial(strain[i], stress[i], tangent[i]);
+
+  return res;
+}
+
+bool
+UniaxialMaterial::isThreadSafe(void) const
+{
+  return false;
+}
+
+int
+UniaxialMaterial::getStateSize(void) const
+{
+  return 0;
+}
+
+int
+UniaxialMaterial::setStateStorage(double *trial, double *committed)
+{
+  return -1;
+}
+
 
 // default operation for strain rate is zero
 double
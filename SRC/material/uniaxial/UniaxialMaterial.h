@@ -54,6 +54,33 @@ class UniaxialMaterial : public Material
     virtual int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
     virtual int setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
 
+    // Set the trial strains of n materials (typically the fibers of a
+    // section, invoked on the first of them) and return their stresses
+    // and tangents in contiguous arrays. The default calls setTrial() on
+    // each; a class may override it to update its own instances without
+    // a virtual call per material.
+    virtual int setTrialBatch(UniaxialMaterial * const *materials, int n,
+                              const double *strain, double *stress, double *tangent);
+
+    // Whether distinct instances of the class may be given trial strains,
+    // committed and reverted from several threads at once, i.e. whether
+    // setTrial*(), get{Stress,Tangent,Strain}(), commitState() and
+    // revertTo*() touch only the state of the instance. sendSelf() and
+    // the response methods are not covered. The default is false; a class
+    // that keeps static work areas must not return true.
+    virtual bool isThreadSafe(void) const;
+
+    // Contiguous history (see FiberStateBuffer.h). A class whose history
+    // is getStateSize() doubles, which commitState() only copies from the
+    // trial to the committed values and revertToLastCommit() back, may
+    // return that size; setStateStorage() then moves the history to the
+    // arrays given, of getStateSize() doubles each, which the caller
+    // owns and copies in place of commitState() and revertToLastCommit().
+    // Any other calls are still made on the material. The defaults are 0
+    // and -1 (the material keeps and commits its own history).
+    virtual int getStateSize(void) const;
+    virtual int setStateStorage(double *trial, double *committed);
+
     virtual double getStrain() = 0;
     virtual double getStrainRate();
     virtual double getStress() = 0;
@@ -42,6 +42,7 @@
 
 #include <math.h>
 #include <float.h>
+#include <new>
 
 #include <elementAPI.h>
 #include <OPS_Globals.h>
@@ -88,30 +89,34 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Concrete01)
 
 Concrete01::Concrete01
 (int tag, double FPC, double EPSC0, double FPCU, double EPSCU)
+  :Concrete01(tag, std::make_shared<Parameters>(Parameters{FPC, EPSC0, FPCU, EPSCU}))
+{
+
+}
+
+Concrete01::Concrete01(int tag, const std::shared_ptr<Parameters> &theParams)
   :UniaxialMaterial(tag, MAT_TAG_Concrete01),
-   fpc(FPC), epsc0(EPSC0), fpcu(FPCU), epscu(EPSCU), 
-   CminStrain(0.0), CendStrain(0.0),
-   Cstrain(0.0), Cstress(0.0) 
+   params(theParams),
+   ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
-	EnergyP = 0;	//SAJalali
-  // Make all concrete parameters negative
-  if (fpc > 0.0)
-    fpc = -fpc;
+  // Make all concrete parameters negative; those shared with another
+  // material have been already
+  if (params->fpc > 0.0)
+    params->fpc = -params->fpc;
   
-  if (epsc0 > 0.0)
-    epsc0 = -epsc0;
+  if (params->epsc0 > 0.0)
+    params->epsc0 = -params->epsc0;
   
-  if (fpcu > 0.0)
-    fpcu = -fpcu;
+  if (params->fpcu > 0.0)
+    params->fpcu = -params->fpcu;
   
-  if (epscu > 0.0)
-    epscu = -epscu;
+  if (params->epscu > 0.0)
+    params->epscu = -params->epscu;
   
   // Initial tangent
-  double Ec0 = 2*fpc/epsc0;
-  Ctangent = Ec0;
-  CunloadSlope = Ec0;
-  Ttangent = Ec0;
+  double Ec0 = 2*params->fpc/params->epsc0;
+  committed->tangent = Ec0;
+  committed->unloadSlope = Ec0;
   
   // Set trial values
   this->revertToLastCommit();
@@ -123,11 +128,9 @@ Concrete01::Concrete01
 }
 
 Concrete01::Concrete01():UniaxialMaterial(0, MAT_TAG_Concrete01),
- fpc(0.0), epsc0(0.0), fpcu(0.0), epscu(0.0),
- CminStrain(0.0), CunloadSlope(0.0), CendStrain(0.0),
- Cstrain(0.0), Cstress(0.0)
+ params(new Parameters{}),
+ ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
-	EnergyP = 0;	//SAJalali
   // Set trial values
   this->revertToLastCommit();
   
@@ -139,66 +142,66 @@ Concrete01::Concrete01():UniaxialMaterial(0, MAT_TAG_Concrete01),
 
 Concrete01::~Concrete01 ()
 {
-  // Does nothing
+  delete [] ownState;
 }
 
 
 int Concrete01::setTrialStrain (double strain, double strainRate)
 {
    // Reset trial history variables to last committed state
-   TminStrain = CminStrain;
-   TendStrain = CendStrain;
-   TunloadSlope = CunloadSlope;
-   Tstress = Cstress;
-   Ttangent = Ctangent;
-   Tstrain = Cstrain;
+   *trial = *committed;
 
   // Determine change in strain from last converged state
-  double dStrain = strain - Cstrain;
+  double dStrain = strain - committed->strain;
 
   if (fabs(dStrain) < DBL_EPSILON)
     return 0;
 
   // Set trial strain
-  Tstrain = strain;
+  trial->strain = strain;
   
   // check for a quick return
-  if (Tstrain > 0.0) {
-    Tstress = 0;
-    Ttangent = 0;
+  if (trial->strain > 0.0) {
+    trial->stress = 0;
+    trial->tangent = 0;
+    //by SAJalali
+    trial->energy += 0.5*committed->stress*(trial->strain - committed->strain);
     return 0;
   }
   
   // Calculate the trial state given the change in strain
   // determineTrialState (dStrain);
-  TunloadSlope = CunloadSlope;
+  trial->unloadSlope = committed->unloadSlope;
   
-  double tempStress = Cstress + TunloadSlope*Tstrain - TunloadSlope*Cstrain;
+  double tempStress = committed->stress + trial->unloadSlope*trial->strain - trial->unloadSlope*committed->strain;
   
   // Material goes further into compression
-  if (strain < Cstrain) {
-    TminStrain = CminStrain;
-    TendStrain = CendStrain;
+  if (strain < committed->strain) {
+    trial->minStrain = committed->minStrain;
+    trial->endStrain = committed->endStrain;
     
     reload ();
     
-    if (tempStress > Tstress) {
-      Tstress = tempStress;
-      Ttangent = TunloadSlope;
+    if (tempStress > trial->stress) {
+      trial->stress = tempStress;
+      trial->tangent = trial->unloadSlope;
     }
   }
   
   // Material goes TOWARD tension
   else if (tempStress <= 0.0) {
-    Tstress = tempStress;
-    Ttangent = TunloadSlope;
+    trial->stress = tempStress;
+    trial->tangent = trial->unloadSlope;
   }
   
   // Made it into tension
   else {
-    Tstress = 0.0;
-    Ttangent = 0.0;
+    trial->stress = 0.0;
+    trial->tangent = 0.0;
   }
+
+  //by SAJalali
+  trial->energy += 0.5*(trial->stress + committed->stress)*(trial->strain - committed->strain);
   
   return 0;
 }
@@ -209,242 +212,248 @@ int
 Concrete01::setTrial (double strain, double &stress, double &tangent, double strainRate)
 {
 	 // Reset trial history variables to last committed state
-   TminStrain = CminStrain;
-   TendStrain = CendStrain;
-   TunloadSlope = CunloadSlope;
-   Tstress = Cstress;
-   Ttangent = Ctangent;
-   Tstrain = Cstrain;
+   *trial = *committed;
 
   // Determine change in strain from last converged state
-  double dStrain = strain - Cstrain;
+  double dStrain = strain - committed->strain;
 
   if (fabs(dStrain) < DBL_EPSILON) {
-    stress = Tstress;
-    tangent = Ttangent;
+    stress = trial->stress;
+    tangent = trial->tangent;
     return 0;
   }
 
   // Set trial strain
-  Tstrain = strain;
+  trial->strain = strain;
   
   // check for a quick return
-  if (Tstrain > 0.0) {
-    Tstress = 0;
-    Ttangent = 0;
+  if (trial->strain > 0.0) {
+    trial->stress = 0;
+    trial->tangent = 0;
     stress = 0;
     tangent = 0;
+    //by SAJalali
+    trial->energy += 0.5*committed->stress*(trial->strain - committed->strain);
     return 0;
   }
   
   
   // Calculate the trial state given the change in strain
   // determineTrialState (dStrain);
-  TunloadSlope = CunloadSlope;
+  trial->unloadSlope = committed->unloadSlope;
   
-  double tempStress = Cstress + TunloadSlope*Tstrain - TunloadSlope*Cstrain;
+  double tempStress = committed->stress + trial->unloadSlope*trial->strain - trial->unloadSlope*committed->strain;
   
   // Material goes further into compression
-  if (strain <= Cstrain) {
-    TminStrain = CminStrain;
-    TendStrain = CendStrain;
+  if (strain <= committed->strain) {
+    trial->minStrain = committed->minStrain;
+    trial->endStrain = committed->endStrain;
     
     reload ();
     
-    if (tempStress > Tstress) {
-      Tstress = tempStress;
-      Ttangent = TunloadSlope;
+    if (tempStress > trial->stress) {
+      trial->stress = tempStress;
+      trial->tangent = trial->unloadSlope;
     }
   }
   
   // Material goes TOWARD tension
   else if (tempStress <= 0.0) {
-    Tstress = tempStress;
-    Ttangent = TunloadSlope;
+    trial->stress = tempStress;
+    trial->tangent = trial->unloadSlope;
   }
   
   // Made it into tension
   else {
-    Tstress = 0.0;
-    Ttangent = 0.0;
+    trial->stress = 0.0;
+    trial->tangent = 0.0;
   }
   
   //opserr << "Concrete01::setTrial() " << strain << " " << tangent << " " << strain << endln;
+
+  //by SAJalali
+  trial->energy += 0.5*(trial->stress + committed->stress)*(trial->strain - committed->strain);
   
-  stress = Tstress;
-  tangent =  Ttangent;
+  stress = trial->stress;
+  tangent =  trial->tangent;
   
   return 0;
 }
 
 void Concrete01::determineTrialState (double dStrain)
 {  
-  TminStrain = CminStrain;
-  TendStrain = CendStrain;
-  TunloadSlope = CunloadSlope;
+  trial->minStrain = committed->minStrain;
+  trial->endStrain = committed->endStrain;
+  trial->unloadSlope = committed->unloadSlope;
   
-  double tempStress = Cstress + TunloadSlope*dStrain;
+  double tempStress = committed->stress + trial->unloadSlope*dStrain;
   
   // Material goes further into compression
-  if (Tstrain <= Cstrain) {
+  if (trial->strain <= committed->strain) {
     
     reload ();
     
-    if (tempStress > Tstress) {
-      Tstress = tempStress;
-      Ttangent = TunloadSlope;
+    if (tempStress > trial->stress) {
+      trial->stress = tempStress;
+      trial->tangent = trial->unloadSlope;
     }
   }
   
   // Material goes TOWARD tension
   else if (tempStress <= 0.0) {
-    Tstress = tempStress;
-    Ttangent = TunloadSlope;
+    trial->stress = tempStress;
+    trial->tangent = trial->unloadSlope;
   }
   
   // Made it into tension
   else {
-    Tstress = 0.0;
-    Ttangent = 0.0;
+    trial->stress = 0.0;
+    trial->tangent = 0.0;
   }
   
 }
 
 void Concrete01::reload ()
 {
-  if (Tstrain <= TminStrain) {
+  if (trial->strain <= trial->minStrain) {
     
-    TminStrain = Tstrain;
+    trial->minStrain = trial->strain;
     
     // Determine point on envelope
     envelope ();
     
     unload ();
   }
-  else if (Tstrain <= TendStrain) {
-    Ttangent = TunloadSlope;
-    Tstress = Ttangent*(Tstrain-TendStrain);
+  else if (trial->strain <= trial->endStrain) {
+    trial->tangent = trial->unloadSlope;
+    trial->stress = trial->tangent*(trial->strain-trial->endStrain);
   }
   else {
-    Tstress = 0.0;
-    Ttangent = 0.0;
+    trial->stress = 0.0;
+    trial->tangent = 0.0;
   }
 }
 
 void Concrete01::envelope ()
 {
-  if (Tstrain > epsc0) {
-    double eta = Tstrain/epsc0;
-    Tstress = fpc*(2*eta-eta*eta);
-    double Ec0 = 2.0*fpc/epsc0;
-    Ttangent = Ec0*(1.0-eta);
+  const Parameters p = *params;
+
+  if (trial->strain > p.epsc0) {
+    double eta = trial->strain/p.epsc0;
+    trial->stress = p.fpc*(2*eta-eta*eta);
+    double Ec0 = 2.0*p.fpc/p.epsc0;
+    trial->tangent = Ec0*(1.0-eta);
   }
-  else if (Tstrain > epscu) {
-    Ttangent = (fpc-fpcu)/(epsc0-epscu);
-    Tstress = fpc + Ttangent*(Tstrain-epsc0);
+  else if (trial->strain > p.epscu) {
+    trial->tangent = (p.fpc-p.fpcu)/(p.epsc0-p.epscu);
+    trial->stress = p.fpc + trial->tangent*(trial->strain-p.epsc0);
   }
   else {
-    Tstress = fpcu;
-    Ttangent = 0.0;
+    trial->stress = p.fpcu;
+    trial->tangent = 0.0;
   }
 }
 
 void Concrete01::unload ()
 {
-  double tempStrain = TminStrain;
+  const Parameters p = *params;
+
+  double tempStrain = trial->minStrain;
   
-  if (tempStrain < epscu)
-    tempStrain = epscu;
+  if (tempStrain < p.epscu)
+    tempStrain = p.epscu;
   
-  double eta = tempStrain/epsc0;
+  double eta = tempStrain/p.epsc0;
   
   double ratio = 0.707*(eta-2.0) + 0.834;
   
   if (eta < 2.0)
     ratio = 0.145*eta*eta + 0.13*eta;
   
-  TendStrain = ratio*epsc0;
+  trial->endStrain = ratio*p.epsc0;
   
-  double temp1 = TminStrain - TendStrain;
+  double temp1 = trial->minStrain - trial->endStrain;
   
-  double Ec0 = 2.0*fpc/epsc0;
+  double Ec0 = 2.0*p.fpc/p.epsc0;
   
-  double temp2 = Tstress/Ec0;
+  double temp2 = trial->stress/Ec0;
   
   if (temp1 > -DBL_EPSILON) {	// temp1 should always be negative
-    TunloadSlope = Ec0;
+    trial->unloadSlope = Ec0;
   }
   else if (temp1 <= temp2) {
-    TendStrain = TminStrain - temp1;
-    TunloadSlope = Tstress/temp1;
+    trial->endStrain = trial->minStrain - temp1;
+    trial->unloadSlope = trial->stress/temp1;
   }
   else {
-    TendStrain = TminStrain - temp2;
-    TunloadSlope = Ec0;
+    trial->endStrain = trial->minStrain - temp2;
+    trial->unloadSlope = Ec0;
   }
 }
 
 double Concrete01::getStress ()
 {
-   return Tstress;
+   return trial->stress;
 }
 
 double Concrete01::getStrain ()
 {
-   return Tstrain;
+   return trial->strain;
 }
 
 double Concrete01::getTangent ()
 {
-   return Ttangent;
+   return trial->tangent;
 }
 
 int Concrete01::commitState ()
 {
-   // History variables
-   CminStrain = TminStrain;
-   CunloadSlope = TunloadSlope;
-   CendStrain = TendStrain;
+   *committed = *trial;
 
-   //added by SAJalali
-   EnergyP += 0.5*(Cstress + Tstress)*(Tstrain - Cstrain);
+   return 0;
+}
 
-   // State variables
-   Cstrain = Tstrain;
-   Cstress = Tstress;
-   Ctangent = Ttangent;
+int Concrete01::revertToLastCommit ()
+{
+   // Reset trial history and state variables to last committed state
+   *trial = *committed;
 
    return 0;
 }
 
-int Concrete01::revertToLastCommit ()
+int
+Concrete01::getStateSize(void) const
 {
-   // Reset trial history variables to last committed state
-   TminStrain = CminStrain;
-   TendStrain = CendStrain;
-   TunloadSlope = CunloadSlope;
+   return sizeof(State)/sizeof(double);
+}
 
-   // Recompute trial stress and tangent
-   Tstrain = Cstrain;
-   Tstress = Cstress;
-   Ttangent = Ctangent;
+int
+Concrete01::setStateStorage(double *trialState, double *committedState)
+{
+   State *newTrial = new (trialState) State(*trial);
+   State *newCommitted = new (committedState) State(*committed);
+
+   delete [] ownState;
+   ownState = nullptr;
+   trial = newTrial;
+   committed = newCommitted;
 
    return 0;
 }
 
 int Concrete01::revertToStart ()
 {
-	double Ec0 = 2.0*fpc/epsc0;
+	double Ec0 = 2.0*params->fpc/params->epsc0;
 
    // History variables
-   CminStrain = 0.0;
-   CunloadSlope = Ec0;
-   CendStrain = 0.0;
+   committed->minStrain = 0.0;
+   committed->unloadSlope = Ec0;
+   committed->endStrain = 0.0;
 
    // State variables
-   Cstrain = 0.0;
-   Cstress = 0.0;
-   Ctangent = Ec0;
+   committed->strain = 0.0;
+   committed->stress = 0.0;
+   committed->tangent = Ec0;
 
    // Reset trial variables and state
    this->revertToLastCommit();
@@ -458,18 +467,12 @@ int Concrete01::revertToStart ()
 
 UniaxialMaterial* Concrete01::getCopy ()
 {
-   Concrete01* theCopy = new Concrete01(this->getTag(),
-                                    fpc, epsc0, fpcu, epscu);
+   // the copy shares the material properties
+   Concrete01* theCopy = new Concrete01(this->getTag(), params);
 
-   // Converged history variables
-   theCopy->CminStrain = CminStrain;
-   theCopy->CunloadSlope = CunloadSlope;
-   theCopy->CendStrain = CendStrain;
-
-   // Converged state variables
-   theCopy->Cstrain = Cstrain;
-   theCopy->Cstress = Cstress;
-   theCopy->Ctangent = Ctangent;
+   // Converged history and state variables
+   *theCopy->committed = *committed;
+   *theCopy->trial = *committed;
 
    return theCopy;
 }
@@ -477,24 +480,24 @@ UniaxialMaterial* Concrete01::getCopy ()
 int Concrete01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(11);
+   Vector data(11);
    data(0) = this->getTag();
 
    // Material properties
-   data(1) = fpc;
-   data(2) = epsc0;
-   data(3) = fpcu;
-   data(4) = epscu;
+   data(1) = params->fpc;
+   data(2) = params->epsc0;
+   data(3) = params->fpcu;
+   data(4) = params->epscu;
 
    // History variables from last converged state
-   data(5) = CminStrain;
-   data(6) = CunloadSlope;
-   data(7) = CendStrain;
+   data(5) = committed->minStrain;
+   data(6) = committed->unloadSlope;
+   data(7) = committed->endStrain;
 
    // State variables from last converged state
-   data(8) = Cstrain;
-   data(9) = Cstress;
-   data(10) = Ctangent;
+   data(8) = committed->strain;
+   data(9) = committed->stress;
+   data(10) = committed->tangent;
 
    // Data is only sent after convergence, so no trial variables
    // need to be sent through data vector
@@ -510,7 +513,7 @@ int Concrete01::recvSelf (int commitTag, Channel& theChannel,
                                  FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(11);
+   Vector data(11);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 
    if (res < 0) {
@@ -521,25 +524,24 @@ int Concrete01::recvSelf (int commitTag, Channel& theChannel,
       this->setTag(int(data(0)));
 
       // Material properties 
-      fpc = data(1);
-      epsc0 = data(2);
-      fpcu = data(3);
-      epscu = data(4);
+      params = std::make_shared<Parameters>();
+      params->fpc = data(1);
+      params->epsc0 = data(2);
+      params->fpcu = data(3);
+      params->epscu = data(4);
 
       // History variables from last converged state
-      CminStrain = data(5);
-      CunloadSlope = data(6);
-      CendStrain = data(7);
+      committed->minStrain = data(5);
+      committed->unloadSlope = data(6);
+      committed->endStrain = data(7);
 
       // State variables from last converged state
-      Cstrain = data(8);
-      Cstress = data(9);
-      Ctangent = data(10);
+      committed->strain = data(8);
+      committed->stress = data(9);
+      committed->tangent = data(10);
 
       // Set trial state variables
-      Tstrain = Cstrain;
-      Tstress = Cstress;
-      Ttangent = Ctangent;
+      *trial = *committed;
    }
 
    return res;
@@ -549,21 +551,21 @@ void Concrete01::Print (OPS_Stream& s, int flag)
 {
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {      
     s << "Concrete01, tag: " << this->getTag() << endln;
-    s << "  fpc: " << fpc << endln;
-    s << "  epsc0: " << epsc0 << endln;
-    s << "  fpcu: " << fpcu << endln;
-    s << "  epscu: " << epscu << endln;
+    s << "  fpc: " << params->fpc << endln;
+    s << "  epsc0: " << params->epsc0 << endln;
+    s << "  fpcu: " << params->fpcu << endln;
+    s << "  epscu: " << params->epscu << endln;
   }
   
   if (flag == OPS_PRINT_PRINTMODEL_JSON) {
     s << "\t\t\t{";
 	s << "\"name\": \"" << this->getTag() << "\", ";
 	s << "\"type\": \"Concrete01\", ";
-	s << "\"Ec\": " << 2.0*fpc/epsc0 << ", ";
-	s << "\"fc\": " << fpc << ", ";
-    s << "\"epsc\": " << epsc0 << ", ";
-    s << "\"fcu\": " << fpcu << ", ";
-    s << "\"epscu\": " << epscu << "}";
+	s << "\"Ec\": " << 2.0*params->fpc/params->epsc0 << ", ";
+	s << "\"fc\": " << params->fpc << ", ";
+    s << "\"epsc\": " << params->epsc0 << ", ";
+    s << "\"fcu\": " << params->fpcu << ", ";
+    s << "\"epscu\": " << params->epscu << "}";
   }
 }
 
@@ -576,19 +578,19 @@ Concrete01::setParameter(const char **argv, int argc, Parameter &param)
 {
 
   if (strcmp(argv[0],"fc") == 0) {// Compressive strength
-    param.setValue(fpc);
+    param.setValue(params->fpc);
     return param.addObject(1, this);
   }
   else if (strcmp(argv[0],"epsco") == 0) {// Strain at compressive strength
-    param.setValue(epsc0);
+    param.setValue(params->epsc0);
     return param.addObject(2, this);
   }
   else if (strcmp(argv[0],"fcu") == 0) {// Crushing strength
-    param.setValue(fpcu);
+    param.setValue(params->fpcu);
     return param.addObject(3, this);
   }
   else if (strcmp(argv[0],"epscu") == 0) {// Strain at crushing strength
-    param.setValue(epscu);
+    param.setValue(params->epscu);
     return param.addObject(4, this);
   }
   
@@ -600,42 +602,46 @@ Concrete01::setParameter(const char **argv, int argc, Parameter &param)
 int
 Concrete01::updateParameter(int parameterID, Information &info)
 {
+	// the properties of this material no longer match those of its copies
+	if (params.use_count() > 1)
+		params = std::make_shared<Parameters>(*params);
+
 	switch (parameterID) {
 	case 1:
-		this->fpc = info.theDouble;
+		params->fpc = info.theDouble;
 		break;
 	case 2:
-		this->epsc0 = info.theDouble;
+		params->epsc0 = info.theDouble;
 		break;
 	case 3:
-		this->fpcu = info.theDouble;
+		params->fpcu = info.theDouble;
 		break;
 	case 4:
-		this->epscu = info.theDouble;
+		params->epscu = info.theDouble;
 		break;
 	default:
 		break;
 	}
         
 	// Make all concrete parameters negative
-	if (fpc > 0.0)
-		fpc = -fpc;
+	if (params->fpc > 0.0)
+		params->fpc = -params->fpc;
 
-	if (epsc0 > 0.0)
-		epsc0 = -epsc0;
+	if (params->epsc0 > 0.0)
+		params->epsc0 = -params->epsc0;
 
-	if (fpcu > 0.0)
-		fpcu = -fpcu;
+	if (params->fpcu > 0.0)
+		params->fpcu = -params->fpcu;
 
-	if (epscu > 0.0)
-		epscu = -epscu;
+	if (params->epscu > 0.0)
+		params->epscu = -params->epscu;
 
 	// Initial tangent
-	double Ec0 = 2*fpc/epsc0;
-	Ctangent = Ec0;
-	CunloadSlope = Ec0;
-	Ttangent = Ec0;
-   	TunloadSlope = CunloadSlope;
+	double Ec0 = 2*params->fpc/params->epsc0;
+	committed->tangent = Ec0;
+	committed->unloadSlope = Ec0;
+	trial->tangent = Ec0;
+   	trial->unloadSlope = committed->unloadSlope;
 
 	return 0;
 }
@@ -696,37 +702,37 @@ Concrete01::getStressSensitivity(int gradIndex, bool conditional)
 
 
 	// Strain increment 
-	double dStrain = Tstrain - Cstrain;
+	double dStrain = trial->strain - committed->strain;
 
 	// Evaluate stress sensitivity 
 	if (dStrain < 0.0) {					// applying more compression to the material
 
-		if (Tstrain < CminStrain) {			// loading along the backbone curve
+		if (trial->strain < committed->minStrain) {			// loading along the backbone curve
 
-			if (Tstrain > epsc0) {			//on the parabola
+			if (trial->strain > params->epsc0) {			//on the parabola
 				
-				TstressSensitivity = fpcSensitivity*(2.0*Tstrain/epsc0-(Tstrain/epsc0)*(Tstrain/epsc0))
-					      + fpc*( (2.0*TstrainSensitivity*epsc0-2.0*Tstrain*epsc0Sensitivity)/(epsc0*epsc0) 
-						  - 2.0*(Tstrain/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)/(epsc0*epsc0));
+				TstressSensitivity = fpcSensitivity*(2.0*trial->strain/params->epsc0-(trial->strain/params->epsc0)*(trial->strain/params->epsc0))
+					      + params->fpc*( (2.0*TstrainSensitivity*params->epsc0-2.0*trial->strain*epsc0Sensitivity)/(params->epsc0*params->epsc0) 
+						  - 2.0*(trial->strain/params->epsc0)*(TstrainSensitivity*params->epsc0-trial->strain*epsc0Sensitivity)/(params->epsc0*params->epsc0));
 				
-				dktdh = 2.0*((fpcSensitivity*epsc0-fpc*epsc0Sensitivity)/(epsc0*epsc0))
-					  * (1.0-Tstrain/epsc0)
-					  - 2.0*(fpc/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)
-					  / (epsc0*epsc0);
+				dktdh = 2.0*((fpcSensitivity*params->epsc0-params->fpc*epsc0Sensitivity)/(params->epsc0*params->epsc0))
+					  * (1.0-trial->strain/params->epsc0)
+					  - 2.0*(params->fpc/params->epsc0)*(TstrainSensitivity*params->epsc0-trial->strain*epsc0Sensitivity)
+					  / (params->epsc0*params->epsc0);
 			}
-			else if (Tstrain > epscu) {		// on the straight inclined line
+			else if (trial->strain > params->epscu) {		// on the straight inclined line
 //cerr << "ON THE STRAIGHT INCLINED LINE" << endl;
 
 				dktdh = ( (fpcSensitivity-fpcuSensitivity)
-					  * (epsc0-epscu) 
-					  - (fpc-fpcu)
+					  * (params->epsc0-params->epscu) 
+					  - (params->fpc-params->fpcu)
 					  * (epsc0Sensitivity-epscuSensitivity) )
-					  / ((epsc0-epscu)*(epsc0-epscu));
+					  / ((params->epsc0-params->epscu)*(params->epsc0-params->epscu));
 
-				double kt = (fpc-fpcu)/(epsc0-epscu);
+				double kt = (params->fpc-params->fpcu)/(params->epsc0-params->epscu);
 
 				TstressSensitivity = fpcSensitivity 
-					      + dktdh*(Tstrain-epsc0)
+					      + dktdh*(trial->strain-params->epsc0)
 						  + kt*(TstrainSensitivity-epsc0Sensitivity);
 			}
 			else {							// on the horizontal line
@@ -736,10 +742,10 @@ Concrete01::getStressSensitivity(int gradIndex, bool conditional)
 			
 			}
 		}
-		else if (Tstrain < CendStrain) {	// reloading after an unloading that didn't go all the way to zero stress
+		else if (trial->strain < committed->endStrain) {	// reloading after an unloading that didn't go all the way to zero stress
 //cerr << "RELOADING AFTER AN UNLOADING THAT DIDN'T GO ALL THE WAY DOWN" << endl;
-			TstressSensitivity = CunloadSlopeSensitivity * (Tstrain-CendStrain)
-				      + CunloadSlope * (TstrainSensitivity-CendStrainSensitivity);
+			TstressSensitivity = CunloadSlopeSensitivity * (trial->strain-committed->endStrain)
+				      + committed->unloadSlope * (TstrainSensitivity-CendStrainSensitivity);
 
 			dktdh = CunloadSlopeSensitivity;
 		}
@@ -750,11 +756,11 @@ Concrete01::getStressSensitivity(int gradIndex, bool conditional)
 
 		}
 	}
-	else if (Cstress+CunloadSlope*dStrain<0.0) {// unloading, but not all the way down to zero stress
+	else if (committed->stress+committed->unloadSlope*dStrain<0.0) {// unloading, but not all the way down to zero stress
 //cerr << "UNLOADING, BUT NOT ALL THE WAY DOWN" << endl;
 		TstressSensitivity = CstressSensitivity 
 			               + CunloadSlopeSensitivity*dStrain
-				           + CunloadSlope*(TstrainSensitivity-CstrainSensitivity);
+				           + committed->unloadSlope*(TstrainSensitivity-CstrainSensitivity);
 
 		dktdh = CunloadSlopeSensitivity;
 	}
@@ -809,7 +815,7 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 	
 	if (SHVs == 0) {
 		SHVs = new Matrix(5,numGrads);
-		CunloadSlopeSensitivity = (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
+		CunloadSlopeSensitivity = (2.0*fpcSensitivity*params->epsc0-2.0*params->fpc*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 	}
 	else {
 		CminStrainSensitivity   = (*SHVs)(0,gradIndex);
@@ -821,36 +827,36 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 
 
 	// Strain increment 
-	double dStrain = Tstrain - Cstrain;
+	double dStrain = trial->strain - committed->strain;
 
 	// Evaluate stress sensitivity 
 	if (dStrain < 0.0) {					// applying more compression to the material
 
-		if (Tstrain < CminStrain) {			// loading along the backbone curve
+		if (trial->strain < committed->minStrain) {			// loading along the backbone curve
 
-			if (Tstrain > epsc0) {			//on the parabola
+			if (trial->strain > params->epsc0) {			//on the parabola
 				
-				TstressSensitivity = fpcSensitivity*(2.0*Tstrain/epsc0-(Tstrain/epsc0)*(Tstrain/epsc0))
-					      + fpc*( (2.0*TstrainSensitivity*epsc0-2.0*Tstrain*epsc0Sensitivity)/(epsc0*epsc0) 
-						  - 2.0*(Tstrain/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)/(epsc0*epsc0));
+				TstressSensitivity = fpcSensitivity*(2.0*trial->strain/params->epsc0-(trial->strain/params->epsc0)*(trial->strain/params->epsc0))
+					      + params->fpc*( (2.0*TstrainSensitivity*params->epsc0-2.0*trial->strain*epsc0Sensitivity)/(params->epsc0*params->epsc0) 
+						  - 2.0*(trial->strain/params->epsc0)*(TstrainSensitivity*params->epsc0-trial->strain*epsc0Sensitivity)/(params->epsc0*params->epsc0));
 				
-				dktdh = 2.0*((fpcSensitivity*epsc0-fpc*epsc0Sensitivity)/(epsc0*epsc0))
-					  * (1.0-Tstrain/epsc0)
-					  - 2.0*(fpc/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)
-					  / (epsc0*epsc0);
+				dktdh = 2.0*((fpcSensitivity*params->epsc0-params->fpc*epsc0Sensitivity)/(params->epsc0*params->epsc0))
+					  * (1.0-trial->strain/params->epsc0)
+					  - 2.0*(params->fpc/params->epsc0)*(TstrainSensitivity*params->epsc0-trial->strain*epsc0Sensitivity)
+					  / (params->epsc0*params->epsc0);
 			}
-			else if (Tstrain > epscu) {		// on the straight inclined line
+			else if (trial->strain > params->epscu) {		// on the straight inclined line
 
 				dktdh = ( (fpcSensitivity-fpcuSensitivity)
-					  * (epsc0-epscu) 
-					  - (fpc-fpcu)
+					  * (params->epsc0-params->epscu) 
+					  - (params->fpc-params->fpcu)
 					  * (epsc0Sensitivity-epscuSensitivity) )
-					  / ((epsc0-epscu)*(epsc0-epscu));
+					  / ((params->epsc0-params->epscu)*(params->epsc0-params->epscu));
 
-				double kt = (fpc-fpcu)/(epsc0-epscu);
+				double kt = (params->fpc-params->fpcu)/(params->epsc0-params->epscu);
 
 				TstressSensitivity = fpcSensitivity 
-					      + dktdh*(Tstrain-epsc0)
+					      + dktdh*(trial->strain-params->epsc0)
 						  + kt*(TstrainSensitivity-epsc0Sensitivity);
 			}
 			else {							// on the horizontal line
@@ -860,10 +866,10 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 			
 			}
 		}
-		else if (Tstrain < CendStrain) {	// reloading after an unloading that didn't go all the way to zero stress
+		else if (trial->strain < committed->endStrain) {	// reloading after an unloading that didn't go all the way to zero stress
 
-			TstressSensitivity = CunloadSlopeSensitivity * (Tstrain-CendStrain)
-				      + CunloadSlope * (TstrainSensitivity-CendStrainSensitivity);
+			TstressSensitivity = CunloadSlopeSensitivity * (trial->strain-committed->endStrain)
+				      + committed->unloadSlope * (TstrainSensitivity-CendStrainSensitivity);
 
 			dktdh = CunloadSlopeSensitivity;
 		}
@@ -874,11 +880,11 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 
 		}
 	}
-	else if (Cstress+CunloadSlope*dStrain<0.0) {// unloading, but not all the way down to zero stress
+	else if (committed->stress+committed->unloadSlope*dStrain<0.0) {// unloading, but not all the way down to zero stress
 	
 		TstressSensitivity = CstressSensitivity 
 			               + CunloadSlopeSensitivity*dStrain
-				           + CunloadSlope*(TstrainSensitivity-CstrainSensitivity);
+				           + committed->unloadSlope*(TstrainSensitivity-CstrainSensitivity);
 
 		dktdh = CunloadSlopeSensitivity;
 	}
@@ -907,27 +913,27 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 	double TunloadSlopeSensitivity = CunloadSlopeSensitivity;
 	double TendStrainSensitivity = CendStrainSensitivity;
 
-	if (dStrain<0.0 && Tstrain<CminStrain) {
+	if (dStrain<0.0 && trial->strain<committed->minStrain) {
 
 		TminStrainSensitivity = TstrainSensitivity;
 
-		if (Tstrain < epscu) {
+		if (trial->strain < params->epscu) {
 
-			epsTemp = epscu; 
+			epsTemp = params->epscu; 
 
 			epsTempSensitivity = epscuSensitivity;
 
 		}
 		else {
 
-			epsTemp = Tstrain;
+			epsTemp = trial->strain;
 
 			epsTempSensitivity = TstrainSensitivity;
 		}
 
-		eta = epsTemp/epsc0;
+		eta = epsTemp/params->epsc0;
 
-		etaSensitivity = (epsTempSensitivity*epsc0-epsTemp*epsc0Sensitivity) / (epsc0*epsc0);
+		etaSensitivity = (epsTempSensitivity*params->epsc0-epsTemp*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 
 		if (eta < 2.0) {
 
@@ -943,32 +949,32 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 			ratioSensitivity = 0.707 * etaSensitivity;
 		}
 
-		temp1 = Tstrain - ratio * epsc0;
+		temp1 = trial->strain - ratio * params->epsc0;
 
-		temp1Sensitivity = TstrainSensitivity - ratioSensitivity * epsc0
+		temp1Sensitivity = TstrainSensitivity - ratioSensitivity * params->epsc0
 			                                  - ratio * epsc0Sensitivity;
 
-		temp2 = Tstress * epsc0 / (2.0*fpc); 
+		temp2 = trial->stress * params->epsc0 / (2.0*params->fpc); 
 		
-		temp2Sensitivity = (2.0*fpc*(TstressSensitivity*epsc0+Tstress*epsc0Sensitivity)
-			-2.0*Tstress*epsc0*fpcSensitivity) / (4.0*fpc*fpc);
+		temp2Sensitivity = (2.0*params->fpc*(TstressSensitivity*params->epsc0+trial->stress*epsc0Sensitivity)
+			-2.0*trial->stress*params->epsc0*fpcSensitivity) / (4.0*params->fpc*params->fpc);
 
 		if (temp1 == 0.0) {
 
-			TunloadSlopeSensitivity = (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
+			TunloadSlopeSensitivity = (2.0*fpcSensitivity*params->epsc0-2.0*params->fpc*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 		}
 		else if (temp1 < temp2) {
 
 			TendStrainSensitivity = TstrainSensitivity - temp1Sensitivity;
 
-			TunloadSlopeSensitivity = (TstressSensitivity*temp1-Tstress*temp1Sensitivity) / (temp1*temp1);
+			TunloadSlopeSensitivity = (TstressSensitivity*temp1-trial->stress*temp1Sensitivity) / (temp1*temp1);
 
 		}
 		else {
 
 			TendStrainSensitivity = TstrainSensitivity - temp2Sensitivity;
 
-			TunloadSlopeSensitivity = (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
+			TunloadSlopeSensitivity = (2.0*fpcSensitivity*params->epsc0-2.0*params->fpc*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 		}
 	}
 	else {
@@ -1098,7 +1104,7 @@ int
 Concrete01::getVariable(const char *varName, Information &theInfo)
 {
   if (strcmp(varName,"ec") == 0) {
-    theInfo.theDouble = epsc0;
+    theInfo.theDouble = params->epsc0;
     return 0;
   } else
     return -1;
@@ -40,6 +40,7 @@
 
 
 #include <UniaxialMaterial.h>
+#include <memory>
 
 class Concrete01 : public UniaxialMaterial
 {
@@ -55,13 +56,17 @@ class Concrete01 : public UniaxialMaterial
   double getStrain(void);      
   double getStress(void);
   double getTangent(void);
-  double getInitialTangent(void) {return 2.0*fpc/epsc0;}
+  double getInitialTangent(void) {return 2.0*params->fpc/params->epsc0;}
 
   int commitState(void);
   int revertToLastCommit(void);    
   int revertToStart(void);        
+
+  int getStateSize(void) const;
+  int setStateStorage(double *trial, double *committed);
   
   UniaxialMaterial *getCopy(void);
+  bool isThreadSafe(void) const {return true;}
   
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
@@ -79,38 +84,40 @@ class Concrete01 : public UniaxialMaterial
 
   int getVariable(const char *variable, Information &);
   //by SAJalali
-  double getEnergy() { return EnergyP; }
+  double getEnergy() { return committed->energy; }
 
  protected:
 
  private:
   /*** Material Properties ***/
-  double fpc;    // Compressive strength
-  double epsc0;  // Strain at compressive strength
-  double fpcu;   // Crushing strength
-  double epscu;  // Strain at crushing strength
-  
-  /*** CONVERGED History Variables ***/
-  double CminStrain;   // Smallest previous concrete strain (compression)
-  double CunloadSlope; // Unloading (reloading) slope from CminStrain
-  double CendStrain;   // Strain at the end of unloading from CminStrain
-  
-  /*** CONVERGED State Variables ***/
-  double Cstrain;
-  double Cstress;   
-  double Ctangent;	// Don't need Ctangent other than for revert and sendSelf/recvSelf
-  // Storing it is better than recomputing it!!!
-  
-  /*** TRIAL History Variables ***/
-  double TminStrain;
-  double TunloadSlope;
-  double TendStrain;
+  // shared by the copies of a material until updateParameter() changes
+  // them for one of them
+  struct Parameters {
+    double fpc;    // Compressive strength
+    double epsc0;  // Strain at compressive strength
+    double fpcu;   // Crushing strength
+    double epscu;  // Strain at crushing strength
+  };
+  std::shared_ptr<Parameters> params;
+
+  Concrete01(int tag, const std::shared_ptr<Parameters> &params);
   
-  /*** TRIAL State Variables ***/
-  double Tstrain;
-  double Tstress;
-  double Ttangent; // Not really a state variable, but declared here
-  // for convenience
+  /*** History and State Variables ***/
+  // the trial and converged values are kept in ownState or in the
+  // arrays given to setStateStorage()
+  struct State {
+    double minStrain;   // Smallest previous concrete strain (compression)
+    double unloadSlope; // Unloading (reloading) slope from minStrain
+    double endStrain;   // Strain at the end of unloading from minStrain
+    double strain;
+    double stress;   
+    double tangent;	// Don't need the converged tangent other than for revert and sendSelf/recvSelf
+    // Storing it is better than recomputing it!!!
+    double energy;      //by SAJalali
+  };
+  State *ownState;
+  State *trial;
+  State *committed;
   
   void determineTrialState (double dStrain);
   
@@ -122,9 +129,6 @@ class Concrete01 : public UniaxialMaterial
   int parameterID;
   Matrix *SHVs;
   // AddingSensitivity:END ///////////////////////////////////////////
-
-  //by SAJalali
-  double EnergyP;
 };
 
 
@@ -43,6 +43,7 @@
 #include <Concrete02.h>
 #include <OPS_Globals.h>
 #include <float.h>
+#include <new>
 #include <Channel.h>
 #include <Information.h>
 
@@ -92,67 +93,69 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Concrete02)
 
 Concrete02::Concrete02(int tag, double _fc, double _epsc0, double _fcu,
 		       double _epscu, double _rat, double _ft, double _Ets):
-  UniaxialMaterial(tag, MAT_TAG_Concrete02),
-  fc(_fc), epsc0(_epsc0), fcu(_fcu), epscu(_epscu), rat(_rat), ft(_ft), Ets(_Ets)
+  Concrete02(tag, std::make_shared<Parameters>(Parameters{_fc, _epsc0, _fcu, _epscu, _rat, _ft, _Ets}))
 {
-  ecminP = 0.0;
-  deptP = 0.0;
-
-  if (fc > 0) fc = -fc;
-  if (epsc0 > 0) epsc0 = -epsc0;
-  if (fcu > 0) fcu = -fcu;
-  if (epscu > 0) epscu = -epscu;
-
-  eP = 2.0*fc/epsc0;
-  epsP = 0.0;
-  sigP = 0.0;
-  eps = 0.0;
-  sig = 0.0;
-  e = 2.0*fc/epsc0;
+
 }
 
 Concrete02::Concrete02(int tag, double _fc, double _epsc0, double _fcu,
 		       double _epscu):
   UniaxialMaterial(tag, MAT_TAG_Concrete02),
-  fc(_fc), epsc0(_epsc0), fcu(_fcu), epscu(_epscu)
+  params(new Parameters{_fc, _epsc0, _fcu, _epscu}),
+  ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
-  ecminP = 0.0;
-  deptP = 0.0;
 
-  if (fc > 0) fc = -fc;
-  if (epsc0 > 0) epsc0 = -epsc0;
-  if (fcu > 0) fcu = -fcu;
-  if (epscu > 0) epscu = -epscu;
+  Parameters &p = *params;
+  if (p.fc > 0) p.fc = -p.fc;
+  if (p.epsc0 > 0) p.epsc0 = -p.epsc0;
+  if (p.fcu > 0) p.fcu = -p.fcu;
+  if (p.epscu > 0) p.epscu = -p.epscu;
 	  
-  eP = 2.0*fc/epsc0;
-  epsP = 0.0;
-  sigP = 0.0;
-  eps = 0.0;
-  sig = 0.0;
-  e = 2.0*fc/epsc0;
-
-  rat = 0.1;
-  ft = 0.1*fc;
-  if (ft < 0.0)
-    ft = -ft;
-  Ets = 0.1*fc/epsc0;
+  committed->e = 2.0*p.fc/p.epsc0;
+  trial->e = 2.0*p.fc/p.epsc0;
+
+  p.rat = 0.1;
+  p.ft = 0.1*p.fc;
+  if (p.ft < 0.0)
+    p.ft = -p.ft;
+  p.Ets = 0.1*p.fc/p.epsc0;
+}
+
+Concrete02::Concrete02(int tag, const std::shared_ptr<Parameters> &theParams):
+  UniaxialMaterial(tag, MAT_TAG_Concrete02),
+  params(theParams),
+  ownState(new State[2]()), trial(ownState), committed(ownState+1)
+{
+
+  // those shared with another material have been made negative already
+  Parameters &p = *params;
+  if (p.fc > 0) p.fc = -p.fc;
+  if (p.epsc0 > 0) p.epsc0 = -p.epsc0;
+  if (p.fcu > 0) p.fcu = -p.fcu;
+  if (p.epscu > 0) p.epscu = -p.epscu;
+
+  committed->e = 2.0*p.fc/p.epsc0;
+  trial->e = 2.0*p.fc/p.epsc0;
 }
 
 Concrete02::Concrete02(void):
-  UniaxialMaterial(0, MAT_TAG_Concrete02)
+  UniaxialMaterial(0, MAT_TAG_Concrete02),
+  params(new Parameters{}),
+  ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
  
 }
 
 Concrete02::~Concrete02(void)
 {
-  // Does nothing
+  delete [] ownState;
 }
 
+// the copy shares the parameters of this material
 UniaxialMaterial*
 Concrete02::getCopy(void)
 {
-  Concrete02 *theCopy = new Concrete02(this->getTag(), fc, epsc0, fcu, epscu, rat, ft, Ets);
+  Concrete02 *theCopy = new Concrete02(this->getTag(), params);
   
   return theCopy;
 }
@@ -160,24 +163,26 @@ Concrete02::getCopy(void)
 double
 Concrete02::getInitialTangent(void)
 {
-  return 2.0*fc/epsc0;
+  return 2.0*params->fc/params->epsc0;
 }
 
 int
 Concrete02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double  ec0 = fc * 2. / epsc0;
+  const Parameters p = *params;
+
+  double  ec0 = p.fc * 2. / p.epsc0;
 
   // retrieve concrete history variables
 
-  ecmin = ecminP;
-  dept = deptP;
-  TEnergy = CEnergy;
+  trial->ecmin = committed->ecmin;
+  trial->dept = committed->dept;
+  trial->energy = committed->energy;
 
   // calculate current strain
 
-  eps = trialStrain;
-  double deps = eps - epsP;
+  trial->eps = trialStrain;
+  double deps = trial->eps - committed->eps;
 
   if (fabs(deps) < DBL_EPSILON)
     return 0;
@@ -185,9 +190,9 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
   // if the current strain is less than the smallest previous strain 
   // call the monotonic envelope in compression and reset minimum strain 
 
-  if (eps < ecmin) {
-    this->Compr_Envlp(eps, sig, e);
-    ecmin = eps;
+  if (trial->eps < trial->ecmin) {
+    this->Compr_Envlp(trial->eps, trial->sig, trial->e);
+    trial->ecmin = trial->eps;
   } else {;
 
     // else, if the current strain is between the minimum strain and ept 
@@ -199,7 +204,7 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
     // (corresponding equations are 2.31 and 2.32 
     // the strain of point R is epsR and the stress is sigmR 
     
-    double epsr = (fcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
+    double epsr = (p.fcu - p.rat * ec0 * p.epscu) / (ec0 * (1.0 - p.rat));
     double sigmr = ec0 * epsr;
     
     // calculate the previous minimum stress sigmm from the minimum 
@@ -207,27 +212,27 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
     
     double sigmm;
     double dumy;
-    this->Compr_Envlp(ecmin, sigmm, dumy);
+    this->Compr_Envlp(trial->ecmin, sigmm, dumy);
     
     // calculate current reloading slope Er (Eq. 2.35 in EERC Report) 
     // calculate the intersection of the current reloading slope Er 
     // with the zero stress axis (variable ept) (Eq. 2.36 in EERC Report) 
     
-    double er = (sigmm - sigmr) / (ecmin - epsr);
-    double ept = ecmin - sigmm / er;
+    double er = (sigmm - sigmr) / (trial->ecmin - epsr);
+    double ept = trial->ecmin - sigmm / er;
     
-    if (eps <= ept) {
-      double sigmin = sigmm + er * (eps - ecmin);
-      double sigmax = er * .5f * (eps - ept);
-      sig = sigP + ec0 * deps;
-      e = ec0;
-      if (sig <= sigmin) {
-	sig = sigmin;
-	e = er;
+    if (trial->eps <= ept) {
+      double sigmin = sigmm + er * (trial->eps - trial->ecmin);
+      double sigmax = er * .5f * (trial->eps - ept);
+      trial->sig = committed->sig + ec0 * deps;
+      trial->e = ec0;
+      if (trial->sig <= sigmin) {
+	trial->sig = sigmin;
+	trial->e = er;
       }
-      if (sig >= sigmax) {
-	sig = sigmax;
-	e = 0.5 * er;
+      if (trial->sig >= sigmax) {
+	trial->sig = sigmax;
+	trial->e = 0.5 * er;
       }
     } else {
       
@@ -240,29 +245,29 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
       // calculate first the strain at the peak of the tensile stress-strain 
       // relation epn (Eq. 2.42 in EERC Report) 
       
-      double epn = ept + dept;
+      double epn = ept + trial->dept;
       double sicn;
-      if (eps <= epn) {
-	this->Tens_Envlp(dept, sicn, e);
-	if (dept != 0.0) {
-	  e = sicn / dept;
+      if (trial->eps <= epn) {
+	this->Tens_Envlp(trial->dept, sicn, trial->e);
+	if (trial->dept != 0.0) {
+	  trial->e = sicn / trial->dept;
 	} else {
-	  e = ec0;
+	  trial->e = ec0;
 	}
-	sig = e * (eps - ept);
+	trial->sig = trial->e * (trial->eps - ept);
       } else {
 	
 	// else, if the current strain is larger than epn the response 
 	// corresponds to the tensile envelope curve shifted by ept 
 	
-	double epstmp = eps - ept;
-	this->Tens_Envlp(epstmp, sig, e);
-	dept = eps - ept;
+	double epstmp = trial->eps - ept;
+	this->Tens_Envlp(epstmp, trial->sig, trial->e);
+	trial->dept = trial->eps - ept;
       }
     }
   }
 
-  TEnergy += 0.5 * (sigP + sig) * (eps - epsP);
+  trial->energy += 0.5 * (committed->sig + trial->sig) * (trial->eps - committed->eps);
   //opserr << "CE: " << CEnergy << " -> TE: " << TEnergy << " | s (" << sigP << ", " << sig << ", M: " << 0.5 * (sigP + sig) << "); dE: " << (eps - epsP) << "\n";
 
   return 0;
@@ -273,65 +278,66 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
 double 
 Concrete02::getStrain(void)
 {
-  return eps;
+  return trial->eps;
 }
 
 double 
 Concrete02::getStress(void)
 {
-  return sig;
+  return trial->sig;
 }
 
 double 
 Concrete02::getTangent(void)
 {
-  return e;
+  return trial->e;
 }
 
 int 
 Concrete02::commitState(void)
 {
-  ecminP = ecmin;
-  deptP = dept;
-  
-  eP = e;
-  sigP = sig;
-  epsP = eps;
-
-  CEnergy = TEnergy;
-
+  *committed = *trial;
   return 0;
 }
 
 int 
 Concrete02::revertToLastCommit(void)
 {
-  ecmin = ecminP;;
-  dept = deptP;
-  
-  e = eP;
-  sig = sigP;
-  eps = epsP;
+  *trial = *committed;
+  return 0;
+}
 
-  TEnergy = CEnergy;
+int
+Concrete02::getStateSize(void) const
+{
+  return sizeof(State)/sizeof(double);
+}
 
+int
+Concrete02::setStateStorage(double *trialState, double *committedState)
+{
+  State *newTrial = new (trialState) State(*trial);
+  State *newCommitted = new (committedState) State(*committed);
+
+  delete [] ownState;
+  ownState = nullptr;
+  trial = newTrial;
+  committed = newCommitted;
   return 0;
 }
 
 int 
 Concrete02::revertToStart(void)
 {
-  ecminP = 0.0;
-  deptP = 0.0;
+  committed->ecmin = 0.0;
+  committed->dept = 0.0;
 
-  eP = 2.0*fc/epsc0;
-  epsP = 0.0;
-  sigP = 0.0;
-  eps = 0.0;
-  sig = 0.0;
-  e = 2.0*fc/epsc0;
+  committed->e = 2.0*params->fc/params->epsc0;
+  committed->eps = 0.0;
+  committed->sig = 0.0;
+  committed->energy = 0.0;
 
-  TEnergy = CEnergy = 0.0;
+  *trial = *committed;
 
   return 0;
 }
@@ -339,19 +345,19 @@ Concrete02::revertToStart(void)
 int 
 Concrete02::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(13);
-  data(0) =fc;    
-  data(1) =epsc0; 
-  data(2) =fcu;   
-  data(3) =epscu; 
-  data(4) =rat;   
-  data(5) =ft;    
-  data(6) =Ets;   
-  data(7) =ecminP;
-  data(8) =deptP; 
-  data(9) =epsP;  
-  data(10) =sigP; 
-  data(11) =eP;   
+  Vector data(13);
+  data(0) =params->fc;    
+  data(1) =params->epsc0; 
+  data(2) =params->fcu;   
+  data(3) =params->epscu; 
+  data(4) =params->rat;   
+  data(5) =params->ft;    
+  data(6) =params->Ets;   
+  data(7) =committed->ecmin;
+  data(8) =committed->dept; 
+  data(9) =committed->eps;  
+  data(10) =committed->sig; 
+  data(11) =committed->e;   
   data(12) = this->getTag();
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
@@ -366,30 +372,29 @@ Concrete02::recvSelf(int commitTag, Channel &theChannel,
 	     FEM_ObjectBroker &theBroker)
 {
 
-  static Vector data(13);
+  Vector data(13);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Concrete02::recvSelf() - failed to recvSelf\n";
     return -1;
   }
 
-  fc = data(0);
-  epsc0 = data(1);
-  fcu = data(2);
-  epscu = data(3);
-  rat = data(4);
-  ft = data(5);
-  Ets = data(6);
-  ecminP = data(7);
-  deptP = data(8);
-  epsP = data(9);
-  sigP = data(10);
-  eP = data(11);
+  params = std::make_shared<Parameters>();
+  params->fc = data(0);
+  params->epsc0 = data(1);
+  params->fcu = data(2);
+  params->epscu = data(3);
+  params->rat = data(4);
+  params->ft = data(5);
+  params->Ets = data(6);
+  committed->ecmin = data(7);
+  committed->dept = data(8);
+  committed->eps = data(9);
+  committed->sig = data(10);
+  committed->e = data(11);
   this->setTag(data(12));
 
-  e = eP;
-  sig = sigP;
-  eps = epsP;
+  *trial = *committed;
   
   return 0;
 }
@@ -398,21 +403,21 @@ void
 Concrete02::Print(OPS_Stream &s, int flag)
 {
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {      
-    s << "Concrete02:(strain, stress, tangent) " << eps << " " << sig << " " << e << endln;
+    s << "Concrete02:(strain, stress, tangent) " << trial->eps << " " << trial->sig << " " << trial->e << endln;
   }
 
   if (flag == OPS_PRINT_PRINTMODEL_JSON) {
     s << "\t\t\t{";
 	s << "\"name\": \"" << this->getTag() << "\", ";
 	s << "\"type\": \"Concrete02\", ";
-	s << "\"Ec\": " << 2.0*fc/epsc0 << ", ";
-	s << "\"fc\": " << fc << ", ";
-    s << "\"epsc\": " << epsc0 << ", ";
-    s << "\"fcu\": " << fcu << ", ";
-    s << "\"epscu\": " << epscu << ", ";
-    s << "\"ratio\": " << rat << ", ";
-    s << "\"ft\": " << ft << ", ";
-    s << "\"Ets\": " << Ets << "}";
+	s << "\"Ec\": " << 2.0*params->fc/params->epsc0 << ", ";
+	s << "\"fc\": " << params->fc << ", ";
+    s << "\"epsc\": " << params->epsc0 << ", ";
+    s << "\"fcu\": " << params->fcu << ", ";
+    s << "\"epscu\": " << params->epscu << ", ";
+    s << "\"ratio\": " << params->rat << ", ";
+    s << "\"ft\": " << params->ft << ", ";
+    s << "\"Ets\": " << params->Ets << "}";
   }
 }
 
@@ -420,6 +425,8 @@ Concrete02::Print(OPS_Stream &s, int flag)
 void
 Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
 {
+  const Parameters p = *params;
+
 /*-----------------------------------------------------------------------
 ! monotonic envelope of concrete in tension (positive envelope)
 !
@@ -433,17 +440,17 @@ Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
 !    Ect  = tangent concrete modulus
 !-----------------------------------------------------------------------*/
   
-  double Ec0  = 2.0*fc/epsc0;
+  double Ec0  = 2.0*p.fc/p.epsc0;
 
-  double eps0 = ft/Ec0;
-  double epsu = ft*(1.0/Ets+1.0/Ec0);
+  double eps0 = p.ft/Ec0;
+  double epsu = p.ft*(1.0/p.Ets+1.0/Ec0);
   if (epsc<=eps0) {
     sigc = epsc*Ec0;
     Ect  = Ec0;
   } else {
     if (epsc<=epsu) {
-      Ect  = -Ets;
-      sigc = ft-Ets*(epsc-eps0);
+      Ect  = -p.Ets;
+      sigc = p.ft-p.Ets*(epsc-eps0);
     } else {
       //      Ect  = 0.0
       Ect  = 1.0e-10;
@@ -457,6 +464,8 @@ Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
 void
 Concrete02::Compr_Envlp (double epsc, double &sigc, double &Ect) 
 {
+  const Parameters p = *params;
+
 /*-----------------------------------------------------------------------
 ! monotonic envelope of concrete in compression (negative envelope)
 !
@@ -472,23 +481,23 @@ Concrete02::Compr_Envlp (double epsc, double &sigc, double &Ect)
 !   Ect   = tangent concrete modulus
 -----------------------------------------------------------------------*/
 
-  double Ec0  = 2.0*fc/epsc0;
+  double Ec0  = 2.0*p.fc/p.epsc0;
 
-  double ratLocal = epsc/epsc0;
-  if (epsc>=epsc0) {
-    sigc = fc*ratLocal*(2.0-ratLocal);
+  double ratLocal = epsc/p.epsc0;
+  if (epsc>=p.epsc0) {
+    sigc = p.fc*ratLocal*(2.0-ratLocal);
     Ect  = Ec0*(1.0-ratLocal);
   } else {
     
     //   linear descending branch between epsc0 and epscu
-    if (epsc>epscu) {
-      sigc = (fcu-fc)*(epsc-epsc0)/(epscu-epsc0)+fc;
-      Ect  = (fcu-fc)/(epscu-epsc0);
+    if (epsc>p.epscu) {
+      sigc = (p.fcu-p.fc)*(epsc-p.epsc0)/(p.epscu-p.epsc0)+p.fc;
+      Ect  = (p.fcu-p.fc)/(p.epscu-p.epsc0);
     } else {
 	   
       // flat friction branch for strains larger than epscu
       
-      sigc = fcu;
+      sigc = p.fcu;
       Ect  = 1.0e-10;
       //       Ect  = 0.0
     }
@@ -500,7 +509,7 @@ int
 Concrete02::getVariable(const char *varName, Information &theInfo)
 {
   if (strcmp(varName,"ec") == 0) {
-    theInfo.theDouble = epsc0;
+    theInfo.theDouble = params->epsc0;
     return 0;
   } else
     return -1;
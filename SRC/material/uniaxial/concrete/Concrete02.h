@@ -41,6 +41,7 @@
 #define Concrete02_h
 
 #include <UniaxialMaterial.h>
+#include <memory>
 
 class Concrete02 : public UniaxialMaterial
 {
@@ -57,6 +58,7 @@ class Concrete02 : public UniaxialMaterial
     const char *getClassType(void) const {return "Concrete02";};    
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) const {return true;}
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     double getStrain(void);      
@@ -66,6 +68,9 @@ class Concrete02 : public UniaxialMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+
+    int getStateSize(void) const;
+    int setStateStorage(double *trial, double *committed);
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -75,7 +80,7 @@ class Concrete02 : public UniaxialMaterial
 
     int getVariable(const char *variable, Information &);
     
-    double getEnergy() { return TEnergy; }
+    double getEnergy() { return trial->energy; }
 
  protected:
     
@@ -83,31 +88,35 @@ class Concrete02 : public UniaxialMaterial
     void Tens_Envlp (double epsc, double &sigc, double &Ect);
     void Compr_Envlp (double epsc, double &sigc, double &Ect);
 
-    // matpar : Concrete FIXED PROPERTIES
-    double fc;    // concrete compression strength           : mp(1)
-    double epsc0; // strain at compression strength          : mp(2)
-    double fcu;   // stress at ultimate (crushing) strain    : mp(3)
-    double epscu; // ultimate (crushing) strain              : mp(4)       
-    double rat;   // ratio between unloading slope at epscu and original slope : mp(5)
-    double ft;    // concrete tensile strength               : mp(6)
-    double Ets;   // tension stiffening slope                : mp(7)
-
-    // hstvP : Concerete HISTORY VARIABLES last committed step
-    double ecminP;  //  hstP(1)
-    double deptP;   //  hstP(2)
-    double epsP;  //  = strain at previous converged step
-    double sigP;  //  = stress at previous converged step
-    double eP;    //   stiffness modulus at last converged step;
-
-    // hstv : Concerete HISTORY VARIABLES  current step
-    double ecmin;  
-    double dept;   
-    double sig;   
-    double e;     
-    double eps;   
-
-    double TEnergy = 0.0;
-    double CEnergy = 0.0;
+    // matpar : Concrete FIXED PROPERTIES, which the copies of a material
+    // share
+    struct Parameters {
+      double fc;    // concrete compression strength           : mp(1)
+      double epsc0; // strain at compression strength          : mp(2)
+      double fcu;   // stress at ultimate (crushing) strain    : mp(3)
+      double epscu; // ultimate (crushing) strain              : mp(4)       
+      double rat;   // ratio between unloading slope at epscu and original slope : mp(5)
+      double ft;    // concrete tensile strength               : mp(6)
+      double Ets;   // tension stiffening slope                : mp(7)
+    };
+    std::shared_ptr<Parameters> params;
+
+    Concrete02(int tag, const std::shared_ptr<Parameters> &params);
+
+    // hstv : Concerete HISTORY VARIABLES, of which the trial (current
+    // step) and committed values are kept in ownState or in the arrays
+    // given to setStateStorage()
+    struct State {
+      double ecmin;  //  hst(1)
+      double dept;   //  hst(2)
+      double eps;    //  = strain
+      double sig;    //  = stress
+      double e;      //  = stiffness modulus
+      double energy;
+    };
+    State *ownState;
+    State *trial;
+    State *committed;
 };
 
 
@@ -37,6 +37,7 @@
 #include <float.h>
 
 #include <OPS_Globals.h>
+#include <new>
 
 #if 1
 #include <elementAPI.h>
@@ -92,23 +93,28 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Steel01)
 
 Steel01::Steel01(int tag, double FY, double E, double B,
                 double A1, double A2, double A3, double A4):
+   Steel01(tag, std::make_shared<Parameters>(Parameters{FY, E, B, A1, A2, A3, A4}))
+{
+
+}
+
+Steel01::Steel01(int tag, const std::shared_ptr<Parameters> &theParams):
    UniaxialMaterial(tag,MAT_TAG_Steel01),
-   fy(FY), E0(E), b(B), a1(A1), a2(A2), a3(A3), a4(A4)
+   params(theParams),
+   ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
    // Sets all history and state variables to initial values
 
    // Initialize state variables
-   Energy = 0;	//by SAJalali
    parameterID = 0;
    SHVs = 0;
    this->revertToStart();
 }
 
 Steel01::Steel01():UniaxialMaterial(0,MAT_TAG_Steel01),
- fy(0.0), E0(0.0), b(0.0), a1(0.0), a2(0.0), a3(0.0), a4(0.0)
+ params(new Parameters{}),
+ ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
-  Energy = 0;	//by SAJalali
-
   // AddingSensitivity:BEGIN /////////////////////////////////////
   parameterID = 0;
   SHVs = 0;
@@ -117,6 +123,8 @@ Steel01::Steel01():UniaxialMaterial(0,MAT_TAG_Steel01),
 
 Steel01::~Steel01 ()
 {
+  delete [] ownState;
+
 // AddingSensitivity:BEGIN /////////////////////////////////////
   if (SHVs != 0) 
       delete SHVs;
@@ -126,25 +134,20 @@ Steel01::~Steel01 ()
 int Steel01::setTrialStrain (double strain, double strainRate)
 {
    // Reset history variables to last converged state
-   TminStrain = CminStrain;
-   TmaxStrain = CmaxStrain;
-   TshiftP = CshiftP;
-   TshiftN = CshiftN;
-   Tloading = Cloading;
-   Tstrain = Cstrain;
-   Tstress = Cstress;
-   Ttangent = Ctangent;
+   *trial = *committed;
 
    // Determine change in strain from last converged state
-   double dStrain = strain - Cstrain;
+   double dStrain = strain - committed->strain;
 
    if (fabs(dStrain) > DBL_EPSILON) {
      // Set trial strain
-     Tstrain = strain;
+     trial->strain = strain;
 
      // Calculate the trial state given the trial strain
      determineTrialState (dStrain);
 
+     //by SAJalali
+     trial->energy += 0.5*(trial->stress + committed->stress)*(trial->strain - committed->strain);
    }
 
    return 0;
@@ -153,47 +156,62 @@ int Steel01::setTrialStrain (double strain, double strainRate)
 int Steel01::setTrial (double strain, double &stress, double &tangent, double strainRate)
 {
    // Reset history variables to last converged state
-   TminStrain = CminStrain;
-   TmaxStrain = CmaxStrain;
-   TshiftP = CshiftP;
-   TshiftN = CshiftN;
-   Tloading = Cloading;
-   Tstrain = Cstrain;
-   Tstress = Cstress;
-   Ttangent = Ctangent;
+   *trial = *committed;
 
    // Determine change in strain from last converged state
-   double dStrain = strain - Cstrain;
+   double dStrain = strain - committed->strain;
 
    if (fabs(dStrain) > DBL_EPSILON) {
      // Set trial strain
-     Tstrain = strain;
+     trial->strain = strain;
 
      // Calculate the trial state given the trial strain
      determineTrialState (dStrain);
 
+     //by SAJalali
+     trial->energy += 0.5*(trial->stress + committed->stress)*(trial->strain - committed->strain);
    }
 
-   stress = Tstress;
-   tangent = Ttangent;
+   stress = trial->stress;
+   tangent = trial->tangent;
 
    return 0;
 }
 
+// Materials of this class are updated with non-virtual calls; any other
+// material in the batch goes through setTrial().
+int
+Steel01::setTrialBatch(UniaxialMaterial * const *materials, int n,
+                       const double *strain, double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    if (materials[i]->getClassTag() == MAT_TAG_Steel01) {
+      Steel01 *theMaterial = static_cast<Steel01 *>(materials[i]);
+      res += theMaterial->Steel01::setTrial(strain[i], stress[i], tangent[i]);
+    } else
+      res += materials[i]->setTrial(strain[i], stress[i], tangent[i]);
+  }
+
+  return res;
+}
+
 void Steel01::determineTrialState (double dStrain)
 {
-      double fyOneMinusB = fy * (1.0 - b);
+      const Parameters p = *params;
+
+      double fyOneMinusB = p.fy * (1.0 - p.b);
 
-      double Esh = b*E0;
-      double epsy = fy/E0;
+      double Esh = p.b*p.E0;
+      double epsy = p.fy/p.E0;
       
-      double c1 = Esh*Tstrain;
+      double c1 = Esh*trial->strain;
       
-      double c2 = TshiftN*fyOneMinusB;
+      double c2 = trial->shiftN*fyOneMinusB;
 
-      double c3 = TshiftP*fyOneMinusB;
+      double c3 = trial->shiftP*fyOneMinusB;
 
-      double c = Cstress + E0*dStrain;
+      double c = committed->stress + p.E0*dStrain;
 
       /**********************************************************
          removal of the following lines due to problems with
@@ -206,14 +224,14 @@ void Steel01::determineTrialState (double dStrain)
       double c1c3 = c1 + c3;
 
       if (c1c3 < c)
-	Tstress = c1c3;
+	trial->stress = c1c3;
       else
-	Tstress = c;
+	trial->stress = c;
 
       double c1c2 = c1-c2;
 
-      if (c1c2 > Tstress)
-	Tstress = c1c2;
+      if (c1c2 > trial->stress)
+	trial->stress = c1c2;
 
       /* ***********************************************************
       and replace them with:
@@ -221,122 +239,122 @@ void Steel01::determineTrialState (double dStrain)
       Tstress = fmax((c1-c2), fmin((c1+c3),c));
       **************************************************************/
 
-      if (fabs(Tstress-c) < DBL_EPSILON)
-	  Ttangent = E0;
+      if (fabs(trial->stress-c) < DBL_EPSILON)
+	  trial->tangent = p.E0;
       else
-	Ttangent = Esh;
+	trial->tangent = Esh;
 
       //
       // Determine if a load reversal has occurred due to the trial strain
       //
 
       // Determine initial loading condition
-      if (Tloading == 0 && dStrain != 0.0) {
+      if (trial->loading == 0 && dStrain != 0.0) {
         if (dStrain > 0.0)
-          Tloading = 1;
+          trial->loading = 1;
         else
-          Tloading = -1;
+          trial->loading = -1;
       }
 
       // Transition from loading to unloading, i.e. positive strain increment
       // to negative strain increment
-      if (Tloading == 1 && dStrain < 0.0) {
-	  Tloading = -1;
-	  if (Cstrain > TmaxStrain)
-	    TmaxStrain = Cstrain;
-	  TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+      if (trial->loading == 1 && dStrain < 0.0) {
+	  trial->loading = -1;
+	  if (committed->strain > trial->maxStrain)
+	    trial->maxStrain = committed->strain;
+	  trial->shiftN = 1 + p.a1*pow((trial->maxStrain-trial->minStrain)/(2.0*p.a2*epsy),0.8);
       }
 
       // Transition from unloading to loading, i.e. negative strain increment
       // to positive strain increment
-      if (Tloading == -1 && dStrain > 0.0) {
-	  Tloading = 1;
-	  if (Cstrain < TminStrain)
-	    TminStrain = Cstrain;
-	  TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+      if (trial->loading == -1 && dStrain > 0.0) {
+	  trial->loading = 1;
+	  if (committed->strain < trial->minStrain)
+	    trial->minStrain = committed->strain;
+	  trial->shiftP = 1 + p.a3*pow((trial->maxStrain-trial->minStrain)/(2.0*p.a4*epsy),0.8);
       }
 }
 
 void Steel01::detectLoadReversal (double dStrain)
 {
+   const Parameters p = *params;
+
    // Determine initial loading condition
-   if (Tloading == 0 && dStrain != 0.0)
+   if (trial->loading == 0 && dStrain != 0.0)
    {
       if (dStrain > 0.0)
-         Tloading = 1;
+         trial->loading = 1;
       else
-         Tloading = -1;
+         trial->loading = -1;
    }
 
-   double epsy = fy/E0;
+   double epsy = p.fy/p.E0;
 
    // Transition from loading to unloading, i.e. positive strain increment
    // to negative strain increment
-   if (Tloading == 1 && dStrain < 0.0) {
-      Tloading = -1;
-      if (Cstrain > TmaxStrain)
-         TmaxStrain = Cstrain;
-      TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+   if (trial->loading == 1 && dStrain < 0.0) {
+      trial->loading = -1;
+      if (committed->strain > trial->maxStrain)
+         trial->maxStrain = committed->strain;
+      trial->shiftN = 1 + p.a1*pow((trial->maxStrain-trial->minStrain)/(2.0*p.a2*epsy),0.8);
    }
 
    // Transition from unloading to loading, i.e. negative strain increment
    // to positive strain increment
-   if (Tloading == -1 && dStrain > 0.0) {
-      Tloading = 1;
-      if (Cstrain < TminStrain)
-         TminStrain = Cstrain;
-      TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+   if (trial->loading == -1 && dStrain > 0.0) {
+      trial->loading = 1;
+      if (committed->strain < trial->minStrain)
+         trial->minStrain = committed->strain;
+      trial->shiftP = 1 + p.a3*pow((trial->maxStrain-trial->minStrain)/(2.0*p.a4*epsy),0.8);
    }
 }
 
 double Steel01::getStrain ()
 {
-   return Tstrain;
+   return trial->strain;
 }
 
 double Steel01::getStress ()
 {
-   return Tstress;
+   return trial->stress;
 }
 
 double Steel01::getTangent ()
 {
-   return Ttangent;
+   return trial->tangent;
 }
 
 int Steel01::commitState ()
 {
-   // History variables
-   CminStrain = TminStrain;
-   CmaxStrain = TmaxStrain;
-   CshiftP = TshiftP;
-   CshiftN = TshiftN;
-   Cloading = Tloading;
+   *committed = *trial;
 
-   // State variables
-   //by SAJalali
-   Energy += 0.5*(Tstress + Cstress)*(Tstrain - Cstrain);
+   return 0;
+}
 
-   Cstrain = Tstrain;
-   Cstress = Tstress;
-   Ctangent = Ttangent;
+int Steel01::revertToLastCommit ()
+{
+   // Reset trial history and state variables to last committed state
+   *trial = *committed;
 
    return 0;
 }
 
-int Steel01::revertToLastCommit ()
+int
+Steel01::getStateSize(void) const
+{
+   return sizeof(State)/sizeof(double);
+}
+
+int
+Steel01::setStateStorage(double *trialState, double *committedState)
 {
-   // Reset trial history variables to last committed state
-   TminStrain = CminStrain;
-   TmaxStrain = CmaxStrain;
-   TshiftP  = CshiftP;
-   TshiftN  = CshiftN;
-   Tloading = Cloading;
-
-   // Reset trial state variables to last committed state
-   Tstrain  = Cstrain;
-   Tstress  = Cstress;
-   Ttangent = Ctangent;
+   State *newTrial = new (trialState) State(*trial);
+   State *newCommitted = new (committedState) State(*committed);
+
+   delete [] ownState;
+   ownState = nullptr;
+   trial = newTrial;
+   committed = newCommitted;
 
    return 0;
 }
@@ -345,26 +363,19 @@ int
 Steel01::revertToStart()
 {
    // History variables
-   CminStrain = 0.0;
-   CmaxStrain = 0.0;
-   CshiftP = 1.0;
-   CshiftN = 1.0;
-   Cloading = 0;
-
-   TminStrain = 0.0;
-   TmaxStrain = 0.0;
-   TshiftP    = 1.0;
-   TshiftN    = 1.0;
-   Tloading   = 0;
+   committed->energy = 0.0;	//by SAJalali
+   committed->minStrain = 0.0;
+   committed->maxStrain = 0.0;
+   committed->shiftP = 1.0;
+   committed->shiftN = 1.0;
+   committed->loading = 0;
 
    // State variables
-   Cstrain  = 0.0;
-   Cstress  = 0.0;
-   Ctangent = E0;
+   committed->strain  = 0.0;
+   committed->stress  = 0.0;
+   committed->tangent = params->E0;
 
-   Tstrain  = 0.0;
-   Tstress  = 0.0;
-   Ttangent = E0;
+   *trial = *committed;
 
 // AddingSensitivity:BEGIN /////////////////////////////////
    if (SHVs != 0) 
@@ -376,32 +387,12 @@ Steel01::revertToStart()
 
 UniaxialMaterial* Steel01::getCopy ()
 {
-   Steel01* theCopy = new Steel01(this->getTag(), fy, E0, b,
-				  a1, a2, a3, a4);
-
-   // Converged history variables
-   theCopy->CminStrain = CminStrain;
-   theCopy->CmaxStrain = CmaxStrain;
-   theCopy->CshiftP = CshiftP;
-   theCopy->CshiftN = CshiftN;
-   theCopy->Cloading = Cloading;
-
-   // Trial history variables
-   theCopy->TminStrain = TminStrain;
-   theCopy->TmaxStrain = TmaxStrain;
-   theCopy->TshiftP = TshiftP;
-   theCopy->TshiftN = TshiftN;
-   theCopy->Tloading = Tloading;
-
-   // Converged state variables
-   theCopy->Cstrain = Cstrain;
-   theCopy->Cstress = Cstress;
-   theCopy->Ctangent = Ctangent;
-
-   // Trial state variables
-   theCopy->Tstrain = Tstrain;
-   theCopy->Tstress = Tstress;
-   theCopy->Ttangent = Ttangent;
+   // the copy shares the material properties
+   Steel01* theCopy = new Steel01(this->getTag(), params);
+
+   // Converged and trial history and state variables
+   *theCopy->committed = *committed;
+   *theCopy->trial = *trial;
 
    return theCopy;
 }
@@ -409,29 +400,29 @@ UniaxialMaterial* Steel01::getCopy ()
 int Steel01::sendSelf (int commitTag, Channel& theChannel)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    data(0) = this->getTag();
 
    // Material properties
-   data(1) = fy;
-   data(2) = E0;
-   data(3) = b;
-   data(4) = a1;
-   data(5) = a2;
-   data(6) = a3;
-   data(7) = a4;
+   data(1) = params->fy;
+   data(2) = params->E0;
+   data(3) = params->b;
+   data(4) = params->a1;
+   data(5) = params->a2;
+   data(6) = params->a3;
+   data(7) = params->a4;
 
    // History variables from last converged state
-   data(8) = CminStrain;
-   data(9) = CmaxStrain;
-   data(10) = CshiftP;
-   data(11) = CshiftN;
-   data(12) = Cloading;
+   data(8) = committed->minStrain;
+   data(9) = committed->maxStrain;
+   data(10) = committed->shiftP;
+   data(11) = committed->shiftN;
+   data(12) = committed->loading;
 
    // State variables from last converged state
-   data(13) = Cstrain;
-   data(14) = Cstress;
-   data(15) = Ctangent;
+   data(13) = committed->strain;
+   data(14) = committed->stress;
+   data(15) = committed->tangent;
 
    // Data is only sent after convergence, so no trial variables
    // need to be sent through data vector
@@ -447,7 +438,7 @@ int Steel01::recvSelf (int commitTag, Channel& theChannel,
                                 FEM_ObjectBroker& theBroker)
 {
    int res = 0;
-   static Vector data(16);
+   Vector data(16);
    res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   
    if (res < 0) {
@@ -458,38 +449,30 @@ int Steel01::recvSelf (int commitTag, Channel& theChannel,
       this->setTag(int(data(0)));
 
       // Material properties
-      fy = data(1);
-      E0 = data(2);
-      b = data(3);
-      a1 = data(4);
-      a2 = data(5);
-      a3 = data(6);
-      a4 = data(7);
+      params = std::make_shared<Parameters>();
+      params->fy = data(1);
+      params->E0 = data(2);
+      params->b = data(3);
+      params->a1 = data(4);
+      params->a2 = data(5);
+      params->a3 = data(6);
+      params->a4 = data(7);
 
       // History variables from last converged state
-      CminStrain = data(8);
-      CmaxStrain = data(9);
-      CshiftP = data(10);
-      CshiftN = data(11);
-      Cloading = int(data(12));
-
-      // Copy converged history values into trial values since data is only
-      // sent (received) after convergence
-      TminStrain = CminStrain;
-      TmaxStrain = CmaxStrain;
-      TshiftP = CshiftP;
-      TshiftN = CshiftN;
-      Tloading = Cloading;
+      committed->minStrain = data(8);
+      committed->maxStrain = data(9);
+      committed->shiftP = data(10);
+      committed->shiftN = data(11);
+      committed->loading = int(data(12));
 
       // State variables from last converged state
-      Cstrain = data(13);
-      Cstress = data(14);
-      Ctangent = data(15);      
-
-      // Copy converged state values into trial values
-      Tstrain = Cstrain;
-      Tstress = Cstress;
-      Ttangent = Ctangent;
+      committed->strain = data(13);
+      committed->stress = data(14);
+      committed->tangent = data(15);      
+
+      // Copy converged values into trial values since data is only
+      // sent (received) after convergence
+      *trial = *committed;
    }
     
    return res;
@@ -501,23 +484,23 @@ void Steel01::Print (OPS_Stream& s, int flag)
     s << "\t\t\t{";
 	s << "\"name\": \"" << this->getTag() << "\", ";
 	s << "\"type\": \"Steel01\", ";
-	s << "\"E\": " << E0 << ", ";
-	s << "\"fy\": " << fy << ", ";
-    s << "\"b\": " << b << ", ";
-    s << "\"a1\": " << a1 << ", ";
-    s << "\"a2\": " << a2 << ", ";
-    s << "\"a3\": " << a3 << ", ";
-    s << "\"a4\": " << a4 << "}";
+	s << "\"E\": " << params->E0 << ", ";
+	s << "\"fy\": " << params->fy << ", ";
+    s << "\"b\": " << params->b << ", ";
+    s << "\"a1\": " << params->a1 << ", ";
+    s << "\"a2\": " << params->a2 << ", ";
+    s << "\"a3\": " << params->a3 << ", ";
+    s << "\"a4\": " << params->a4 << "}";
   }
   else if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {    
     s << "Steel01 tag: " << this->getTag() << endln;
-    s << "  fy: " << fy << " ";
-    s << "  E0: " << E0 << " ";
-    s << "   b: " << b << " ";
-    s << "  a1: " << a1 << " ";
-    s << "  a2: " << a2 << " ";
-    s << "  a3: " << a3 << " ";
-    s << "  a4: " << a4 << " ";
+    s << "  fy: " << params->fy << " ";
+    s << "  E0: " << params->E0 << " ";
+    s << "   b: " << params->b << " ";
+    s << "  a1: " << params->a1 << " ";
+    s << "  a2: " << params->a2 << " ";
+    s << "  a3: " << params->a3 << " ";
+    s << "  a4: " << params->a4 << " ";
   } 
 }
 
@@ -530,31 +513,31 @@ Steel01::setParameter(const char **argv, int argc, Parameter &param)
 {
 
   if (strcmp(argv[0],"sigmaY") == 0 || strcmp(argv[0],"fy") == 0 || strcmp(argv[0],"Fy") == 0) {
-    param.setValue(fy);
+    param.setValue(params->fy);
     return param.addObject(1, this);
   }
   if (strcmp(argv[0],"E") == 0) {
-    param.setValue(E0);
+    param.setValue(params->E0);
     return param.addObject(2, this);
   }
   if (strcmp(argv[0],"b") == 0) {
-    param.setValue(b);
+    param.setValue(params->b);
     return param.addObject(3, this);
   }
   if (strcmp(argv[0],"a1") == 0) {
-    param.setValue(a1);
+    param.setValue(params->a1);
     return param.addObject(4, this);
   }
   if (strcmp(argv[0],"a2") == 0) {
-    param.setValue(a2);
+    param.setValue(params->a2);
     return param.addObject(5, this);
   }
   if (strcmp(argv[0],"a3") == 0) {
-    param.setValue(a3);
+    param.setValue(params->a3);
     return param.addObject(6, this);
   }
   if (strcmp(argv[0],"a4") == 0) {
-    param.setValue(a4);
+    param.setValue(params->a4);
     return param.addObject(7, this);
   }
 
@@ -566,35 +549,39 @@ Steel01::setParameter(const char **argv, int argc, Parameter &param)
 int
 Steel01::updateParameter(int parameterID, Information &info)
 {
+	// the properties of this material no longer match those of its copies
+	if (params.use_count() > 1)
+		params = std::make_shared<Parameters>(*params);
+
 	switch (parameterID) {
 	case -1:
 		return -1;
 	case 1:
-		this->fy = info.theDouble;
+		params->fy = info.theDouble;
 		break;
 	case 2:
-		this->E0 = info.theDouble;
+		params->E0 = info.theDouble;
 		break;
 	case 3:
-		this->b = info.theDouble;
+		params->b = info.theDouble;
 		break;
 	case 4:
-		this->a1 = info.theDouble;
+		params->a1 = info.theDouble;
 		break;
 	case 5:
-		this->a2 = info.theDouble;
+		params->a2 = info.theDouble;
 		break;
 	case 6:
-		this->a3 = info.theDouble;
+		params->a3 = info.theDouble;
 		break;
 	case 7:
-		this->a4 = info.theDouble;
+		params->a4 = info.theDouble;
 		break;
 	default:
 		return -1;
 	}
 
-	Ttangent = E0;          // Initial stiffness
+	trial->tangent = params->E0;          // Initial stiffness
 
 	return 0;
 }
@@ -645,13 +632,13 @@ Steel01::getStressSensitivity(int gradIndex, bool conditional)
 
 	// Compute min and max stress
 	double Tstress;
-	double dStrain = Tstrain-Cstrain;
-	double sigmaElastic = Cstress + E0*dStrain;
-	double fyOneMinusB = fy * (1.0 - b);
-	double Esh = b*E0;
-	double c1 = Esh*Tstrain;
-	double c2 = TshiftN*fyOneMinusB;
-	double c3 = TshiftP*fyOneMinusB;
+	double dStrain = trial->strain-committed->strain;
+	double sigmaElastic = committed->stress + params->E0*dStrain;
+	double fyOneMinusB = params->fy * (1.0 - params->b);
+	double Esh = params->b*params->E0;
+	double c1 = Esh*trial->strain;
+	double c2 = trial->shiftN*fyOneMinusB;
+	double c3 = trial->shiftP*fyOneMinusB;
 	double sigmaMax = c1+c3;
 	double sigmaMin = c1-c2;
 
@@ -659,20 +646,20 @@ Steel01::getStressSensitivity(int gradIndex, bool conditional)
 	// Evaluate stress sensitivity 
 	if ( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) ) {
 		Tstress = sigmaMax;
-		gradient = E0Sensitivity*b*Tstrain 
-				 + E0*bSensitivity*Tstrain
-				 + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*trial->strain 
+				 + params->E0*bSensitivity*trial->strain
+				 + trial->shiftP*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 	else {
 		Tstress = sigmaElastic;
 		gradient = CstressSensitivity 
-			     + E0Sensitivity*(Tstrain-Cstrain)
-				 - E0*CstrainSensitivity;
+			     + E0Sensitivity*(trial->strain-committed->strain)
+				 - params->E0*CstrainSensitivity;
 	}
 	if (sigmaMin > Tstress) {
-		gradient = E0Sensitivity*b*Tstrain
-			     + E0*bSensitivity*Tstrain
-				 - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*trial->strain
+			     + params->E0*bSensitivity*trial->strain
+				 - trial->shiftN*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 
 	return gradient;
@@ -732,13 +719,13 @@ Steel01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numGrad
 
 	// Compute min and max stress
 	double Tstress;
-	double dStrain = Tstrain-Cstrain;
-	double sigmaElastic = Cstress + E0*dStrain;
-	double fyOneMinusB = fy * (1.0 - b);
-	double Esh = b*E0;
-	double c1 = Esh*Tstrain;
-	double c2 = TshiftN*fyOneMinusB;
-	double c3 = TshiftP*fyOneMinusB;
+	double dStrain = trial->strain-committed->strain;
+	double sigmaElastic = committed->stress + params->E0*dStrain;
+	double fyOneMinusB = params->fy * (1.0 - params->b);
+	double Esh = params->b*params->E0;
+	double c1 = Esh*trial->strain;
+	double c2 = trial->shiftN*fyOneMinusB;
+	double c3 = trial->shiftP*fyOneMinusB;
 	double sigmaMax = c1+c3;
 	double sigmaMin = c1-c2;
 
@@ -746,22 +733,22 @@ Steel01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numGrad
 	// Evaluate stress sensitivity ('gradient')
 	if ( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) ) {
 		Tstress = sigmaMax;
-		gradient = E0Sensitivity*b*Tstrain 
-				 + E0*bSensitivity*Tstrain
-				 + E0*b*TstrainSensitivity
-				 + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*trial->strain 
+				 + params->E0*bSensitivity*trial->strain
+				 + params->E0*params->b*TstrainSensitivity
+				 + trial->shiftP*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 	else {
 		Tstress = sigmaElastic;
 		gradient = CstressSensitivity 
-			     + E0Sensitivity*(Tstrain-Cstrain)
-				 + E0*(TstrainSensitivity-CstrainSensitivity);
+			     + E0Sensitivity*(trial->strain-committed->strain)
+				 + params->E0*(TstrainSensitivity-CstrainSensitivity);
 	}
 	if (sigmaMin > Tstress) {
-		gradient = E0Sensitivity*b*Tstrain
-			     + E0*bSensitivity*Tstrain
-			     + E0*b*TstrainSensitivity
-				 - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*trial->strain
+			     + params->E0*bSensitivity*trial->strain
+			     + params->E0*params->b*TstrainSensitivity
+				 - trial->shiftN*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 
 
@@ -39,6 +39,7 @@
 
 
 #include <UniaxialMaterial.h>
+#include <memory>
 
 // Default values for isotropic hardening parameters a1, a2, a3, and a4
 #define STEEL_01_DEFAULT_A1        0.0
@@ -59,16 +60,22 @@ class Steel01 : public UniaxialMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
+    int setTrialBatch(UniaxialMaterial * const *materials, int n,
+                      const double *strain, double *stress, double *tangent);
     double getStrain(void);              
     double getStress(void);
     double getTangent(void);
-    double getInitialTangent(void) {return E0;};
+    double getInitialTangent(void) {return params->E0;};
 
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
 
+    int getStateSize(void) const;
+    int setStateStorage(double *trial, double *committed);
+
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) const {return true;}
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -85,48 +92,48 @@ class Steel01 : public UniaxialMaterial
     int    commitSensitivity        (double strainGradient, int gradIndex, int numGrads);
     // AddingSensitivity:END ///////////////////////////////////////////
 	//by SAJalali
-	virtual double getEnergy() { return Energy; }
+	virtual double getEnergy() { return committed->energy; }
 
  protected:
     
  private:
-	 double Energy;	//by SAJalali
-	/*** Material Properties ***/
-    double fy;  // Yield stress
-    double E0;  // Initial stiffness
-    double b;   // Hardening ratio (b = Esh/E0)
-    double a1;
-    double a2;
-    double a3;
-    double a4;  // a1 through a4 are coefficients for isotropic hardening
-    
-    /*** CONVERGED History Variables ***/
-    double CminStrain;  // Minimum strain in compression
-    double CmaxStrain;  // Maximum strain in tension
-    double CshiftP;     // Shift in hysteresis loop for positive loading
-    double CshiftN;     // Shift in hysteresis loop for negative loading
-    int Cloading;       // Flag for loading/unloading
-                        // 1 = loading (positive strain increment)
-                        // -1 = unloading (negative strain increment)
-                        // 0 initially
-
-    /*** CONVERGED State Variables ***/    
-    double Cstrain;
-    double Cstress;
-    double Ctangent;    
-
-    /*** TRIAL History Variables ***/
-    double TminStrain;
-    double TmaxStrain;
-    double TshiftP;
-    double TshiftN;
-    int Tloading;
-    
-    /*** TRIAL State Variables ***/
-    double Tstrain;
-    double Tstress;
-    double Ttangent; // Not really a state variable, but declared here
-                     // for convenience
+    /*** Material Properties ***/
+    // shared by the copies of a material until updateParameter() changes
+    // them for one of them
+    struct Parameters {
+      double fy;  // Yield stress
+      double E0;  // Initial stiffness
+      double b;   // Hardening ratio (b = Esh/E0)
+      double a1;
+      double a2;
+      double a3;
+      double a4;  // a1 through a4 are coefficients for isotropic hardening
+    };
+    std::shared_ptr<Parameters> params;
+
+    Steel01(int tag, const std::shared_ptr<Parameters> &params);
+
+    /*** History and State Variables ***/
+    // the trial and converged values are kept in ownState or in the
+    // arrays given to setStateStorage()
+    struct State {
+      double minStrain;  // Minimum strain in compression
+      double maxStrain;  // Maximum strain in tension
+      double shiftP;     // Shift in hysteresis loop for positive loading
+      double shiftN;     // Shift in hysteresis loop for negative loading
+      double loading;    // Flag for loading/unloading
+                         // 1 = loading (positive strain increment)
+                         // -1 = unloading (negative strain increment)
+                         // 0 initially
+      double strain;
+      double stress;
+      double tangent;    // Not really a state variable, but declared here
+                         // for convenience
+      double energy;     //by SAJalali
+    };
+    State *ownState;
+    State *trial;
+    State *committed;
 
     // Calculates the trial state variables based on the trial strain
     void determineTrialState (double dStrain);
@@ -41,6 +41,7 @@
 #include <Parameter.h>
 
 #include <OPS_Globals.h>
+#include <new>
 
 #if 1
 #include <elementAPI.h>
@@ -122,8 +123,16 @@ Steel02::Steel02(int tag,
      double _R0, double _cR1, double _cR2,
      double _a1, double _a2, double _a3, double _a4, double sigInit):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), a1(_a1), a2(_a2), a3(_a3), a4(_a4), 
-  sigini(sigInit)
+  params(new Parameters{_Fy, _E0, _b, _R0, _cR1, _cR2, _a1, _a2, _a3, _a4, sigInit}),
+  ownState(new State[2]()), trial(ownState), committed(ownState+1)
+{
+  this->revertToStart();
+}
+
+Steel02::Steel02(int tag, const std::shared_ptr<Parameters> &theParams):
+  UniaxialMaterial(tag, MAT_TAG_Steel02),
+  params(theParams),
+  ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
   this->revertToStart();
 }
@@ -131,112 +140,68 @@ Steel02::Steel02(int tag,
 int 
 Steel02::revertToStart(void)
 {
-  EnergyP = 0;  //by SAJalali
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;  
-
-  konP = 0;
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
-
-  if (sigini != 0.0) {
-    epsP = sigini/E0;
-    sigP = sigini;
+  committed->energy = 0;  //by SAJalali
+  committed->e = params->E0;
+  committed->eps = 0.0;
+  committed->sig = 0.0;
+
+  committed->kon = 0;
+  committed->epsmax = params->Fy/params->E0;
+  committed->epsmin = -committed->epsmax;
+  committed->epspl = 0.0;
+  committed->epss0 = 0.0;
+  committed->sigs0 = 0.0;
+  committed->epsr = 0.0;
+  committed->sigr = 0.0;
+
+  if (params->sigini != 0.0) {
+    committed->eps = params->sigini/params->E0;
+    committed->sig = params->sigini;
   } 
 
+  *trial = *committed;
+  trial->sig = 0.0;
+  trial->eps = 0.0;
+  trial->e = params->E0;  
+
   return 0;
 }
 
+// Default values for no isotropic hardening
 Steel02::Steel02(int tag,
      double _Fy, double _E0, double _b,
      double _R0, double _cR1, double _cR2):
-  UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), sigini(0.0)
+  Steel02(tag, _Fy, _E0, _b, _R0, _cR1, _cR2, 0.0, 1.0, 0.0, 1.0)
 {
-  EnergyP = 0;  //by SAJalali
-  konP = 0;
-
-  // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
-
-  eP = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig = 0.0;
-  eps = 0.0;
-  e = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+
 }
 
+// Default values for elastic to hardening transitions and no
+// isotropic hardening
 Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
-  UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), sigini(0.0)
+  Steel02(tag, _Fy, _E0, _b, 15.0, 0.925, 0.15, 0.0, 1.0, 0.0, 1.0)
 {
-  EnergyP = 0;  // by SAJalali
-  konP    = 0;  //
-
-  // Default values for elastic to hardening transitions
-  R0  = 15.0;
-  cR1 = 0.925;
-  cR2 = 0.15;
-
-  // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
-
-  eP   = E0;
-  epsP = 0.0;
-  sigP = 0.0;
-  sig  = 0.0;
-  eps  = 0.0;
-  e    = E0;
-
-  epsmaxP = Fy/E0;
-  epsminP = -epsmaxP;
-  epsplP = 0.0;
-  epss0P = 0.0;
-  sigs0P = 0.0;
-  epssrP = 0.0;
-  sigsrP = 0.0;
+
 }
 
 Steel02::Steel02(void):
-  UniaxialMaterial(0, MAT_TAG_Steel02)
+  UniaxialMaterial(0, MAT_TAG_Steel02),
+  params(new Parameters{}),
+  ownState(new State[2]()), trial(ownState), committed(ownState+1)
 {
-  EnergyP = 0;  //by SAJalali
-  konP = 0;
+
 }
 
 Steel02::~Steel02(void)
 {
-  // Does nothing
+  delete [] ownState;
 }
 
+// the copy shares the parameters of this material
 UniaxialMaterial*
 Steel02::getCopy(void)
 {
-  Steel02 *theCopy = new Steel02(this->getTag(), Fy, E0, b, R0, cR1, cR2, a1, a2, a3, a4, sigini);
+  Steel02 *theCopy = new Steel02(this->getTag(), params);
   
   return theCopy;
 }
@@ -244,58 +209,61 @@ Steel02::getCopy(void)
 double
 Steel02::getInitialTangent(void)
 {
-  return E0;
+  return params->E0;
 }
 
 int
 Steel02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double Esh = b * E0;
-  double epsy = Fy / E0;
+  const Parameters p = *params;
+
+  double Esh = p.b * p.E0;
+  double epsy = p.Fy / p.E0;
 
   // modified C-P. Lamarche 2006
-  if (sigini != 0.0) {
-    double epsini = sigini/E0;
-    eps = trialStrain + epsini;
+  if (p.sigini != 0.0) {
+    double epsini = p.sigini/p.E0;
+    trial->eps = trialStrain + epsini;
   } else
-    eps = trialStrain;
+    trial->eps = trialStrain;
   // modified C-P. Lamarche 2006
 
-  double deps = eps - epsP;
+  double deps = trial->eps - committed->eps;
   
-  epsmax = epsmaxP;
-  epsmin = epsminP;
-  epspl  = epsplP;
-  epss0  = epss0P;  
-  sigs0  = sigs0P; 
-  epsr   = epssrP;  
-  sigr   = sigsrP;  
-  kon    = konP;
+  trial->epsmax = committed->epsmax;
+  trial->epsmin = committed->epsmin;
+  trial->epspl  = committed->epspl;
+  trial->epss0  = committed->epss0;  
+  trial->sigs0  = committed->sigs0; 
+  trial->epsr   = committed->epsr;  
+  trial->sigr   = committed->sigr;  
+  trial->kon    = committed->kon;
 
-  if (kon == 0 || kon == 3) { // modified C-P. Lamarche 2006
+  if (trial->kon == 0 || trial->kon == 3) { // modified C-P. Lamarche 2006
 
 
     if (fabs(deps) < 10.0*DBL_EPSILON) {
 
-      e = E0;
-      sig = sigini;                // modified C-P. Lamarche 2006
-      kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
+      trial->e = p.E0;
+      trial->sig = p.sigini;                // modified C-P. Lamarche 2006
+      trial->kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
+      trial->energy = committed->energy;
       return 0;
 
     } else {
 
-      epsmax = epsy;
-      epsmin = -epsy;
+      trial->epsmax = epsy;
+      trial->epsmin = -epsy;
       if (deps < 0.0) {
-        kon = 2;
-        epss0 = epsmin;
-        sigs0 = -Fy;
-        epspl = epsmin;
+        trial->kon = 2;
+        trial->epss0 = trial->epsmin;
+        trial->sigs0 = -p.Fy;
+        trial->epspl = trial->epsmin;
       } else {
-        kon = 1;
-        epss0 = epsmax;
-        sigs0 = Fy;
-        epspl = epsmax;
+        trial->kon = 1;
+        trial->epss0 = trial->epsmax;
+        trial->sigs0 = p.Fy;
+        trial->epspl = trial->epsmax;
       }
     }
   }
@@ -307,21 +275,21 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
   // To include isotropic strain hardening shift the strain hardening 
   // asymptote by sigsft before calculating the intersection point 
   // Constants a3 and a4 control this stress shift on the tension side
-  if (kon == 2 && deps > 0.0) {
+  if (trial->kon == 2 && deps > 0.0) {
 
-    kon = 1;
-    epsr = epsP;
-    sigr = sigP;
+    trial->kon = 1;
+    trial->epsr = committed->eps;
+    trial->sigr = committed->sig;
     //epsmin = min(epsP, epsmin);
-    if (epsP < epsmin)
-      epsmin = epsP;
-      double d1 = (epsmax - epsmin) / (2.0*(a4 * epsy));
-      double shft = 1.0 + a3 * pow(d1, 0.8);
-      epss0 = (Fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-      sigs0 = Fy * shft + Esh * (epss0 - epsy * shft);
-      epspl = epsmax;
-
-    } else if (kon == 1 && deps < 0.0) {
+    if (committed->eps < trial->epsmin)
+      trial->epsmin = committed->eps;
+      double d1 = (trial->epsmax - trial->epsmin) / (2.0*(p.a4 * epsy));
+      double shft = 1.0 + p.a3 * pow(d1, 0.8);
+      trial->epss0 = (p.Fy * shft - Esh * epsy * shft - trial->sigr + p.E0 * trial->epsr) / (p.E0 - Esh);
+      trial->sigs0 = p.Fy * shft + Esh * (trial->epss0 - epsy * shft);
+      trial->epspl = trial->epsmax;
+
+    } else if (trial->kon == 1 && deps < 0.0) {
       
       // update the maximum previous strain, store the last load reversal 
       // point and calculate the stress and strain (sigs0 and epss0) at the 
@@ -330,34 +298,38 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
       // asymptote by sigsft before calculating the intersection point 
       // Constants a1 and a2 control this stress shift on compression side 
 
-      kon = 2;
-      epsr = epsP;
-      sigr = sigP;
+      trial->kon = 2;
+      trial->epsr = committed->eps;
+      trial->sigr = committed->sig;
       //      epsmax = max(epsP, epsmax);
-      if (epsP > epsmax)
-        epsmax = epsP;
+      if (committed->eps > trial->epsmax)
+        trial->epsmax = committed->eps;
       
-      double d1 = (epsmax - epsmin) / (2.0*(a2 * epsy));
-      double shft = 1.0 + a1 * pow(d1, 0.8);
-      epss0 = (-Fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-      sigs0 = -Fy * shft + Esh * (epss0 + epsy * shft);
-      epspl = epsmin;
+      double d1 = (trial->epsmax - trial->epsmin) / (2.0*(p.a2 * epsy));
+      double shft = 1.0 + p.a1 * pow(d1, 0.8);
+      trial->epss0 = (-p.Fy * shft + Esh * epsy * shft - trial->sigr + p.E0 * trial->epsr) / (p.E0 - Esh);
+      trial->sigs0 = -p.Fy * shft + Esh * (trial->epss0 + epsy * shft);
+      trial->epspl = trial->epsmin;
   }
 
   
   // calculate current stress sig and tangent modulus E 
 
-  double xi     = fabs((epspl-epss0)/epsy);
-  double R      = R0*(1.0 - (cR1*xi)/(cR2+xi));
-  double epsrat = (eps-epsr)/(epss0-epsr);
+  double xi     = fabs((trial->epspl-trial->epss0)/epsy);
+  double R      = p.R0*(1.0 - (p.cR1*xi)/(p.cR2+xi));
+  double epsrat = (trial->eps-trial->epsr)/(trial->epss0-trial->epsr);
   double dum1  = 1.0 + pow(fabs(epsrat),R);
   double dum2  = pow(dum1,(1/R));
 
-  sig   = b*epsrat +(1.0-b)*epsrat/dum2;
-  sig   = sig*(sigs0-sigr)+sigr;
+  trial->sig   = p.b*epsrat +(1.0-p.b)*epsrat/dum2;
+  trial->sig   = trial->sig*(trial->sigs0-trial->sigr)+trial->sigr;
 
-  e = b + (1.0-b)/(dum1*dum2);
-  e = e*(sigs0-sigr)/(epss0-epsr);
+  trial->e = p.b + (1.0-p.b)/(dum1*dum2);
+  trial->e = trial->e*(trial->sigs0-trial->sigr)/(trial->epss0-trial->epsr);
+
+  //by SAJalali
+  trial->energy = committed->energy 
+                + 0.5*(trial->sig + committed->sig)*(trial->eps - committed->eps);
 
   return 0;
 }
@@ -367,88 +339,81 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 double 
 Steel02::getStrain(void)
 {
-  return eps;
+  return trial->eps;
 }
 
 double 
 Steel02::getStress(void)
 {
-  return sig;
+  return trial->sig;
 }
 
 double 
 Steel02::getTangent(void)
 {
-  return e;
+  return trial->e;
 }
 
 int 
 Steel02::commitState(void)
 {
-  epsminP = epsmin;
-  epsmaxP = epsmax;
-  epsplP = epspl;
-  epss0P = epss0;
-  sigs0P = sigs0;
-  epssrP = epsr;
-  sigsrP = sigr;
-  konP = kon;
-
-  //by SAJalali
-  EnergyP += 0.5*(sig + sigP)*(eps - epsP);
-
-  eP = e;
-  sigP = sig;
-  epsP = eps;
-
+  *committed = *trial;
   return 0;
 }
 
 int 
 Steel02::revertToLastCommit(void)
 {
-  epsmin = epsminP;
-  epsmax = epsmaxP;
-  epspl = epsplP;
-  epss0 = epss0P;
-  sigs0 = sigs0P;
-  epsr = epssrP;
-  sigr = sigsrP;
-  kon = konP;
-  
-  e = eP;
-  sig = sigP;
-  eps = epsP;
+  *trial = *committed;
+  return 0;
+}
+
+int
+Steel02::getStateSize(void) const
+{
+  return sizeof(State)/sizeof(double);
+}
+
+int
+Steel02::setStateStorage(double *trialState, double *committedState)
+{
+  State *newTrial = new (trialState) State(*trial);
+  State *newCommitted = new (committedState) State(*committed);
+
+  delete [] ownState;
+  ownState = nullptr;
+  trial = newTrial;
+  committed = newCommitted;
   return 0;
 }
 
 int 
 Steel02::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(23);
-  data(0)  = Fy;
-  data(1)  = E0;
-  data(2)  = b;
-  data(3)  = R0;
-  data(4)  = cR1;
-  data(5)  = cR2;
-  data(6)  = a1;
-  data(7)  = a2;
-  data(8)  = a3;
-  data(9)  = a4;
-  data(10) = epsminP;
-  data(11) = epsmaxP;
-  data(12) = epsplP;
-  data(13) = epss0P;
-  data(14) = sigs0P;
-  data(15) = epssrP;
-  data(16) = sigsrP;
-  data(17) = konP;  
-  data(18) = epsP;  
-  data(19) = sigP;  
-  data(20) = eP;    
+  Vector data(23);
+  data(0)  = params->Fy;
+  data(1)  = params->E0;
+  data(2)  = params->b;
+  data(3)  = params->R0;
+  data(4)  = params->cR1;
+  data(5)  = params->cR2;
+  data(6)  = params->a1;
+  data(7)  = params->a2;
+  data(8)  = params->a3;
+  data(9)  = params->a4;
+  data(10) = committed->epsmin;
+  data(11) = committed->epsmax;
+  data(12) = committed->epspl;
+  data(13) = committed->epss0;
+  data(14) = committed->sigs0;
+  data(15) = committed->epsr;
+  data(16) = committed->sigr;
+  data(17) = committed->kon;  
+  data(18) = committed->eps;  
+  data(19) = committed->sig;  
+  data(20) = committed->e;    
   data(21) = this->getTag();
-  data(22) = sigini;
+  data(22) = params->sigini;
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::sendSelf() - failed to sendSelf\n";
@@ -461,40 +426,39 @@ int
 Steel02::recvSelf(int commitTag, Channel &theChannel, 
        FEM_ObjectBroker &theBroker)
 {
-  static Vector data(23);
+  Vector data(23);
 
   if (theChannel.recvVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::recvSelf() - failed to recvSelf\n";
     return -1;
   }
 
-  Fy = data(0);
-  E0 = data(1);
-  b = data(2); 
-  R0 = data(3);
-  cR1 = data(4);
-  cR2 = data(5);
-  a1 = data(6); 
-  a2 = data(7); 
-  a3 = data(8); 
-  a4 = data(9); 
-  epsminP = data(10);
-  epsmaxP = data(11);
-  epsplP = data(12); 
-  epss0P = data(13); 
-  sigs0P = data(14); 
-  epssrP = data(15); 
-  sigsrP = data(16); 
-  konP = int(data(17));   
-  epsP = data(18);   
-  sigP = data(19);   
-  eP   = data(20);   
+  params = std::make_shared<Parameters>();
+  params->Fy = data(0);
+  params->E0 = data(1);
+  params->b = data(2); 
+  params->R0 = data(3);
+  params->cR1 = data(4);
+  params->cR2 = data(5);
+  params->a1 = data(6); 
+  params->a2 = data(7); 
+  params->a3 = data(8); 
+  params->a4 = data(9); 
+  committed->epsmin = data(10);
+  committed->epsmax = data(11);
+  committed->epspl = data(12); 
+  committed->epss0 = data(13); 
+  committed->sigs0 = data(14); 
+  committed->epsr = data(15); 
+  committed->sigr = data(16); 
+  committed->kon = int(data(17));   
+  committed->eps = data(18);   
+  committed->sig = data(19);   
+  committed->e   = data(20);   
   this->setTag(int(data(21)));
-  sigini = data(22);
+  params->sigini = data(22);
 
-  e = eP;
-  sig = sigP;
-  eps = epsP;
+  *trial = *committed;
   
   return 0;
 }
@@ -505,33 +469,33 @@ Steel02::Print(OPS_Stream &s, int flag)
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {      
     //    s << "Steel02:(strain, stress, tangent) " << eps << " " << sig << " " << e << endln;
     s << "Steel02 tag: " << this->getTag() << endln;
-    s << "  fy: " << Fy << ", ";
-    s << "  E0: " << E0 << ", ";
-    s << "   b: " << b << ", ";
-    s << "  R0: " << R0 << ", ";
-    s << " cR1: " << cR1 << ", ";
-    s << " cR2: " << cR2 << ", ";    
-    s << "  a1: " << a1 << ", ";
-    s << "  a2: " << a2 << ", ";
-    s << "  a3: " << a3 << ", ";
-    s << "  a4: " << a4;    
+    s << "  fy: " << params->Fy << ", ";
+    s << "  E0: " << params->E0 << ", ";
+    s << "   b: " << params->b << ", ";
+    s << "  R0: " << params->R0 << ", ";
+    s << " cR1: " << params->cR1 << ", ";
+    s << " cR2: " << params->cR2 << ", ";    
+    s << "  a1: " << params->a1 << ", ";
+    s << "  a2: " << params->a2 << ", ";
+    s << "  a3: " << params->a3 << ", ";
+    s << "  a4: " << params->a4;    
   }
   
   if (flag == OPS_PRINT_PRINTMODEL_JSON) {
     s << "\t\t\t{";
     s << "\"name\": \"" << this->getTag() << "\", ";
     s << "\"type\": \"Steel02\", ";
-    s << "\"E\": " << E0 << ", ";
-    s << "\"fy\": " << Fy << ", ";
-    s << "\"b\": " << b << ", ";
-    s << "\"R0\": " << R0 << ", ";
-    s << "\"cR1\": " << cR1 << ", ";
-    s << "\"cR2\": " << cR2 << ", ";
-    s << "\"a1\": " << a1 << ", ";
-    s << "\"a2\": " << a2 << ", ";
-    s << "\"a3\": " << a3 << ", ";
-    s << "\"a4\": " << a4 << ", ";    
-    s << "\"sigini\": " << sigini << "}";
+    s << "\"E\": " << params->E0 << ", ";
+    s << "\"fy\": " << params->Fy << ", ";
+    s << "\"b\": " << params->b << ", ";
+    s << "\"R0\": " << params->R0 << ", ";
+    s << "\"cR1\": " << params->cR1 << ", ";
+    s << "\"cR2\": " << params->cR2 << ", ";
+    s << "\"a1\": " << params->a1 << ", ";
+    s << "\"a2\": " << params->a2 << ", ";
+    s << "\"a3\": " << params->a3 << ", ";
+    s << "\"a4\": " << params->a4 << ", ";    
+    s << "\"sigini\": " << params->sigini << "}";
   }
 }
 
@@ -541,47 +505,47 @@ Steel02::setParameter(const char **argv, int argc, Parameter &param)
 {
 
   if (strcmp(argv[0],"sigmaY") == 0 || strcmp(argv[0],"fy") == 0 || strcmp(argv[0],"Fy") == 0) {
-    param.setValue(Fy);
+    param.setValue(params->Fy);
     return param.addObject(1, this);
   }
   if (strcmp(argv[0],"E") == 0) {
-    param.setValue(E0);
+    param.setValue(params->E0);
     return param.addObject(2, this);
   }
   if (strcmp(argv[0],"b") == 0) {
-    param.setValue(b);
+    param.setValue(params->b);
     return param.addObject(3, this);
   }
   if (strcmp(argv[0],"a1") == 0) {
-    param.setValue(a1);
+    param.setValue(params->a1);
     return param.addObject(4, this);
   }
   if (strcmp(argv[0],"a2") == 0) {
-    param.setValue(a2);
+    param.setValue(params->a2);
     return param.addObject(5, this);
   }
   if (strcmp(argv[0],"a3") == 0) {
-    param.setValue(a3);
+    param.setValue(params->a3);
     return param.addObject(6, this);
   }
   if (strcmp(argv[0],"a4") == 0) {
-    param.setValue(a4);
+    param.setValue(params->a4);
     return param.addObject(7, this);
   }
     if (strcmp(argv[0],"R0") == 0) {
-    param.setValue(R0);
+    param.setValue(params->R0);
     return param.addObject(8, this);
   }
   if (strcmp(argv[0],"cR1") == 0) {
-    param.setValue(cR1);
+    param.setValue(params->cR1);
     return param.addObject(9, this);
   }
   if (strcmp(argv[0],"cR2") == 0) {
-    param.setValue(cR2);
+    param.setValue(params->cR2);
     return param.addObject(10, this);
   }
   if (strcmp(argv[0],"sig0") == 0) {
-    param.setValue(sigini);
+    param.setValue(params->sigini);
     return param.addObject(11, this);
   }
 
@@ -593,41 +557,45 @@ Steel02::setParameter(const char **argv, int argc, Parameter &param)
 int
 Steel02::updateParameter(int parameterID, Information &info)
 {
+  // the parameters of this material no longer match those of its copies
+  if (params.use_count() > 1)
+    params = std::make_shared<Parameters>(*params);
+
   switch (parameterID) {
   case -1:
     return -1;
   case 1:
-    this->Fy = info.theDouble;
+    params->Fy = info.theDouble;
     break;
   case 2:
-    this->E0 = info.theDouble;
+    params->E0 = info.theDouble;
     break;
   case 3:
-    this->b = info.theDouble;
+    params->b = info.theDouble;
     break;
   case 4:
-    this->a1 = info.theDouble;
+    params->a1 = info.theDouble;
     break;
   case 5:
-    this->a2 = info.theDouble;
+    params->a2 = info.theDouble;
     break;
   case 6:
-    this->a3 = info.theDouble;
+    params->a3 = info.theDouble;
     break;
   case 7:
-    this->a4 = info.theDouble;
+    params->a4 = info.theDouble;
     break;
   case 8:
-    this->R0 = info.theDouble;
+    params->R0 = info.theDouble;
     break;
   case 9:
-    this->cR1 = info.theDouble;
+    params->cR1 = info.theDouble;
     break;
   case 10:
-    this->cR2 = info.theDouble;
+    params->cR2 = info.theDouble;
     break;
   case 11:
-    this->sigini = info.theDouble;
+    params->sigini = info.theDouble;
     break;
   default:
     return -1;
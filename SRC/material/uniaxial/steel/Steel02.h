@@ -40,6 +40,7 @@
 #define Steel02_h
 
 #include <UniaxialMaterial.h>
+#include <memory>
 
 class Steel02 : public UniaxialMaterial
 {
@@ -66,6 +67,7 @@ class Steel02 : public UniaxialMaterial
 
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) const {return true;}
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     double getStrain(void);      
@@ -75,6 +77,9 @@ class Steel02 : public UniaxialMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+
+    int getStateSize(void) const;
+    int setStateStorage(double *trial, double *committed);
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -86,49 +91,49 @@ class Steel02 : public UniaxialMaterial
     int updateParameter(int parameterID, Information &info);
     
     //by SAJalali
-	virtual double getEnergy() { return EnergyP; };
+	virtual double getEnergy() { return committed->energy; };
 
  protected:
     
  private:
-	 double EnergyP; //by SAJalali
-	 // matpar : STEEL FIXED PROPERTIES
-    double Fy;  //  = matpar(1)  : yield stress
-    double E0;  //  = matpar(2)  : initial stiffness
-    double b;   //  = matpar(3)  : hardening ratio (Esh/E0)
-    double R0;  //  = matpar(4)  : exp transition elastic-plastic
-    double cR1; //  = matpar(5)  : coefficient for changing R0 to R
-    double cR2; //  = matpar(6)  : coefficient for changing R0 to R
-    double a1;  //  = matpar(7)  : coefficient for isotropic hardening in compression
-    double a2;  //  = matpar(8)  : coefficient for isotropic hardening in compression
-    double a3;  //  = matpar(9)  : coefficient for isotropic hardening in tension
-    double a4;  //  = matpar(10) : coefficient for isotropic hardening in tension
-    double sigini; // initial 
-    // hstvP : STEEL HISTORY VARIABLES
-    double epsminP; //  = hstvP(1) : max eps in compression
-    double epsmaxP; //  = hstvP(2) : max eps in tension
-    double epsplP;  //  = hstvP(3) : plastic excursion
-    double epss0P;  //  = hstvP(4) : eps at asymptotes intersection
-    double sigs0P;  //  = hstvP(5) : sig at asymptotes intersection
-    double epssrP;  //  = hstvP(6) : eps at last inversion point
-    double sigsrP;  //  = hstvP(7) : sig at last inversion point
-    int    konP;    //  = hstvP(8) : index for loading/unloading
-    // hstv : STEEL HISTORY VARIABLES   
-    double epsP;  //  = strain at previous converged step
-    double sigP;  //  = stress at previous converged step
-    double eP;    //   stiffness modulus at last converged step;
+    // matpar : STEEL FIXED PROPERTIES, which the copies of a material share
+    // until updateParameter() changes them for one of them
+    struct Parameters {
+      double Fy;     //  = matpar(1)  : yield stress
+      double E0;     //  = matpar(2)  : initial stiffness
+      double b;      //  = matpar(3)  : hardening ratio (Esh/E0)
+      double R0;     //  = matpar(4)  : exp transition elastic-plastic
+      double cR1;    //  = matpar(5)  : coefficient for changing R0 to R
+      double cR2;    //  = matpar(6)  : coefficient for changing R0 to R
+      double a1;     //  = matpar(7)  : coefficient for isotropic hardening in compression
+      double a2;     //  = matpar(8)  : coefficient for isotropic hardening in compression
+      double a3;     //  = matpar(9)  : coefficient for isotropic hardening in tension
+      double a4;     //  = matpar(10) : coefficient for isotropic hardening in tension
+      double sigini; // initial 
+    };
+    std::shared_ptr<Parameters> params;
+
+    Steel02(int tag, const std::shared_ptr<Parameters> &params);
 
-    double epsmin; 
-    double epsmax; 
-    double epspl;  
-    double epss0;  
-    double sigs0; 
-    double epsr;  
-    double sigr;  
-    int    kon;    
-    double sig;   
-    double e;     
-    double eps;   //  = strain at current step
+    // hstv : STEEL HISTORY VARIABLES, of which the trial and committed
+    // values are kept in ownState or in the arrays of setStateStorage()
+    struct State {
+      double epsmin; //  = hstv(1) : max eps in compression
+      double epsmax; //  = hstv(2) : max eps in tension
+      double epspl;  //  = hstv(3) : plastic excursion
+      double epss0;  //  = hstv(4) : eps at asymptotes intersection
+      double sigs0;  //  = hstv(5) : sig at asymptotes intersection
+      double epsr;   //  = hstv(6) : eps at last inversion point
+      double sigr;   //  = hstv(7) : sig at last inversion point
+      double kon;    //  = hstv(8) : index for loading/unloading
+      double eps;    //  = strain
+      double sig;    //  = stress
+      double e;      //  = stiffness modulus
+      double energy; //by SAJalali
+    };
+    State *ownState;
+    State *trial;
+    State *committed;
 };
 
 
@@ -0,0 +1,136 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of the array pool
+// used by Matrix and Vector.
+//
+#include <ArrayPool.h>
+#include <atomic>
+
+#ifndef ARRAY_POOL_BLOCKS_PER_SIZE
+#  define ARRAY_POOL_BLOCKS_PER_SIZE 8
+#endif
+
+#ifndef ARRAY_POOL_MAX_CACHED
+#  define ARRAY_POOL_MAX_CACHED (1 << 18)  // doubles held by one thread
+#endif
+
+namespace OpenSees {
+namespace array_pool {
+
+namespace {
+
+std::atomic<long> num_requests{0},
+                  num_allocations{0},
+                  num_releases{0},
+                  num_frees{0};
+
+// a released array holds the link to the next array of its list
+struct Block {
+  Block *next;
+};
+
+enum : unsigned char {Unused, Open, Closed};
+
+//
+// The free lists of a thread. The lists are plain data so that they can
+// still be read when Matrix and Vector objects with static storage are
+// destroyed after the thread's Reaper, which empties and closes them.
+//
+struct Cache {
+  Block         *head[ARRAY_POOL_MAX_SIZE+1];
+  unsigned char  count[ARRAY_POOL_MAX_SIZE+1];
+  long           cached;
+  unsigned char  state;
+};
+
+thread_local Cache cache;
+
+struct Reaper {
+  ~Reaper() {
+    for (int n = 1; n <= ARRAY_POOL_MAX_SIZE; n++)
+      while (cache.head[n] != nullptr) {
+        Block *block = cache.head[n];
+        cache.head[n] = block->next;
+        delete [] reinterpret_cast<double*>(block);
+      }
+    cache.state = Closed;
+  }
+};
+
+} // namespace
+
+
+double *
+allocate(int n)
+{
+  num_requests.fetch_add(1, std::memory_order_relaxed);
+
+  if (n <= ARRAY_POOL_MAX_SIZE && cache.head[n] != nullptr) {
+    Block *block = cache.head[n];
+    cache.head[n] = block->next;
+    cache.count[n]--;
+    cache.cached -= n;
+    return reinterpret_cast<double*>(block);
+  }
+
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return new double[n];
+}
+
+
+void
+release(double *data, int n)
+{
+  if (data == nullptr)
+    return;
+
+  num_releases.fetch_add(1, std::memory_order_relaxed);
+
+  if (cache.state == Unused) {
+    // the lists are emptied when the thread exits
+    thread_local Reaper reaper;
+    (void)reaper;
+    cache.state = Open;
+  }
+
+  if (cache.state == Open && n > 0 && n <= ARRAY_POOL_MAX_SIZE
+      && cache.count[n] < ARRAY_POOL_BLOCKS_PER_SIZE
+      && cache.cached + n <= ARRAY_POOL_MAX_CACHED) {
+    Block *block = reinterpret_cast<Block*>(data);
+    block->next = cache.head[n];
+    cache.head[n] = block;
+    cache.count[n]++;
+    cache.cached += n;
+    return;
+  }
+
+  num_frees.fetch_add(1, std::memory_order_relaxed);
+  delete [] data;
+}
+
+
+statistics
+get_statistics()
+{
+  return statistics{num_requests.load(),
+                    num_allocations.load(),
+                    num_releases.load(),
+                    num_frees.load()};
+}
+
+
+void
+reset_statistics()
+{
+  num_requests    = 0;
+  num_allocations = 0;
+  num_releases    = 0;
+  num_frees       = 0;
+}
+
+} // namespace array_pool
+} // namespace OpenSees
@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Storage for the data of Matrix and Vector objects.
+//
+// Arrays of up to ARRAY_POOL_MAX_SIZE doubles are kept, when released, on
+// a free list of the calling thread for their size, and handed out again
+// by the next request for that size; the temporaries formed by the Matrix
+// and Vector operators in element state determination then reuse the same
+// few blocks instead of going to the heap on every call. Larger arrays, and
+// arrays released once a thread's lists are full, go straight to the heap.
+//
+// Every request and every heap allocation is counted, so the allocations
+// made by a piece of code can be found by resetting the counts before it
+// and reading them after it.
+//
+#ifndef OpenSees_ArrayPool_h
+#define OpenSees_ArrayPool_h
+
+#ifndef ARRAY_POOL_MAX_SIZE
+#  define ARRAY_POOL_MAX_SIZE 1024
+#endif
+
+namespace OpenSees {
+namespace array_pool {
+
+struct statistics {
+  long requests;     // calls to allocate()
+  long allocations;  // of which went to the heap
+  long releases;     // calls to release()
+  long frees;        // of which went to the heap
+};
+
+// returns uninitialized storage for n > 0 doubles
+double    *allocate(int n);
+
+// returns storage from allocate(n), or from allocate(m) with m > n
+void       release(double *data, int n);
+
+statistics get_statistics();
+void       reset_statistics();
+
+} // namespace array_pool
+} // namespace OpenSees
+
+#endif
@@ -38,15 +38,9 @@
 
 #include <math.h>
 #include <assert.h>
+#include <vector>
 
-#ifndef NO_STATIC_WORK
-# define MATRIX_WORK_AREA 400
-# define INT_WORK_AREA 20
-  int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-  int Matrix::sizeIntWork = INT_WORK_AREA;
-  double *Matrix::matrixWork = nullptr;
-  int    *Matrix::intWork    = nullptr;
-#endif
+namespace array_pool = OpenSees::array_pool;
 
 //#define MATRIX_BLAS
 //#define NO_WORK
@@ -59,11 +53,6 @@
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
 }
 
 
@@ -73,17 +62,14 @@ Matrix::Matrix(int nRows,int nCols)
 //assert(nRows > 0);
 //assert(nCols > 0);
 
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
   dataSize = numRows * numCols;
   data = nullptr;
 
-  if (dataSize > 0)
-    data = new double[dataSize]{};
+  if (dataSize > 0) {
+    data = array_pool::allocate(dataSize);
+    for (int i=0; i<dataSize; i++)
+      data[i] = 0.0;
+  }
 }
 
 Matrix::Matrix(double *theData, int row, int col) 
@@ -91,31 +77,18 @@ Matrix::Matrix(double *theData, int row, int col)
 {
 //assert(row > 0);
 //assert(col > 0);
-
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
 }
 
 
 Matrix::Matrix(const Matrix &other)
 : numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
   numRows  = other.numRows;
   numCols  = other.numCols;
   dataSize = other.dataSize;
 
   if (dataSize != 0) {
-    data = new double[dataSize];
+    data = array_pool::allocate(dataSize);
     // copy the data
     double *dataPtr = data;
     double *otherDataPtr = other.data;
@@ -148,20 +121,43 @@ Matrix::~Matrix()
 {
   if (data != nullptr) {
     if (fromFree == 0 && dataSize > 0){
-      delete [] data; 
+      array_pool::release(data, dataSize);
       data = nullptr;
     }
   }
-#ifdef NO_STATIC_WORK
+
   if (matrixWork != nullptr)
-    delete [] matrixWork;
+    array_pool::release(matrixWork, sizeDoubleWork);
 
   if (intWork != nullptr)
     delete [] intWork;
-#endif
 }
     
 
+double *
+Matrix::getDoubleWork(int size)
+{
+  if (size > sizeDoubleWork) {
+    if (matrixWork != nullptr)
+      array_pool::release(matrixWork, sizeDoubleWork);
+    matrixWork = array_pool::allocate(size);
+    sizeDoubleWork = size;
+  }
+  return matrixWork;
+}
+
+int *
+Matrix::getIntWork(int size)
+{
+  if (size > sizeIntWork) {
+    if (intWork != nullptr)
+      delete [] intWork;
+    intWork = new int[size];
+    sizeIntWork = size;
+  }
+  return intWork;
+}
+
 //
 // METHODS - Zero, Assemble, Solve
 //
@@ -174,7 +170,7 @@ Matrix::setData(double *theData, int row, int col)
   // delete the old if allocated
   if (data != nullptr)
     if (fromFree == 0) {
-      delete [] data; 
+      array_pool::release(data, dataSize);
       data = 0;
     }
   numRows  = row;
@@ -206,13 +202,13 @@ Matrix::resize(int rows, int cols) {
     // free the old space
     if (data != nullptr)
       if (fromFree == 0){
-        delete [] data; 
+        array_pool::release(data, dataSize);
         data = 0;
       }
 
     fromFree = 0;
     // create new space
-    data = new double[newSize];
+    data = array_pool::allocate(newSize);
     dataSize = newSize;
     numRows = rows;
     numCols = cols;
@@ -257,26 +253,8 @@ Matrix::Solve(const Vector &b, Vector &x)
     assert(numRows == x.Size());
     assert(numRows == b.Size());
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != nullptr) {
-        delete [] matrixWork;
-        matrixWork = nullptr;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = nullptr;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;  
-    }
+    double *matrixWork = this->getDoubleWork(dataSize);
+    int    *intWork    = this->getIntWork(n);
  
     // copy the data
     for (int i=0; i<dataSize; i++)
@@ -306,30 +284,12 @@ Matrix::Solve(const Vector &b, Vector &x) const
     assert(numRows == x.Size());
     assert(numRows == b.Size());
 
-#if defined(NO_STATIC_WORK)
-    /* static */ double *matrixWork = nullptr;
-    /* static */ int *intWork = nullptr;
-    /* static */ int sizeDoubleWork = 0;
-    /* static */ int sizeIntWork    = 0;
-#endif
-
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != nullptr) {
-        delete [] matrixWork;
-        matrixWork = nullptr;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-    if (n > sizeIntWork) {
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = nullptr;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;  
-    }
+    // this matrix is not modified, so its own work areas are not used
+    double *matrixWork = array_pool::allocate(dataSize);
+    thread_local std::vector<int> pivots;
+    if ((int)pivots.size() < n)
+      pivots.resize(n);
+    int *intWork = pivots.data();
  
     // copy the data
     int i;
@@ -349,8 +309,7 @@ Matrix::Solve(const Vector &b, Vector &x) const
 
     DGESV(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
 
-    delete [] intWork;
-    delete [] matrixWork;
+    array_pool::release(matrixWork, dataSize);
 
     return -abs(info);
 }
@@ -367,23 +326,8 @@ Matrix::Solve(const Matrix &b, Matrix &x) // const
     assert(n == b.numRows);
     assert(x.numCols == b.numCols);
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != 0) {
-        delete [] matrixWork;
-        matrixWork = 0;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-    if (n > sizeIntWork) {
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = 0;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;
-    }
+    double *matrixWork = this->getDoubleWork(dataSize);
+    int    *intWork    = this->getIntWork(n);
 
     // copy the data
     int i;
@@ -459,25 +403,8 @@ Matrix::Invert()
 
     default:
   
-      // check work area can hold all the data
-      if (dataSize > sizeDoubleWork) {
-        if (matrixWork != nullptr) {
-          delete [] matrixWork;
-          matrixWork = 0;
-        }
-        matrixWork = new double[dataSize];
-        sizeDoubleWork = dataSize;
-      }
-
-      // check work area can hold all the data
-      if (n > sizeIntWork) {
-        if (intWork != 0) {
-          delete [] intWork;
-          intWork = nullptr;
-        }
-        intWork = new int[n];
-        sizeIntWork = n;  
-      }
+      double *matrixWork = this->getDoubleWork(dataSize);
+      int    *intWork    = this->getIntWork(n);
 #if 0
       // copy the data 
       for (int i=0; i<dataSize; i++)
@@ -487,7 +414,7 @@ Matrix::Invert()
       int ldA = n;
       double *Wptr = matrixWork;
       double *Aptr = data;
-      int workSize = sizeDoubleWork;
+      int workSize = dataSize;
       
       int *iPIV = intWork;
 
@@ -833,98 +760,26 @@ Matrix::addMatrixTripleProduct(double thisFact,
   if (thisFact == 1.0 && otherFact == 0.0)
     return 0;
 
-  // check work area can hold the temporary matrix
+  // work area for the temporary matrix B * T
   int dimB = B.numCols;
   int sizeWork = dimB * numCols;
 
-  if (sizeWork > sizeDoubleWork) {
-    // TODO
-    this->addMatrix(thisFact, T^B*T, otherFact);
-    return 0;
-  }
-  else {
-    int m = B.numRows,
-        n = T.numCols,
-        k = B.numCols;
-      //k = T.numRows;
-    double zero = 0.0,
-           one  = 1.0;
-
-    DGEMM ("N", "N", &m      , &n      , &k,&one      , B.data, &B.numRows, // m
-                                                        T.data, &T.numRows, // k
-                                            &zero,  matrixWork, &m);
-
-    DGEMM ("T", "N", &numRows, &numCols, &k,&otherFact, T.data, &T.numRows,
-                                                    matrixWork, &m, // k
-                                            &thisFact,    data, &numRows);
-    return 0;
-  }
+  double *matrixWork = this->getDoubleWork(sizeWork);
 
-  // zero out the work area
-  double *matrixWorkPtr = matrixWork;
-  for (int l=0; l<sizeWork; l++)
-    *matrixWorkPtr++ = 0.0;
-  
-  // now form B * T * fact store in matrixWork == A area
-  // NOTE: looping as per blas3 DGEMM : j,k,i
-
-  double *tkjPtr  = &(T.data)[0];
-  for (int j=0; j<numCols; j++) {
-    double *aijPtrA = &matrixWork[j*dimB];
-    for (int k=0; k<dimB; k++) {
-      double tmp = *tkjPtr++ * otherFact;
-      double *aijPtr = aijPtrA;
-      double *bikPtr = &(B.data)[k*dimB];
-      for (int i=0; i<dimB; i++) 
-        *aijPtr++ += *bikPtr++ * tmp;
-    }
-  }
+  int m = B.numRows,
+      n = T.numCols,
+      k = B.numCols;
+  double zero = 0.0,
+         one  = 1.0;
 
-  // now form T' * matrixWork
-  // NOTE: looping as per blas3 DGEMM : j,i,k
-  if (thisFact == 1.0) {
-    double *dataPtr = &data[0];
-    for (int j=0; j< numCols; j++) {
-      double *workkjPtrA = &matrixWork[j*dimB];
-      for (int i=0; i<numRows; i++) {
-        double *ckiPtr = &(T.data)[i*dimB];
-        double *workkjPtr = workkjPtrA;
-        double aij = 0.0;
-        for (int k=0; k< dimB; k++)
-          aij += *ckiPtr++ * *workkjPtr++;
-        *dataPtr++ += aij;
-      }
-    }
-  } else if (thisFact == 0.0) {
-    double *dataPtr = &data[0];
-    for (int j=0; j< numCols; j++) {
-      double *workkjPtrA = &matrixWork[j*dimB];
-      for (int i=0; i<numRows; i++) {
-        double *ckiPtr = &(T.data)[i*dimB];
-        double *workkjPtr = workkjPtrA;
-        double aij = 0.0;
-        for (int k=0; k< dimB; k++)
-          aij += *ckiPtr++ * *workkjPtr++;
-        *dataPtr++ = aij;
-      }
-    }
-
-  } else {
-    double *dataPtr = &data[0];
-    for (int j=0; j< numCols; j++) {
-      double *workkjPtrA = &matrixWork[j*dimB];
-      for (int i=0; i<numRows; i++) {
-        double *ckiPtr = &(T.data)[i*dimB];
-        double *workkjPtr = workkjPtrA;
-        double aij = 0.0;
-        for (int k=0; k< dimB; k++)
-          aij += *ckiPtr++ * *workkjPtr++;
-        double value = *dataPtr * thisFact + aij;
-        *dataPtr++ = value;
-      }
-    }
-  }
+  // work = B * T, then this = this*thisFact + T' * work * otherFact
+  DGEMM ("N", "N", &m      , &n      , &k,&one      , B.data, &B.numRows, // m
+                                                      T.data, &T.numRows, // k
+                                          &zero,  matrixWork, &m);
 
+  DGEMM ("T", "N", &numRows, &numCols, &k,&otherFact, T.data, &T.numRows,
+                                                  matrixWork, &m, // k
+                                          &thisFact,    data, &numRows);
   return 0;
 }
 
@@ -942,15 +797,13 @@ Matrix::addMatrixTripleProduct(double thisFact,
     if (thisFact == 1.0 && otherFact == 0.0)
       return 0;
 
-    // check work area can hold the temporary matrix
+    // work area for the temporary matrix B * C
     int sizeWork = B.numRows * numCols;
-#ifndef NO_WORK
-    if (sizeWork > sizeDoubleWork) {
-#endif
-      this->addMatrix(thisFact, A^B*C, otherFact);
-      return 0;
-#ifndef NO_WORK
-    }
+#ifdef NO_WORK
+    this->addMatrix(thisFact, A^B*C, otherFact);
+    return 0;
+#else
+    double *matrixWork = this->getDoubleWork(sizeWork);
 
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
@@ -1194,14 +1047,15 @@ Matrix::operator=(const Matrix &other)
       opserr << "Matrix::operator=() - matrix dimensions do not match\n";
 #endif
 
-      if (this->data != 0) {
-          delete [] this->data;
+      if (this->data != 0 && fromFree == 0) {
+          array_pool::release(this->data, dataSize);
           this->data = 0;
       }
 
       int theSize = other.numCols*other.numRows;
 
-      data = new double[theSize];
+      data = array_pool::allocate(theSize);
+      fromFree = 0;
 
       this->dataSize = theSize;
       this->numCols  = other.numCols;
@@ -1229,7 +1083,7 @@ Matrix::operator=( Matrix &&other)
     return *this;
 
   if (this->data != 0 && fromFree == 0){
-    delete [] this->data;
+    array_pool::release(this->data, dataSize);
     this->data = 0;
   }
         
@@ -29,9 +29,9 @@
 //
 #ifndef Matrix_h
 #define Matrix_h 
-#define NO_STATIC_WORK
 #include <assert.h>
 #include <cstddef>
+#include "ArrayPool.h"
 using std::size_t;
 
 class Vector;
@@ -63,7 +63,7 @@ class Matrix
     template <int nr, int nc>
     inline int setData(OpenSees::MatrixND<nr,nc,double> &M) {
       if (!fromFree && data != nullptr)
-        delete[] data;
+        OpenSees::array_pool::release(data, dataSize);
 
       fromFree = 1; // Cannot delete data
       data = &M.values[0][0];
@@ -195,17 +195,16 @@ class Matrix
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-#ifdef NO_STATIC_WORK
+
+    // the work areas are allocated on first use and belong to each
+    // matrix, so that distinct matrices may be solved and inverted on
+    // several threads at once
+    double *getDoubleWork(int size);
+    int    *getIntWork(int size);
     double *matrixWork = nullptr;
     int *intWork = nullptr;
-    int sizeDoubleWork = 400;
-    int sizeIntWork = 20;
-#else
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
-#endif
+    int sizeDoubleWork = 0;
+    int sizeIntWork = 0;
 
     int numRows;
     int numCols;
@@ -32,6 +32,9 @@
 #include <math.h>
 #include <assert.h>
 #include "blasdecl.h"
+#include "ArrayPool.h"
+
+namespace array_pool = OpenSees::array_pool;
 
 #if 0
 #define VECTOR_BLAS
@@ -55,15 +58,18 @@ Vector::Vector(int size)
   assert(size >= 0);
 
   // get some space for the vector
-  if (size > 0)
-    theData = new double [size]{};
+  if (size > 0) {
+    theData = array_pool::allocate(size);
+    for (int i=0; i<size; i++)
+      theData[i] = 0.0;
+  }
 }
 
 Vector::Vector(std::shared_ptr<double[]> data, int size)
 : sz(size), theData(nullptr), fromFree(0)
 {
   if (size > 0) {
-    theData = new double [size];
+    theData = array_pool::allocate(size);
 
     for (int i=0; i<sz; i++)
       theData[i] = data[i];
@@ -85,7 +91,7 @@ Vector::Vector(const Vector &other)
 : sz(other.sz),theData(0),fromFree(0)
 {
   if (sz != 0) {
-    theData = new double [other.sz];    
+    theData = array_pool::allocate(other.sz);
   }
   // copy the component data
   for (int i=0; i<sz; i++)
@@ -96,7 +102,7 @@ Vector::Vector(const Vector &other)
 //  Move constructor
 #if !defined(NO_CXX11_MOVE)   
 Vector::Vector(Vector &&other)
-: sz(other.sz),theData(other.theData),fromFree(0)
+: sz(other.sz),theData(other.theData),fromFree(other.fromFree)
 {
   other.theData = nullptr;
   other.sz = 0;
@@ -107,8 +113,8 @@ Vector::Vector(Vector &&other)
 
 Vector::~Vector()
 {
-  if (fromFree == 0 && theData != nullptr)
-    delete [] theData;
+  if (fromFree == 0)
+    array_pool::release(theData, sz);
   theData = nullptr;
 }
 
@@ -119,7 +125,7 @@ Vector::setData(double *newData, int size)
   assert(size >  0);
 
   if (theData != nullptr && fromFree == 0) {
-    delete [] theData;
+    array_pool::release(theData, sz);
     theData = nullptr;
   }
   sz = size;
@@ -151,15 +157,14 @@ Vector::resize(int newSize)
 
     // delete the old array
     if (theData != 0 && fromFree == 0) {
-      delete [] theData;
+      array_pool::release(theData, sz);
       theData = nullptr;
     }
     sz = 0;
     fromFree = 0;
     
     // create new memory
-    // theData = (double *)malloc(newSize*sizeof(double));    
-    theData = new double[newSize];
+    theData = array_pool::allocate(newSize);
 
     sz = newSize;
   }  
@@ -671,18 +676,16 @@ Vector::operator[](int x)
   
   if (x >= sz) {
     // TODO: Is this expected?
-    double *dataNew = new double[x+1];
+    double *dataNew = array_pool::allocate(x+1);
     for (int i=0; i<sz; i++)
       dataNew[i] = theData[i];
     for (int j=sz; j<x; j++)
       dataNew[j] = 0.0;
     
     if (fromFree == 0)
-      if (theData != 0){
-        delete [] theData;
-      theData = 0;
-    }
+      array_pool::release(theData, sz);
     theData = dataNew;
+    fromFree = 0;
     sz = x+1;
   }
 
@@ -726,14 +729,15 @@ Vector::operator=(const Vector &V)
 
       if (sz != V.sz)  {
           // Check that we are not deleting an empty Vector
-          if (this->theData != nullptr){
-            delete [] this->theData;
+          if (this->theData != nullptr && fromFree == 0) {
+            array_pool::release(this->theData, sz);
             this->theData = nullptr;
           }
           this->sz = V.sz;
+          this->fromFree = 0;
           
           // Check that we are not creating an empty Vector
-          this->theData = (sz != 0) ? new double[sz] : nullptr;
+          this->theData = (sz != 0) ? array_pool::allocate(sz) : nullptr;
       }
 
       // copy the data
@@ -751,12 +755,13 @@ Vector::operator=(Vector &&V)
 {
   // first check we are not trying v = v
   if (this != &V) {
-    if (this->theData != nullptr) { 
-      delete [] this->theData;
+    if (this->theData != nullptr && fromFree == 0) { 
+      array_pool::release(this->theData, sz);
       this->theData = 0;
     }
     theData = V.theData;
     this->sz = V.sz;
+    this->fromFree = V.fromFree;
     V.theData = 0;
     V.sz = 0;
   }
@@ -5,10 +5,12 @@
 # define  DAXPY  daxpy_
 # define  DSCAL  dscal_
 # define  DGEMV  dgemv_
+# define  DTRSV  dtrsv_
 // Level 3
 # define  DGETRF dgetrf_  
 # define  DGETRI dgetri_  
 # define  DGEMM  dgemm_   
+# define  DTRSM  dtrsm_
 // Lapack
 # define  DGESV  dgesv_
 # define  DGETRS dgetrs_
@@ -16,6 +18,7 @@
 # define  DGBTRS dgbtrs_
 # define  DPBSV  dpbsv_
 # define  DPBTRS dpbtrs_
+# define  DPOTRF dpotrf_
 #endif
 extern "C" {
   void DAXPY (int*, double*, double*, const int*, double*, const int*);
@@ -26,6 +29,9 @@ extern "C" {
               double* X, int* incX,
               double* beta,
               double* Y, int* incY);
+  void DTRSV (const char* uplo, const char* trans, const char* diag,
+              int* N, double* A, int* lda,
+              double* X, int* incX);
 // Level 3
 //void DGESV(int *N, int *NRHS, double *A, int *LDA, 
 //           int *iPiv, double *B, int *LDB, int *INFO);
@@ -47,6 +53,12 @@ extern "C" {
              double* beta,
              double* C, const int* ldc);
 
+  void DTRSM(const char* side, const char* uplo, const char* transA,
+             const char* diag, int* M, int* N,
+             double* alpha,
+             double* A, const int* lda,
+             double* B, const int* ldb);
+
 //
 // Lapack
 //
@@ -78,6 +90,9 @@ int  DPBTRS(char *UPLO,
            int *N, int *KD, int *NRHS, 
            double *A, int *LDA, double *B, int *LDB, 
            int *INFO);
+
+// Sparse SPD
+int  DPOTRF(char *UPLO, int *N, double *A, int *LDA, int *INFO);
 }
 
 #endif // blasdecl_H
@@ -0,0 +1,247 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of ResponseHandle.
+//
+#include <ResponseHandle.h>
+#include <Response.h>
+#include <Information.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Node.h>
+#include <Vector.h>
+#include <DummyStream.h>
+#include <string.h>
+
+ResponseHandle::ResponseHandle(Domain &domain)
+:theDomain(&domain), offsets(1, 0),
+ values(std::make_shared<std::vector<double>>())
+{
+
+}
+
+ResponseHandle::~ResponseHandle()
+{
+    for (Entry &entry : entries)
+      if (entry.theResponse != nullptr)
+        delete entry.theResponse;
+}
+
+
+int
+ResponseHandle::addElementResponse(int eleTag, const char **argv, int argc)
+{
+    Entry entry;
+    entry.tag = eleTag;
+    entry.nodeData = NodeData::Unknown;
+    entry.args.assign(argv, argv + argc);
+    entry.theElement  = nullptr;
+    entry.theNode     = nullptr;
+    entry.theResponse = nullptr;
+
+    if (this->bind(entry) < 0)
+      return -1;
+
+    entries.push_back(entry);
+    offsets.push_back(offsets.back());
+    return int(entries.size()) - 1;
+}
+
+
+int
+ResponseHandle::addNodeResponse(int nodeTag, NodeData type)
+{
+    Entry entry;
+    entry.tag = nodeTag;
+    entry.nodeData = type;
+    entry.theElement  = nullptr;
+    entry.theNode     = nullptr;
+    entry.theResponse = nullptr;
+
+    if (this->bind(entry) < 0 || entry.theNode->getResponse(type) == nullptr)
+      return -1;
+
+    entries.push_back(entry);
+    offsets.push_back(offsets.back());
+    return int(entries.size()) - 1;
+}
+
+
+void
+ResponseHandle::truncate(int numEntries)
+{
+    if (numEntries < 0 || numEntries >= int(entries.size()))
+      return;
+
+    for (std::size_t i = numEntries; i < entries.size(); i++)
+      if (entries[i].theResponse != nullptr)
+        delete entries[i].theResponse;
+
+    entries.resize(numEntries);
+    offsets.resize(numEntries + 1);
+}
+
+
+//
+// The values are gathered in two sweeps: the first asks each entry for its
+// data and lays out the offsets, so that the buffer is only replaced when
+// the number of values changes, and the second copies the data into it.
+//
+int
+ResponseHandle::fetch(void)
+{
+    const int numEntries = entries.size();
+    data.resize(numEntries);
+
+    int result = 0;
+    int numValues = 0;
+    for (int i = 0; i < numEntries; i++) {
+      data[i] = this->getData(entries[i]);
+      if (data[i] == nullptr)
+        result = -1;
+      else
+        numValues += data[i]->Size();
+      offsets[i+1] = numValues;
+    }
+
+    if (numValues != int(values->size()))
+      values = std::make_shared<std::vector<double>>(numValues);
+
+    double *to = values->data();
+    for (int i = 0; i < numEntries; i++) {
+      if (data[i] == nullptr)
+        continue;
+      const Vector &from = *data[i];
+      for (int j = 0; j < from.Size(); j++)
+        *to++ = from(j);
+    }
+
+    return result;
+}
+
+
+int
+ResponseHandle::getNumEntries(void) const
+{
+    return entries.size();
+}
+
+int
+ResponseHandle::getNumValues(void) const
+{
+    return offsets.back();
+}
+
+const double *
+ResponseHandle::getValues(void) const
+{
+    return values->data();
+}
+
+const std::vector<int> &
+ResponseHandle::getOffsets(void) const
+{
+    return offsets;
+}
+
+std::shared_ptr<std::vector<double>>
+ResponseHandle::getBuffer(void)
+{
+    return values;
+}
+
+
+NodeData
+ResponseHandle::getNodeData(const char *name)
+{
+    if (strcmp(name, "disp") == 0 || strcmp(name, "displ") == 0)
+      return NodeData::Disp;
+    else if (strcmp(name, "vel") == 0 || strcmp(name, "veloc") == 0)
+      return NodeData::Vel;
+    else if (strcmp(name, "accel") == 0)
+      return NodeData::Accel;
+    else if (strcmp(name, "incrDisp") == 0)
+      return NodeData::IncrDisp;
+    else if (strcmp(name, "incrDeltaDisp") == 0)
+      return NodeData::IncrDeltaDisp;
+    else if (strcmp(name, "reaction") == 0 || strcmp(name, "react") == 0)
+      return NodeData::Reaction;
+    else if (strcmp(name, "unbalance") == 0 || strcmp(name, "unbalancedLoad") == 0)
+      return NodeData::UnbalancedLoad;
+    else if (strcmp(name, "unbalanceInclInertia") == 0)
+      return NodeData::UnbalanceInclInertia;
+    else if (strcmp(name, "rayleighForces") == 0)
+      return NodeData::RayleighForces;
+
+    return NodeData::Unknown;
+}
+
+
+int
+ResponseHandle::bind(Entry &entry)
+{
+    if (entry.theResponse != nullptr) {
+      delete entry.theResponse;
+      entry.theResponse = nullptr;
+    }
+    entry.theElement = nullptr;
+    entry.theNode    = nullptr;
+
+    if (entry.nodeData != NodeData::Unknown) {
+      entry.theNode = theDomain->getNode(entry.tag);
+      return entry.theNode != nullptr ? 0 : -1;
+    }
+
+    Element *theElement = theDomain->getElement(entry.tag);
+    if (theElement == nullptr)
+      return -1;
+
+    // the resisting force is read directly, as by Domain::getElementResponse
+    if (entry.args.size() == 1 && entry.args[0] == "forces") {
+      entry.theElement = theElement;
+      return 0;
+    }
+
+    std::vector<const char *> argv(entry.args.size());
+    for (std::size_t i = 0; i < entry.args.size(); i++)
+      argv[i] = entry.args[i].c_str();
+
+    DummyStream dummy;
+    entry.theResponse = theElement->setResponse(argv.data(), int(argv.size()), dummy);
+    if (entry.theResponse == nullptr)
+      return -1;
+
+    entry.theElement = theElement;
+    return 0;
+}
+
+
+const Vector *
+ResponseHandle::getData(Entry &entry)
+{
+    if (entry.nodeData != NodeData::Unknown) {
+      Node *theNode = theDomain->getNode(entry.tag);
+      if (theNode != entry.theNode)
+        this->bind(entry);
+      if (entry.theNode == nullptr)
+        return nullptr;
+      return entry.theNode->getResponse(entry.nodeData);
+    }
+
+    Element *theElement = theDomain->getElement(entry.tag);
+    if (theElement != entry.theElement)
+      this->bind(entry);
+    if (entry.theElement == nullptr)
+      return nullptr;
+
+    if (entry.theResponse == nullptr)
+      return &entry.theElement->getResistingForce();
+
+    if (entry.theResponse->getResponse() < 0)
+      return nullptr;
+
+    return &entry.theResponse->getInformation().getData();
+}
@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: A ResponseHandle holds a set of element and node responses
+// that are bound once and then fetched together into one array of values.
+// Binding an element response parses its arguments and creates its
+// Response object, as eleResponse does on every call; fetching only asks
+// each Response, or node, for its current values and packs them one after
+// the other.
+//
+// The values of entry i are getValues()[getOffsets()[i]] up to
+// getValues()[getOffsets()[i+1]]. Each entry is looked up by its tag on
+// every fetch, so an element or node that is removed or replaced is bound
+// again, or contributes no values while it is missing. The buffer of
+// values is reused by each fetch unless the layout changes; it is shared
+// so that a caller holding on to it, e.g. a NumPy array, keeps it alive.
+//
+#ifndef ResponseHandle_h
+#define ResponseHandle_h
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <NodeData.h>
+
+class Domain;
+class Element;
+class Node;
+class Response;
+class Vector;
+
+class ResponseHandle
+{
+  public:
+    ResponseHandle(Domain &theDomain);
+    ~ResponseHandle();
+
+    // the entries own their Response objects
+    ResponseHandle(const ResponseHandle &) = delete;
+    ResponseHandle &operator=(const ResponseHandle &) = delete;
+
+    // bind a response; each returns the index of the entry or -1 if the
+    // element or node does not exist or has no such response
+    int addElementResponse(int eleTag, const char **argv, int argc);
+    int addNodeResponse(int nodeTag, NodeData type);
+
+    // remove the entries from index numEntries on, e.g. those a bind that
+    // failed part way had added
+    void truncate(int numEntries);
+
+    int fetch(void);
+
+    int getNumEntries(void) const;
+    int getNumValues(void) const;
+    const double *getValues(void) const;
+    const std::vector<int> &getOffsets(void) const;
+    std::shared_ptr<std::vector<double>> getBuffer(void);
+
+    // the NodeData for a name such as "disp", "vel" or "reaction";
+    // NodeData::Unknown if there is none
+    static NodeData getNodeData(const char *name);
+
+  private:
+    struct Entry {
+      int tag;
+      NodeData nodeData;              // NodeData::Unknown for an element
+      std::vector<std::string> args;  // the element response arguments
+      Element  *theElement;
+      Node     *theNode;
+      Response *theResponse;          // null for the element forces
+    };
+
+    int bind(Entry &entry);
+    const Vector *getData(Entry &entry);
+
+    Domain *theDomain;
+    std::vector<Entry> entries;
+    std::vector<const Vector *> data;
+    std::vector<int> offsets;
+    std::shared_ptr<std::vector<double>> values;
+};
+
+#endif
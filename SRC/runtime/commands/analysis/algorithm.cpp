@@ -46,6 +46,8 @@
 #include <SecantAccelerator3.h>
 #include <MillerAccelerator.h>
 #include <runtimeAPI.h>
+#include <LinearSOE.h>
+#include <LinearSOESolver.h>
 class G3_Runtime;
 
 extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
@@ -817,11 +819,39 @@ TclCommand_accelCPU(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
   return TCL_OK;
 }
 
+//
+//   numFact <-symbolic | -numeric>
+//
+// With no option, returns the number of factorizations requested by the
+// algorithm; -symbolic and -numeric return the number of orderings and
+// numeric factorizations actually performed by the linear solver.
+//
 int
 TclCommand_numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
   assert(clientData != nullptr);
   BasicAnalysisBuilder *builder = (BasicAnalysisBuilder *)clientData;
+
+  if (argc > 1) {
+    LinearSOE *theSOE = builder->getLinearSOE();
+    LinearSOESolver *theSolver = theSOE != nullptr ? theSOE->getSolver() : nullptr;
+    if (theSolver == nullptr) {
+      opserr << G3_ERROR_PROMPT << "no linear solver has been set\n";
+      return TCL_ERROR;
+    }
+
+    if (strcmp(argv[1], "-symbolic") == 0)
+      Tcl_SetObjResult(interp, Tcl_NewIntObj(theSolver->getNumSymbolicFactor()));
+    else if (strcmp(argv[1], "-numeric") == 0)
+      Tcl_SetObjResult(interp, Tcl_NewIntObj(theSolver->getNumNumericFactor()));
+    else {
+      opserr << G3_ERROR_PROMPT << "unknown option " << argv[1]
+             << ", expected -symbolic or -numeric\n";
+      return TCL_ERROR;
+    }
+    return TCL_OK;
+  }
+
   EquiSolnAlgo* algo = builder->getAlgorithm();
 
   if (algo == nullptr)
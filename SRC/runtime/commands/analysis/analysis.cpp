@@ -87,6 +87,15 @@ G3_AddTclAnalysisAPI(Tcl_Interp *interp, Domain* domain)
 //
 // command invoked to build an Analysis object
 //
+//   analysis <-linear> Static|Transient <-threads $n>
+//
+// With -threads $n ($n > 0) the elements that are thread safe (see
+// Element::isThreadSafe) are updated, committed and formed on a pool of
+// $n threads, one colour of the FE_Elements at a time. The results are
+// the same for any $n > 0 but, as the contributions to the SOE are then
+// summed in colour rather than storage order, they may differ in the
+// last bits from those without a pool ($n = 0, the default).
+//
 static int
 specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
                 TCL_Char ** const argv)
@@ -111,6 +120,21 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
     );
     argi++;
   }
+
+  // options following the analysis type
+  for (int i = argi+1; i < argc; i++) {
+    if (strcmp(argv[i], "-threads") == 0) {
+      int numThreads;
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &numThreads) != TCL_OK
+                      || numThreads < 0) {
+        opserr << G3_ERROR_PROMPT << "-threads requires a non-negative integer\n";
+        return TCL_ERROR;
+      }
+      builder->setNumThreads(numThreads);
+      i++;
+    }
+  }
+
   if (strcmp(argv[argi], "Static") == 0) {
     builder->setStaticAnalysis();
     return TCL_OK;
@@ -176,7 +200,34 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
       if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
         return TCL_ERROR;
 
-      if (argc == 6) {
+      if (argc > 3 && strcmp(argv[3], "-adaptive") == 0) {
+        //   analyze $numIncr $dT -adaptive $tol <-dtMin $dtMin> <-dtMax $dtMax> <-atol $atol>
+        double tol;
+        double dtMin = 1.0e-3*dT,
+               dtMax = dT,
+               atol  = 0.0;
+        if (argc < 5 || Tcl_GetDouble(interp, argv[4], &tol) != TCL_OK) {
+          opserr << G3_ERROR_PROMPT << "analyze numIncr? deltaT? -adaptive tol? <-dtMin dtMin?> <-dtMax dtMax?> <-atol atol?>\n";
+          return TCL_ERROR;
+        }
+        for (int argi = 5; argi < argc; argi++) {
+          if (strcmp(argv[argi], "-dtMin") == 0 && argi + 1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++argi], &dtMin) != TCL_OK)
+              return TCL_ERROR;
+          } else if (strcmp(argv[argi], "-dtMax") == 0 && argi + 1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++argi], &dtMax) != TCL_OK)
+              return TCL_ERROR;
+          } else if (strcmp(argv[argi], "-atol") == 0 && argi + 1 < argc) {
+            if (Tcl_GetDouble(interp, argv[++argi], &atol) != TCL_OK)
+              return TCL_ERROR;
+          } else {
+            opserr << G3_ERROR_PROMPT << "analyze -adaptive - unknown option " << argv[argi] << "\n";
+            return TCL_ERROR;
+          }
+        }
+        result = builder->analyzeAdaptive(numIncr, dT, tol, dtMin, dtMax, atol);
+
+      } else if (argc == 6) {
         int Jd;
         double dtMin, dtMax;
         if (Tcl_GetDouble(interp, argv[3], &dtMin) != TCL_OK)
@@ -290,6 +341,10 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
              (strcmp(argv[loc], "-fullGenLapackEigen") == 0))
       typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
 
+    else if ((strcmp(argv[loc], "lanczos") == 0) ||
+             (strcmp(argv[loc], "-lanczos") == 0))
+      typeSolver = EigenSOE_TAGS_LanczosSOE;
+
     else {
       opserr << "eigen - unknown option: " << argv[loc] << endln;
     }
@@ -339,7 +394,10 @@ static int
 modalProperties(ClientData clientData, Tcl_Interp *interp, int argc,
                 TCL_Char ** const argv)
 {
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
   G3_Runtime *rt = G3_getRuntime(interp);
+  *G3_getAnalysisModelPtr(rt) = builder->getAnalysisModel();
   OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
   OPS_DomainModalProperties(rt);
   return TCL_OK;
@@ -349,9 +407,13 @@ static int
 responseSpectrum(ClientData clientData, Tcl_Interp *interp, int argc,
                  TCL_Char ** const argv)
 {
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
   OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
   G3_Runtime *rt = G3_getRuntime(interp);
-  OPS_ResponseSpectrumAnalysis(rt);
+  *G3_getAnalysisModelPtr(rt) = builder->getAnalysisModel();
+  if (OPS_ResponseSpectrumAnalysis(rt) < 0)
+    return TCL_ERROR;
   return TCL_OK;
 }
 
@@ -38,6 +38,9 @@ extern Tcl_CmdProc TclCommand_totalCPU;
 extern Tcl_CmdProc TclCommand_solveCPU;
 extern Tcl_CmdProc TclCommand_numFact;
 
+// commands/analysis/batch.cpp
+extern Tcl_CmdProc TclCommand_batchAnalyze;
+
 // from commands/analysis/ctest.cpp
 extern Tcl_CmdProc specifyCTest;
 extern Tcl_CmdProc getCTestNorms;
@@ -60,6 +63,7 @@ struct char_cmd {
     {"analysis",            &specifyAnalysis},
 
     {"analyze",             &analyzeModel},
+    {"batchAnalyze",        &TclCommand_batchAnalyze},
     {"initialize",          &initializeAnalysis},
     {"modalProperties",     &modalProperties},
     {"modalDamping",        &modalDamping},
@@ -0,0 +1,213 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file implements the batchAnalyze command, which runs
+// the transient analysis of the model under each of several ground motion
+// records with a BatchTransientAnalysis.
+//
+#include <tcl.h>
+#include <assert.h>
+#include <string.h>
+#include <fstream>
+#include <vector>
+#include <runtimeAPI.h>
+#include <G3_Logging.h>
+
+#include <Vector.h>
+#include <NodeData.h>
+#include <ResponseHandle.h>
+#include <TransientIntegrator.h>
+#include <EquiSolnAlgo.h>
+#include <ConvergenceTest.h>
+#include "BasicAnalysisBuilder.h"
+#include "BatchTransientAnalysis.h"
+#include "TclPackageClassBroker.h"
+
+static int
+readRecordFile(const char *path, Vector &accel)
+{
+  std::ifstream file(path);
+  if (!file.is_open())
+    return -1;
+
+  std::vector<double> values;
+  double value;
+  while (file >> value)
+    values.push_back(value);
+
+  accel.resize(values.size());
+  for (int i = 0; i < (int)values.size(); i++)
+    accel(i) = values[i];
+  return 0;
+}
+
+//
+//   batchAnalyze $dT <-workers $n> <-rayleigh $alphaM $betaK $betaK0 $betaKc>
+//       -file   $dof $dt $factor $path        (one for each record)
+//       -values $dof $dt $factor {$a0 $a1 ...}
+//       -node   $tag $dof disp|vel|accel      (one for each EDP)
+//       -drift  $iNode $jNode $dof $perpDirn
+//
+// The records are analyzed from the current state of the model, with the
+// integrator, algorithm and test of the current analysis, until their end;
+// the system of equations is not taken from the current analysis (see
+// BatchTransientAnalysis.h). -workers is ignored, with a warning, while an
+// "analysis ... -threads n" pool or an asynchronous recorder is running. The result
+// is a list with, for each record, the status of its analysis (0 if it
+// reached the end) followed by the absolute maximum of each EDP.
+//
+int
+TclCommand_batchAnalyze(ClientData clientData, Tcl_Interp *interp, int argc,
+                        TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+  Domain *domain = builder->getDomain();
+
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "want batchAnalyze dT? <-workers n?> -file|-values ... -node|-drift ...\n";
+    return TCL_ERROR;
+  }
+
+  double dT;
+  if (Tcl_GetDouble(interp, argv[1], &dT) != TCL_OK || dT <= 0.0) {
+    opserr << G3_ERROR_PROMPT << "batchAnalyze - invalid time step " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  TclPackageClassBroker broker;
+  BatchTransientAnalysis batch(*domain, broker);
+  int numWorkers = 1;
+
+  for (int argi = 2; argi < argc; argi++) {
+    if (strcmp(argv[argi], "-workers") == 0) {
+      if (argi + 1 >= argc || Tcl_GetInt(interp, argv[argi+1], &numWorkers) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "batchAnalyze -workers n? - invalid number of workers\n";
+        return TCL_ERROR;
+      }
+      argi += 1;
+    }
+
+    else if (strcmp(argv[argi], "-rayleigh") == 0) {
+      double factors[4];
+      if (argi + 4 >= argc) {
+        opserr << G3_ERROR_PROMPT << "batchAnalyze -rayleigh alphaM? betaK? betaK0? betaKc?\n";
+        return TCL_ERROR;
+      }
+      for (int i = 0; i < 4; i++)
+        if (Tcl_GetDouble(interp, argv[argi+1+i], &factors[i]) != TCL_OK) {
+          opserr << G3_ERROR_PROMPT << "batchAnalyze -rayleigh - invalid factor " << argv[argi+1+i] << "\n";
+          return TCL_ERROR;
+        }
+      batch.setRayleighDamping(factors[0], factors[1], factors[2], factors[3]);
+      argi += 4;
+    }
+
+    else if (strcmp(argv[argi], "-file") == 0 || strcmp(argv[argi], "-values") == 0) {
+      int dof;
+      double dt, factor;
+      if (argi + 4 >= argc
+          || Tcl_GetInt(interp, argv[argi+1], &dof) != TCL_OK
+          || Tcl_GetDouble(interp, argv[argi+2], &dt) != TCL_OK
+          || Tcl_GetDouble(interp, argv[argi+3], &factor) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "batchAnalyze " << argv[argi] << " dof? dt? factor? source?\n";
+        return TCL_ERROR;
+      }
+
+      Vector accel;
+      if (argv[argi][1] == 'f') {
+        if (readRecordFile(argv[argi+4], accel) < 0) {
+          opserr << G3_ERROR_PROMPT << "batchAnalyze - could not read " << argv[argi+4] << "\n";
+          return TCL_ERROR;
+        }
+      } else {
+        int numValues;
+        TCL_Char **values;
+        if (Tcl_SplitList(interp, argv[argi+4], &numValues, &values) != TCL_OK)
+          return TCL_ERROR;
+        accel.resize(numValues);
+        for (int i = 0; i < numValues; i++)
+          if (Tcl_GetDouble(interp, values[i], &accel(i)) != TCL_OK) {
+            opserr << G3_ERROR_PROMPT << "batchAnalyze -values - invalid value " << values[i] << "\n";
+            Tcl_Free((char *)values);
+            return TCL_ERROR;
+          }
+        Tcl_Free((char *)values);
+      }
+
+      if (batch.addRecord(dof - 1, accel, dt, factor) < 0)
+        return TCL_ERROR;
+      argi += 4;
+    }
+
+    else if (strcmp(argv[argi], "-node") == 0) {
+      int tag, dof;
+      if (argi + 3 >= argc
+          || Tcl_GetInt(interp, argv[argi+1], &tag) != TCL_OK
+          || Tcl_GetInt(interp, argv[argi+2], &dof) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "batchAnalyze -node tag? dof? response?\n";
+        return TCL_ERROR;
+      }
+      NodeData response = ResponseHandle::getNodeData(argv[argi+3]);
+      if (response == NodeData::Unknown) {
+        opserr << G3_ERROR_PROMPT << "batchAnalyze -node - unknown response " << argv[argi+3] << "\n";
+        return TCL_ERROR;
+      }
+      batch.addNodeEnvelope(tag, dof - 1, response);
+      argi += 3;
+    }
+
+    else if (strcmp(argv[argi], "-drift") == 0) {
+      int iNode, jNode, dof, perpDirn;
+      if (argi + 4 >= argc
+          || Tcl_GetInt(interp, argv[argi+1], &iNode) != TCL_OK
+          || Tcl_GetInt(interp, argv[argi+2], &jNode) != TCL_OK
+          || Tcl_GetInt(interp, argv[argi+3], &dof) != TCL_OK
+          || Tcl_GetInt(interp, argv[argi+4], &perpDirn) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "batchAnalyze -drift iNode? jNode? dof? perpDirn?\n";
+        return TCL_ERROR;
+      }
+      batch.addDriftEnvelope(iNode, jNode, dof - 1, perpDirn - 1);
+      argi += 4;
+    }
+
+    else {
+      opserr << G3_ERROR_PROMPT << "batchAnalyze - unknown option " << argv[argi] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (batch.getNumRecords() == 0) {
+    opserr << G3_ERROR_PROMPT << "batchAnalyze - no records given\n";
+    return TCL_ERROR;
+  }
+
+  TransientIntegrator *theIntegrator = builder->getTransientIntegrator();
+  if (theIntegrator != nullptr && batch.setIntegrator(*theIntegrator) < 0)
+    return TCL_ERROR;
+
+  EquiSolnAlgo *theAlgorithm = builder->getAlgorithm();
+  if (theAlgorithm != nullptr && batch.setAlgorithm(*theAlgorithm) < 0)
+    return TCL_ERROR;
+
+  ConvergenceTest *theTest = builder->getConvergenceTest();
+  if (theTest != nullptr && batch.setConvergenceTest(*theTest) < 0)
+    return TCL_ERROR;
+
+  batch.analyze(dT, numWorkers);
+
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  for (int i = 0; i < batch.getNumRecords(); i++) {
+    Tcl_Obj *row = Tcl_NewListObj(0, nullptr);
+    Tcl_ListObjAppendElement(interp, row, Tcl_NewIntObj(batch.getStatus(i)));
+    for (int j = 0; j < batch.getNumEDPs(); j++)
+      Tcl_ListObjAppendElement(interp, row, Tcl_NewDoubleObj(batch.getEDP(i, j)));
+    Tcl_ListObjAppendElement(interp, result, row);
+  }
+  Tcl_SetObjResult(interp, result);
+
+  return TCL_OK;
+}
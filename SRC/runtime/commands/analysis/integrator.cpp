@@ -327,6 +327,10 @@ G3Parse_newTransientIntegrator(ClientData clientData, Tcl_Interp *interp, int ar
     theTransientIntegrator = (TransientIntegrator *)OPS_CentralDifferenceNoDamping(rt, argc, argv);
   }
 
+  else if (strcmp(argv[1], "LumpedCentralDifference") == 0) {
+    theTransientIntegrator = (TransientIntegrator *)OPS_LumpedCentralDifference(rt, argc, argv);
+  }
+
   return theTransientIntegrator;
 }
 
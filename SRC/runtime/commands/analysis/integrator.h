@@ -17,6 +17,7 @@ OPS_Routine OPS_ExplicitDifference;
 OPS_Routine OPS_CentralDifference;
 OPS_Routine OPS_CentralDifferenceAlternative;
 OPS_Routine OPS_CentralDifferenceNoDamping;
+OPS_Routine OPS_LumpedCentralDifference;
 OPS_Routine OPS_Collocation;
 OPS_Routine OPS_CollocationHSFixedNumIter;
 OPS_Routine OPS_CollocationHSIncrLimit;
@@ -38,6 +38,7 @@
 #include <SparseGenRowLinSOE.h>
 #include <SymSparseLinSOE.h>
 #include <SymSparseLinSolver.h>
+#include <SymSparseSupernodalSolver.h>
 
 #ifdef _CUDA
 #  include <BandGenLinSOE_Single.h>
@@ -206,12 +207,30 @@ specify_SparseSPD(G3_Runtime *rt, int argc, G3_Char ** const argv)
     //   2 -- ND
     //   3 -- RCM
 
+    //
+    //   system SparseSPD <$ordering> <-supernodal> <-threads $n>
+    //
     int lSparse = 1;
-    if (argc == 3) {
-      if (Tcl_GetInt(interp, argv[2], &lSparse) != TCL_OK)
+    bool supernodal = false;
+    int numThreads = 1;
+    for (int i = 2; i < argc; i++) {
+      if (strcmp(argv[i], "-supernodal") == 0)
+        supernodal = true;
+      else if (strcmp(argv[i], "-threads") == 0) {
+        if (++i >= argc || Tcl_GetInt(interp, argv[i], &numThreads) != TCL_OK) {
+          opserr << G3_ERROR_PROMPT << "-threads requires the number of threads\n";
+          return nullptr;
+        }
+      }
+      else if (Tcl_GetInt(interp, argv[i], &lSparse) != TCL_OK)
         return nullptr;
     }
-    SymSparseLinSolver *theSolver = new SymSparseLinSolver();
+
+    SymSparseLinSolver *theSolver = nullptr;
+    if (supernodal)
+      theSolver = new SymSparseSupernodalSolver(numThreads);
+    else
+      theSolver = new SymSparseLinSolver();
     return new SymSparseLinSOE(*theSolver, lSparse);
 }
 
@@ -116,6 +116,9 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "eleForce",            &eleForce,            domain, nullptr);
   Tcl_CreateCommand(interp, "eleResponse",         &eleResponse,         domain, nullptr);
   Tcl_CreateCommand(interp, "eleDynamicalForce",   &eleDynamicalForce,   domain, nullptr);
+  Tcl_CreateCommand(interp, "bindResponses",       &bindResponses,       domain, nullptr);
+  Tcl_CreateCommand(interp, "fetchResponses",      &fetchResponses,      domain, nullptr);
+  Tcl_CreateCommand(interp, "freeResponses",       &freeResponses,       domain, nullptr);
 
   Tcl_CreateCommand(interp, "nodeDOFs",            &nodeDOFs,            domain, nullptr);
   Tcl_CreateCommand(interp, "nodeCoord",           &nodeCoord,           domain, nullptr);
@@ -152,6 +155,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateObjCommand(interp, "constrainedNodes",    &constrainedNodes,    domain, nullptr);
   Tcl_CreateObjCommand(interp, "constrainedDOFs",     &constrainedDOFs,     domain, nullptr);
   Tcl_CreateObjCommand(interp, "domainChange",        &domainChange,        domain, nullptr);
+  Tcl_CreateObjCommand(interp, "reorderDomain",       &reorderDomain,       domain, nullptr);
   Tcl_CreateObjCommand(interp, "remove",              &removeObject,        domain, nullptr);
   Tcl_CreateCommand(interp,    "retainedNodes",       &retainedNodes,       domain, nullptr);
   Tcl_CreateCommand(interp,    "retainedDOFs",        &retainedDOFs,        domain, nullptr);
@@ -103,6 +103,7 @@ Tcl_ObjCmdProc constrainedNodes;
 Tcl_ObjCmdProc fixedDOFs;
 Tcl_ObjCmdProc constrainedDOFs;
 Tcl_ObjCmdProc domainChange;
+Tcl_ObjCmdProc reorderDomain;
 Tcl_CmdProc retainedDOFs;
 Tcl_CmdProc updateElementDomain;
 
@@ -144,6 +145,11 @@ Tcl_CmdProc basicForce;
 
 Tcl_CmdProc basicStiffness;
 
+// domain/response.cpp
+Tcl_CmdProc bindResponses;
+Tcl_CmdProc fetchResponses;
+Tcl_CmdProc freeResponses;
+
 // added: Chris McGann, U.Washington for initial state analysis of nDMaterials
 Tcl_CmdProc InitialStateAnalysis;
 
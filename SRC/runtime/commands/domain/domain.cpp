@@ -45,6 +45,18 @@ domainChange(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+int
+reorderDomain(ClientData clientData, Tcl_Interp *interp, int argc,
+              Tcl_Obj *const *objv)
+{
+  assert(clientData != nullptr);
+  if (((Domain*)clientData)->reorderComponents() < 0) {
+    opserr << "WARNING failed to reorder the nodes and elements\n";
+    return TCL_ERROR;
+  }
+  return TCL_OK;
+}
+
 
 int
 removeObject(ClientData clientData, Tcl_Interp *interp, int argc,
@@ -41,6 +41,8 @@
 #include <DataFileStreamAdd.h>
 #include <XmlFileStream.h>
 #include <BinaryFileStream.h>
+#include <AsyncStream.h>
+#include <ColumnFileStream.h>
 #include <DatabaseStream.h>
 #include <DummyStream.h>
 #include <TCP_Stream.h>
@@ -98,6 +100,7 @@ struct OutputOptions {
   int writeBufferSize   = 0;
   bool doScientific     = false;
   bool closeOnWrite     = false;
+  bool async            = false; // write from a background thread
 
   FE_Datastore *theDatabase = nullptr;
 
@@ -107,6 +110,7 @@ struct OutputOptions {
     XML_STREAM,
     DATABASE_STREAM,
     BINARY_STREAM,
+    COLUMN_STREAM,
     DATA_STREAM_CSV,
     TCP_STREAM,
     DATA_STREAM_ADD,
@@ -155,6 +159,9 @@ createOutputStream(OutputOptions &options)
 
     } else if (options.eMode == OutputOptions::BINARY_STREAM) {
       theOutputStream = new BinaryFileStream(options.filename);
+
+    } else if (options.eMode == OutputOptions::COLUMN_STREAM) {
+      theOutputStream = new ColumnFileStream(options.filename);
     }
 
   } else if (options.eMode == OutputOptions::TCP_STREAM && options.inetAddr != 0) {
@@ -169,6 +176,9 @@ createOutputStream(OutputOptions &options)
 
   theOutputStream->setPrecision(options.precision);
 
+  if (options.async)
+    theOutputStream = new AsyncStream(theOutputStream);
+
   return theOutputStream;
 }
 
@@ -292,6 +302,11 @@ parseOutputOption(OutputOptions *options, Tcl_Interp* interp, int argc, TCL_Char
       loc++;
     }
 
+    else if (strcmp(argv[loc], "-async") == 0) {
+      options->async = true;
+      loc++;
+    }
+
     else if (strcmp(argv[loc], "-buffer") == 0 ||
              strcmp(argv[loc], "-bufferSize") == 0) {
       loc++;
@@ -320,6 +335,9 @@ parseOutputOption(OutputOptions *options, Tcl_Interp* interp, int argc, TCL_Char
       else if ((strcmp(argv[loc], "-binary") == 0)) {
         eMode = OutputOptions::BINARY_STREAM;
       }
+      else if ((strcmp(argv[loc], "-columnar") == 0)) {
+        eMode = OutputOptions::COLUMN_STREAM;
+      }
       else if ((strcmp(argv[loc], "-TCP") == 0) ||
                (strcmp(argv[loc], "-tcp") == 0)) {
         options->inetAddr = argv[loc + 1];
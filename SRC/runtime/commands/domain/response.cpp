@@ -12,6 +12,10 @@
 
 #include <DummyStream.h>
 #include <Element.h>
+#include <ResponseHandle.h>
+#include <memory>
+#include <vector>
+#include <string.h>
 
 int
 basicDeformation(ClientData clientData, Tcl_Interp *interp, int argc,
@@ -590,3 +594,185 @@ sectionFlexibility(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+
+
+//
+// Response handles
+//
+//   bindResponses ele  {eleTag ...}  args...
+//   bindResponses node {nodeTag ...} disp|vel|accel|incrDisp|reaction|...
+//     binds the response to each of the elements or nodes, in a new handle
+//     whose number is returned; with "-add handle" before "ele" or "node"
+//     the responses are added to an existing handle instead
+//
+//   fetchResponses handle ?-offsets?
+//     the current values of all the responses of the handle, one after the
+//     other; with -offsets, the index at which those of each response start,
+//     followed by the number of values
+//
+//   freeResponses handle
+//
+typedef std::vector<std::unique_ptr<ResponseHandle>> ResponseHandles;
+
+static void
+deleteResponseHandles(ClientData clientData, Tcl_Interp *interp)
+{
+  delete (ResponseHandles *)clientData;
+}
+
+static ResponseHandles &
+getResponseHandles(Tcl_Interp *interp)
+{
+  ResponseHandles *handles =
+    (ResponseHandles *)Tcl_GetAssocData(interp, "OPS::ResponseHandles", nullptr);
+  if (handles == nullptr) {
+    handles = new ResponseHandles();
+    Tcl_SetAssocData(interp, "OPS::ResponseHandles", deleteResponseHandles, (ClientData)handles);
+  }
+  return *handles;
+}
+
+static ResponseHandle *
+getResponseHandle(Tcl_Interp *interp, const char *arg)
+{
+  int tag;
+  ResponseHandles &handles = getResponseHandles(interp);
+  if (Tcl_GetInt(interp, arg, &tag) != TCL_OK || tag < 0 ||
+      tag >= int(handles.size()) || handles[tag] == nullptr) {
+    opserr << G3_ERROR_PROMPT << "no response handle " << arg << "\n";
+    return nullptr;
+  }
+  return handles[tag].get();
+}
+
+int
+bindResponses(ClientData clientData, Tcl_Interp *interp, int argc,
+              TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain *the_domain = (Domain*)clientData;
+
+  ResponseHandles &handles = getResponseHandles(interp);
+  ResponseHandle *theHandle = nullptr;
+  int handleTag = -1;
+
+  int argi = 1;
+  if (argc > 2 && strcmp(argv[1], "-add") == 0) {
+    if ((theHandle = getResponseHandle(interp, argv[2])) == nullptr)
+      return TCL_ERROR;
+    Tcl_GetInt(interp, argv[2], &handleTag);
+    argi = 3;
+  }
+
+  if (argc < argi + 3) {
+    opserr << G3_ERROR_PROMPT << "want - bindResponses ?-add handle? ele|node tags args...\n";
+    return TCL_ERROR;
+  }
+
+  const bool isNode = strcmp(argv[argi], "node") == 0;
+  if (!isNode && strcmp(argv[argi], "ele") != 0 && strcmp(argv[argi], "element") != 0) {
+    opserr << G3_ERROR_PROMPT << "bindResponses - expected ele or node, got " << argv[argi] << "\n";
+    return TCL_ERROR;
+  }
+
+  NodeData nodeData = NodeData::Unknown;
+  if (isNode && (nodeData = ResponseHandle::getNodeData(argv[argi+2])) == NodeData::Unknown) {
+    opserr << G3_ERROR_PROMPT << "bindResponses - unknown node response " << argv[argi+2] << "\n";
+    return TCL_ERROR;
+  }
+
+  int numTags;
+  TCL_Char **tags;
+  if (Tcl_SplitList(interp, argv[argi+1], &numTags, &tags) != TCL_OK)
+    return TCL_ERROR;
+
+  std::unique_ptr<ResponseHandle> newHandle;
+  if (theHandle == nullptr) {
+    newHandle.reset(new ResponseHandle(*the_domain));
+    theHandle = newHandle.get();
+  }
+
+  // on an error, an existing handle is left with the entries it had
+  const int numEntries = theHandle->getNumEntries();
+
+  for (int i = 0; i < numTags; i++) {
+    int tag;
+    if (Tcl_GetInt(interp, tags[i], &tag) != TCL_OK) {
+      opserr << G3_ERROR_PROMPT << "bindResponses - could not read tag " << tags[i] << "\n";
+      Tcl_Free((char *)tags);
+      theHandle->truncate(numEntries);
+      return TCL_ERROR;
+    }
+
+    int ok = isNode ? theHandle->addNodeResponse(tag, nodeData)
+                    : theHandle->addElementResponse(tag, argv + argi + 2, argc - argi - 2);
+    if (ok < 0) {
+      opserr << G3_ERROR_PROMPT << "bindResponses - no such response for "
+             << (isNode ? "node " : "element ") << tag << "\n";
+      Tcl_Free((char *)tags);
+      theHandle->truncate(numEntries);
+      return TCL_ERROR;
+    }
+  }
+  Tcl_Free((char *)tags);
+
+  if (newHandle != nullptr) {
+    handleTag = handles.size();
+    handles.push_back(std::move(newHandle));
+  }
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(handleTag));
+  return TCL_OK;
+}
+
+int
+fetchResponses(ClientData clientData, Tcl_Interp *interp, int argc,
+               TCL_Char ** const argv)
+{
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "want - fetchResponses handle ?-offsets?\n";
+    return TCL_ERROR;
+  }
+
+  ResponseHandle *theHandle = getResponseHandle(interp, argv[1]);
+  if (theHandle == nullptr)
+    return TCL_ERROR;
+
+  if (argc > 2 && strcmp(argv[2], "-offsets") == 0) {
+    const std::vector<int> &offsets = theHandle->getOffsets();
+    Tcl_Obj *listPtr = Tcl_NewListObj(0, nullptr);
+    for (int offset : offsets)
+      Tcl_ListObjAppendElement(interp, listPtr, Tcl_NewIntObj(offset));
+    Tcl_SetObjResult(interp, listPtr);
+    return TCL_OK;
+  }
+
+  theHandle->fetch();
+
+  const int size = theHandle->getNumValues();
+  const double *values = theHandle->getValues();
+  std::vector<Tcl_Obj *> objs(size);
+  for (int i = 0; i < size; i++)
+    objs[i] = Tcl_NewDoubleObj(values[i]);
+
+  Tcl_SetObjResult(interp, Tcl_NewListObj(size, objs.data()));
+  return TCL_OK;
+}
+
+int
+freeResponses(ClientData clientData, Tcl_Interp *interp, int argc,
+              TCL_Char ** const argv)
+{
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "want - freeResponses handle\n";
+    return TCL_ERROR;
+  }
+
+  if (getResponseHandle(interp, argv[1]) == nullptr)
+    return TCL_ERROR;
+
+  int tag;
+  Tcl_GetInt(interp, argv[1], &tag);
+  getResponseHandles(interp)[tag].reset();
+  return TCL_OK;
+}
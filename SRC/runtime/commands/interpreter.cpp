@@ -14,6 +14,8 @@
 #include <G3_Runtime.h>
 #include <OPS_Globals.h>
 #include <Timer.h>
+#include <ArrayPool.h>
+#include <AnalysisProfile.h>
 
 static Tcl_ObjCmdProc *Tcl_putsCommand = nullptr;
 static Timer *theTimer = nullptr;
@@ -351,6 +353,99 @@ maxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+//
+// allocations <-reset>
+//
+// Returns a dictionary with the number of requests for Matrix and Vector
+// storage, and of the heap allocations made for them, since the start or
+// the last reset; with -reset the counts are then set to zero.
+//
+static int
+allocations(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv)
+{
+  const OpenSees::array_pool::statistics stats = OpenSees::array_pool::get_statistics();
+
+  Tcl_Obj *dict = Tcl_NewDictObj();
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("requests", -1),    Tcl_NewWideIntObj(stats.requests));
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("allocations", -1), Tcl_NewWideIntObj(stats.allocations));
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("releases", -1),    Tcl_NewWideIntObj(stats.releases));
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("frees", -1),       Tcl_NewWideIntObj(stats.frees));
+  Tcl_SetObjResult(interp, dict);
+
+  if (argc > 1) {
+    if (strcmp(argv[1], "-reset") != 0) {
+      opserr << "WARNING unknown option '" << argv[1] << "', want: allocations <-reset>\n";
+      return TCL_ERROR;
+    }
+    OpenSees::array_pool::reset_statistics();
+  }
+  return TCL_OK;
+}
+
+//
+// profile <start|stop|reset>
+//
+// With no argument, returns a dictionary with the time spent in and the
+// calls made to each phase of the analysis steps taken while profiling, the
+// number of steps, iterations and factorizations, and the calls made to the
+// elements of each class by the update, formTangent, formUnbalance and
+// commit phases. start resets the profile and enables it.
+//
+static int
+profile(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv)
+{
+  if (argc > 1) {
+    if (strcmp(argv[1], "start") == 0) {
+      AnalysisProfile::reset();
+      AnalysisProfile::setEnabled(true);
+    } else if (strcmp(argv[1], "stop") == 0) {
+      AnalysisProfile::setEnabled(false);
+    } else if (strcmp(argv[1], "reset") == 0) {
+      AnalysisProfile::reset();
+    } else {
+      opserr << "WARNING unknown option '" << argv[1] << "', want: profile <start|stop|reset>\n";
+      return TCL_ERROR;
+    }
+    return TCL_OK;
+  }
+
+  Tcl_Obj *dict  = Tcl_NewDictObj(),
+          *time  = Tcl_NewDictObj(),
+          *calls = Tcl_NewDictObj(),
+          *elements = Tcl_NewDictObj();
+
+  for (int i = 0; i < AnalysisProfile::NumCounts; i++) {
+    AnalysisProfile::Count count = AnalysisProfile::Count(i);
+    Tcl_DictObjPut(interp, dict, Tcl_NewStringObj(AnalysisProfile::getName(count), -1),
+                   Tcl_NewWideIntObj(AnalysisProfile::getCount(count)));
+  }
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("iterations", -1),
+                 Tcl_NewWideIntObj(AnalysisProfile::getCalls(AnalysisProfile::Test)));
+
+  for (int i = 0; i < AnalysisProfile::NumPhases; i++) {
+    AnalysisProfile::Phase phase = AnalysisProfile::Phase(i);
+    Tcl_Obj *name = Tcl_NewStringObj(AnalysisProfile::getName(phase), -1);
+    Tcl_DictObjPut(interp, time,  name, Tcl_NewDoubleObj(AnalysisProfile::getTime(phase)));
+    Tcl_DictObjPut(interp, calls, name, Tcl_NewWideIntObj(AnalysisProfile::getCalls(phase)));
+  }
+
+  for (const auto &entry : AnalysisProfile::getElementCalls()) {
+    Tcl_Obj *counts = Tcl_NewDictObj();
+    for (int i = 0; i < AnalysisProfile::NumPhases; i++)
+      if (entry.second[i] != 0)
+        Tcl_DictObjPut(interp, counts,
+                       Tcl_NewStringObj(AnalysisProfile::getName(AnalysisProfile::Phase(i)), -1),
+                       Tcl_NewWideIntObj(entry.second[i]));
+    Tcl_DictObjPut(interp, elements, Tcl_NewStringObj(entry.first.c_str(), -1), counts);
+  }
+
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("time", -1),     time);
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("calls", -1),    calls);
+  Tcl_DictObjPut(interp, dict, Tcl_NewStringObj("elements", -1), elements);
+  Tcl_SetObjResult(interp, dict);
+  return TCL_OK;
+}
+
 int
 OpenSeesAppInit(Tcl_Interp *interp)
 {
@@ -386,6 +481,8 @@ OpenSeesAppInit(Tcl_Interp *interp)
   Tcl_CreateCommand(interp, "start",               startTimer,   nullptr, nullptr);
   Tcl_CreateCommand(interp, "stop",                stopTimer,    nullptr, nullptr);
   Tcl_CreateCommand(interp, "timer",               timer,        nullptr, nullptr);
+  Tcl_CreateCommand(interp, "allocations",         allocations,  nullptr, nullptr);
+  Tcl_CreateCommand(interp, "profile",             profile,      nullptr, nullptr);
 
   // File utilities
   Tcl_CreateCommand(interp, "stripXML",            stripOpenSeesXML,    nullptr, NULL);
@@ -14,11 +14,16 @@ namespace py = pybind11;
 #include <G3_Runtime.h>
 #include <elementAPI.h> // G3_getRuntime/SafeBuilder
 #include <runtime/runtime/BasicModelBuilder.h>
+#include <runtime/runtime/BasicAnalysisBuilder.h>
+#include <runtime/runtime/BatchTransientAnalysis.h>
+#include <runtime/runtime/TclPackageClassBroker.h>
 
 #include <Domain.h>
 #include <Vector.h>
 #include <Node.h>
 #include <NodeData.h>
+#include <ResponseHandle.h>
+#include <ColumnFileReader.h>
 #include <Element.h>
 #include <SectionForceDeformation.h>
 #include <UniaxialMaterial.h>
@@ -32,6 +37,8 @@ namespace py = pybind11;
 #include <TransientAnalysis.h>
 #include <DirectIntegrationAnalysis.h>
 #include <StaticAnalysis.h>
+#include <TransientIntegrator.h>
+#include <ConvergenceTest.h>
 
 #include <LoadPattern.h>
 #include <EarthquakePattern.h>
@@ -503,7 +510,182 @@ init_obj_module(py::module &m)
     })
     .def ("getTime", &Domain::getCurrentTime)
   ;
+
+  //
+  // Bulk responses; fetch() returns a view of the values, which the array
+  // keeps alive, and which the next fetch() overwrites in place unless the
+  // number of values changes.
+  //
+  py::class_<ResponseHandle>(m, "_ResponseHandle")
+    .def (py::init<Domain&>(), py::keep_alive<1, 2>())
+    .def ("add_element", [](ResponseHandle& handle, std::vector<int> tags, std::vector<std::string> args) {
+        std::vector<const char *> argv;
+        for (const std::string &arg : args)
+          argv.push_back(arg.c_str());
+        const int numEntries = handle.getNumEntries();
+        for (int tag : tags)
+          if (handle.addElementResponse(tag, argv.data(), (int)argv.size()) < 0) {
+            handle.truncate(numEntries);
+            throw std::runtime_error("no such response for element " + std::to_string(tag));
+          }
+    }, py::arg("tags"), py::arg("args"))
+    .def ("add_node", [](ResponseHandle& handle, std::vector<int> tags, std::string type) {
+        NodeData data = ResponseHandle::getNodeData(type.c_str());
+        if (data == NodeData::Unknown)
+          throw std::runtime_error("unknown node response " + type);
+        const int numEntries = handle.getNumEntries();
+        for (int tag : tags)
+          if (handle.addNodeResponse(tag, data) < 0) {
+            handle.truncate(numEntries);
+            throw std::runtime_error("no such response for node " + std::to_string(tag));
+          }
+    }, py::arg("tags"), py::arg("type"))
+    .def ("fetch", [](ResponseHandle& handle) {
+        handle.fetch();
+        auto *buffer = new std::shared_ptr<std::vector<double>>(handle.getBuffer());
+        py::capsule owner(buffer, [](void *p) {
+          delete static_cast<std::shared_ptr<std::vector<double>>*>(p);
+        });
+        return py::array_t<double>((*buffer)->size(), (*buffer)->data(), owner);
+    })
+    .def ("offsets", [](ResponseHandle& handle) {
+        const std::vector<int> &offsets = handle.getOffsets();
+        return py::array_t<int>(offsets.size(), offsets.data());
+    })
+    .def ("__len__", &ResponseHandle::getNumEntries)
+  ;
+
+  //
+  // Column files; the arrays are read-only views of the mapped file, which
+  // they keep open, except for a column spread over several chunks, which
+  // is gathered into a new array.
+  //
+  auto column_view = [](py::object self, int column) -> py::array_t<double> {
+    const ColumnFileReader &reader = self.cast<const ColumnFileReader&>();
+    if (column < 0 || column >= reader.getNumColumns())
+      throw py::index_error("no column " + std::to_string(column));
+    py::array_t<double> array;
+    if (reader.getNumChunks() == 1) {
+      long rows = reader.getChunkRows(0);
+      array = py::array_t<double>(rows, reader.getChunk(0) + column*rows, self);
+      array.attr("setflags")(py::arg("write") = false);
+    } else {
+      array = py::array_t<double>(reader.getNumRows());
+      reader.getColumn(column, array.mutable_data());
+    }
+    return array;
+  };
+
+  py::class_<ColumnFileReader>(m, "_ColumnFile")
+    .def (py::init([](std::string path) {
+        std::unique_ptr<ColumnFileReader> reader(new ColumnFileReader());
+        if (reader->open(path.c_str()) < 0)
+          throw std::runtime_error("could not read column file " + path);
+        return reader;
+    }))
+    .def_property_readonly ("labels", [](ColumnFileReader& reader) {
+        std::vector<std::string> labels;
+        for (int i = 0; i < reader.getNumColumns(); i++)
+          labels.push_back(reader.getLabel(i));
+        return labels;
+    })
+    .def_property_readonly ("sources", [](ColumnFileReader& reader) {
+        std::vector<std::string> sources;
+        for (int i = 0; i < reader.getNumColumns(); i++)
+          sources.push_back(reader.getSource(i));
+        return sources;
+    })
+    .def ("__len__", &ColumnFileReader::getNumRows)
+    .def ("num_chunks", &ColumnFileReader::getNumChunks)
+    .def ("chunk", [](py::object self, int chunk) {
+        const ColumnFileReader &reader = self.cast<const ColumnFileReader&>();
+        if (chunk < 0 || chunk >= reader.getNumChunks())
+          throw py::index_error("no chunk " + std::to_string(chunk));
+        const py::ssize_t rows = reader.getChunkRows(chunk);
+        const py::ssize_t cols = reader.getNumColumns();
+        py::array_t<double> array({cols, rows}, {rows*py::ssize_t(sizeof(double)), py::ssize_t(sizeof(double))},
+                                  reader.getChunk(chunk), self);
+        array.attr("setflags")(py::arg("write") = false);
+        return array;
+    })
+    .def ("column", column_view)
+    .def ("column", [column_view](py::object self, std::string label, py::object source) {
+        const ColumnFileReader &reader = self.cast<const ColumnFileReader&>();
+        std::string text = source.is_none() ? std::string() : source.cast<std::string>();
+        int column = reader.findColumn(label.c_str(), source.is_none() ? nullptr : text.c_str());
+        if (column < 0)
+          throw py::key_error(label);
+        return column_view(self, column);
+    }, py::arg("label"), py::arg("source") = py::none())
+  ;
   
+  //
+  // Batches of records; the DOFs and nodes are numbered as in the Tcl
+  // commands, and analyze() returns the EDPs with a row for each record.
+  //
+  py::class_<BatchTransientAnalysis>(m, "_BatchAnalysis")
+    .def (py::init([](Domain& domain) {
+        static TclPackageClassBroker broker;
+        return std::unique_ptr<BatchTransientAnalysis>(new BatchTransientAnalysis(domain, broker));
+    }), py::keep_alive<1, 2>())
+    .def ("use_analysis", [](BatchTransientAnalysis& batch, py::object interpaddr) {
+        Tcl_Interp *interp = (Tcl_Interp*)PyLong_AsVoidPtr(interpaddr.ptr());
+        Tcl_CmdInfo info;
+        if (Tcl_GetCommandInfo(interp, "analyze", &info) != 1 || info.clientData == nullptr)
+          throw std::runtime_error("no analysis in the interpreter");
+        BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)info.clientData;
+        if (builder->getTransientIntegrator() != nullptr
+            && batch.setIntegrator(*builder->getTransientIntegrator()) < 0)
+          throw std::runtime_error("the integrator could not be copied");
+        if (builder->getAlgorithm() != nullptr
+            && batch.setAlgorithm(*builder->getAlgorithm()) < 0)
+          throw std::runtime_error("the algorithm could not be copied");
+        if (builder->getConvergenceTest() != nullptr
+            && batch.setConvergenceTest(*builder->getConvergenceTest()) < 0)
+          throw std::runtime_error("the convergence test could not be copied");
+    })
+    .def ("set_rayleigh", &BatchTransientAnalysis::setRayleighDamping,
+          py::arg("alphaM"), py::arg("betaK"), py::arg("betaK0"), py::arg("betaKc"))
+    .def ("add_record", [](BatchTransientAnalysis& batch, int dof,
+                           py::array_t<double, ARRAY_FLAGS> accel, double dt, double factor) {
+        py::buffer_info info = accel.request();
+        Vector values(static_cast<double*>(info.ptr), (int)info.shape[0]);
+        int record = batch.addRecord(dof - 1, values, dt, factor);
+        if (record < 0)
+          throw std::runtime_error("invalid record");
+        return record;
+    }, py::arg("dof"), py::arg("accel"), py::arg("dt"), py::arg("factor") = 1.0)
+    .def ("add_node", [](BatchTransientAnalysis& batch, int tag, int dof, std::string type) {
+        NodeData data = ResponseHandle::getNodeData(type.c_str());
+        if (data == NodeData::Unknown)
+          throw std::runtime_error("unknown node response " + type);
+        return batch.addNodeEnvelope(tag, dof - 1, data);
+    }, py::arg("tag"), py::arg("dof"), py::arg("type"))
+    .def ("add_drift", [](BatchTransientAnalysis& batch, int iNode, int jNode, int dof, int perpDirn) {
+        return batch.addDriftEnvelope(iNode, jNode, dof - 1, perpDirn - 1);
+    }, py::arg("iNode"), py::arg("jNode"), py::arg("dof"), py::arg("perpDirn"))
+    .def ("analyze", [](BatchTransientAnalysis& batch, double dt, int workers) {
+        {
+          py::gil_scoped_release release;
+          batch.analyze(dt, workers);
+        }
+        const py::ssize_t rows = batch.getNumRecords();
+        const py::ssize_t cols = batch.getNumEDPs();
+        py::array_t<double> edps({rows, cols});
+        auto view = edps.mutable_unchecked<2>();
+        for (py::ssize_t i = 0; i < rows; i++)
+          for (py::ssize_t j = 0; j < cols; j++)
+            view(i, j) = batch.getEDP(i, j);
+        return edps;
+    }, py::arg("dt"), py::arg("workers") = 1)
+    .def ("status", [](BatchTransientAnalysis& batch) {
+        std::vector<int> status;
+        for (int i = 0; i < batch.getNumRecords(); i++)
+          status.push_back(batch.getStatus(i));
+        return status;
+    })
+  ;
+
   py::class_<G3_Runtime>(m, "_Runtime")
   ;
 
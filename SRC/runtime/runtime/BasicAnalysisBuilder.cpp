@@ -8,11 +8,14 @@
 //
 #include <assert.h>
 #include <stdio.h>
+#include <math.h>
+#include <algorithm>
 #include <unordered_map>
 
 #include "BasicAnalysisBuilder.h"
 #include <Domain.h>
 #include <G3_Logging.h>
+#include <AnalysisProfile.h>
 // Abstract classes
 #include <EquiSolnAlgo.h>
 #include <StaticIntegrator.h>
@@ -41,6 +44,7 @@
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <ArpackSOE.h>
+#include <LanczosSOE.h>
 #include <ProfileSPDLinSOE.h>
 #include <NewtonRaphson.h>
 #include <RCM.h>
@@ -128,6 +132,8 @@ BasicAnalysisBuilder::wipe()
     theAnalysisModel = new AnalysisModel();
   }
   theVariableTimeStepTransientAnalysis = nullptr;
+  adaptiveDt   = 0.0;
+  adaptiveNorm = 0.0;
 }
 
 void
@@ -159,6 +165,7 @@ BasicAnalysisBuilder::setLinks(CurrentAnalysis flag)
 
     if (theAnalysisModel && theSOE && theTest && theTransientIntegrator) {
       theTransientIntegrator->setLinks(*theAnalysisModel, *theSOE, theTest);
+      theTransientIntegrator->setThreadPool(theDomain ? theDomain->getThreadPool() : nullptr);
     }
     // if (theTransientIntegrator && domainStamp != 0)
     //   theTransientIntegrator->domainChanged();
@@ -172,8 +179,10 @@ BasicAnalysisBuilder::setLinks(CurrentAnalysis flag)
     if (theDomain && theAnalysisModel && theStaticIntegrator && theHandler)
       theHandler->setLinks(*theDomain, *theAnalysisModel, *theStaticIntegrator);
 
-    if (theAnalysisModel && theSOE && theTest && theStaticIntegrator)
+    if (theAnalysisModel && theSOE && theTest && theStaticIntegrator) {
       theStaticIntegrator->setLinks(*theAnalysisModel, *theSOE, theTest);
+      theStaticIntegrator->setThreadPool(theDomain ? theDomain->getThreadPool() : nullptr);
+    }
 
     if (theAnalysisModel && theStaticIntegrator && theSOE && theTest && theAlgorithm)
       theAlgorithm->setLinks(*theAnalysisModel, *theStaticIntegrator, *theSOE, theTest);
@@ -230,6 +239,9 @@ BasicAnalysisBuilder::domainChanged(void)
 
   opsdbg << G3_DEBUG_PROMPT << "Domain changed\n";
 
+  // the error scale of analyzeAdaptive() belongs to the old model
+  adaptiveNorm = 0.0;
+
   theAnalysisModel->clearAll();
   if (theHandler != nullptr) {
     theHandler->clearAll();
@@ -256,18 +268,20 @@ BasicAnalysisBuilder::domainChanged(void)
   }
 
   // Invoke setSize() on the LinearSOE which
-  // causes that object to determine its size
-  Graph &theGraph = theAnalysisModel->getDOFGraph();
-
-  if (theSOE != nullptr) {
-    if (theSOE->setSize(theGraph) < 0) {
+  // causes that object to determine its size; a matrix free
+  // integrator does not use it
+  const bool matrixFree = this->CurrentAnalysisFlag == TRANSIENT_ANALYSIS
+                       && theTransientIntegrator != nullptr
+                       && theTransientIntegrator->isMatrixFree();
+  if (theSOE != nullptr && !matrixFree) {
+    if (theSOE->setSize(theAnalysisModel->getDOFCSRGraph()) < 0) {
       opserr << "BasicAnalysisBuilder::domainChange() - LinearSOE::setSize() failed\n";
       return -3;
     }
   }
 
   if (theEigenSOE != nullptr) {
-    int result = theEigenSOE->setSize(theGraph);
+    int result = theEigenSOE->setSize(theAnalysisModel->getDOFGraph());
     if (result < 0) {
       return -3;
     }
@@ -391,6 +405,7 @@ BasicAnalysisBuilder::analyzeStatic(int numSteps)
         theStaticIntegrator->revertToLastStep();
         return -4;
       }
+      AnalysisProfile::addCount(AnalysisProfile::Steps);
   }
 
   return 0;
@@ -437,9 +452,108 @@ BasicAnalysisBuilder::analyzeSubLevel(int level, double dT)
   return result;
 }
 
+int
+BasicAnalysisBuilder::analyzeAdaptive(int numSteps, double dT, double tol,
+                                      double dtMin, double dtMax, double atol)
+{
+  if (theTransientIntegrator == nullptr || dT <= 0.0 || tol <= 0.0
+      || dtMin <= 0.0 || dtMax < dtMin || atol < 0.0) {
+    opserr << "BasicAnalysisBuilder::analyzeAdaptive() - invalid arguments\n";
+    return -1;
+  }
+
+  // the step grows or shrinks with the cube root of the ratio of the
+  // tolerance to the error, which is of the third order in the step, but
+  // by no more than these factors at a time
+  const double safety = 0.9,
+               grow   = 2.0,
+               shrink = 0.2;
+
+  double h = adaptiveDt > 0.0 ? adaptiveDt : std::min(dT, dtMax);
+
+  // the errors are measured against the largest norm of the displacements
+  // reached so far, kept across calls so that the steps do not depend on
+  // how a script splits its analyze commands, and not against less than
+  // atol. from rest the error of a step is a fixed fraction of its own
+  // displacement whatever its size, so without atol the first step that
+  // moves the model is taken as it is
+  for (int i=0; i<numSteps; i++) {
+    const double end = theDomain->getCurrentTime() + dT;
+
+    double remaining = dT;
+    while (remaining > 1.0e-12*dT) {
+      h = std::max(dtMin, std::min(h, dtMax));
+
+      // end the interval with the step, or with two steps of the same
+      // size rather than a long one and a sliver
+      double step = h;
+      if (remaining <= 1.000001*h)
+        step = remaining;
+      else if (remaining < 2.0*h)
+        step = 0.5*remaining;
+
+      ops_Dt = step;
+      int result = this->solveStep(step);
+      if (result < 0) {
+        // the domain and integrator have been reverted; try a smaller step
+        if (step <= dtMin*1.000001)
+          return result;
+        h = 0.5*step;
+        continue;
+      }
+
+      double ratio = 0.0;
+      double errorNorm = 0.0, dispNorm = 0.0;
+      if (theTransientIntegrator->getLocalError(errorNorm, dispNorm) == 0) {
+        double scale = std::max(atol, adaptiveNorm);
+        if (scale > 0.0)
+          ratio = errorNorm/(std::max(scale, dispNorm)*tol);
+      }
+
+      if (ratio > 1.0 && step > dtMin*1.000001) {
+        theDomain->revertToLastCommit();
+        theTransientIntegrator->revertToLastStep();
+        h = step*std::max(shrink, safety*cbrt(1.0/ratio));
+        continue;
+      }
+
+      result = this->commitStep();
+      if (result < 0)
+        return result;
+
+      if (dispNorm > adaptiveNorm)
+        adaptiveNorm = dispNorm;
+
+      double factor = ratio > 0.0 ? std::min(grow, safety*cbrt(1.0/ratio)) : grow;
+      // a step cut short by the end of the interval does not limit the next
+      if (step < h && factor > 1.0)
+        h = std::max(h, step*factor);
+      else
+        h = step*factor;
+
+      remaining = end - theDomain->getCurrentTime();
+    }
+  }
+
+  adaptiveDt = std::max(dtMin, std::min(h, dtMax));
+  return 0;
+}
+
 // analyze a transient step
 int
 BasicAnalysisBuilder::analyzeStep(double dT)
+{
+  int result = this->solveStep(dT);
+  if (result < 0)
+    return result;
+
+  return this->commitStep();
+}
+
+// solve for the response at the end of a transient step, which is left
+// uncommitted; if the step fails, the domain and integrator are reverted
+int
+BasicAnalysisBuilder::solveStep(double dT)
 {
   int result = 0;
   if (theAnalysisModel->analysisStep(dT) < 0) {
@@ -467,18 +581,25 @@ BasicAnalysisBuilder::analyzeStep(double dT)
     return -2;
   }
 
-  result = theAlgorithm->solveCurrentStep();
-  if (result < 0) {
-    if (SolveFailedMessage.find(result) != SolveFailedMessage.end()) {
-        opserr << OpenSees::PromptAnalysisFailure << SolveFailedMessage[result];
+  if (!theTransientIntegrator->isMatrixFree()) {
+    result = theAlgorithm->solveCurrentStep();
+    if (result < 0) {
+      if (SolveFailedMessage.find(result) != SolveFailedMessage.end()) {
+          opserr << OpenSees::PromptAnalysisFailure << SolveFailedMessage[result];
+      }
+      theDomain->revertToLastCommit();
+      theTransientIntegrator->revertToLastStep();
+      return -3;
     }
-    theDomain->revertToLastCommit();
-    theTransientIntegrator->revertToLastStep();
-    return -3;
   }
 
+  return result;
+}
 
-  result = theTransientIntegrator->commit();
+int
+BasicAnalysisBuilder::commitStep()
+{
+  int result = theTransientIntegrator->commit();
   if (result < 0) {
     opserr << "DirectIntegrationAnalysis::analyze() - ";
     opserr << "the Integrator failed to commit";
@@ -487,6 +608,7 @@ BasicAnalysisBuilder::analyzeStep(double dT)
     theTransientIntegrator->revertToLastStep();
     return -4;
   }
+  AnalysisProfile::addCount(AnalysisProfile::Steps);
 
   return result;
 }
@@ -610,6 +732,24 @@ BasicAnalysisBuilder::set(ConvergenceTest* obj)
 
 }
 
+void
+BasicAnalysisBuilder::setNumThreads(int n)
+{
+  if (theDomain == nullptr)
+    return;
+
+  // the pool belongs to the Domain; detach the integrators from
+  // the old one before it is replaced
+  if (theStaticIntegrator != nullptr)
+    theStaticIntegrator->setThreadPool(nullptr);
+  if (theTransientIntegrator != nullptr)
+    theTransientIntegrator->setThreadPool(nullptr);
+
+  theDomain->setNumThreads(n);
+
+  this->setLinks(this->CurrentAnalysisFlag);
+}
+
 void
 BasicAnalysisBuilder::set(EigenSOE &theNewSOE)
 {
@@ -742,6 +882,9 @@ BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
         FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
         theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+    } else if (typeSolver == EigenSOE_TAGS_LanczosSOE) {
+        theEigenSOE = new LanczosSOE(shift);
+
     } else {
         theEigenSOE = new ArpackSOE(shift);
     }
@@ -790,11 +933,9 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
 
     result = theHandler->doneNumberingDOF();
 
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
-
-    result = theSOE->setSize(theGraph);
+    result = theSOE->setSize(theAnalysisModel->getDOFCSRGraph());
 
-    result = theEigenSOE->setSize(theGraph);
+    result = theEigenSOE->setSize(theAnalysisModel->getDOFGraph());
 
     theAnalysisModel->clearDOFGraph();
 
@@ -881,6 +1022,12 @@ BasicAnalysisBuilder::getDomain()
   return theDomain;
 }
 
+AnalysisModel*
+BasicAnalysisBuilder::getAnalysisModel()
+{
+  return theAnalysisModel;
+}
+
 EquiSolnAlgo*
 BasicAnalysisBuilder::getAlgorithm()
 {
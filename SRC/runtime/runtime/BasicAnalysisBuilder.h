@@ -61,9 +61,14 @@ public:
     void set(ConvergenceTest* obj);
     void set(EigenSOE& obj);
 
+    // threads shared by the Domain and the integrators for the
+    // element loops; 0 runs them serially
+    void setNumThreads(int numThreads);
+
     LinearSOE* getLinearSOE();
 
     Domain* getDomain();
+    AnalysisModel* getAnalysisModel();
     int initialize();
 
     int  newTransientAnalysis();
@@ -96,6 +101,14 @@ public:
     int analyzeStep(double dT);
     int analyzeSubLevel(int level, double dT);
 
+    // numSteps intervals of dT, each taken in as many steps, between dtMin
+    // and dtMax, as keep the local error estimated by the integrator below
+    // tol times the larger of atol and the largest displacement norm of the
+    // analysis; the last step of each interval ends on it, so that
+    // recorders with -dT record on a fixed grid
+    int analyzeAdaptive(int numSteps, double dT, double tol,
+                        double dtMin, double dtMax, double atol = 0.0);
+
     void wipe();
 
     
@@ -103,6 +116,8 @@ public:
 
 private:
     void setLinks(CurrentAnalysis flag = EMPTY_ANALYSIS);
+    int  solveStep(double dT);
+    int  commitStep();
     void fillDefaults(enum CurrentAnalysis flag);
 
     Domain                    *theDomain;
@@ -123,6 +138,12 @@ private:
     int numSubLevels = 0;
     int numSubSteps  = 0;
 
+    // the step analyzeAdaptive() ended with, and starts the next call with,
+    // and the largest norm of the displacements it has reached since the
+    // last wipe or change of the domain, which its errors are measured against
+    double adaptiveDt   = 0.0;
+    double adaptiveNorm = 0.0;
+
     bool freeSOE = true;
     bool freeTI  = true;
 
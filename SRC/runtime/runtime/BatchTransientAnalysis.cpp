@@ -0,0 +1,479 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// BatchTransientAnalysis.
+//
+#include "BatchTransientAnalysis.h"
+#include "BasicAnalysisBuilder.h"
+
+#include <Domain.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <UniformExcitation.h>
+#include <GroundMotion.h>
+#include <PathSeries.h>
+#include <NodeData.h>
+#include <EnvelopeNodeRecorder.h>
+#include <EnvelopeDriftRecorder.h>
+#include <DummyStream.h>
+#include <TransientIntegrator.h>
+#include <EquiSolnAlgo.h>
+#include <ConvergenceTest.h>
+#include <AsyncStream.h>
+#include <threads/thread_pool.hpp>
+#include <TransformationConstraintHandler.h>
+#include <FEM_ObjectBroker.h>
+#include <ID.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#if !defined(_WIN32)
+#  include <unistd.h>
+#  include <poll.h>
+#  include <sys/wait.h>
+#  include <cerrno>
+#endif
+
+extern Domain *ops_TheActiveDomain;
+extern double  ops_Dt;
+
+BatchTransientAnalysis::BatchTransientAnalysis(Domain &domain, FEM_ObjectBroker &broker)
+:theDomain(domain), theBroker(broker),
+ integratorClass(-1), algorithmClass(-1), testClass(-1),
+ rayleigh(false), alphaM(0.0), betaK(0.0), betaK0(0.0), betaKc(0.0)
+{
+
+}
+
+BatchTransientAnalysis::~BatchTransientAnalysis()
+{
+
+}
+
+int
+BatchTransientAnalysis::setIntegrator(TransientIntegrator &theIntegrator)
+{
+  theIntegratorData.clear();
+  integratorClass = -1;
+  if (theIntegrator.sendSelf(0, theIntegratorData) < 0) {
+    opserr << "BatchTransientAnalysis::setIntegrator() - the integrator could not be copied\n";
+    return -1;
+  }
+  integratorClass = theIntegrator.getClassTag();
+  return 0;
+}
+
+int
+BatchTransientAnalysis::setAlgorithm(EquiSolnAlgo &theAlgorithm)
+{
+  theAlgorithmData.clear();
+  algorithmClass = -1;
+  if (theAlgorithm.sendSelf(0, theAlgorithmData) < 0) {
+    opserr << "BatchTransientAnalysis::setAlgorithm() - the algorithm could not be copied\n";
+    return -1;
+  }
+  algorithmClass = theAlgorithm.getClassTag();
+  return 0;
+}
+
+int
+BatchTransientAnalysis::setConvergenceTest(ConvergenceTest &theTest)
+{
+  theTestData.clear();
+  testClass = -1;
+  if (theTest.sendSelf(0, theTestData) < 0) {
+    opserr << "BatchTransientAnalysis::setConvergenceTest() - the test could not be copied\n";
+    return -1;
+  }
+  testClass = theTest.getClassTag();
+  return 0;
+}
+
+void
+BatchTransientAnalysis::setRayleighDamping(double aM, double bK, double bK0, double bKc)
+{
+  rayleigh = true;
+  alphaM = aM;
+  betaK  = bK;
+  betaK0 = bK0;
+  betaKc = bKc;
+}
+
+int
+BatchTransientAnalysis::addRecord(int dof, const Vector &accel, double dt, double factor)
+{
+  if (dt <= 0.0 || accel.Size() == 0) {
+    opserr << "BatchTransientAnalysis::addRecord() - the record needs values and a time step\n";
+    return -1;
+  }
+  records.push_back(Record{dof, accel, dt, factor});
+  return records.size() - 1;
+}
+
+int
+BatchTransientAnalysis::addNodeEnvelope(int node, int dof, NodeData response)
+{
+  // the recorders take the trial response
+  if (response == NodeData::Disp)
+    response = NodeData::DisplTrial;
+  else if (response == NodeData::Vel)
+    response = NodeData::VelocTrial;
+  else if (response == NodeData::Accel)
+    response = NodeData::AccelTrial;
+
+  edps.push_back(EDP{false, node, 0, dof, 0, response});
+  return edps.size() - 1;
+}
+
+int
+BatchTransientAnalysis::addDriftEnvelope(int iNode, int jNode, int dof, int perpDirn)
+{
+  edps.push_back(EDP{true, iNode, jNode, dof, perpDirn, NodeData::Disp});
+  return edps.size() - 1;
+}
+
+int
+BatchTransientAnalysis::getNumRecords(void) const
+{
+  return records.size();
+}
+
+int
+BatchTransientAnalysis::getNumEDPs(void) const
+{
+  return edps.size();
+}
+
+int
+BatchTransientAnalysis::getStatus(int record) const
+{
+  if (record < 0 || record >= (int)status.size())
+    return -1;
+  return status[record];
+}
+
+double
+BatchTransientAnalysis::getEDP(int record, int edp) const
+{
+  const int numEDP = edps.size();
+  if (record < 0 || record >= (int)status.size() || edp < 0 || edp >= numEDP)
+    return 0.0;
+  return results[record*numEDP + edp];
+}
+
+int
+BatchTransientAnalysis::analyze(double dT, int numWorkers)
+{
+  const int numRecords = records.size();
+  status.assign(numRecords, 0);
+  results.assign(numRecords*edps.size(), 0.0);
+
+  if (dT <= 0.0) {
+    opserr << "BatchTransientAnalysis::analyze() - the time step must be positive\n";
+    return numRecords;
+  }
+
+  theModel.clear();
+  if (theDomain.sendSelf(0, theModel) < 0) {
+    opserr << "BatchTransientAnalysis::analyze() - the domain could not be copied\n";
+    status.assign(numRecords, -1);
+    return numRecords;
+  }
+
+  // the analyses of the copies make them the active domain
+  Domain *activeDomain = ops_TheActiveDomain;
+  double  activeDt     = ops_Dt;
+
+  // a thread that holds a lock when a worker is forked leaves it held there
+  if (numWorkers > 1 && numRecords > 1
+      && (OpenSees::thread_pool::get_live_thread_count() != 0 || AsyncStream::isWriting())) {
+    opserr << "WARNING BatchTransientAnalysis::analyze() - threads are running (a thread pool"
+              " or an asynchronous recorder), so the records are analyzed in this process\n";
+    numWorkers = 1;
+  }
+
+  int numFailed;
+#if !defined(_WIN32)
+  if (numWorkers > 1 && numRecords > 1)
+    numFailed = this->runForked(dT, numWorkers);
+  else
+#endif
+    numFailed = this->runSerial(dT);
+
+  ops_TheActiveDomain = activeDomain;
+  ops_Dt = activeDt;
+
+  theModel.clear();
+  return numFailed;
+}
+
+//
+// Analyzes a copy of the model under one record, writing the EDPs; returns
+// the status of the record.
+//
+int
+BatchTransientAnalysis::runRecord(int i, double dT, double *edpValues)
+{
+  const Record &record = records[i];
+
+  Domain *theCopy = new Domain();
+  theModel.rewind();
+  if (theCopy->recvSelf(0, theModel, theBroker) < 0) {
+    opserr << "BatchTransientAnalysis - the domain could not be copied for record " << i << "\n";
+    delete theCopy;
+    return -1;
+  }
+
+  if (rayleigh)
+    theCopy->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+
+  // the record, starting from the time of the model
+  int patternTag = 0;
+  LoadPattern *thePattern;
+  LoadPatternIter &thePatterns = theCopy->getLoadPatterns();
+  while ((thePattern = thePatterns()) != nullptr)
+    if (thePattern->getTag() >= patternTag)
+      patternTag = thePattern->getTag() + 1;
+
+  const double startTime = theCopy->getCurrentTime();
+  PathSeries *theSeries = new PathSeries(0, record.accel, record.dt, record.factor,
+                                         false, false, startTime);
+  GroundMotion *theMotion = new GroundMotion(nullptr, nullptr, theSeries);
+  UniformExcitation *theExcitation = new UniformExcitation(*theMotion, record.dof, patternTag);
+  if (theCopy->addLoadPattern(theExcitation) == false) {
+    opserr << "BatchTransientAnalysis - record " << i << " could not be added\n";
+    delete theExcitation;
+    delete theCopy;
+    return -1;
+  }
+
+  // the recorders belong to the copy
+  std::vector<Recorder *> theRecorders;
+  for (const EDP &edp : edps) {
+    Recorder *theRecorder;
+    if (edp.drift)
+      theRecorder = new EnvelopeDriftRecorder(edp.iNode, edp.jNode, edp.dof, edp.perpDirn,
+                                              *theCopy, *new DummyStream());
+    else {
+      ID dofs(1), nodes(1);
+      dofs(0)  = edp.dof;
+      nodes(0) = edp.iNode;
+      theRecorder = new EnvelopeNodeRecorder(dofs, &nodes, edp.response, 0,
+                                             *theCopy, *new DummyStream());
+    }
+    theCopy->addRecorder(*theRecorder);
+    theRecorders.push_back(theRecorder);
+  }
+
+  int result = 0;
+  {
+    BasicAnalysisBuilder builder(theCopy);
+
+    if (integratorClass != -1) {
+      TransientIntegrator *theIntegrator = theBroker.getNewTransientIntegrator(integratorClass);
+      theIntegratorData.rewind();
+      if (theIntegrator == nullptr || theIntegrator->recvSelf(0, theIntegratorData, theBroker) < 0) {
+        opserr << "BatchTransientAnalysis - the integrator could not be copied\n";
+        delete theIntegrator;
+        result = -1;
+      } else
+        builder.set(*theIntegrator);
+    }
+
+    if (algorithmClass != -1) {
+      EquiSolnAlgo *theAlgorithm = theBroker.getNewEquiSolnAlgo(algorithmClass);
+      theAlgorithmData.rewind();
+      if (theAlgorithm == nullptr || theAlgorithm->recvSelf(0, theAlgorithmData, theBroker) < 0) {
+        opserr << "BatchTransientAnalysis - the algorithm could not be copied\n";
+        delete theAlgorithm;
+        result = -1;
+      } else
+        builder.set(theAlgorithm);
+    }
+
+    if (testClass != -1) {
+      ConvergenceTest *theTest = theBroker.getNewConvergenceTest(testClass);
+      theTestData.rewind();
+      if (theTest == nullptr || theTest->recvSelf(0, theTestData, theBroker) < 0) {
+        opserr << "BatchTransientAnalysis - the convergence test could not be copied\n";
+        delete theTest;
+        result = -1;
+      } else
+        builder.set(theTest);
+    }
+
+    if (theCopy->getNumMPs() != 0)
+      builder.set(new TransformationConstraintHandler());
+
+    if (result == 0) {
+      builder.setTransientAnalysis();
+
+      const double duration = record.accel.Size()*record.dt;
+      const int numSteps = (int)std::ceil(duration/dT - 1.0e-9);
+      result = builder.analyze(numSteps, dT);
+      if (result > 0)
+        result = 0;
+    }
+  }
+
+  for (int j = 0; j < (int)theRecorders.size(); j++)
+    edpValues[j] = theRecorders[j]->getRecordedValue(0, 0, false);
+
+  delete theCopy;
+  return result;
+}
+
+int
+BatchTransientAnalysis::runSerial(double dT)
+{
+  const int numEDP = edps.size();
+  int numFailed = 0;
+  for (int i = 0; i < (int)records.size(); i++) {
+    status[i] = this->runRecord(i, dT, results.data() + i*numEDP);
+    if (status[i] != 0)
+      numFailed++;
+  }
+  return numFailed;
+}
+
+#if !defined(_WIN32)
+//
+// Each worker writes the status of its record followed by the EDPs to a
+// pipe, which is read as it is written so that a long list of EDPs does
+// not fill it; a worker that ends without writing all of them failed.
+//
+int
+BatchTransientAnalysis::runForked(double dT, int numWorkers)
+{
+  struct Worker {
+    pid_t pid;
+    int   fd;
+    int   record;
+    std::vector<char> data;
+  };
+
+  const int numRecords = records.size();
+  const int numEDP = edps.size();
+  const std::size_t numBytes = (numEDP + 1)*sizeof(double);
+
+  // nothing buffered in this process is to be written again by a worker
+  std::fflush(nullptr);
+  std::cout.flush();
+  std::cerr.flush();
+
+  std::vector<Worker> workers;
+  int numFailed = 0;
+  int next = 0;
+  while (next < numRecords || !workers.empty()) {
+
+    while (next < numRecords && (int)workers.size() < numWorkers) {
+      const int i = next++;
+      int fds[2];
+      pid_t pid = -1;
+      if (pipe(fds) == 0) {
+        pid = fork();
+        if (pid < 0) {
+          close(fds[0]);
+          close(fds[1]);
+        }
+      }
+
+      if (pid == 0) {
+        close(fds[0]);
+        std::vector<double> values(numEDP + 1, 0.0);
+        values[0] = this->runRecord(i, dT, values.data() + 1);
+        const char *bytes = reinterpret_cast<const char *>(values.data());
+        std::size_t written = 0;
+        while (written < numBytes) {
+          ssize_t n = write(fds[1], bytes + written, numBytes - written);
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0)
+            break;
+          written += n;
+        }
+        close(fds[1]);
+        _exit(0);
+      }
+
+      if (pid < 0) {
+        // no more processes; this one analyzes the record itself
+        status[i] = this->runRecord(i, dT, results.data() + i*numEDP);
+        if (status[i] != 0)
+          numFailed++;
+        continue;
+      }
+
+      close(fds[1]);
+      workers.push_back(Worker{pid, fds[0], i, {}});
+    }
+
+    if (workers.empty())
+      continue;
+
+    std::vector<struct pollfd> fds(workers.size());
+    for (std::size_t w = 0; w < workers.size(); w++) {
+      fds[w].fd = workers[w].fd;
+      fds[w].events = POLLIN;
+      fds[w].revents = 0;
+    }
+    if (poll(fds.data(), fds.size(), -1) < 0 && errno != EINTR)
+      break;
+
+    for (int w = workers.size() - 1; w >= 0; w--) {
+      if (fds[w].revents == 0)
+        continue;
+
+      Worker &worker = workers[w];
+      char buffer[4096];
+      ssize_t n = read(worker.fd, buffer, sizeof(buffer));
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n > 0) {
+        worker.data.insert(worker.data.end(), buffer, buffer + n);
+        continue;
+      }
+
+      // the worker is done
+      close(worker.fd);
+      int exitStatus;
+      while (waitpid(worker.pid, &exitStatus, 0) < 0 && errno == EINTR)
+        ;
+
+      const int i = worker.record;
+      if (worker.data.size() == numBytes) {
+        std::vector<double> values(numEDP + 1);
+        std::memcpy(values.data(), worker.data.data(), numBytes);
+        status[i] = (int)values[0];
+        for (int j = 0; j < numEDP; j++)
+          results[i*numEDP + j] = values[j+1];
+      } else {
+        opserr << "BatchTransientAnalysis - the analysis of record " << i << " did not finish\n";
+        status[i] = -1;
+      }
+      if (status[i] != 0)
+        numFailed++;
+
+      workers.erase(workers.begin() + w);
+    }
+  }
+
+  // if poll() failed, what is left is waited for and counted as failed
+  for (Worker &worker : workers) {
+    close(worker.fd);
+    int exitStatus;
+    waitpid(worker.pid, &exitStatus, 0);
+    status[worker.record] = -1;
+    numFailed++;
+  }
+
+  return numFailed;
+}
+#endif
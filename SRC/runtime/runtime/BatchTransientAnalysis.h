@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: BatchTransientAnalysis runs the transient analysis of one
+// model under each of a batch of ground motion records, as for incremental
+// dynamic analysis, without building the model again for each record.
+//
+// The Domain is sent once through a MemoryChannel, in the state it is in
+// when analyze() is invoked (after gravity, say), and a copy of it is
+// received for each record. The record is applied to the copy as a
+// UniformExcitation, and the copy is analyzed by a BasicAnalysisBuilder
+// with copies of the integrator, algorithm and convergence test that were
+// set, until the end of the record. The system of equations is not copied
+// (the broker cannot make most of them): each copy is solved with the
+// default of the BasicAnalysisBuilder, a ProfileSPDLinSOE, or with a
+// TransformationConstraintHandler where the model has MP_Constraints. The engineering demand parameters (EDPs) are the
+// absolute maxima of the responses given to addNodeEnvelope() and
+// addDriftEnvelope(), which are taken from an EnvelopeNodeRecorder or
+// EnvelopeDriftRecorder added to the copy.
+//
+// The records are analyzed numWorkers at a time, each in a process forked
+// for it, which shares the pages of the model with the others until it
+// writes to them. Most elements and materials keep their scratch space in
+// static variables, so the copies cannot be analyzed by threads of one
+// process. With one worker, or where there is no fork(), the records are
+// analyzed one after the other in this process.
+//
+// fork() copies only the calling thread, and a lock held by another
+// thread at that moment stays held in the child. The records are
+// therefore analyzed in this process, with a warning, while the threads
+// of a thread_pool (the pool of the Domain given by "analysis ... -threads
+// n", or the pool of the fiber sections) or the writer of an AsyncStream
+// are running. Other threads of the program (of an embedding interpreter,
+// say) cannot be seen here, and must not hold locks the workers need.
+//
+#ifndef BatchTransientAnalysis_h
+#define BatchTransientAnalysis_h
+
+#include <vector>
+#include <Vector.h>
+#include <MemoryChannel.h>
+
+class Domain;
+class TransientIntegrator;
+class EquiSolnAlgo;
+class ConvergenceTest;
+class FEM_ObjectBroker;
+enum class NodeData : int;
+
+class BatchTransientAnalysis
+{
+  public:
+    BatchTransientAnalysis(Domain &theDomain, FEM_ObjectBroker &theBroker);
+    ~BatchTransientAnalysis();
+
+    // the analysis of each record is given a copy of these; if they are
+    // not set, it uses the defaults of the BasicAnalysisBuilder
+    int  setIntegrator(TransientIntegrator &theIntegrator);
+    int  setAlgorithm(EquiSolnAlgo &theAlgorithm);
+    int  setConvergenceTest(ConvergenceTest &theTest);
+    void setRayleighDamping(double alphaM, double betaK, double betaK0, double betaKc);
+
+    // a record of ground accelerations at the interval dt, scaled by
+    // factor, in the direction dof (from 0); returns the index of the record
+    int addRecord(int dof, const Vector &accel, double dt, double factor = 1.0);
+
+    // the absolute maximum of the response of a node at dof, or of the drift
+    // between two nodes; returns the index of the EDP
+    int addNodeEnvelope(int node, int dof, NodeData response);
+    int addDriftEnvelope(int iNode, int jNode, int dof, int perpDirn);
+
+    // analyzes each record with steps of dT until its end; returns the
+    // number of records whose analysis failed
+    int analyze(double dT, int numWorkers = 1);
+
+    int    getNumRecords(void) const;
+    int    getNumEDPs(void) const;
+
+    // 0 if the analysis of the record reached its end, or the negative
+    // value returned by the analysis that failed
+    int    getStatus(int record) const;
+
+    // the EDP over the analysis of the record, up to a failure
+    double getEDP(int record, int edp) const;
+
+  private:
+    struct Record {
+      int    dof;
+      Vector accel;
+      double dt;
+      double factor;
+    };
+
+    struct EDP {
+      bool     drift;
+      int      iNode;
+      int      jNode;
+      int      dof;
+      int      perpDirn;
+      NodeData response;
+    };
+
+    int runRecord(int record, double dT, double *edps);
+    int runSerial(double dT);
+    int runForked(double dT, int numWorkers);
+
+    Domain           &theDomain;
+    FEM_ObjectBroker &theBroker;
+
+    std::vector<Record> records;
+    std::vector<EDP>    edps;
+
+    // the model, integrator, algorithm and test as sent through a MemoryChannel
+    MemoryChannel theModel;
+    MemoryChannel theIntegratorData;
+    MemoryChannel theAlgorithmData;
+    MemoryChannel theTestData;
+    int integratorClass;
+    int algorithmClass;
+    int testClass;
+
+    bool   rayleigh;
+    double alphaM, betaK, betaK0, betaKc;
+
+    std::vector<int>    status;
+    std::vector<double> results;
+};
+
+#endif
@@ -21,10 +21,12 @@
 #include <Hash.h>
 using namespace OpenSees::Hash;
 using namespace OpenSees::Hash::literals;
-#define DISPATCH(symbol) case  hasher<std::string>()(#symbol): return new symbol();
 //
-// case hasher<std::string>()(Truss::class_name):  return new Truss();
+// Elements are sent with the class tags of classTags.h, so they are
+// dispatched on ELE_TAG_<class>, not on a hash of the class name
+// (case hasher<std::string>()(Truss::class_name): return new Truss();)
 //
+#define DISPATCH(symbol) case ELE_TAG_##symbol: return new symbol();
 #include "packages.h"
 #include <TclPackageClassBroker.h>
 
@@ -454,6 +456,7 @@ using namespace OpenSees::Hash::literals;
 #include "HHTHSIncrReduct_TP.h"
 #include "KRAlphaExplicit.h"
 #include "KRAlphaExplicit_TP.h"
+#include "LumpedCentralDifference.h"
 #include "Newmark.h"
 // #include "StagedNewmark.h"
 #include "NewmarkExplicit.h"
@@ -509,6 +512,7 @@ using namespace OpenSees::Hash::literals;
 #include "TrapezoidalTimeSeriesIntegrator.h"
 
 #include "eigenSOE/ArpackSOE.h"
+#include "eigenSOE/LanczosSOE.h"
 
 #ifdef _PETSC
 #  include "PetscSOE.h"
@@ -649,7 +653,8 @@ TclPackageClassBroker::getNewElement(int classTag)
     DISPATCH(EightNodeQuad);
     DISPATCH(ConstantPressureVolumeQuad);
     DISPATCH(BBarFourNodeQuadUP);
-    DISPATCH(NineFourNodeQuadUP);
+  case ELE_TAG_Nine_Four_Node_QuadUP:
+    return new NineFourNodeQuadUP();
 
 #if defined(OPSDEF_Elements_UW)
     DISPATCH(SSPquad);
@@ -669,7 +674,8 @@ TclPackageClassBroker::getNewElement(int classTag)
     DISPATCH(BbarBrick);
     DISPATCH(BBarBrickUP);
     DISPATCH(BrickUP);
-    DISPATCH(TwentyEightNodeBrickUP);
+  case ELE_TAG_Twenty_Eight_Node_BrickUP:
+    return new TwentyEightNodeBrickUP();
 
 // Shells
     DISPATCH(ShellMITC4);
@@ -1940,6 +1946,9 @@ TclPackageClassBroker::getNewTransientIntegrator(int classTag)
   case INTEGRATOR_TAGS_KRAlphaExplicit_TP:
     return new KRAlphaExplicit_TP();
 
+  case INTEGRATOR_TAGS_LumpedCentralDifference:
+    return new LumpedCentralDifference(); // must recvSelf
+
   case INTEGRATOR_TAGS_Newmark:
     return new Newmark();
 #if 0
@@ -2075,6 +2084,10 @@ TclPackageClassBroker::getNewEigenSOE(int classTagSOE)
     theSOE = new ArpackSOE();
     return theSOE;
 
+  case EigenSOE_TAGS_LanczosSOE:
+    theSOE = new LanczosSOE();
+    return theSOE;
+
   default:
     opserr << "TclPackageClassBroker::getNewEigenSOE - ";
     opserr << " - no EigenSOE type exists for class tag ";
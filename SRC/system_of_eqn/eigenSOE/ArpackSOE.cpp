@@ -53,6 +53,15 @@ ArpackSOE::ArpackSOE(double s)
 }
 
 
+ArpackSOE::ArpackSOE(EigenSolver &theSolvr, int classTag, double s)
+:EigenSOE(theSolvr, classTag),
+ M(0), Msize(0), mDiagonal(false), shift(s), theModel(0), theSOE(0),
+ processID(-1), numChannels(0), theChannels(0), localCol(0), sizeLocal(0)
+{
+
+}
+
+
 int
 ArpackSOE::getNumEqn(void) const
 {
@@ -63,10 +63,13 @@ class ArpackSOE : public EigenSOE
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
     friend class ArpackSolver;
+    friend class LanczosSolver;
 
 	int checkSameInt(int);
 
   protected:
+    // for the subclasses that use another solver on the same system
+    ArpackSOE(EigenSolver &theSolver, int classTag, double shift);
     
   private:
     double *M;
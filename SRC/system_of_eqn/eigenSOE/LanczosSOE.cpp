@@ -0,0 +1,18 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of LanczosSOE.
+//
+#include <LanczosSOE.h>
+#include <LanczosSolver.h>
+#include <classTags.h>
+
+LanczosSOE::LanczosSOE(double shift)
+:ArpackSOE(*(new LanczosSolver()), EigenSOE_TAGS_LanczosSOE, shift)
+{
+  LanczosSolver *theSolvr = static_cast<LanczosSolver *>(this->getSolver());
+  theSolvr->setEigenSOE(*this);
+}
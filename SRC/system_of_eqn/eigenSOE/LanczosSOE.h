@@ -0,0 +1,22 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: LanczosSOE is the ArpackSOE solved by a LanczosSolver
+// instead of ARPACK; K - shift M is assembled in the LinearSOE of the
+// analysis in the same way.
+//
+#ifndef LanczosSOE_h
+#define LanczosSOE_h
+
+#include <ArpackSOE.h>
+
+class LanczosSOE : public ArpackSOE
+{
+  public:
+    LanczosSOE(double shift = 0.0);
+};
+
+#endif
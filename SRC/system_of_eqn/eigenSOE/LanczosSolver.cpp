@@ -0,0 +1,510 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of LanczosSolver.
+//
+#include <LanczosSolver.h>
+#include <ArpackSOE.h>
+#include <LinearSOE.h>
+#include <AnalysisModel.h>
+#include <DOF_GrpIter.h>
+#include <DOF_Group.h>
+#include <FE_EleIter.h>
+#include <FE_Element.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <classTags.h>
+#include <math.h>
+#include <algorithm>
+#include <random>
+
+#ifdef _WIN32
+extern "C" int DSYEV(char *jobz, char *uplo, int *n, double *a, int *lda,
+                     double *w, double *work, int *lwork, int *info);
+#else
+extern "C" int dsyev_(char *jobz, char *uplo, int *n, double *a, int *lda,
+                      double *w, double *work, int *lwork, int *info);
+#endif
+
+namespace {
+  // convergence tolerance on the residual of a Ritz pair of the operator,
+  // relative to its Ritz value, and the number of basis extensions allowed
+  constexpr double tol = 1.0e-8;
+  constexpr int maxIter = 1000;
+
+  double dot(const double *x, const double *y, int n)
+  {
+    double sum = 0.0;
+    for (int i = 0; i < n; i++)
+      sum += x[i]*y[i];
+    return sum;
+  }
+
+  void axpy(double a, const double *x, double *y, int n)
+  {
+    for (int i = 0; i < n; i++)
+      y[i] += a*x[i];
+  }
+}
+
+LanczosSolver::LanczosSolver()
+:EigenSolver(EigenSOLVER_TAGS_LanczosSolver),
+ theArpackSOE(0), theSOE(0), size(0), numMode(0), haveModes(false),
+ maxBasis(0), numBasis(0)
+{
+
+}
+
+
+LanczosSolver::~LanczosSolver()
+{
+
+}
+
+
+int
+LanczosSolver::solve(int numModes, bool generalized, bool findSmallest)
+{
+  if (generalized == false || findSmallest == false) {
+    opserr << "LanczosSolver::solve() - only solves the generalized problem for the modes nearest the shift\n";
+    return -1;
+  }
+
+  theSOE = theArpackSOE->theSOE;
+  if (theSOE == nullptr) {
+    opserr << "LanczosSolver::solve() - no LinearSOE set\n";
+    return -1;
+  }
+
+  if (theArpackSOE->processID != -1) {
+    opserr << "LanczosSolver::solve() - does not solve a distributed system\n";
+    return -1;
+  }
+
+  const int n = size;
+  const int nev = numModes;
+  if (nev <= 0 || nev > n) {
+    opserr << "LanczosSolver::solve() - number of modes " << nev
+           << " is not between 1 and the number of equations " << n << endln;
+    return -1;
+  }
+
+  // room for a few blocks of the size of the number of modes; a third of
+  // what is not needed for the modes is kept on a restart
+  maxBasis = std::min(n, std::max(4*nev, nev + 20));
+  const int maxKeep = nev + (maxBasis - nev)/3;
+  V.assign(std::size_t(n)*maxBasis, 0.0);
+  MV.assign(std::size_t(n)*maxBasis, 0.0);
+  W.assign(std::size_t(n)*maxBasis, 0.0);
+  H.assign(std::size_t(maxBasis)*maxBasis, 0.0);
+  numBasis = 0;
+
+  //
+  // the first block is the modes of the last solve; the vectors that are
+  // missing are random vectors to which the operator is applied, so that
+  // they have no components a massless dof could not have in a mode
+  //
+  std::vector<double> X(std::size_t(n)*nev);
+  const int numStart = this->getStartVectors(X.data(), nev);
+  this->addToBasis(X.data(), numStart);
+
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  std::vector<double> x(n), r(n), Mr(n);
+  for (int attempt = 0; numBasis < nev && attempt < 2*nev; attempt++) {
+    for (int i = 0; i < n; i++)
+      x[i] = uniform(generator);
+    this->multiplyM(x.data(), Mr.data());
+    Vector b(Mr.data(), n);
+    theSOE->setB(b);
+    if (theSOE->solve() < 0) {
+      opserr << "LanczosSolver::solve() - the LinearSOE failed in solve()\n";
+      return -1;
+    }
+    const Vector &u = theSOE->getX();
+    for (int i = 0; i < n; i++)
+      x[i] = u(i);
+    this->addToBasis(x.data(), 1);
+  }
+
+  if (numBasis < nev) {
+    opserr << "LanczosSolver::solve() - could not find " << nev
+           << " M-orthogonal starting vectors, M may have too few nonzero entries\n";
+    return -1;
+  }
+
+  int first = 0;
+  int numRitz = 0;
+  std::vector<double> theta(maxBasis), lastTheta(maxBasis);
+  std::vector<double> Y(std::size_t(maxBasis)*maxBasis);
+  std::vector<int> order(maxBasis);
+  std::vector<int> unconverged;
+  int lwork = 3*maxBasis;
+  std::vector<double> work(lwork);
+
+  int iter = 0;
+  for ( ; iter < maxIter; iter++) {
+
+    // apply the operator to the vectors added to the basis
+    for (int j = first; j < numBasis; j++) {
+      if (this->applyOperator(j) < 0) {
+        opserr << "LanczosSolver::solve() - the LinearSOE failed in solve()\n";
+        return -1;
+      }
+    }
+
+    //
+    // Rayleigh-Ritz; the wanted Ritz values of the operator are those
+    // largest in magnitude, as they are those of the modes nearest the shift
+    //
+    int k = numRitz = numBasis;
+    for (int j = 0; j < k; j++)
+      for (int i = 0; i < k; i++)
+        Y[std::size_t(j)*k + i] = H[std::size_t(j)*maxBasis + i];
+
+    char jobz = 'V';
+    char uplo = 'U';
+    int info = 0;
+#ifdef _WIN32
+    DSYEV(&jobz, &uplo, &k, Y.data(), &k, theta.data(), work.data(), &lwork, &info);
+#else
+    dsyev_(&jobz, &uplo, &k, Y.data(), &k, theta.data(), work.data(), &lwork, &info);
+#endif
+    if (info != 0) {
+      opserr << "LanczosSolver::solve() - LAPACK dsyev failed with info " << info << endln;
+      return -1;
+    }
+
+    for (int i = 0; i < k; i++)
+      order[i] = i;
+    std::sort(order.begin(), order.begin() + k,
+              [&theta](int a, int b) {return fabs(theta[a]) > fabs(theta[b]);});
+
+    //
+    // the residual of a Ritz pair (theta, V y) is W y - theta V y; it is
+    // measured in the norm of M, the basis being M-orthonormal
+    //
+    unconverged.clear();
+    for (int a = 0; a < nev; a++) {
+      const double *y = &Y[std::size_t(order[a])*k];
+      std::fill(r.begin(), r.end(), 0.0);
+      for (int i = 0; i < k; i++) {
+        axpy(y[i], &W[std::size_t(i)*n], r.data(), n);
+        axpy(-theta[order[a]]*y[i], &V[std::size_t(i)*n], r.data(), n);
+      }
+      this->multiplyM(r.data(), Mr.data());
+      if (sqrt(fabs(dot(r.data(), Mr.data(), n))) > tol*fabs(theta[order[a]]))
+        unconverged.push_back(a);
+    }
+
+    if (unconverged.empty())
+      break;
+
+    //
+    // the next block is the operator applied to the last block, as in
+    // block Lanczos, until the basis is full; it is then restarted with
+    // the best Ritz vectors, and the next block is the operator applied
+    // to those of the modes that have not converged
+    //
+    const int numLast = numBasis - first;
+    int numNext = numLast;
+    X.assign(std::size_t(n)*std::max(numLast, (int)unconverged.size()), 0.0);
+
+    if (numBasis + numLast > maxBasis) {
+      const int numKeep = std::min(k, maxKeep);
+      std::vector<double> Z(std::size_t(n)*numKeep);
+      for (std::vector<double> *B : {&V, &MV, &W}) {
+        std::fill(Z.begin(), Z.end(), 0.0);
+        for (int a = 0; a < numKeep; a++) {
+          const double *y = &Y[std::size_t(order[a])*k];
+          for (int i = 0; i < k; i++)
+            axpy(y[i], &(*B)[std::size_t(i)*n], &Z[std::size_t(a)*n], n);
+        }
+        std::copy(Z.begin(), Z.end(), B->begin());
+      }
+
+      // the Ritz vectors are now the basis, and H is diagonal
+      for (int a = 0; a < numKeep; a++)
+        lastTheta[a] = theta[order[a]];
+      std::fill(H.begin(), H.end(), 0.0);
+      std::fill(Y.begin(), Y.begin() + std::size_t(numKeep)*numKeep, 0.0);
+      for (int a = 0; a < numKeep; a++) {
+        theta[a] = lastTheta[a];
+        order[a] = a;
+        H[std::size_t(a)*maxBasis + a] = theta[a];
+        Y[std::size_t(a)*numKeep + a] = 1.0;
+      }
+      numRitz = numBasis = numKeep;
+
+      numNext = std::min((int)unconverged.size(), maxBasis - numBasis);
+      for (int b = 0; b < numNext; b++) {
+        const double *w = &W[std::size_t(unconverged[b])*n];
+        std::copy(w, w + n, &X[std::size_t(b)*n]);
+      }
+
+    } else {
+      std::copy(W.begin() + std::size_t(first)*n, W.begin() + std::size_t(numBasis)*n, X.begin());
+    }
+
+    first = numBasis;
+    if (this->addToBasis(X.data(), numNext) == 0)
+      // the basis is an invariant subspace of the operator
+      break;
+  }
+
+  if (!unconverged.empty()) {
+    if (iter == maxIter)
+      opserr << "LanczosSolver::solve() - maximum number of iterations reached";
+    else
+      opserr << "LanczosSolver::solve() - the basis stopped growing";
+    opserr << " with " << (int)unconverged.size() << " of " << nev
+           << " modes not converged\n";
+    std::vector<double>().swap(V);
+    std::vector<double>().swap(MV);
+    std::vector<double>().swap(W);
+    return -2;
+  }
+
+  //
+  // the eigenvalues of the wanted Ritz pairs in ascending order, and their
+  // eigenvectors W y / theta, which unlike V y have no part M does not see;
+  // they are M-normalized
+  //
+  const int k = numRitz;
+  const double shift = theArpackSOE->getShift();
+  std::sort(order.begin(), order.begin() + nev,
+            [&theta](int a, int b) {return 1.0/theta[a] < 1.0/theta[b];});
+
+  eigenvalues.resize(nev);
+  eigenvectors.assign(std::size_t(n)*nev, 0.0);
+  for (int a = 0; a < nev; a++) {
+    eigenvalues[a] = shift + 1.0/theta[order[a]];
+    const double *y = &Y[std::size_t(order[a])*k];
+    double *phi = &eigenvectors[std::size_t(a)*n];
+    for (int i = 0; i < k; i++)
+      axpy(y[i], &W[std::size_t(i)*n], phi, n);
+    this->multiplyM(phi, Mr.data());
+    const double norm = sqrt(fabs(dot(phi, Mr.data(), n)));
+    if (norm > 0.0)
+      for (int i = 0; i < n; i++)
+        phi[i] /= norm;
+  }
+
+  // the basis is only needed during the solve
+  std::vector<double>().swap(V);
+  std::vector<double>().swap(MV);
+  std::vector<double>().swap(W);
+
+  numMode = nev;
+  haveModes = true;
+  return 0;
+}
+
+
+//
+// Fill the first columns of X with the modes the nodes hold from the last
+// solve; returns the number of columns filled.
+//
+int
+LanczosSolver::getStartVectors(double *X, int numVectors)
+{
+  if (haveModes == false)
+    return 0;
+
+  const int n = size;
+  const int numStart = std::min(numMode, numVectors);
+  std::fill(X, X + std::size_t(n)*numStart, 0.0);
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theArpackSOE->theModel->getDOFs();
+  while ((dofPtr = theDofs()) != 0) {
+    const ID &id = dofPtr->getID();
+    bool isFree = false;
+    for (int i = 0; i < id.Size(); i++)
+      if (id(i) >= 0 && id(i) < n)
+        isFree = true;
+    if (isFree == false)
+      continue;
+
+    const Matrix &modes = dofPtr->getEigenvectors();
+    const int numRows = std::min(id.Size(), modes.noRows());
+    const int numCols = std::min(numStart, modes.noCols());
+    for (int j = 0; j < numCols; j++)
+      for (int i = 0; i < numRows; i++)
+        if (id(i) >= 0 && id(i) < n)
+          X[std::size_t(j)*n + id(i)] = modes(i, j);
+  }
+
+  return numStart;
+}
+
+
+//
+// M-orthonormalize the columns of X against the basis and each other, by
+// classical Gram-Schmidt done twice, and add those that are not dependent
+// on it to the basis; returns the number added.
+//
+int
+LanczosSolver::addToBasis(double *X, int numVectors)
+{
+  const int n = size;
+  const int numBefore = numBasis;
+  std::vector<double> c(maxBasis);
+
+  for (int j = 0; j < numVectors && numBasis < maxBasis; j++) {
+    double *x = &X[std::size_t(j)*n];
+    double *Mx = &MV[std::size_t(numBasis)*n];
+    this->multiplyM(x, Mx);
+    const double norm0 = sqrt(fabs(dot(x, Mx, n)));
+    if (norm0 == 0.0)
+      continue;
+
+    for (int pass = 0; pass < 2; pass++) {
+      for (int i = 0; i < numBasis; i++)
+        c[i] = dot(&MV[std::size_t(i)*n], x, n);
+      for (int i = 0; i < numBasis; i++)
+        axpy(-c[i], &V[std::size_t(i)*n], x, n);
+    }
+    // M x is formed again rather than updated along with x, as it loses
+    // the accuracy x keeps when x is nearly dependent on the basis
+    this->multiplyM(x, Mx);
+
+    const double norm = sqrt(fabs(dot(x, Mx, n)));
+    if (norm <= 1.0e-8*norm0)
+      continue;
+
+    double *v = &V[std::size_t(numBasis)*n];
+    for (int i = 0; i < n; i++) {
+      v[i] = x[i]/norm;
+      Mx[i] /= norm;
+    }
+    numBasis++;
+  }
+
+  return numBasis - numBefore;
+}
+
+
+//
+// Set column col of W to (K - shift M)^-1 M times column col of the basis,
+// and the entries of H in that column and row.
+//
+int
+LanczosSolver::applyOperator(int col)
+{
+  const int n = size;
+  Vector b(&MV[std::size_t(col)*n], n);
+  theSOE->setB(b);
+  if (theSOE->solve() < 0)
+    return -1;
+
+  const Vector &u = theSOE->getX();
+  double *w = &W[std::size_t(col)*n];
+  for (int i = 0; i < n; i++)
+    w[i] = u(i);
+
+  for (int i = 0; i <= col; i++) {
+    double h = dot(&MV[std::size_t(i)*n], w, n);
+    H[std::size_t(col)*maxBasis + i] = h;
+    H[std::size_t(i)*maxBasis + col] = h;
+  }
+
+  return 0;
+}
+
+
+void
+LanczosSolver::multiplyM(double *x, double *y)
+{
+  const int n = size;
+
+  if (theArpackSOE->mDiagonal == true) {
+    const double *M = theArpackSOE->M;
+    for (int i = 0; i < n; i++)
+      y[i] = M[i]*x[i];
+    return;
+  }
+
+  Vector X(x, n);
+  Vector Y(y, n);
+  Y.Zero();
+
+  AnalysisModel *theModel = theArpackSOE->theModel;
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel->getFEs();
+  while ((elePtr = theEles()) != 0)
+    Y.Assemble(elePtr->getM_Force(X, 1.0), elePtr->getID(), 1.0);
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theModel->getDOFs();
+  while ((dofPtr = theDofs()) != 0)
+    Y.Assemble(dofPtr->getM_Force(X, 1.0), dofPtr->getID(), 1.0);
+}
+
+
+int
+LanczosSolver::setEigenSOE(ArpackSOE &theSOE)
+{
+  theArpackSOE = &theSOE;
+  return 0;
+}
+
+
+const Vector &
+LanczosSolver::getEigenvector(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "LanczosSolver::getEigenvector() - mode " << mode << " is out of range (1 - " << numMode << ")\n";
+    theVector.resize(size);
+    theVector.Zero();
+    return theVector;
+  }
+
+  theVector.setData(&eigenvectors[std::size_t(mode-1)*size], size);
+  return theVector;
+}
+
+
+double
+LanczosSolver::getEigenvalue(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "LanczosSolver::getEigenvalue() - mode " << mode << " is out of range (1 - " << numMode << ")\n";
+    return -1;
+  }
+
+  return eigenvalues[mode-1];
+}
+
+
+int
+LanczosSolver::setSize()
+{
+  // the modes at the nodes no longer fit a system of another size
+  if (theArpackSOE->Msize != size) {
+    size = theArpackSOE->Msize;
+    haveModes = false;
+    numMode = 0;
+  }
+
+  return 0;
+}
+
+
+int
+LanczosSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+LanczosSolver::recvSelf(int commitTag, Channel &theChannel,
+                        FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: LanczosSolver is a shift-invert block Lanczos solver for the
+// generalized problem K x = lambda M x that works on the ArpackSOE. Like
+// the ArpackSolver, it applies (K - shift M)^-1 with the solve() of the
+// LinearSOE of the analysis, so that each application after the first is
+// a solve with the factorization of K - shift M.
+//
+// The basis is M-orthonormal and extended a block at a time, with a
+// Rayleigh-Ritz step after each; when it is full, it is restarted with the
+// Ritz vectors that approximate the wanted modes best (thick restart). The
+// first block is the eigenvectors of the last solve, as stored at the
+// nodes, so that a solve after a small change of K, such as those made to
+// track the periods during a nonlinear analysis, converges in a few solves.
+//
+#ifndef LanczosSolver_h
+#define LanczosSolver_h
+
+#include <EigenSolver.h>
+#include <vector>
+
+class ArpackSOE;
+class LinearSOE;
+
+class LanczosSolver : public EigenSolver
+{
+  public:
+    LanczosSolver();
+    ~LanczosSolver();
+
+    int solve(int numModes, bool generalized, bool findSmallest = true);
+    int setSize();
+    int setEigenSOE(ArpackSOE &theSOE);
+
+    const Vector &getEigenvector(int mode);
+    double getEigenvalue(int mode);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+                 FEM_ObjectBroker &theBroker);
+
+  private:
+    int  getStartVectors(double *X, int numVectors);
+    int  addToBasis(double *X, int numVectors);
+    int  applyOperator(int col);
+    void multiplyM(double *x, double *y);
+
+    ArpackSOE *theArpackSOE;
+    LinearSOE *theSOE;
+    int size;
+    int numMode;
+    bool haveModes;                  // whether the nodes hold modes of this size
+    std::vector<double> eigenvalues;
+    std::vector<double> eigenvectors;
+    Vector theVector;
+
+    int maxBasis;                    // number of vectors in a full basis
+    int numBasis;
+    std::vector<double> V;           // the basis
+    std::vector<double> MV;          // M times the basis
+    std::vector<double> W;           // (K - shift M)^-1 M times the basis
+    std::vector<double> H;           // V^T M W, maxBasis x maxBasis
+};
+
+#endif
@@ -32,15 +32,23 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<Vector.h>
+#include<FE_Element.h>
+#include<Graph.h>
+#include<CSRGraph.h>
+#include<math.h>
+#include<AnalysisProfile.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
-    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
+    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver),
+     keepNorms(false), normsValid(0), productXB(0.0), numSymbolicSeen(0)
 {
 
 }
 
 LinearSOE::LinearSOE(int classtag)
-:MovableObject(classtag), theModel(0), theSolver(0)
+:MovableObject(classtag), theModel(0), theSolver(0),
+ keepNorms(false), normsValid(0), productXB(0.0), numSymbolicSeen(0)
 {
 
 }
@@ -55,10 +63,65 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
-  if (theSolver != 0)
-    return (theSolver->solve());
-  else 
+  normsValid = 0;
+  if (theSolver == 0)
+    return -1;
+
+  // the symbolic factorizations are done by setSize(), so they are those
+  // made since the last solve
+  const int numNumeric = theSolver->getNumNumericFactor();
+  int result;
+  {
+    AnalysisProfile::Scope scope(AnalysisProfile::Solve);
+    result = theSolver->solve();
+  }
+  if (AnalysisProfile::isEnabled()) {
+    AnalysisProfile::addCount(AnalysisProfile::SymbolicFactor, theSolver->getNumSymbolicFactor() - numSymbolicSeen);
+    AnalysisProfile::addCount(AnalysisProfile::NumericFactor,  theSolver->getNumNumericFactor() - numNumeric);
+  }
+  numSymbolicSeen = theSolver->getNumSymbolicFactor();
+  return result;
+}
+
+int
+LinearSOE::solveBlock(int numRHS, double *X)
+{
+  if (theSolver == 0)
     return -1;
+
+  const int n = this->getNumEqn();
+
+  if (!theSolver->canSolveBlock()) {
+    for (int k = 0; k < numRHS; k++) {
+      Vector col(X + (size_t)k*n, n);
+      this->setB(col);
+      int result = this->solve();
+      if (result < 0)
+        return result;
+      col = this->getX();
+    }
+    return 0;
+  }
+
+  const int numNumeric = theSolver->getNumNumericFactor();
+  int result;
+  {
+    AnalysisProfile::Scope scope(AnalysisProfile::Solve);
+    result = theSolver->solveBlock(numRHS, X);
+  }
+  if (AnalysisProfile::isEnabled()) {
+    AnalysisProfile::addCount(AnalysisProfile::SymbolicFactor, theSolver->getNumSymbolicFactor() - numSymbolicSeen);
+    AnalysisProfile::addCount(AnalysisProfile::NumericFactor,  theSolver->getNumNumericFactor() - numNumeric);
+  }
+  numSymbolicSeen = theSolver->getNumSymbolicFactor();
+  return result;
+}
+
+int
+LinearSOE::setSize(const CSRGraph &theGraph)
+{
+  Graph theVertices(theGraph);
+  return this->setSize(theVertices);
 }
 
 int
@@ -82,6 +145,7 @@ int
 LinearSOE::setSolver(LinearSOESolver &newSolver)
 {
     theSolver = &newSolver;
+    numSymbolicSeen = newSolver.getNumSymbolicFactor();
     return 0;
 }
 
@@ -104,7 +168,118 @@ LinearSOE::addA(const Matrix &) {
   return -1;
 }
 
+int
+LinearSOE::addA(const Matrix &m, const FE_Element &theEle, double fact) {
+  return this->addA(m, theEle.getID(), fact);
+}
+
 int
 LinearSOE::addColA(const Vector &col, int colIndex, double fact) {
   return -1;
 }
+
+void
+LinearSOE::setKeepNorms(bool keep)
+{
+  keepNorms  = keep;
+  normsValid = 0;
+}
+
+//
+// The max, 1 and 2-norms of a vector are gathered in one pass; the sums
+// are formed in the same order as in Vector::pNorm, so the max and 1-norms
+// match it, but the 2-norm squares and roots with multiply and sqrt rather
+// than pow, and may differ from it in the last bit.
+//
+static void
+vectorNorms(const Vector &v, double norms[3])
+{
+  const int n = v.Size();
+  double max = 0.0, sum = 0.0, sumSq = 0.0;
+  for (int i=0; i<n; i++) {
+    double data = fabs(v(i));
+    max    = (data>max) ? data : max;
+    sum   += data;
+    sumSq += data*data;
+  }
+  norms[0] = max;
+  norms[1] = sum;
+  norms[2] = sqrt(sumSq);
+}
+
+double
+LinearSOE::getNormB(int nType)
+{
+  if (nType > 2)
+    return this->getB().pNorm(nType);
+
+  if (!keepNorms || !(normsValid & NormsB)) {
+    vectorNorms(this->getB(), normB);
+    if (keepNorms)
+      normsValid |= NormsB;
+  }
+  return normB[nType > 0 ? nType : 0];
+}
+
+double
+LinearSOE::getNormX(int nType)
+{
+  if (nType > 2)
+    return this->getX().pNorm(nType);
+
+  if (!keepNorms || !(normsValid & NormsX)) {
+    vectorNorms(this->getX(), normX);
+    if (keepNorms)
+      normsValid |= NormsX;
+  }
+  return normX[nType > 0 ? nType : 0];
+}
+
+//
+// The product X^B reads both vectors, so the norms of whichever of them
+// are out of date are formed in the same pass.
+//
+double
+LinearSOE::getProductXB(void)
+{
+  if (keepNorms && (normsValid & NormsXB))
+    return productXB;
+
+  const Vector &x = this->getX();
+  const Vector &b = this->getB();
+  const bool formX = !keepNorms || !(normsValid & NormsX);
+  const bool formB = !keepNorms || !(normsValid & NormsB);
+  const int n = x.Size();
+
+  double maxX = 0.0, sumX = 0.0, sumSqX = 0.0;
+  double maxB = 0.0, sumB = 0.0, sumSqB = 0.0;
+  double product = 0.0;
+  for (int i=0; i<n; i++) {
+    const double xi = x(i), bi = b(i);
+    product += xi*bi;
+    if (formX) {
+      double data = fabs(xi);
+      maxX    = (data>maxX) ? data : maxX;
+      sumX   += data;
+      sumSqX += data*data;
+    }
+    if (formB) {
+      double data = fabs(bi);
+      maxB    = (data>maxB) ? data : maxB;
+      sumB   += data;
+      sumSqB += data*data;
+    }
+  }
+
+  productXB = product;
+  if (formX) {
+    normX[0] = maxX; normX[1] = sumX; normX[2] = sqrt(sumSqX);
+  }
+  if (formB) {
+    normB[0] = maxB; normB[1] = sumB; normB[2] = sqrt(sumSqB);
+  }
+  if (keepNorms)
+    normsValid |= NormsB|NormsX|NormsXB;
+
+  return productXB;
+}
@@ -35,12 +35,15 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <MovableObject.h>
+#include <atomic>
 
 class LinearSOESolver;
 class Graph;
+class CSRGraph;
 class Matrix;
 class Vector;
 class ID;
+class FE_Element;
 class AnalysisModel;
 
 class LinearSOE : public MovableObject
@@ -51,10 +54,18 @@ class LinearSOE : public MovableObject
     virtual ~LinearSOE();
 
     virtual int solve(void);    
+    // solves A X = B for the numRHS columns of B stored in X, overwriting
+    // them with the solutions; see LinearSOESolver::solveBlock(). When the
+    // solver has no block solve the columns are solved one at a time with
+    // solve(), which leaves B and X with the last of them.
+            int solveBlock(int numRHS, double *X);
     virtual int setLinks(AnalysisModel &theModel);    
 
     // pure virtual functions
     virtual int setSize(Graph &theGraph) =0;    
+    // sizes the system from the compressed graph of the equations; by
+    // default it is converted to a Graph for setSize(Graph &)
+    virtual int setSize(const CSRGraph &theGraph);
     virtual int getNumEqn(void) const =0;
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0) =0;
@@ -62,6 +73,10 @@ class LinearSOE : public MovableObject
     virtual int setB(const Vector &, double fact = 1.0) =0;        
 
     virtual int addA(const Matrix &);
+    // adds the matrix of an FE_Element of theModel at the equations of
+    // its ID; sparse SOEs override it to use the locations of the
+    // element's coefficients saved in setSize()
+    virtual int addA(const Matrix &, const FE_Element &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
 
     virtual void zeroA(void) =0;
@@ -75,6 +90,13 @@ class LinearSOE : public MovableObject
             double getDeterminant(void);
     virtual double normRHS(void) = 0;
 
+    // norms of B and X, as Vector::pNorm, and the product X^B; SOEs that
+    // keep their norms compute them once after each change to B or X and
+    // return the saved values until the next change
+            double getNormB(int nType = 2);
+            double getNormX(int nType = 2);
+            double getProductXB(void);
+
     virtual void setX(int loc, double value) =0;
     virtual void setX(const Vector &X) =0;
     
@@ -82,10 +104,35 @@ class LinearSOE : public MovableObject
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
+
+    // a subclass keeping its norms must call changedB()/changedX()
+    // whenever it modifies B or X outside of LinearSOE::solve(); addB()
+    // may be called by several threads at once, so the flags are atomic
+    // and are cleared only when still set
+    void setKeepNorms(bool keep);
+    void changedB(void) {
+      if (normsValid.load(std::memory_order_relaxed) & (NormsB|NormsXB))
+        normsValid.fetch_and(~(NormsB|NormsXB), std::memory_order_relaxed);
+    }
+    void changedX(void) {
+      if (normsValid.load(std::memory_order_relaxed) & (NormsX|NormsXB))
+        normsValid.fetch_and(~(NormsX|NormsXB), std::memory_order_relaxed);
+    }
+
     AnalysisModel* theModel;
     
   private:
+    enum {NormsB = 1, NormsX = 2, NormsXB = 4};
+
     LinearSOESolver *theSolver;    
+
+    bool   keepNorms;
+    std::atomic<int> normsValid;
+    double normB[3], normX[3];  // max, 1 and 2-norm
+    double productXB;
+
+    // symbolic factorizations of theSolver counted by the analysis profile
+    int numSymbolicSeen;
 };
 
 
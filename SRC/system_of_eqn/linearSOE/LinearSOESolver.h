@@ -45,8 +45,27 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // Invoked by the LinearSOE instead of setSize() when the size and
+    // sparsity pattern of A are those of the last setSize(), so that
+    // solvers may keep their ordering and symbolic factorization.
+    virtual int setSizeSamePattern(void);
+
+    // Solve A X = B for numRHS right hand sides at once, factoring A
+    // first if it is not factored. X holds the numRHS columns of B, each
+    // of size() values, on entry and the solutions on exit; the B and X
+    // of the LinearSOE are left as they are. Solvers that do not provide
+    // it leave the LinearSOE to solve the columns one at a time.
+    virtual bool canSolveBlock(void) const {return false;};
+    virtual int solveBlock(int numRHS, double *X) {return -1;};
+
+    // Number of symbolic (ordering) and numeric factorizations done
+    int getNumSymbolicFactor(void) const {return numSymbolicFactor;};
+    int getNumNumericFactor(void) const  {return numNumericFactor;};
     
   protected:
+    int numSymbolicFactor;
+    int numNumericFactor;
     
   private:
 
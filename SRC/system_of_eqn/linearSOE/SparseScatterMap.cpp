@@ -0,0 +1,145 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of SparseScatterMap.
+//
+#include <SparseScatterMap.h>
+#include <ID.h>
+#include <Matrix.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+
+SparseScatterMap::SparseScatterMap()
+{
+
+}
+
+int
+SparseScatterMap::build(AnalysisModel &theModel, int numEqn,
+                        const Locator &locate, bool upper)
+{
+    this->clear();
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theModel.getFEs();
+    while ((elePtr = theEles()) != nullptr) {
+      const int tag = elePtr->getTag();
+      if (tag < 0)
+        continue;
+      if (tag >= (int)theSlots.size())
+        theSlots.resize(tag+1, Slot{0, 0, -1});
+
+      const ID &id = elePtr->getID();
+      const int idSize = id.Size();
+
+      theSlots[tag] = Slot{(int)theLocations.size(), (int)theEquations.size(), idSize};
+      for (int i=0; i<idSize; i++)
+        theEquations.push_back(id(i));
+
+      theLocations.resize(theLocations.size() + idSize*idSize, -1);
+      int32_t *loc = theLocations.data() + theSlots[tag].start;
+
+      for (int j=0; j<idSize; j++) {
+        int col = id(j);
+        if (col < 0 || col >= numEqn)
+          continue;
+
+        for (int i=0; i<idSize; i++) {
+          int row = id(i);
+          if (row < 0 || row >= numEqn)
+            continue;
+          // an ID may hold an equation twice (e.g. under a transformation),
+          // in which case both m(i,j) and m(j,i) go to its diagonal
+          if (upper && i > j && row != col)
+            continue;
+
+          loc[j*idSize + i] = locate(row, col);
+        }
+      }
+    }
+
+    return 0;
+}
+
+void
+SparseScatterMap::clear(void)
+{
+    theSlots.clear();
+    theLocations.clear();
+    theEquations.clear();
+}
+
+const int32_t *
+SparseScatterMap::find(const Matrix &m, const FE_Element &theEle) const
+{
+    const int tag = theEle.getTag();
+    if (tag < 0 || tag >= (int)theSlots.size())
+      return nullptr;
+
+    const Slot &slot = theSlots[tag];
+    if (slot.size != m.noRows() || slot.size != m.noCols())
+      return nullptr;
+
+    // the FE_Element may have been renumbered since the map was built
+    const ID &id = theEle.getID();
+    if (id.Size() != slot.size)
+      return nullptr;
+    const int *eqn = theEquations.data() + slot.eqn;
+    for (int i=0; i<slot.size; i++)
+      if (id(i) != eqn[i])
+        return nullptr;
+
+    return theLocations.data() + slot.start;
+}
+
+int
+SparseScatterMap::add(const Matrix &m, const FE_Element &theEle, double fact,
+                      double *values) const
+{
+    const int32_t *loc = this->find(m, theEle);
+    if (loc == nullptr)
+      return -1;
+
+    const int size = m.noRows();
+    if (fact == 1.0) {
+      for (int j=0; j<size; j++)
+        for (int i=0; i<size; i++, loc++)
+          if (*loc >= 0)
+            values[*loc] += m(i,j);
+    } else {
+      for (int j=0; j<size; j++)
+        for (int i=0; i<size; i++, loc++)
+          if (*loc >= 0)
+            values[*loc] += fact * m(i,j);
+    }
+
+    return 0;
+}
+
+int
+SparseScatterMap::add(const Matrix &m, const FE_Element &theEle, double fact,
+                      double *const *address) const
+{
+    const int32_t *loc = this->find(m, theEle);
+    if (loc == nullptr)
+      return -1;
+
+    const int size = m.noRows();
+    if (fact == 1.0) {
+      for (int j=0; j<size; j++)
+        for (int i=0; i<size; i++, loc++)
+          if (*loc >= 0)
+            *address[*loc] += m(i,j);
+    } else {
+      for (int j=0; j<size; j++)
+        for (int i=0; i<size; i++, loc++)
+          if (*loc >= 0)
+            *address[*loc] += fact * m(i,j);
+    }
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SparseScatterMap caches, for every FE_Element of an
+// AnalysisModel, the position in the value array of a sparse matrix store
+// of each coefficient of the element matrix. It is built by the sparse
+// LinearSOE classes in setSize() so that addA(Matrix, FE_Element) becomes
+// a direct indexed add instead of a search through the row (or column)
+// index arrays of A.
+//
+// The positions are kept as 32 bit offsets in one array, in the order of
+// the FE_Elements, and are found from the tag of the FE_Element; the
+// constraint handlers number the FE_Elements of a model from 0. The map is
+// rebuilt by setSize() whenever the FE_Elements or their equation numbers
+// change. The equation numbers each slot was built for are kept with it,
+// and an FE_Element whose tag, matrix size or ID the map does not know
+// makes add() return -1, in which case the SOE falls back to its searching
+// assembly.
+//
+#ifndef SparseScatterMap_h
+#define SparseScatterMap_h
+
+#include <stdint.h>
+#include <vector>
+#include <functional>
+
+class Matrix;
+class FE_Element;
+class AnalysisModel;
+
+class SparseScatterMap
+{
+  public:
+    // Returns the position of the stored coefficient (row, col) of A in
+    // the values passed to add(), or -1 if it is not stored (e.g. the
+    // other half of a symmetric A).
+    typedef std::function<int (int row, int col)> Locator;
+
+    SparseScatterMap();
+
+    // When upper is true only the coefficients m(i,j) with i <= j of an
+    // element matrix are scattered, and those of the lower half that fall
+    // on the diagonal of A; this is the convention of stores that keep a
+    // single triangle of a symmetric A.
+    int  build(AnalysisModel &theModel, int numEqn, const Locator &locate,
+               bool upper = false);
+    void clear(void);
+
+    // values[p] += fact*m(i,j) for the position p of each coefficient;
+    // the second form is for stores that are not a single array, and
+    // whose locator numbers the addresses in a table of its own
+    int  add(const Matrix &m, const FE_Element &theEle, double fact,
+             double *values) const;
+    int  add(const Matrix &m, const FE_Element &theEle, double fact,
+             double *const *address) const;
+
+  private:
+    struct Slot {
+      int start;  // first position in theLocations
+      int eqn;    // first equation number in theEquations
+      int size;   // size of the element matrix
+    };
+
+    const int32_t *find(const Matrix &m, const FE_Element &theEle) const;
+
+    std::vector<Slot>    theSlots;      // by FE_Element tag
+    std::vector<int32_t> theLocations;  // column-major, as in Matrix
+    std::vector<int>     theEquations;  // the ID of each slot
+};
+
+#endif
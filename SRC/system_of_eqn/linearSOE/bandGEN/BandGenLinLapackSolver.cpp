@@ -93,50 +93,46 @@ int
 BandGenLinLapackSolver::solve(void)
 {
     assert(theSOE != nullptr);
-    // if (theSOE == nullptr) {
-    //     opserr << "WARNING BandGenLinLapackSolver::solve(void)- ";
-    //     opserr << " No LinearSOE object has been set\n";
-    //     return -1;
-    // }
+
+    // first copy B into X, then solve A X = B in place
+    int n = theSOE->size;
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+    for (int i=0; i<n; i++) {
+	*(Xptr++) = *(Bptr++);
+    }
+
+    return this->solveBlock(1, theSOE->X);
+}
+
+int
+BandGenLinLapackSolver::solveBlock(int numRHS, double *X)
+{
+    assert(theSOE != nullptr);
 
     int n = theSOE->size;
     // check iPiv is large enough
     assert(!(iPivSize < n));
-    // if (iPivSize < n) {
-    //     opserr << "WARNING BandGenLinLapackSolver::solve(void)- ";
-    //     opserr << " iPiv not large enough - has setSize() been called?\n";
-    //     return -1;
-    // }	
 
     int kl = theSOE->numSubD;
     int ku = theSOE->numSuperD;
     int ldA = 2*kl + ku +1;
-    int nrhs = 1;
+    int nrhs = numRHS;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
     int    *iPIV = iPiv;
 
-    // first copy B into X
-    for (int i=0; i<n; i++) {
-	*(Xptr++) = *(Bptr++);
-    }
-    Xptr = theSOE->X;
-
     // now solve AX = B
 
     char type[] = "N";
     if (theSOE->factored == false)
       // factor and solve
-      DGBSV(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+      DGBSV(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,X,&ldB,&info);
 
     else  {
       // solve only using factored matrix
-      // unsigned int sizeC = 1;
-      //DGBTRS("N",&sizeC,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
-      DGBTRS(type,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+      DGBTRS(type,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,X,&ldB,&info);
     }
 
     // check if successful
@@ -151,6 +147,8 @@ BandGenLinLapackSolver::solve(void)
       }
     }
 
+    if (theSOE->factored == false)
+      numNumericFactor++;
     theSOE->factored = true;
     if (doDet)
       this->setDeterminant();
@@ -42,6 +42,9 @@ class BandGenLinLapackSolver : public BandGenLinSolver
     int solve();
     int setSize();
 
+    bool canSolveBlock(void) const {return true;};
+    int solveBlock(int numRHS, double *X);
+
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
@@ -27,6 +27,7 @@
 #include <BandGenLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -40,6 +41,7 @@ BandGenLinSOE::BandGenLinSOE(BandGenLinSolver &theSolvr)
  size(0), numSuperD(0), numSubD(0), A(0), B(0), X(0), 
  vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
 {
+    this->setKeepNorms(true);
     theSolvr.setLinearSOE(*this);
 }
 
@@ -48,6 +50,7 @@ BandGenLinSOE::BandGenLinSOE()
  size(0), numSuperD(0), numSubD(0), A(0), B(0), X(0), 
  vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -56,6 +59,7 @@ BandGenLinSOE::BandGenLinSOE(int classTag)
  size(0), numSuperD(0), numSubD(0), A(0), B(0), X(0), 
  vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -66,6 +70,7 @@ BandGenLinSOE::BandGenLinSOE(int N, int numSuperDiag, int numSubDiag,
  size(N), numSuperD(numSuperDiag), numSubD(numSubDiag), A(0), B(0), 
  X(0), vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
 {
+    this->setKeepNorms(true);
     Asize = N * (2*numSubD + numSuperD +1);
     A = new double[Asize];
 
@@ -115,6 +120,18 @@ BandGenLinSOE::~BandGenLinSOE()
 int 
 BandGenLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0)
+        return -1;
+
+    return this->setSize(theEdges);
+}
+
+int 
+BandGenLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
@@ -126,22 +143,19 @@ BandGenLinSOE::setSize(Graph &theGraph)
     numSubD = 0;
     numSuperD = 0;
 
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-    
-    while ((vertexPtr = theVertices()) != nullptr) {
-        int vertexNum = vertexPtr->getTag();
-        const ID &theAdjacency = vertexPtr->getAdjacency();
-        for (int i=0; i<theAdjacency.Size(); i++) {
-            int otherNum = theAdjacency(i);
-            int diff = vertexNum - otherNum;
-            if (diff > 0) {
-                if (diff > numSuperD)
-                    numSuperD = diff;
-            } else 
-                if (diff < numSubD)
-                    numSubD = diff;
-        }
+    // the adjacency is in order, so the bands are set by the first and
+    // last entries of each vertex
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+        if (start[vertexNum] == start[vertexNum+1])
+            continue;
+        int diff = vertexNum - adjacency[start[vertexNum]];
+        if (diff > numSuperD)
+            numSuperD = diff;
+        diff = vertexNum - adjacency[start[vertexNum+1]-1];
+        if (diff < numSubD)
+            numSubD = diff;
     }
     numSubD *= -1;
 
@@ -336,6 +350,7 @@ BandGenLinSOE::addColA(const Vector &colData, int col, double fact)
 int 
 BandGenLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
+    this->changedB();
     assert(id.Size() == v.Size() );
 
     // check for a quick return 
@@ -371,6 +386,7 @@ BandGenLinSOE::addB(const Vector &v, const ID &id, double fact)
 int
 BandGenLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     assert(v.Size() == size);
 
     // check for a quick return 
@@ -410,6 +426,7 @@ BandGenLinSOE::zeroA(void)
 void 
 BandGenLinSOE::zeroB(void)
 {
+    this->changedB();
     double *Bptr = B;
     for (int i=0; i<size; i++)
         *Bptr++ = 0;
@@ -448,6 +465,7 @@ BandGenLinSOE::normRHS(void)
 void 
 BandGenLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc < size && loc >= 0)
         X[loc] = value;
 }
@@ -455,6 +473,7 @@ BandGenLinSOE::setX(int loc, double value)
 void 
 BandGenLinSOE::setX(const Vector &x)
 {
+    this->changedX();
     if (x.Size() == size && vectX != 0)
       *vectX = x;
 }
@@ -38,6 +38,8 @@ DistributedBandGenLinSOE::DistributedBandGenLinSOE(BandGenLinSolver &theSolvr)
   :BandGenLinSOE(LinSOE_TAGS_DistributedBandGenLinSOE), 
    processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0), myB(0), myVectB(0)
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
 	this->setSolver(theSolvr);
     theSolvr.setLinearSOE(*this);
 }
@@ -46,6 +48,8 @@ DistributedBandGenLinSOE::DistributedBandGenLinSOE()
   :BandGenLinSOE(LinSOE_TAGS_DistributedBandGenLinSOE), 
    processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0), myB(0), myVectB(0)
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
 
 }
 
@@ -72,6 +76,13 @@ DistributedBandGenLinSOE::~DistributedBandGenLinSOE()
 }
 
 
+// the graph is exchanged with the other processes as a Graph
+int 
+DistributedBandGenLinSOE::setSize(const CSRGraph &theGraph)
+{
+  return this->LinearSOE::setSize(theGraph);
+}
+
 int 
 DistributedBandGenLinSOE::setSize(Graph &theGraph)
 {
@@ -49,6 +49,7 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
 
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);
     int setB(const Vector &, double fact = 1.0);            
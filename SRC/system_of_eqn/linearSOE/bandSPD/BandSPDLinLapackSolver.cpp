@@ -48,19 +48,29 @@ BandSPDLinLapackSolver::solve(void)
   assert(theSOE != nullptr);
 
     int n = theSOE->size;
-    int kd = theSOE->half_band -1;
-    int ldA = kd +1;
-    int nrhs = 1;
-    int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
     double *Xptr = theSOE->X;
     double *Bptr = theSOE->B;
 
     // first copy B into X
     for (int i=0; i<n; i++)
       *(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
+
+    return this->solveBlock(1, theSOE->X);
+}
+
+
+int
+BandSPDLinLapackSolver::solveBlock(int numRHS, double *X)
+{
+  assert(theSOE != nullptr);
+
+    int n = theSOE->size;
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    int nrhs = numRHS;
+    int ldB = n;
+    int info;
+    double *Aptr = theSOE->A;
 
     // now solve AX = Y
 
@@ -68,14 +78,11 @@ BandSPDLinLapackSolver::solve(void)
     char tflag[] = "U";
     if (theSOE->factored == false) {
       // factor and solve
-      DPBSV(tflag, &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+      DPBSV(tflag, &n,&kd,&nrhs,Aptr,&ldA,X,&ldB,&info);
 
     } else {
       // solve only using factored matrix
-      // unsigned int sizeC = 1;
-      // DPBTRS("U", sizeC, &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-
-        DPBTRS(tflag, &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+        DPBTRS(tflag, &n,&kd,&nrhs,Aptr,&ldA,X,&ldB,&info);
     }
 
 
@@ -88,6 +95,8 @@ BandSPDLinLapackSolver::solve(void)
       }
     }
 
+    if (theSOE->factored == false)
+      numNumericFactor++;
     theSOE->factored = true;
     return 0;
 }
@@ -45,6 +45,8 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
     ~BandSPDLinLapackSolver();
 
     int solve(void);
+    bool canSolveBlock(void) const {return true;};
+    int solveBlock(int numRHS, double *X);
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
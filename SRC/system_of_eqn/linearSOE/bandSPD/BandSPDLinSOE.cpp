@@ -27,6 +27,7 @@
 #include <BandSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <Channel.h>
@@ -44,6 +45,7 @@ BandSPDLinSOE::BandSPDLinSOE(BandSPDLinSolver &the_Solver)
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
     the_Solver.setLinearSOE(*this);
 }
 
@@ -54,6 +56,7 @@ BandSPDLinSOE::BandSPDLinSOE(BandSPDLinSolver &the_Solver, int classTag)
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -64,6 +67,7 @@ BandSPDLinSOE::BandSPDLinSOE(int classTag)
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -75,6 +79,7 @@ BandSPDLinSOE::BandSPDLinSOE(int N, int numSuper,
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
     size = N;
     half_band = numSuper+1;
 
@@ -120,23 +125,33 @@ BandSPDLinSOE::getNumEqn(void) const
 int 
 BandSPDLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0)
+        return -1;
+
+    return this->setSize(theEdges);
+}
+
+int 
+BandSPDLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
     half_band = 0;
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-    
-    while ((vertexPtr = theVertices()) != nullptr) {
-        int vertexNum = vertexPtr->getTag();
-        const ID &theAdjacency = vertexPtr->getAdjacency();
-        for (int i=0; i<theAdjacency.Size(); i++) {
-            int otherNum = theAdjacency(i);
-            int diff = vertexNum-otherNum;
-            if (half_band < diff)
-                half_band = diff;
-        }
+    // the adjacency is in order, so the band is set by the first entry
+    // of each vertex
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+        if (start[vertexNum] == start[vertexNum+1])
+            continue;
+        int diff = vertexNum - adjacency[start[vertexNum]];
+        if (half_band < diff)
+            half_band = diff;
     }
     half_band += 1; // include the diagonal
      
@@ -289,6 +304,7 @@ BandSPDLinSOE::addColA(const Vector &colData, int col, double fact)
 int 
 BandSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
+    this->changedB();
     assert(id.Size() == v.Size());
 
     // check for a quick return 
@@ -323,6 +339,7 @@ BandSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
 int
 BandSPDLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     assert(v.Size() == size);
 
     // check for a quick return 
@@ -359,6 +376,7 @@ BandSPDLinSOE::zeroA(void)
 void 
 BandSPDLinSOE::zeroB(void)
 {
+    this->changedB();
     double *Bptr = B;
     for (int i=0; i<size; i++)
         *Bptr++ = 0;
@@ -368,6 +386,7 @@ BandSPDLinSOE::zeroB(void)
 void 
 BandSPDLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc < size && loc >= 0)
         X[loc] = value;
 }
@@ -375,6 +394,7 @@ BandSPDLinSOE::setX(int loc, double value)
 void 
 BandSPDLinSOE::setX(const Vector &x)
 {
+    this->changedX();
     if (x.Size() == size && vectX != 0)
       *vectX = x;
 }
@@ -56,6 +56,7 @@ class BandSPDLinSOE : public LinearSOE
 
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
 
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
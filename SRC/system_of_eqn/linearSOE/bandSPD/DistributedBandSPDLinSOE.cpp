@@ -39,6 +39,8 @@ DistributedBandSPDLinSOE::DistributedBandSPDLinSOE(BandSPDLinSolver &theSolvr)
   :BandSPDLinSOE(theSolvr, LinSOE_TAGS_DistributedBandSPDLinSOE), 
    processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0),  myVectB(0), myB(0)
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
     theSolvr.setLinearSOE(*this);
 }
 
@@ -46,6 +48,8 @@ DistributedBandSPDLinSOE::DistributedBandSPDLinSOE()
   :BandSPDLinSOE(LinSOE_TAGS_DistributedBandSPDLinSOE), 
    processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0),  myVectB(0), myB(0)
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
 
 }
 
@@ -73,6 +77,13 @@ DistributedBandSPDLinSOE::~DistributedBandSPDLinSOE()
 
 
 
+// the graph is exchanged with the other processes as a Graph
+int 
+DistributedBandSPDLinSOE::setSize(const CSRGraph &theGraph)
+{
+  return this->LinearSOE::setSize(theGraph);
+}
+
 int 
 DistributedBandSPDLinSOE::setSize(Graph &theGraph)
 {
@@ -53,6 +53,7 @@ class DistributedBandSPDLinSOE : public BandSPDLinSOE
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int solve(void);
     const Vector &getB(void);
 
@@ -75,29 +75,38 @@ FullGenLinLapackSolver::solve(void)
 {
     assert(theSOE != nullptr);
     
+    int n = theSOE->size;
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+    
+    // first copy B into X
+    for (int i=0; i<n; i++)
+     *(Xptr++) = *(Bptr++);
+
+    return this->solveBlock(1, theSOE->X);
+}
+
+
+int
+FullGenLinLapackSolver::solveBlock(int numRHS, double *X)
+{
+    assert(theSOE != nullptr);
+    
     int n = theSOE->size;
     
     // check for quick return
-    if (n == 0)
+    if (n == 0 || numRHS == 0)
       return 0;
     
     // check iPiv is large enough
     assert(!(sizeIpiv < n));
-    //  opserr << " iPiv not large enough - has setSize() been called?\n";
      
     int ldA = n;
-    int nrhs = 1;
+    int nrhs = numRHS;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
     int *iPIV = iPiv;
-    
-    // first copy B into X
-    for (int i=0; i<n; i++)
-     *(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
 
     //
     // now solve AX = Y
@@ -105,10 +114,10 @@ FullGenLinLapackSolver::solve(void)
     char tran[] = "N";
     if (theSOE->factored == false)  
      // factor and solve 
-      DGESV(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+      DGESV(&n,&nrhs,Aptr,&ldA,iPIV,X,&ldB,&info);
     else {
      // solve only using factored matrix      
-      DGETRS(tran, &n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);      
+      DGETRS(tran, &n,&nrhs,Aptr,&ldA,iPIV,X,&ldB,&info);      
     }
 
     
@@ -124,6 +133,8 @@ FullGenLinLapackSolver::solve(void)
       }      
     }
 
+    if (theSOE->factored == false)
+      numNumericFactor++;
     theSOE->factored = true;
 
     // we must call setDeterminant while A is factored
@@ -38,6 +38,8 @@ class FullGenLinLapackSolver : public FullGenLinSolver
     ~FullGenLinLapackSolver();
 
     int solve(void);
+    bool canSolveBlock(void) const {return true;};
+    int solveBlock(int numRHS, double *X);
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -28,6 +28,7 @@
 #include <FullGenLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <assert.h>
@@ -45,6 +46,7 @@ FullGenLinSOE::FullGenLinSOE(FullGenLinSolver &theSolvr)
  Asize(0), Bsize(0), 
  factored(false)
 {
+    this->setKeepNorms(true);
     theSolvr.setLinearSOE(*this);
 }
 
@@ -56,6 +58,7 @@ FullGenLinSOE::FullGenLinSOE(int N, FullGenLinSolver &theSolvr)
  Asize(0), Bsize(0), 
  factored(false)
 {
+    this->setKeepNorms(true);
     size = N;
     Bsize = size;
     Asize = size*size;
@@ -98,6 +101,18 @@ FullGenLinSOE::getNumEqn(void) const
 int 
 FullGenLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0)
+        return -1;
+
+    return this->setSize(theEdges);
+}
+
+int 
+FullGenLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
@@ -242,6 +257,7 @@ FullGenLinSOE::addColA(const Vector &colData, int col, double fact)
 int 
 FullGenLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
+    this->changedB();
     // check for a quick return 
     if (fact == 0.0)  return 0;
 
@@ -276,6 +292,7 @@ FullGenLinSOE::addB(const Vector &v, const ID &id, double fact)
 int
 FullGenLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     assert (v.Size() == size);
 
     // check for a quick return 
@@ -313,6 +330,7 @@ FullGenLinSOE::zeroA(void)
 void 
 FullGenLinSOE::zeroB(void)
 {
+    this->changedB();
     double *Bptr = B;
     for (int i=0; i<size; i++)
 	*Bptr++ = 0;
@@ -340,6 +358,7 @@ FullGenLinSOE::formAp(const Vector &p, Vector &Ap)
 void 
 FullGenLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc < size && loc >=0)
 	X[loc] = value;
 }
@@ -347,6 +366,7 @@ FullGenLinSOE::setX(int loc, double value)
 void 
 FullGenLinSOE::setX(const Vector &x)
 {
+    this->changedX();
   if (x.Size() == size && vectX != 0)
     *vectX = x;
 }
@@ -54,6 +54,7 @@ class FullGenLinSOE : public LinearSOE
 
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);        
@@ -31,6 +31,7 @@
 #include <MumpsSOE.h>
 #include <MumpsSolver.h>
 #include <Matrix.h>
+#include <FE_Element.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -211,6 +212,7 @@ MumpsSOE::setSize(Graph &theGraph)
 	opserr << "WARNING:MumpsSOE::setSize :";
 	opserr << " vertex " << a << " not in graph! - size set to 0\n";
 	size = 0;
+	theScatter.clear();
 	return -1;
       }
       
@@ -278,6 +280,18 @@ MumpsSOE::setSize(Graph &theGraph)
   for (int i=0; i<size; i++)
     for (int k=colStartA[i]; k<colStartA[i+1]; k++)
       colA[count++] = i;
+
+  // cache where each FE_Element's coefficients go in A; for the
+  // symmetric types only row >= col is stored, so the rest map to -1
+  if (theModel != nullptr)
+    theScatter.build(*theModel, size, [this](int row, int col) -> int {
+      for (int k=colStartA[col]; k<colStartA[col+1]; k++)
+	if (rowA[k] == row)
+	  return k;
+      return -1;
+    });
+  else
+    theScatter.clear();
   
   // invoke setSize() on the Solver    
   LinearSOESolver *the_Solver = this->getSolver();
@@ -400,6 +414,19 @@ MumpsSOE::addA(const Matrix &m, const ID &id, double fact)
 }
 
     
+int
+MumpsSOE::addA(const Matrix &m, const FE_Element &theEle, double fact)
+{
+    if (fact == 0.0)
+      return 0;
+
+    // direct add at the locations saved for theEle in setSize()
+    if (theScatter.add(m, theEle, fact, A) == 0)
+      return 0;
+
+    return this->addA(m, theEle.getID(), fact);
+}
+
 int 
 MumpsSOE::addB(const Vector &v, const ID &id, double fact)
 {
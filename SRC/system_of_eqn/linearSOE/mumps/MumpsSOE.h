@@ -41,6 +41,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 
 class MumpsSolver;
 class MumpsParallelSolver;
@@ -59,6 +60,7 @@ class MumpsSOE : public LinearSOE
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addA(const Matrix &, const FE_Element &, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
     
@@ -89,6 +91,7 @@ class MumpsSOE : public LinearSOE
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
     int matType;
+    SparseScatterMap theScatter; // location in A of each FE_Element's coefficients
 
   private:
 };
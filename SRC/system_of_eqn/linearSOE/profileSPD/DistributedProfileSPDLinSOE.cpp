@@ -39,6 +39,8 @@ DistributedProfileSPDLinSOE::DistributedProfileSPDLinSOE(ProfileSPDLinSolver &th
    processID(0), numChannels(0), theChannels(0), 
    localCol(0), sizeLocal(0), workArea(0), sizeWork(0), myVectB(0), myB(0)
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
     theSolvr.setLinearSOE(*this);
 }
 
@@ -48,6 +50,8 @@ DistributedProfileSPDLinSOE::DistributedProfileSPDLinSOE()
    processID(0), numChannels(0), theChannels(0), 
    localCol(0), sizeLocal(0), workArea(0), sizeWork(0), myVectB(0), myB(0)
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
 
 }
 
@@ -77,6 +81,13 @@ DistributedProfileSPDLinSOE::~DistributedProfileSPDLinSOE()
 }
 
 
+// the graph is exchanged with the other processes as a Graph
+int 
+DistributedProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
+{
+  return this->LinearSOE::setSize(theGraph);
+}
+
 int 
 DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
 {
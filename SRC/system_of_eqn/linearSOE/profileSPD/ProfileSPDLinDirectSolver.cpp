@@ -99,16 +99,8 @@ ProfileSPDLinDirectSolver::setSize(void)
 int 
 ProfileSPDLinDirectSolver::solve(void)
 {
-  //  Timer timer;
-  //  timer.start();
-
     // check for quick returns
     assert(theSOE != nullptr);
-    // if (theSOE == 0) {
-    //     opserr << "ProfileSPDLinDirectSolver::solve(void): ";
-    //     opserr << " - No ProfileSPDSOE has been assigned\n";
-    //     return -1;
-    // }
     
     if (theSOE->size == 0)
 	return 0;
@@ -121,10 +113,24 @@ ProfileSPDLinDirectSolver::solve(void)
     for (int ii=0; ii<theSize; ii++)
 	X[ii] = B[ii];
 
+    return this->solveBlock(1, X);
+}
+
+
+int 
+ProfileSPDLinDirectSolver::solveBlock(int numRHS, double *X)
+{
+    // check for quick returns
+    assert(theSOE != nullptr);
     
+    int theSize = theSOE->size;
+    if (theSize == 0 || numRHS == 0)
+	return 0;
+
+    int first = 0;
     if (theSOE->isAfactored == false)  {
 
-	// FACTOR & SOLVE
+	// FACTOR & SOLVE the first column
 	double *ajiPtr, *akjPtr, *akiPtr, *bjPtr;    
 	
 	// if the matrix has not been factored already factor it into U^t D U
@@ -203,6 +209,7 @@ ProfileSPDLinDirectSolver::solve(void)
 
 	theSOE->isAfactored = true;
 	theSOE->numInt = 0;
+	numNumericFactor++;
 	
 	
 	// divide by diag term 
@@ -221,47 +228,54 @@ ProfileSPDLinDirectSolver::solve(void)
 
 	    for (int j=rowktop; j<k; j++) 
 		X[j] -= *ajiPtr++ * bk;
-	}   	 	
+	}
+	first = 1;
     }
 
-    else {
+    // JUST DO SOLVE for the remaining columns
+    for (int k=first; k<numRHS; k++)
+	this->substitute(X + (size_t)k*theSize);
 
-	// JUST DO SOLVE
+    return 0;
+}
 
-	// do forward substitution 
-	for (int i=1; i<theSize; i++) {
-	    
-	    int rowitop = RowTop[i];	    
-	    double *ajiPtr = topRowPtr[i];
-	    double *bjPtr  = &X[rowitop];  
-	    double tmp = 0;	    
-	    
-	    for (int j=rowitop; j<i; j++) 
-		tmp -= *ajiPtr++ * *bjPtr++; 
-	    
-	    X[i] += tmp;
-	}
 
-	// divide by diag term 
-	double *bjPtr = X; 
-	double *aiiPtr = invD;
-	for (int j=0; j<theSize; j++) 
-	    *bjPtr++ = *aiiPtr++ * X[j];
+void
+ProfileSPDLinDirectSolver::substitute(double *X)
+{
+    int theSize = theSOE->size;
+
+    // do forward substitution 
+    for (int i=1; i<theSize; i++) {
+	
+	int rowitop = RowTop[i];	    
+	double *ajiPtr = topRowPtr[i];
+	double *bjPtr  = &X[rowitop];  
+	double tmp = 0;	    
+	
+	for (int j=rowitop; j<i; j++) 
+	    tmp -= *ajiPtr++ * *bjPtr++; 
+	
+	X[i] += tmp;
+    }
 
+    // divide by diag term 
+    double *bjPtr = X; 
+    double *aiiPtr = invD;
+    for (int j=0; j<theSize; j++) 
+	*bjPtr++ = *aiiPtr++ * X[j];
 
-	// now do the back substitution storing result in X
-	for (int k=(theSize-1); k>0; k--) {
 
-	    int rowktop = RowTop[k];
-	    double bk = X[k];
-	    double *ajiPtr = topRowPtr[k]; 		
+    // now do the back substitution storing result in X
+    for (int k=(theSize-1); k>0; k--) {
 
-	    for (int j=rowktop; j<k; j++) 
-		X[j] -= *ajiPtr++ * bk;
-	}   	 
-    }    
+	int rowktop = RowTop[k];
+	double bk = X[k];
+	double *ajiPtr = topRowPtr[k]; 		
 
-    return 0;
+	for (int j=rowktop; j<k; j++) 
+	    X[j] -= *ajiPtr++ * bk;
+    }   	 
 }
 
 double
@@ -386,6 +400,7 @@ ProfileSPDLinDirectSolver::factor(int n)
 
 	theSOE->isAfactored = true;
 	theSOE->numInt = n;
+	numNumericFactor++;
 	
     }	
     return 0;
@@ -53,6 +53,8 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     virtual int setSize(void);    
     double getDeterminant(void);
 
+    bool canSolveBlock(void) const {return true;};
+    int solveBlock(int numRHS, double *X);
     
     virtual int factor(int n);
 #if 0
@@ -69,7 +71,8 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     double **topRowPtr, *invD;
     
   private:
-
+    // forward and back substitution of X with the factored A
+    void substitute(double *X);
 };
 
 
@@ -28,6 +28,7 @@
 #include <ProfileSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -45,6 +46,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver)
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
  numInt(0) 
 {
+    this->setKeepNorms(true);
     the_Solver.setLinearSOE(*this);
 }
 
@@ -55,6 +57,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int classTag)
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
  numInt(0) 
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -65,6 +68,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver, int classTag
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
  numInt(0) 
 {
+    this->setKeepNorms(true);
     the_Solver.setLinearSOE(*this);
 }
 
@@ -76,6 +80,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int N, int *iLoc,
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
  numInt(0)
 {
+    this->setKeepNorms(true);
     size = N;
     profileSize = iLoc[N-1];
     
@@ -122,6 +127,18 @@ ProfileSPDLinSOE::getNumEqn(void) const
 int 
 ProfileSPDLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0)
+        return -1;
+
+    return this->setSize(theEdges);
+}
+
+int 
+ProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
     int oldSize = size;
     int result = 0;
     size = theGraph.getNumVertex();
@@ -140,26 +157,15 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     }
 
     // now we go through the vertices to find the height of each col and
-    // width of each row from the connectivity information.
-    
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-
-    while ((vertexPtr = theVertices()) != 0) {
-	int vertexNum = vertexPtr->getTag();
-	const ID &theAdjacency = vertexPtr->getAdjacency();
-	int iiDiagLoc = iDiagLoc[vertexNum];
-	int *iiDiagLocPtr = &(iDiagLoc[vertexNum]);
-
-	for (int i=0; i<theAdjacency.Size(); i++) {
-	    int otherNum = theAdjacency(i);
-	    int diff = vertexNum-otherNum;
-	    if (diff > 0) {
-		if (iiDiagLoc < diff) {
-		    iiDiagLoc = diff;
-		    *iiDiagLocPtr = diff;
-		}
-	    } 
+    // width of each row from the connectivity information; the adjacency
+    // is in order, so the height is set by the first entry
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+	if (start[vertexNum] < start[vertexNum+1]) {
+	    int diff = vertexNum - adjacency[start[vertexNum]];
+	    if (diff > 0)
+		iDiagLoc[vertexNum] = diff;
 	}
     }
 
@@ -368,6 +374,7 @@ ProfileSPDLinSOE::addColA(const Vector &colData, int col, double fact)
 int 
 ProfileSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
+    this->changedB();
     
     // check for a quick return 
     if (fact == 0.0)  return 0;
@@ -406,6 +413,7 @@ ProfileSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
 int
 ProfileSPDLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     // check for a quick return 
     if (fact == 0.0)  return 0;
 
@@ -445,6 +453,7 @@ ProfileSPDLinSOE::zeroA(void)
 void 
 ProfileSPDLinSOE::zeroB(void)
 {
+    this->changedB();
     double *Bptr = B;
     for (int i=0; i<size; i++)
 	*Bptr++ = 0;
@@ -454,6 +463,7 @@ ProfileSPDLinSOE::zeroB(void)
 void 
 ProfileSPDLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc < size && loc >=0)
 	X[loc] = value;
 }
@@ -461,6 +471,7 @@ ProfileSPDLinSOE::setX(int loc, double value)
 void 
 ProfileSPDLinSOE::setX(const Vector &x)
 {
+    this->changedX();
   if (x.Size() == size && vectX != 0)
     *vectX = x;
 }
@@ -48,6 +48,7 @@ class ProfileSPDLinSubstrSolver : public ProfileSPDLinDirectSolver,
     ~ProfileSPDLinSubstrSolver();
 
     int solve(void);
+    bool canSolveBlock(void) const {return false;};
     int condenseA(int numInt);
     int condenseRHS(int numInt, Vector *v =0);
     int computeCondensedMatVect(int numInt, const Vector &u);    
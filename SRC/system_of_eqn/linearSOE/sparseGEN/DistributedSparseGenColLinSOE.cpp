@@ -42,6 +42,8 @@ DistributedSparseGenColLinSOE::DistributedSparseGenColLinSOE(SparseGenColLinSolv
    myVectB(0)
   
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
     theSolvr.setLinearSOE(*this);
 }
 
@@ -51,6 +53,8 @@ DistributedSparseGenColLinSOE::DistributedSparseGenColLinSOE()
    myVectB(0)
   
 {
+    // B and X are exchanged between the processes in solve()
+    this->setKeepNorms(false);
 
 }
 
@@ -75,6 +79,13 @@ DistributedSparseGenColLinSOE::~DistributedSparseGenColLinSOE()
 
 
 
+// the graph is exchanged with the other processes as a Graph
+int 
+DistributedSparseGenColLinSOE::setSize(const CSRGraph &theGraph)
+{
+  return this->LinearSOE::setSize(theGraph);
+}
+
 int 
 DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
 {
@@ -50,6 +50,7 @@ class DistributedSparseGenColLinSOE : public SparseGenColLinSOE
 
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);            
@@ -34,13 +34,17 @@
 #include <SparseGenColLinSOE.h>
 #include <SparseGenColLinSolver.h>
 #include <Matrix.h>
+#include <FE_Element.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <vector>
+#include <algorithm>
 #include <iostream>
 using std::nothrow;
 
@@ -51,6 +55,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver)
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
     the_Solver.setLinearSOE(*this);
 }
 
@@ -62,6 +67,7 @@ SparseGenColLinSOE::SparseGenColLinSOE()
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -72,6 +78,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int classTag)
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
 
 }
 
@@ -83,6 +90,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver, int cl
    Asize(0), Bsize(0),
    factored(false)
 {
+    this->setKeepNorms(true);
   //    the_Solver.setLinearSOE(*this);
 }
 
@@ -96,6 +104,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int N, int NNZ, int *ColStartA, int *RowA
  Asize(0), Bsize(0),
  factored(false)
 {
+    this->setKeepNorms(true);
 
     A = new double[NNZ]{};
 
@@ -145,19 +154,30 @@ SparseGenColLinSOE::getNumEqn(void) const
 int 
 SparseGenColLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0) {
+        size = 0;
+        theScatter.clear();
+        return -1;
+    }
+    return this->setSize(theEdges);
+}
+
+int 
+SparseGenColLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
 
     int result = 0;
     int oldSize = size;
+    int oldNNZ  = nnz;
     size = theGraph.getNumVertex();
 
-    // fist itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-        const ID &theAdjacency = theVertex->getAdjacency();
-        newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
-    }
+    // the adjacency of each vertex and the diag entry
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    int newNNZ = start[size] + size;
     nnz = newNNZ;
 
     if (newNNZ > Asize) { // we have to get more space for A and rowA
@@ -201,56 +221,49 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
         vectB = new Vector(B,size);        
     }
 
-    // fill in colStartA and rowA
+    // keep the old structure of A to check whether it changes
+    std::vector<int> oldColStartA, oldRowA;
+    if (size == oldSize && nnz == oldNNZ && size != 0) {
+      oldColStartA.assign(colStartA, colStartA+size+1);
+      oldRowA.assign(rowA, rowA+nnz);
+    }
+
+    // fill in colStartA and rowA; the adjacency is in order, so the
+    // diag entry is only to be placed among it
     if (size != 0) {
       colStartA[0] = 0;
-      int startLoc = 0;
       int lastLoc = 0;
       for (int a=0; a<size; a++) {
-
-        theVertex = theGraph.getVertexPtr(a);
-        if (theVertex == 0) {
-          // opserr << "WARNING:SparseGenColLinSOE::setSize :";
-          // opserr << " vertex " << a << " not in graph! - size set to 0\n";
-          size = 0;
-          return -1;
-        }
-
-        rowA[lastLoc++] = theVertex->getTag(); // place diag in first
-        const ID &theAdjacency = theVertex->getAdjacency();
-        int idSize = theAdjacency.Size();
-        
-        // now we have to place the entries in the ID into order in rowA
-        for (int i=0; i<idSize; i++) {
-
-          int row = theAdjacency(i);
-          bool foundPlace = false;
-          // find a place in rowA for current col
-          for (int j=startLoc; j<lastLoc; j++)
-            if (rowA[j] > row) { 
-              // move the entries already there one further on
-              // and place col in current location
-              for (int k=lastLoc; k>j; k--)
-                
-                rowA[k] = rowA[k-1];
-              rowA[j] = row;
-              foundPlace = true;
-              j = lastLoc;
-            }
-          if (foundPlace == false) // put in at the end
-            rowA[lastLoc] = row;
-
-          lastLoc++;
-        }
-        colStartA[a+1] = lastLoc;;            
-        startLoc = lastLoc;
+        int k = start[a];
+        for ( ; k < start[a+1] && adjacency[k] < a; k++)
+          rowA[lastLoc++] = adjacency[k];
+        rowA[lastLoc++] = a;
+        for ( ; k < start[a+1]; k++)
+          rowA[lastLoc++] = adjacency[k];
+        colStartA[a+1] = lastLoc;
       }
     }
 
+    // cache where each FE_Element's coefficients go in A
+    if (theModel != nullptr)
+      theScatter.build(*theModel, size, [this](int row, int col) -> int {
+        for (int k=colStartA[col]; k<colStartA[col+1]; k++)
+          if (rowA[k] == row)
+            return k;
+        return -1;
+      });
+    else
+      theScatter.clear();
     
-    // invoke setSize() on the Solver    
+    // invoke setSize() on the Solver, or setSizeSamePattern() if the
+    // structure of A has not changed
+    bool samePattern = !oldRowA.empty()
+                    && std::equal(oldColStartA.begin(), oldColStartA.end(), colStartA)
+                    && std::equal(oldRowA.begin(), oldRowA.end(), rowA);
+
     LinearSOESolver *the_Solver = this->getSolver();
-    int solverOK = the_Solver->setSize();
+    int solverOK = samePattern ? the_Solver->setSizeSamePattern()
+                               : the_Solver->setSize();
     if (solverOK < 0) {
         // opserr << "WARNING:SparseGenColLinSOE::setSize :";
         // opserr << " solver failed setSize()\n";
@@ -316,9 +329,23 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 }
 
     
+int
+SparseGenColLinSOE::addA(const Matrix &m, const FE_Element &theEle, double fact)
+{
+    if (fact == 0.0)
+      return 0;
+
+    // direct add at the locations saved for theEle in setSize()
+    if (theScatter.add(m, theEle, fact, A) == 0)
+      return 0;
+
+    return this->addA(m, theEle.getID(), fact);
+}
+
 int 
 SparseGenColLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
+    this->changedB();
     // check that m and id are of similar size
     assert(id.Size() == v.Size() );
 
@@ -355,6 +382,7 @@ SparseGenColLinSOE::addB(const Vector &v, const ID &id, double fact)
 int
 SparseGenColLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     assert(v.Size() == size);
 
     // check for a quick return 
@@ -390,6 +418,7 @@ SparseGenColLinSOE::zeroA(void)
 void 
 SparseGenColLinSOE::zeroB(void)
 {
+    this->changedB();
     double *Bptr = B;
     for (int i=0; i<size; i++)
         *Bptr++ = 0;
@@ -398,6 +427,7 @@ SparseGenColLinSOE::zeroB(void)
 void 
 SparseGenColLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc < size && loc >=0)
         X[loc] = value;
 }
@@ -405,6 +435,7 @@ SparseGenColLinSOE::setX(int loc, double value)
 void 
 SparseGenColLinSOE::setX(const Vector &x)
 {
+    this->changedX();
   if (x.Size() == size && vectX != 0)
     *vectX = x;
 }
@@ -26,6 +26,7 @@
 #include <SparseGenRowLinSOE.h>
 #include <SparseGenRowLinSolver.h>
 #include <Matrix.h>
+#include <FE_Element.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -201,6 +202,7 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
 	  // opserr << "WARNING:SparseGenRowLinSOE::setSize :";
 	  // opserr << " vertex " << a << " not in graph! - size set to 0\n";
 	  size = 0;
+	  theScatter.clear();
 	  return -1;
 	}
 
@@ -234,6 +236,17 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
       }
     }
 
+    // cache where each FE_Element's coefficients go in A
+    if (theModel != nullptr)
+      theScatter.build(*theModel, size, [this](int row, int col) -> int {
+	for (int k=rowStartA[row]; k<rowStartA[row+1]; k++)
+	  if (colA[k] == col)
+	    return k;
+	return -1;
+      });
+    else
+      theScatter.clear();
+
     // invoke setSize() on the Solver   
      LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -255,8 +268,6 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return 0;
 
     const int idSize = id.Size();
-    
-    // check that m and id are of similar size
 
     if (fact == 1.0) { // do not need to multiply 
 	for (int i=0; i<idSize; i++) {
@@ -301,6 +312,19 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
 }
 
     
+int
+SparseGenRowLinSOE::addA(const Matrix &m, const FE_Element &theEle, double fact)
+{
+    if (fact == 0.0)
+      return 0;
+
+    // direct add at the locations saved for theEle in setSize()
+    if (theScatter.add(m, theEle, fact, A) == 0)
+      return 0;
+
+    return this->addA(m, theEle.getID(), fact);
+}
+
 int 
 SparseGenRowLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
@@ -237,6 +237,7 @@ SuperLU::solve(void)
 	  opserr << " Error " << info << " returned in factorization dgstrf()\n";
 	  return -info;
 	}
+	numNumericFactor++;
 
 	if (symmetric == 'Y')
 	  options.Fact= SamePattern_SameRowPerm;
@@ -306,6 +307,7 @@ SuperLU::setSize()
       get_perm_c(permSpec, &A, perm_c);
 
       sp_preorder(&options, &A, perm_c, etree, &AC);
+      numSymbolicFactor++;
 
       // create the rhs SuperMatrix B 
       dCreate_Dense_Matrix(&B, n, 1, theSOE->X, n, SLU_DN, SLU_D, SLU_GE);
@@ -328,6 +330,23 @@ SuperLU::setSize()
     return 0;
 }
 
+
+int
+SuperLU::setSizeSamePattern(void)
+{
+    // The column permutation, the elimination tree and AC depend only on
+    // the structure of A; they are kept, provided A was set up over the
+    // same arrays of the SOE, and the next dgstrf() reuses them.
+    int n = theSOE->size;
+    if (n == 0 || sizePerm < n || AC.ncol != n
+        || ((NCformat *)A.Store)->nzval != theSOE->A
+        || ((NCformat *)A.Store)->rowind != theSOE->rowA
+        || ((NCformat *)A.Store)->colptr != theSOE->colStartA)
+      return this->setSize();
+
+    return 0;
+}
+
 int
 SuperLU::sendSelf(int cTag, Channel &theChannel)
 {
@@ -60,6 +60,7 @@ class SuperLU : public SparseGenColLinSolver
 
     int solve(void);
     int setSize(void);
+    int setSizeSamePattern(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
@@ -0,0 +1,321 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of SupernodalCholesky.
+//
+#include <SupernodalCholesky.h>
+#include <blasdecl.h>
+#include <threads/thread_pool.hpp>
+#include <algorithm>
+
+SupernodalCholesky::SupernodalCholesky()
+:n(0)
+{
+
+}
+
+int
+SupernodalCholesky::analyze(int size, const int *colStart, const int *row)
+{
+    n = size;
+
+    // the rows i > j of A by column are the columns k < i of A by row
+    std::vector<int> lowStart(n+1, 0), lowCol(colStart[n]);
+    for (int p = 0; p < colStart[n]; p++)
+      lowStart[row[p]+1]++;
+    for (int i = 0; i < n; i++)
+      lowStart[i+1] += lowStart[i];
+    {
+      std::vector<int> next(lowStart.begin(), lowStart.end()-1);
+      for (int j = 0; j < n; j++)
+        for (int p = colStart[j]; p < colStart[j+1]; p++)
+          lowCol[next[row[p]]++] = j;
+    }
+
+    // elimination tree
+    std::vector<int> parent(n, -1), ancestor(n, -1);
+    for (int i = 0; i < n; i++)
+      for (int p = lowStart[i]; p < lowStart[i+1]; p++)
+        for (int k = lowCol[p]; k != -1 && k < i; ) {
+          int next = ancestor[k];
+          ancestor[k] = i;
+          if (next == -1)
+            parent[k] = i;
+          k = next;
+        }
+
+    // count the entries in each column of L; the entries in row i are the
+    // nodes of the subtree of the etree met going up from each k of row i
+    std::vector<int> mark(n, -1), count(n, 1);
+    for (int i = 0; i < n; i++) {
+      mark[i] = i;
+      for (int p = lowStart[i]; p < lowStart[i+1]; p++)
+        for (int j = lowCol[p]; mark[j] != i; j = parent[j]) {
+          mark[j] = i;
+          count[j]++;
+        }
+    }
+
+    // column j-1 joins the supernode of column j when its structure is
+    // that of column j with row j-1 added
+    superStart.clear();
+    superStart.push_back(0);
+    if (n > 0) {
+      for (int j = 1; j < n; j++)
+        if (parent[j-1] != j || count[j-1] != count[j] + 1)
+          superStart.push_back(j);
+      superStart.push_back(n);
+    }
+    const int numSuper = superStart.size() - 1;
+
+    colSuper.resize(n);
+    rowStart.assign(numSuper+1, 0);
+    panelStart.assign(numSuper+1, 0);
+    for (int s = 0; s < numSuper; s++) {
+      const int nc = superStart[s+1] - superStart[s];
+      const int nr = nc + count[superStart[s+1]-1] - 1;
+      for (int j = superStart[s]; j < superStart[s+1]; j++)
+        colSuper[j] = s;
+      rowStart[s+1]   = rowStart[s] + nr;
+      panelStart[s+1] = panelStart[s] + long(nr)*nc;
+    }
+
+    // rows of each supernode: its own columns, then those of the last
+    // column below the diagonal, collected in ascending order as above
+    rows.resize(rowStart[numSuper]);
+    std::vector<int> next(numSuper);
+    for (int s = 0; s < numSuper; s++) {
+      next[s] = rowStart[s];
+      for (int j = superStart[s]; j < superStart[s+1]; j++)
+        rows[next[s]++] = j;
+    }
+    std::fill(mark.begin(), mark.end(), -1);
+    for (int i = 0; i < n; i++) {
+      mark[i] = i;
+      for (int p = lowStart[i]; p < lowStart[i+1]; p++)
+        for (int j = lowCol[p]; mark[j] != i; j = parent[j]) {
+          mark[j] = i;
+          const int s = colSuper[j];
+          if (j == superStart[s+1] - 1)
+            rows[next[s]++] = i;
+        }
+    }
+
+    // the updates of each supernode by the supernodes below it, in
+    // ascending order of the descendant
+    updateStart.assign(numSuper+1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+      std::vector<int> fill(updateStart.begin(), updateStart.end()-1);
+      for (int d = 0; d < numSuper; d++) {
+        const int nc = superStart[d+1] - superStart[d];
+        for (int p = rowStart[d] + nc; p < rowStart[d+1]; ) {
+          const int s = colSuper[rows[p]];
+          int q = p;
+          while (q < rowStart[d+1] && rows[q] < superStart[s+1])
+            q++;
+          if (pass == 0)
+            updateStart[s+1]++;
+          else
+            updates[fill[s]++] = Update{d, p - rowStart[d], q - p};
+          p = q;
+        }
+      }
+      if (pass == 0) {
+        for (int s = 0; s < numSuper; s++)
+          updateStart[s+1] += updateStart[s];
+        updates.resize(updateStart[numSuper]);
+      }
+    }
+
+    // group the supernodes by their height in the supernodal etree
+    std::vector<int> height(numSuper, 0);
+    int numLevels = numSuper > 0 ? 1 : 0;
+    for (int s = 0; s < numSuper; s++) {
+      const int p = parent[superStart[s+1]-1];
+      if (p != -1) {
+        const int ps = colSuper[p];
+        height[ps] = std::max(height[ps], height[s] + 1);
+        numLevels  = std::max(numLevels, height[ps] + 1);
+      }
+    }
+    levelStart.assign(numLevels+1, 0);
+    for (int s = 0; s < numSuper; s++)
+      levelStart[height[s]+1]++;
+    for (int l = 0; l < numLevels; l++)
+      levelStart[l+1] += levelStart[l];
+    levels.resize(numSuper);
+    {
+      std::vector<int> fill(levelStart.begin(), levelStart.end()-1);
+      for (int s = 0; s < numSuper; s++)
+        levels[fill[height[s]]++] = s;
+    }
+
+    values.assign(panelStart[numSuper], 0.0);
+    return 0;
+}
+
+void
+SupernodalCholesky::zero(void)
+{
+    std::fill(values.begin(), values.end(), 0.0);
+}
+
+double *
+SupernodalCholesky::address(int i, int j)
+{
+    if (i < j || i >= n || j < 0)
+      return nullptr;
+
+    const int s = colSuper[j];
+    const int *first = &rows[rowStart[s]],
+              *last  = &rows[0] + rowStart[s+1];
+    const int *r = std::lower_bound(first, last, i);
+    if (r == last || *r != i)
+      return nullptr;
+
+    const int nr = rowStart[s+1] - rowStart[s];
+    return &values[panelStart[s] + long(j - superStart[s])*nr + (r - first)];
+}
+
+int
+SupernodalCholesky::factor(OpenSees::thread_pool *pool)
+{
+    const int numLevels = levelStart.size() - 1;
+    for (int l = 0; l < numLevels; l++) {
+      const int *level = &levels[levelStart[l]];
+      const int numInLevel = levelStart[l+1] - levelStart[l];
+
+      if (pool != nullptr && numInLevel > 1) {
+        std::vector<int> status(numInLevel, 0);
+        pool->submit_loop<int>(0, numInLevel, [&](int k) {
+          status[k] = this->factorSupernode(level[k]);
+        }).wait();
+        for (int k = 0; k < numInLevel; k++)
+          if (status[k] != 0)
+            return status[k];
+      } else {
+        for (int k = 0; k < numInLevel; k++)
+          if (int info = this->factorSupernode(level[k]))
+            return info;
+      }
+    }
+    return 0;
+}
+
+//
+// L(s) -= sum over descendants d of L(d) L(d)^T restricted to the rows
+// and columns of s, then L(s) is factored.
+//
+int
+SupernodalCholesky::factorSupernode(int s)
+{
+    const int f  = superStart[s];
+    int nc = superStart[s+1] - f;
+    int nr = rowStart[s+1] - rowStart[s];
+    const int *sRows = &rows[rowStart[s]];
+    double *Ls = &values[panelStart[s]];
+
+    thread_local std::vector<int>    relative;
+    thread_local std::vector<double> work;
+    if ((int)relative.size() < n)
+      relative.resize(n);
+    for (int r = 0; r < nr; r++)
+      relative[sRows[r]] = r;
+
+    double one = 1.0, zero = 0.0;
+    for (int u = updateStart[s]; u < updateStart[s+1]; u++) {
+      const Update &update = updates[u];
+      const int d = update.desc;
+      int ncd = superStart[d+1] - superStart[d];
+      int nrd = rowStart[d+1] - rowStart[d];
+      const int *dRows = &rows[rowStart[d]] + update.first;
+      double *Ld = &values[panelStart[d]] + update.first;
+
+      // C = L(d) L(d)^T for the rows of d from those in s down
+      int m = nrd - update.first;
+      int k = update.count;
+      if (work.size() < size_t(m)*k)
+        work.resize(size_t(m)*k);
+      double *C = work.data();
+      DGEMM("N", "T", &m, &k, &ncd, &one, Ld, &nrd, Ld, &nrd, &zero, C, &m);
+
+      for (int j = 0; j < k; j++) {
+        double *col = Ls + long(dRows[j] - f)*nr;
+        for (int i = j; i < m; i++)
+          col[relative[dRows[i]]] -= C[long(j)*m + i];
+      }
+    }
+
+    char uplo = 'L';
+    int info = 0;
+    DPOTRF(&uplo, &nc, Ls, &nr, &info);
+    if (info != 0)
+      return f + info;
+
+    if (nr > nc) {
+      int m = nr - nc;
+      DTRSM("R", "L", "T", "N", &m, &nc, &one, Ls, &nr, Ls + nc, &nr);
+    }
+    return 0;
+}
+
+void
+SupernodalCholesky::solve(double *x)
+{
+    const int numSuper = superStart.size() - 1;
+    thread_local std::vector<double> work;
+    int inc = 1;
+
+    // forward substitution, L y = x
+    for (int s = 0; s < numSuper; s++) {
+      const int f = superStart[s];
+      int nc = superStart[s+1] - f;
+      int nr = rowStart[s+1] - rowStart[s];
+      const int *sRows = &rows[rowStart[s]];
+      double *Ls = &values[panelStart[s]];
+
+      DTRSV("L", "N", "N", &nc, Ls, &nr, x + f, &inc);
+      if (nr > nc) {
+        int m = nr - nc;
+        double one = 1.0, zero = 0.0;
+        work.resize(m);
+        DGEMV("N", &m, &nc, &one, Ls + nc, &nr, x + f, &inc, &zero, work.data(), &inc);
+        for (int r = 0; r < m; r++)
+          x[sRows[nc+r]] -= work[r];
+      }
+    }
+
+    // backward substitution, L^T x = y
+    for (int s = numSuper-1; s >= 0; s--) {
+      const int f = superStart[s];
+      int nc = superStart[s+1] - f;
+      int nr = rowStart[s+1] - rowStart[s];
+      const int *sRows = &rows[rowStart[s]];
+      double *Ls = &values[panelStart[s]];
+
+      if (nr > nc) {
+        int m = nr - nc;
+        double minusOne = -1.0, one = 1.0;
+        work.resize(m);
+        for (int r = 0; r < m; r++)
+          work[r] = x[sRows[nc+r]];
+        DGEMV("T", &m, &nc, &minusOne, Ls + nc, &nr, work.data(), &inc, &one, x + f, &inc);
+      }
+      DTRSV("L", "T", "N", &nc, Ls, &nr, x + f, &inc);
+    }
+}
+
+int
+SupernodalCholesky::getNumSupernodes(void) const
+{
+    return superStart.empty() ? 0 : superStart.size() - 1;
+}
+
+long
+SupernodalCholesky::getFactorSize(void) const
+{
+    return values.size();
+}
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SupernodalCholesky is a left-looking supernodal Cholesky
+// factorization A = L L^T of a sparse symmetric positive definite matrix.
+//
+// analyze() takes the pattern of the strictly lower triangle of A, already
+// in the order in which it is to be factored, and computes the elimination
+// tree, the structure of L and its partition into supernodes; a supernode
+// is a set of consecutive columns of L with the same structure below the
+// diagonal, and its columns are stored together as one dense column-major
+// panel. The values of A are then written into L through address(), after
+// zero(), and factor() computes L in place using the dense BLAS/LAPACK
+// kernels DGEMM, DPOTRF and DTRSM on the panels.
+//
+// Supernodes are factored by levels of the supernodal elimination tree,
+// the level of a supernode being its height above the leaves; supernodes
+// on the same level share no ancestor path, so a level can be spread over
+// a thread pool. The updates of a supernode are added in a fixed order,
+// so the factor does not depend on the number of threads.
+//
+#ifndef SupernodalCholesky_h
+#define SupernodalCholesky_h
+
+#include <vector>
+
+namespace OpenSees {
+  class thread_pool;
+}
+
+class SupernodalCholesky
+{
+  public:
+    SupernodalCholesky();
+
+    // colStart and row hold the rows i > j of each column j of A
+    int     analyze(int n, const int *colStart, const int *row);
+
+    void    zero(void);
+    double *address(int i, int j);  // of L(i,j), i >= j; nullptr if not stored
+
+    // returns 0, or the column + 1 at which A was found not to be positive
+    // definite
+    int     factor(OpenSees::thread_pool *pool = nullptr);
+
+    // overwrites x with the solution of L L^T x = x
+    void    solve(double *x);
+
+    int     getNumSupernodes(void) const;
+    long    getFactorSize(void) const;
+
+  private:
+    struct Update {
+      int desc;   // descendant supernode
+      int first;  // position in the rows of desc of the first row in this supernode
+      int count;  // number of rows of desc in this supernode
+    };
+
+    int  factorSupernode(int s);
+
+    int n;
+    std::vector<int>    superStart;  // first column of each supernode, and n
+    std::vector<int>    colSuper;    // supernode of each column
+    std::vector<int>    rowStart;    // start of the rows of each supernode in rows
+    std::vector<int>    rows;        // rows of each supernode, ascending
+    std::vector<long>   panelStart;  // start of the panel of each supernode in values
+    std::vector<double> values;
+
+    std::vector<int>    updateStart; // start of the updates of each supernode
+    std::vector<Update> updates;
+    std::vector<int>    levelStart;  // start of each level in levels
+    std::vector<int>    levels;      // supernodes, by level
+};
+
+#endif
@@ -19,12 +19,17 @@
 #include <SymSparseLinSOE.h>
 #include <SymSparseLinSolver.h>
 #include <Matrix.h>
+#include <FE_Element.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
 
 extern "C" {
 #include "symbolic.h"
@@ -41,17 +46,32 @@ SymSparseLinSOE::SymSparseLinSOE(SymSparseLinSolver &the_Solver, int lSparse)
  nblks(0), xblk(0), invp(0), diag(0), penv(0), rowblks(0),
  begblk(0), first(0) 
 {
+    this->setKeepNorms(true);
     the_Solver.setLinearSOE(*this);
     this->LSPARSE = lSparse;
 }
 
 
-/* A destructor for cleanning memory.
+SymSparseLinSOE::~SymSparseLinSOE()
+{
+    this->freeFactor();
+
+    // free the "C++" style vectors.
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;    
+    if (vectB != 0) delete vectB;
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colA != 0) delete [] colA;
+}
+
+
+/* Free the storage of the factor set up by symFactorization().
  * For diag and penv, it is rather straightforward to clean.
  * For row segments, since the memory of nz is allocated for each
  * row, the deallocated needs some special care.
  */
-SymSparseLinSOE::~SymSparseLinSOE()
+void SymSparseLinSOE::freeFactor(void)
 {
     // free the diagonal vector
     if (diag != NULL) free(diag);
@@ -69,7 +89,7 @@ SymSparseLinSOE::~SymSparseLinSOE()
     OFFDBLK *tempBlk;
     int curRow = -1;
 
-    while (1) {
+    while (blkPtr != NULL) {
       if (blkPtr->next == blkPtr) {
 	if (blkPtr != NULL) {
 	  free(blkPtr);
@@ -94,16 +114,13 @@ SymSparseLinSOE::~SymSparseLinSOE()
     if (xblk != 0)  free(xblk);
     if (rowblks != 0)   free(rowblks);
     if (invp != 0)  free(invp);
-    
-    // free the "C++" style vectors.
-    if (B != 0) delete [] B;
-    if (X != 0) delete [] X;
-    if (vectX != 0) delete vectX;    
-    if (vectB != 0) delete vectB;
-    if (rowStartA != 0) delete [] rowStartA;
-    if (colA != 0) delete [] colA;
-}
+    if (begblk != 0)  free(begblk);
 
+    nblks = 0;
+    xblk = 0; invp = 0; rowblks = 0;
+    diag = 0; penv = 0;
+    begblk = 0; first = 0;
+}
 
 int SymSparseLinSOE::getNumEqn(void) const
 {
@@ -117,19 +134,31 @@ int SymSparseLinSOE::getNumEqn(void) const
  */
 int SymSparseLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0) {
+        size = 0;
+        theScatter.clear();
+        theAddress.clear();
+        return -1;
+    }
+    return this->setSize(theEdges);
+}
+
+int SymSparseLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
 
     int result = 0;
     int oldSize = size;
+    int oldNNZ  = nnz;
+    int *oldColA = colA;
     size = theGraph.getNumVertex();
 
-    // first itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-        const ID &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.Size(); 
-    }
+    // the adjacency of each vertex
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    int newNNZ = start[size];
     nnz = newNNZ;
  
     colA = new int[newNNZ];
@@ -168,58 +197,84 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
 	 vectB = new Vector(B,size);	
     }
 
-    // fill in rowStartA and colA
-    if (size != 0) {
-        rowStartA[0] = 0;
-        int startLoc = 0;
-	int lastLoc = 0;
-
-	for (int a=0; a<size; a++) {
-	   theVertex = theGraph.getVertexPtr(a);
-	   if (theVertex == 0) {
-	        // opserr << "WARNING:SymSparseLinSOE::setSize :";
-	        // opserr << " vertex " << a << " not in graph! - size set to 0\n";
-	        size = 0;
-	        return -1;
-	   }
+    // keep the old structure of A to check whether it changes
+    std::vector<int> oldRowStartA;
+    if (size == oldSize && nnz == oldNNZ && size != 0 && oldColA != 0)
+      oldRowStartA.assign(rowStartA, rowStartA+size+1);
 
-	   const ID &theAdjacency = theVertex->getAdjacency();
-	   int idSize = theAdjacency.Size();
-	
-           // now we have to place the entries in the ID into order in colA
-	   for (int i=0; i<idSize; i++) {
-	      int row = theAdjacency(i);
-	      bool foundPlace = false;
-	 
-	      for (int j=startLoc; j<lastLoc; j++)
-	          if (colA[j] > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	              for (int k=lastLoc; k>j; k--)
-		          colA[k] = colA[k-1];
-                      colA[j] = row;
-		      foundPlace = true;
-    	              j = lastLoc;
-		  }
-		  
-	      if (foundPlace == false) // put in at the end
-	      	   colA[lastLoc] = row;
-
-	      lastLoc++;
-	   }
-	   rowStartA[a+1] = lastLoc;;	    
-	   startLoc = lastLoc;
-	}
+    // fill in rowStartA and colA, the adjacency being in order
+    if (size != 0) {
+        std::copy(start, start+size+1, rowStartA);
+        std::copy(adjacency, adjacency+nnz, colA);
     }
     
-    // call "C" function to form elimination tree and to do the symbolic factorization.
-    nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
-			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+    bool samePattern = !oldRowStartA.empty()
+                    && std::equal(oldRowStartA.begin(), oldRowStartA.end(), rowStartA)
+                    && std::equal(oldColA, oldColA+nnz, colA);
+    if (oldColA != 0)
+      delete [] oldColA;
+
+    // the solver forms the elimination tree and does the symbolic
+    // factorization, unless the structure of A is unchanged
+    LinearSOESolver *the_Solver = this->getSolver();
+    result = samePattern ? the_Solver->setSizeSamePattern()
+                         : the_Solver->setSize();
+    if (result < 0) {
+      theScatter.clear();
+      theAddress.clear();
+      return result;
+    }
+
+    // cache where each FE_Element's coefficients go in the factor storage;
+    // only the upper half m(i,j), i <= j, of the element matrix is used.
+    // L is held in several arrays, so the map refers to theAddress, which
+    // lists each coefficient of L the elements touch once.
+    theAddress.clear();
+    if (theModel != nullptr) {
+      std::unordered_map<double *, int> position;
+      theScatter.build(*theModel, size, [&](int row, int col) -> int {
+	double *address = this->locate(row, col);
+	if (address == nullptr)
+	  return -1;
+	auto found = position.emplace(address, (int)theAddress.size());
+	if (found.second)
+	  theAddress.push_back(address);
+	return found.first->second;
+      }, true);
+    } else
+      theScatter.clear();
 
     return result;
 }
 
 
+/* Return the address in the factor storage of the coefficient (row, col)
+ * of A, where row and col are equation numbers before the reordering, or
+ * nullptr if it is not stored.
+ */
+double *SymSparseLinSOE::locate(int row, int col)
+{
+    int i_eq = invp[row];
+    int j_eq = invp[col];
+    if (i_eq == j_eq)
+      return &diag[i_eq];
+    if (i_eq < j_eq) {
+      int tmp = i_eq; i_eq = j_eq; j_eq = tmp;
+    }
+
+    if (j_eq >= xblk[rowblks[i_eq]]) /* diagonal block (profile) */
+      return penv[i_eq+1] - i_eq + j_eq;
+
+    /* row segment; there is one per row in each block */
+    OFFDBLK *ptr = begblk[rowblks[j_eq]];
+    while (ptr->row < i_eq)
+      ptr = ptr->bnext;
+    if (ptr->row != i_eq || j_eq < ptr->beg)
+      return nullptr;
+    return ptr->nz + (j_eq - ptr->beg);
+}
+
+
 /* Perform the element stiffness assembly here.
  */
 int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
@@ -292,7 +347,8 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
    int lnee = nee;
    
    /* initialize isort */
-   for(int i = 0, k = 0; i < lnee ; i++ )
+   k = 0;
+   for (int i = 0; i < lnee ; i++ )
    {
        if( newID[i] >= 0 ) {
 	   isort[k] = i;
@@ -348,7 +404,11 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
 		jt = jpos;
 	    }
 
-	    if (j_eq >= xblk[iblk]) /* diagonal block (profile) */
+	    if (j_eq == i_eq) /* an equation twice in the ID */
+	    {
+	        diag[i_eq] += 2.0 * m[it*idSize + jt] * fact;
+	    }
+	    else if (j_eq >= xblk[iblk]) /* diagonal block (profile) */
 	    {  
 	        loc = iloc + j_eq ;
 		*loc += m[it*idSize + jt] * fact;
@@ -372,11 +432,27 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
     return 0;
 }
 
+
+/* Assemble the matrix of an FE_Element of the model at the locations
+ * saved for it in setSize().
+ */
+int SymSparseLinSOE::addA(const Matrix &m, const FE_Element &theEle, double fact)
+{
+   if (fact == 0.0)
+       return 0;
+
+   if (theScatter.add(m, theEle, fact, theAddress.data()) == 0)
+       return 0;
+
+   return this->addA(m, theEle.getID(), fact);
+}
+
     
 /* assemble the force vector B (A*X = B).
  */
 int SymSparseLinSOE::addB(const Vector &in_v, const ID &in_id, double fact)
 {
+    this->changedB();
     assert(in_id.Size() == in_v.Size());
 
     // check for a quick return 
@@ -405,35 +481,29 @@ int SymSparseLinSOE::addB(const Vector &in_v, const ID &in_id, double fact)
        delete [] v;
        return 0;
    }
-    int *newID = new int[idSize];
-
-    for (int i=0; i<idSize; i++) {
-       newID[i] = id[i];
-	if (newID[i] >= 0)
-	    newID[i] = invp[newID[i]];
-    }
 
+    // B is kept in the numbering of the equations, as are X and the
+    // vectors given to setB(); the solvers reorder it
     if (fact == 1.0) { // do not need to multiply if fact == 1.0
 	for (int i=0; i<idSize; i++) {
-	    int pos = newID[i];
+	    int pos = id[i];
 	    if (pos <size && pos >= 0)
 		B[pos] += v[i];
 	}
     } else if (fact == -1.0) { // do not need to multiply if fact == -1.0
 	for (int i=0; i<idSize; i++) {
-	    int pos = newID[i];
+	    int pos = id[i];
 	    if (pos <size && pos >= 0)
 		B[pos] -= v[i];
 	}
     } else {
 	for (int i=0; i<idSize; i++) {
-	    int pos = newID[i];
+	    int pos = id[i];
 	    if (pos <size && pos >= 0)
 		B[pos] += v[i] * fact;  // assemble
 	}
     }	
 
-    delete [] newID;
     delete [] v;
     delete [] id;
 
@@ -444,6 +514,7 @@ int SymSparseLinSOE::addB(const Vector &in_v, const ID &in_id, double fact)
 int
 SymSparseLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     assert(v.Size() == size);
 
     // check for a quick return 
@@ -498,6 +569,7 @@ void SymSparseLinSOE::zeroA(void)
 void 
 SymSparseLinSOE::zeroB(void)
 {
+    this->changedB();
     double *Bptr = B;
     for (int i=0; i<size; i++)
 	*Bptr++ = 0;
@@ -506,6 +578,7 @@ SymSparseLinSOE::zeroB(void)
 void 
 SymSparseLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc < size && loc >=0)
 	X[loc] = value;
 }
@@ -513,6 +586,7 @@ SymSparseLinSOE::setX(int loc, double value)
 void
 SymSparseLinSOE::setX(const Vector &x)
 {
+    this->changedX();
     if (x.Size() == size && vectX != 0) 
         *vectX = x;
 }
@@ -551,7 +625,7 @@ int SymSparseLinSOE::setSymSparseLinSolver(SymSparseLinSolver &newSolver)
     newSolver.setLinearSOE(*this);
     
     if (size != 0) {
-        int solverOK = newSolver.setSize();
+        int solverOK = newSolver.setSizeSamePattern();
 	if (solverOK < 0) {
 	    // opserr << "WARNING:SymSparseLinSOE::setSolver :";
 	    // opserr << "the new solver could not setSeize() - staying with old\n";
@@ -21,6 +21,8 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
+#include <vector>
 
 extern "C" {
    #include <FeStructs.h>
@@ -39,7 +41,9 @@ class SymSparseLinSOE : public LinearSOE
 
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addA(const Matrix &, const FE_Element &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);        
     
@@ -59,10 +63,14 @@ class SymSparseLinSOE : public LinearSOE
 		 FEM_ObjectBroker &theBroker);
 
     friend class SymSparseLinSolver;
+    friend class SymSparseSupernodalSolver;
 
   protected:
     
   private:
+    void freeFactor(void);
+    double *locate(int row, int col);
+
     int size;            // order of A
     int nnz;             // number of non-zeros in A
     double *B, *X;       // 1d arrays containing coefficients of B and X
@@ -81,6 +89,9 @@ class SymSparseLinSOE : public LinearSOE
     OFFDBLK  **begblk;
     OFFDBLK  *first;
 
+    SparseScatterMap theScatter; // location in L of each FE_Element's coefficients
+    std::vector<double *> theAddress; // the coefficients of L theScatter refers to
+
 };
 
 #endif
@@ -18,9 +18,12 @@
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
 
+#include <vector>
+
 extern "C" {
 #include "nmat.h"
 #include "FeStructs.h"
+#include "symbolic.h"
 }
 
 void* OPS_SymSparseLinSolver()
@@ -50,6 +53,14 @@ SymSparseLinSolver::SymSparseLinSolver()
 }
 
 
+SymSparseLinSolver::SymSparseLinSolver(int classTag)
+:LinearSOESolver(classTag),
+ theSOE(0)
+{
+    // nothing to do.
+}
+
+
 SymSparseLinSolver::~SymSparseLinSolver()
 { 
     // nothing to do.
@@ -87,10 +98,10 @@ SymSparseLinSolver::solve(void)
     if (neq == 0)
 	return 0;
 
-    // first copy B into X
+    // first copy B into X, in the reordered numbering of the factor
 
     for (int i=0; i<neq; i++) {
-        theSOE->X[i] = theSOE->B[i];
+        theSOE->X[invp[i]] = theSOE->B[i];
     }
     double *Xptr = theSOE->X;
 
@@ -105,6 +116,7 @@ SymSparseLinSolver::solve(void)
 	    return -1;
 	}
 	theSOE->factored = true;
+	numNumericFactor++;
     }
 
     // do forward and backward substitution.
@@ -130,10 +142,45 @@ SymSparseLinSolver::solve(void)
 }
 
 
+/* Form the elimination tree and do the symbolic factorization of the
+ * structure (rowStartA, colA) of the SOE, freeing any previous factor.
+ */
 int
 SymSparseLinSolver::setSize()
 {
-    // nothing to do
+    if (theSOE == 0) {
+	opserr << "WARNING SymSparseLinSolver::setSize(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    // the ordering overwrites the adjacency it is given, so it works on a
+    // copy; the SOE keeps (rowStartA, colA) to compare the next pattern
+    const int size = theSOE->size;
+    std::vector<int> xadj(theSOE->rowStartA, theSOE->rowStartA + size+1);
+    std::vector<int> adjncy(theSOE->colA, theSOE->colA + xadj[size]);
+    adjncy.push_back(0);
+
+    theSOE->freeFactor();
+    theSOE->nblks = symFactorization(xadj.data(), adjncy.data(), size,
+				     theSOE->LSPARSE, &theSOE->xblk, &theSOE->invp,
+				     &theSOE->rowblks, &theSOE->begblk, &theSOE->first,
+				     &theSOE->penv, &theSOE->diag);
+    theSOE->factored = false;
+    numSymbolicFactor++;
+    return 0;
+}
+
+
+/* The ordering and the symbolic factorization only depend on the
+ * structure of A, so they are kept if there is one.
+ */
+int
+SymSparseLinSolver::setSizeSamePattern()
+{
+    if (theSOE == 0 || theSOE->first == 0)
+	return this->setSize();
+
     return 0;
 }
 
@@ -30,6 +30,7 @@ class SymSparseLinSolver : public LinearSOESolver
 
     int solve(void);
     int setSize(void);
+    int setSizeSamePattern(void);
 
     int setLinearSOE(SymSparseLinSOE &theSOE); 
 	
@@ -38,10 +39,11 @@ class SymSparseLinSolver : public LinearSOESolver
 		 Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
   protected:
-
-  private:
+    SymSparseLinSolver(int classTag);
 
     SymSparseLinSOE *theSOE;
+
+  private:
     
 };
 
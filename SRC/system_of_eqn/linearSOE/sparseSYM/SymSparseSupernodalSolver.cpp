@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// SymSparseSupernodalSolver.
+//
+#include <SymSparseSupernodalSolver.h>
+#include <SymSparseLinSOE.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+#include <threads/thread_pool.hpp>
+
+SymSparseSupernodalSolver::SymSparseSupernodalSolver(int numThreads)
+:SymSparseLinSolver(SOLVER_TAGS_SymSparseSupernodalSolver),
+ analyzed(false), thePool(nullptr)
+{
+    if (numThreads > 1)
+      thePool = new OpenSees::thread_pool(numThreads);
+}
+
+
+SymSparseSupernodalSolver::~SymSparseSupernodalSolver()
+{
+    if (thePool != nullptr)
+      delete thePool;
+}
+
+
+int
+SymSparseSupernodalSolver::setSize(void)
+{
+    // the envelope storage that the SOE assembles A into
+    int result = this->SymSparseLinSolver::setSize();
+    if (result < 0)
+      return result;
+
+    analyzed = false;
+    fromA.clear();
+    toL.clear();
+
+    const int n = theSOE->size;
+    const int *rowStartA = theSOE->rowStartA,
+              *colA      = theSOE->colA,
+              *invp      = theSOE->invp;
+
+    // strictly lower triangle of the reordered A, by column
+    std::vector<int> colStart(n+1, 0), row;
+    for (int r = 0; r < n; r++)
+      for (int p = rowStartA[r]; p < rowStartA[r+1]; p++)
+        if (invp[r] > invp[colA[p]])
+          colStart[invp[colA[p]]+1]++;
+    for (int j = 0; j < n; j++)
+      colStart[j+1] += colStart[j];
+    row.resize(colStart[n]);
+    {
+      std::vector<int> next(colStart.begin(), colStart.end()-1);
+      for (int r = 0; r < n; r++)
+        for (int p = rowStartA[r]; p < rowStartA[r+1]; p++)
+          if (invp[r] > invp[colA[p]])
+            row[next[invp[colA[p]]]++] = invp[r];
+    }
+
+    result = theFactor.analyze(n, colStart.data(), row.data());
+    if (result < 0)
+      return result;
+
+    // where each coefficient of A goes in L
+    fromA.reserve(n + colStart[n]);
+    toL.reserve(n + colStart[n]);
+    for (int r = 0; r < n; r++) {
+      const int i = invp[r];
+      const double *a = theSOE->locate(r, r);
+      double *l = theFactor.address(i, i);
+      if (a != nullptr && l != nullptr) {
+        fromA.push_back(a);
+        toL.push_back(l);
+      }
+
+      for (int p = rowStartA[r]; p < rowStartA[r+1]; p++) {
+        const int j = invp[colA[p]];
+        if (i <= j)
+          continue;
+        a = theSOE->locate(r, colA[p]);
+        l = theFactor.address(i, j);
+        if (a != nullptr && l != nullptr) {
+          fromA.push_back(a);
+          toL.push_back(l);
+        }
+      }
+    }
+
+    analyzed = true;
+    return 0;
+}
+
+
+int
+SymSparseSupernodalSolver::setSizeSamePattern(void)
+{
+    if (!analyzed)
+      return this->setSize();
+
+    return this->SymSparseLinSolver::setSizeSamePattern();
+}
+
+
+int
+SymSparseSupernodalSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING SymSparseSupernodalSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    const int neq = theSOE->size;
+    if (neq == 0)
+	return 0;
+
+    if (!analyzed) {
+	opserr << "WARNING SymSparseSupernodalSolver::solve(void)- ";
+	opserr << " setSize() has not been called\n";
+	return -1;
+    }
+
+    if (theSOE->factored == false) {
+	theFactor.zero();
+	const size_t numCoeff = fromA.size();
+	for (size_t k = 0; k < numCoeff; k++)
+	    *toL[k] = *fromA[k];
+
+	int info = theFactor.factor(thePool);
+	if (info != 0) {
+	    opserr << "WARNING SymSparseSupernodalSolver::solve(void)- ";
+	    opserr << " matrix not positive definite at reordered equation " << info - 1 << "\n";
+	    return -1;
+	}
+	theSOE->factored = true;
+	numNumericFactor++;
+    }
+
+    // the factor is in the reordered numbering, B and X are not
+    const int *invp = theSOE->invp;
+    double *X = theSOE->X;
+    std::vector<double> x(neq);
+    for (int m = 0; m < neq; m++)
+	x[invp[m]] = theSOE->B[m];
+
+    theFactor.solve(x.data());
+
+    for (int m = 0; m < neq; m++)
+	X[m] = x[invp[m]];
+
+    return 0;
+}
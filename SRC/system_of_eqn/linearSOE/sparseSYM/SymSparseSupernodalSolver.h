@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SymSparseSupernodalSolver solves a SymSparseLinSOE with a
+// supernodal Cholesky factorization (see SupernodalCholesky.h) in place of
+// the generalized envelope factorization of SymSparseLinSolver.
+//
+// The SOE still assembles A into its envelope storage, in the order chosen
+// by its ordering scheme (MMD, ND or RCM); the solver keeps a map from
+// each stored coefficient of A to its place in L and copies A into L
+// before each factorization, so A is left intact. With more than one
+// thread, independent supernodes are factored in parallel.
+//
+#ifndef SymSparseSupernodalSolver_h
+#define SymSparseSupernodalSolver_h
+
+#include <vector>
+#include <SymSparseLinSolver.h>
+#include <SupernodalCholesky.h>
+
+namespace OpenSees {
+  class thread_pool;
+}
+
+class SymSparseSupernodalSolver : public SymSparseLinSolver
+{
+  public:
+    SymSparseSupernodalSolver(int numThreads = 1);
+    ~SymSparseSupernodalSolver();
+
+    int solve(void);
+    int setSize(void);
+    int setSizeSamePattern(void);
+
+  private:
+    SupernodalCholesky theFactor;
+    std::vector<const double *> fromA;  // coefficients of A
+    std::vector<double *>       toL;    // and their place in L
+    bool analyzed;
+    OpenSees::thread_pool *thePool;
+};
+
+#endif
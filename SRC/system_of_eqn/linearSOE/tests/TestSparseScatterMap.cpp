@@ -0,0 +1,288 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file is a driver to test the assembly of the sparse
+// LinearSOEs through the SparseScatterMap they build in setSize(). The
+// matrices of the FE_Elements of a braced truss, two of whose nodes are
+// tied by an equalDOF under the Transformation handler, are added once by
+// addA(Matrix, FE_Element) and once by the searching addA(Matrix, ID), and
+// the solutions of the two systems for the same B are compared. The tie
+// is crossed by a bar, so that the ID of its TransformationFE holds an
+// equation twice. Then, for the SOEs of a general matrix, whose searching
+// assembly skips the coefficients outside the pattern, the DOFs are
+// renumbered without a new setSize(), and the assembly by FE_Element must
+// give what the searching one gives.
+//
+#include <stdlib.h>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Truss.h>
+#include <ElasticMaterial.h>
+#include <SP_Constraint.h>
+#include <MP_Constraint.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <TransformationConstraintHandler.h>
+#include <DOF_Numberer.h>
+#include <PlainNumberer.h>
+#include <RCM.h>
+#include <LoadControl.h>
+#include <CSRGraph.h>
+
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+#include <SymSparseSupernodalSolver.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+thread_local Element *ops_TheActiveElement = 0;
+
+static const int numBays = 4;
+static const int numStories = 3;
+
+static int
+nodeTag(int i, int j)
+{
+  return 1 + j*(numBays+1) + i;
+}
+
+// a braced truss of numBays x numStories panels on pinned supports
+static void
+buildTruss(Domain &theDomain)
+{
+  for (int j = 0; j <= numStories; j++)
+    for (int i = 0; i <= numBays; i++)
+      theDomain.addNode(new Node(nodeTag(i,j), 2, 100.0*i, 80.0*j));
+
+  for (int i = 0; i <= numBays; i++) {
+    theDomain.addSP_Constraint(new SP_Constraint(nodeTag(i,0), 0, 0.0, true));
+    theDomain.addSP_Constraint(new SP_Constraint(nodeTag(i,0), 1, 0.0, true));
+  }
+
+  ElasticMaterial theMaterial(1, 29000.0, 0.0);
+  int tag = 0;
+  for (int j = 0; j < numStories; j++) {
+    for (int i = 0; i <= numBays; i++)
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i,j), nodeTag(i,j+1), theMaterial, 10.0));
+    for (int i = 0; i < numBays; i++) {
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i,j+1), nodeTag(i+1,j+1), theMaterial, 5.0));
+      theDomain.addElement(new Truss(++tag, 2, nodeTag(i,j), nodeTag(i+1,j+1), theMaterial, 2.0 + i));
+    }
+  }
+
+  // tie the horizontal displacement of the two top corners, and cross
+  // the tie with a bar
+  const int left = nodeTag(0,numStories), right = nodeTag(numBays,numStories);
+  Matrix Ccr(1,1);
+  Ccr(0,0) = 1.0;
+  ID dofs(1);
+  dofs(0) = 0;
+  theDomain.addMP_Constraint(new MP_Constraint(left, right, Ccr, dofs, dofs));
+  theDomain.addElement(new Truss(++tag, 2, right, nodeTag(0,numStories-1), theMaterial, 3.0));
+}
+
+static const Matrix &
+formTangent(FE_Element &theEle)
+{
+  theEle.zeroTangent();
+  theEle.addKtToTang(1.0);
+  return theEle.getTangent(nullptr);
+}
+
+enum Assembly {ByID, ByElement, ByElementHalves};
+
+// solves the system assembled one way for B(i) = 1 + 0.1*i
+static Vector
+solve(LinearSOE &theSOE, AnalysisModel &theModel, Assembly how)
+{
+  const int numEqn = theSOE.getNumEqn();
+  theSOE.zeroA();
+  theSOE.zeroB();
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel.getFEs();
+  while ((elePtr = theEles()) != nullptr) {
+    const Matrix &K = formTangent(*elePtr);
+    switch (how) {
+      case ByID:
+        theSOE.addA(K, elePtr->getID());
+        break;
+      case ByElement:
+        theSOE.addA(K, *elePtr);
+        break;
+      case ByElementHalves:
+        theSOE.addA(K, *elePtr, 0.5);
+        theSOE.addA(K, *elePtr, 0.5);
+        break;
+    }
+  }
+
+  Vector B(numEqn);
+  for (int i = 0; i < numEqn; i++)
+    B(i) = 1.0 + 0.1*i;
+  theSOE.setB(B);
+
+  if (theSOE.solve() < 0)
+    return Vector();
+
+  return theSOE.getX();
+}
+
+static bool
+sameSolution(const Vector &x, const Vector &y)
+{
+  if (x.Size() == 0 || x.Size() != y.Size())
+    return false;
+
+  Vector d(x);
+  d -= y;
+  return d.Norm() <= 1.0e-10*x.Norm();
+}
+
+static bool
+sameBits(const Vector &x, const Vector &y)
+{
+  if (x.Size() != y.Size())
+    return false;
+  for (int i = 0; i < x.Size(); i++)
+    if (x(i) != y(i))
+      return false;
+  return true;
+}
+
+// the FE_Elements and DOF_Groups made anew and numbered, as when the
+// domain changes
+static int
+numberDOF(DOF_Numberer &theNumberer, AnalysisModel &theModel, ConstraintHandler &theHandler)
+{
+  theModel.clearAll();
+  theHandler.clearAll();
+  theNumberer.setLinks(theModel);
+  if (theHandler.handle() < 0 || theNumberer.numberDOF() < 0
+      || theHandler.doneNumberingDOF() < 0)
+    return -1;
+  return 0;
+}
+
+static int numFailed = 0;
+
+// the FE_Elements are renumbered after setSize(), which the SOE is not
+// told of; their scatter map is then stale, and the assembly by
+// FE_Element must take the searching path as the assembly by ID does
+static void
+testRenumbered(const char *name, LinearSOE &theSOE, AnalysisModel &theModel,
+               ConstraintHandler &theHandler)
+{
+  opserr << "TEST: " << name << " renumbered without setSize()\n";
+
+  PlainNumberer thePlain;
+  bool passed = numberDOF(thePlain, theModel, theHandler) == 0;
+  if (passed) {
+    Vector x = solve(theSOE, theModel, ByID);
+    passed = x.Size() > 0 && sameBits(x, solve(theSOE, theModel, ByElement));
+  }
+
+  // back to the numbering the SOEs are sized for
+  DOF_Numberer theRCM(*(new RCM(false)));
+  if (numberDOF(theRCM, theModel, theHandler) < 0)
+    passed = false;
+
+  if (passed)
+    opserr << "PASS: " << name << " stale scatter map not used\n\n";
+  else {
+    opserr << "FAIL: " << name << " stale scatter map not used\n\n";
+    numFailed++;
+  }
+}
+
+static void
+testSOE(const char *name, LinearSOE &theSOE, AnalysisModel &theModel)
+{
+  opserr << "TEST: " << name << "\n";
+
+  theSOE.setLinks(theModel);
+  bool passed = theSOE.setSize(theModel.getDOFCSRGraph()) >= 0;
+
+  Vector x = solve(theSOE, theModel, ByID);
+  passed = passed
+        && sameSolution(x, solve(theSOE, theModel, ByElement))
+        && sameSolution(x, solve(theSOE, theModel, ByElementHalves));
+
+  if (passed)
+    opserr << "PASS: " << name << " assembly by FE_Element\n\n";
+  else {
+    opserr << "FAIL: " << name << " assembly by FE_Element\n\n";
+    numFailed++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  opserr << " *******************************************************************\n";
+  opserr << "                  SparseScatterMap unit test\n";
+  opserr << " *******************************************************************\n\n";
+
+  Domain theDomain;
+  buildTruss(theDomain);
+
+  AnalysisModel theModel;
+  TransformationConstraintHandler theHandler;
+  DOF_Numberer theNumberer(*(new RCM(false)));
+  LoadControl theIntegrator(1.0, 1, 1.0, 1.0);
+
+  theModel.setLinks(theDomain, theHandler);
+  theHandler.setLinks(theDomain, theModel, theIntegrator);
+  theNumberer.setLinks(theModel);
+
+  if (theHandler.handle() < 0 || theNumberer.numberDOF() < 0
+      || theHandler.doneNumberingDOF() < 0) {
+    opserr << "FAILED SparseScatterMap unit test: the model could not be set up\n";
+    return 1;
+  }
+
+  {
+    UmfpackGenLinSOE theSOE(*(new UmfpackGenLinSolver()));
+    testSOE("UmfpackGenLinSOE", theSOE, theModel);
+    testRenumbered("UmfpackGenLinSOE", theSOE, theModel, theHandler);
+  }
+  {
+    SparseGenColLinSOE theSOE(*(new SuperLU()));
+    testSOE("SparseGenColLinSOE", theSOE, theModel);
+    testRenumbered("SparseGenColLinSOE", theSOE, theModel, theHandler);
+  }
+  {
+    SymSparseLinSOE theSOE(*(new SymSparseLinSolver()), 1);
+    testSOE("SymSparseLinSOE", theSOE, theModel);
+  }
+  {
+    SymSparseLinSOE theSOE(*(new SymSparseSupernodalSolver()), 1);
+    testSOE("SymSparseLinSOE, supernodal", theSOE, theModel);
+  }
+
+  if (numFailed == 0)
+    opserr << "PASSED SparseScatterMap unit test\n";
+  else
+    opserr << "FAILED SparseScatterMap unit test: " << numFailed << " failures\n";
+
+  return numFailed == 0 ? 0 : 1;
+}
@@ -32,6 +32,7 @@
 #include <UmfpackGenLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSRGraph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -41,17 +42,20 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ID.h>
+#include <FE_Element.h>
 
 UmfpackGenLinSOE::UmfpackGenLinSOE(UmfpackGenLinSolver &the_Solver)
-    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(), factored(false)
 {
+    this->setKeepNorms(true);
     the_Solver.setLinearSOE(*this);
 }
 
 
 UmfpackGenLinSOE::UmfpackGenLinSOE()
-    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(), factored(false)
 {
+    this->setKeepNorms(true);
 }
 
 
@@ -69,20 +73,35 @@ UmfpackGenLinSOE::getNumEqn(void) const
 int
 UmfpackGenLinSOE::setSize(Graph &theGraph)
 {
+    CSRGraph theEdges;
+    if (theEdges.build(theGraph) < 0) {
+	theScatter.clear();
+	return -1;
+    }
+    return this->setSize(theEdges);
+}
+
+int
+UmfpackGenLinSOE::setSize(const CSRGraph &theGraph)
+{
+    this->changedB();
+    this->changedX();
+    factored = false;
     int size = theGraph.getNumVertex();
     if (size < 0) {
 	opserr<<"size of soe < 0\n";
 	return -1;
     }
 
-    // fist itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int nnz = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-	const ID &theAdjacency = theVertex->getAdjacency();
-	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
-    }
+    // the adjacency of each vertex and the diag entry
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    int nnz = start[size] + size;
+
+    // keep the old structure of A to check whether it changes
+    std::vector<int> oldAp, oldAi;
+    oldAp.swap(Ap);
+    oldAi.swap(Ai);
 
     // resize A, B, X
     Ap.reserve(size+1);
@@ -93,43 +112,37 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
     X.resize(size);
     X.Zero();
 
-    // fill in Ai and Ap
+    // fill in Ai and Ap; the adjacency is in order, so the diag entry is
+    // only to be placed among it
     Ap.push_back(0);
     for (int a=0; a<size; a++) {
-
-	theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	    opserr << "WARNING:UmfpackGenLinSOE::setSize :";
-	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
-	    size = 0;
-	    return -1;
-	}
-
-	const ID &theAdjacency = theVertex->getAdjacency();
-	int idSize = theAdjacency.Size();
-	ID col(0,idSize+1);
-
-	// diagonal
-	col.insert(theVertex->getTag());
-
-	// now we have to place the entries in the ID into order in Ai
-	for (int i=0; i<idSize; i++) {
-	    int row = theAdjacency(i);
-	    col.insert(row);
-	}
-
-	// copy to Ai
-	for (int i=0; i<col.Size(); i++) {
-	    Ai.push_back(col(i));
-	}
+	int k = start[a];
+	for ( ; k < start[a+1] && adjacency[k] < a; k++)
+	    Ai.push_back(adjacency[k]);
+	Ai.push_back(a);
+	for ( ; k < start[a+1]; k++)
+	    Ai.push_back(adjacency[k]);
 
 	// set Ap
-	Ap.push_back(Ap[a]+col.Size());
+	Ap.push_back(Ai.size());
     }
 
-    // invoke setSize() on the Solver
+    // cache where each FE_Element's coefficients go in Ax
+    if (theModel != nullptr)
+	theScatter.build(*theModel, size, [this](int row, int col) -> int {
+	    for (int k=Ap[col]; k<Ap[col+1]; k++)
+		if (Ai[k] == row)
+		    return k;
+	    return -1;
+	});
+    else
+	theScatter.clear();
+
+    // invoke setSize() on the Solver, or setSizeSamePattern() if the
+    // structure of A has not changed
     LinearSOESolver *the_Solver = this->getSolver();
-    int solverOK = the_Solver->setSize();
+    int solverOK = (Ap == oldAp && Ai == oldAi) ? the_Solver->setSizeSamePattern()
+                                                : the_Solver->setSize();
     if (solverOK < 0) {
 	opserr << "WARNING:UmfpackGenLinSOE::setSize :";
 	opserr << " solver failed setSize()\n";
@@ -154,6 +167,11 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
 
+    // A changes, so the factorization is made again by the next solve; it
+    // is only written when set, as the threaded assembly comes after zeroA()
+    if (factored)
+	factored = false;
+
     int size = X.Size();
     if (fact == 1.0) { // do not need to multiply
 	for (int j=0; j<idSize; j++) {
@@ -202,10 +220,25 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
     return 0;
 }
 
+int
+UmfpackGenLinSOE::addA(const Matrix &m, const FE_Element &theEle, double fact)
+{
+    if (fact == 0.0)
+      return 0;
+
+    // direct add at the locations saved for theEle in setSize()
+    if (factored)
+	factored = false;
+    if (theScatter.add(m, theEle, fact, Ax.data()) == 0)
+	return 0;
+
+    return this->addA(m, theEle.getID(), fact);
+}
 
 int
 UmfpackGenLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
+    this->changedB();
     // check for a quick return 
     if (fact == 0.0)
       return 0;
@@ -243,6 +276,7 @@ UmfpackGenLinSOE::addB(const Vector &v, const ID &id, double fact)
 int
 UmfpackGenLinSOE::setB(const Vector &v, double fact)
 {
+    this->changedB();
     // check for a quick return 
     if (fact == 0.0)  {
 	B.Zero();
@@ -277,17 +311,20 @@ void
 UmfpackGenLinSOE::zeroA(void)
 {
     Ax.assign(Ax.size(),0.0);
+    factored = false;
 }
 
 void
 UmfpackGenLinSOE::zeroB(void)
 {
+    this->changedB();
     B.Zero();
 }
 
 void
 UmfpackGenLinSOE::setX(int loc, double value)
 {
+    this->changedX();
     if (loc<X.Size() && loc>=0) {
 	X(loc) = value;
     }
@@ -297,6 +334,7 @@ UmfpackGenLinSOE::setX(int loc, double value)
 void
 UmfpackGenLinSOE::setX(const Vector &x)
 {
+    this->changedX();
     if (x.Size() == X.Size()) {
 	X = x;
     }
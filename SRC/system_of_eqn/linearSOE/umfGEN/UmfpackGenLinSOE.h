@@ -30,6 +30,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 #include <vector>
 
 class UmfpackGenLinSolver;
@@ -44,7 +45,9 @@ public:
 
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addA(const Matrix &, const FE_Element &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);        
     
@@ -71,6 +74,8 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    SparseScatterMap theScatter;
+    bool factored;  // whether the solver holds the factorization of Ax
 };
 
 
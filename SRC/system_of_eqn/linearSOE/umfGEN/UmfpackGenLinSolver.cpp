@@ -28,6 +28,8 @@
 #include <UmfpackGenLinSOE.h>
 #include <UmfpackGenLinSolver.h>
 #include <math.h>
+#include <vector>
+#include <algorithm>
 #include <assert.h>
 #include <Constants.h>
 #include <Channel.h>
@@ -36,7 +38,7 @@
 
 UmfpackGenLinSolver::UmfpackGenLinSolver(bool doDet_)
     :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), 
-     Symbolic(nullptr), theSOE(nullptr),
+     Symbolic(nullptr), Numeric(nullptr), theSOE(nullptr),
      det(0.0), doDet(doDet_)
 {
 }
@@ -44,6 +46,9 @@ UmfpackGenLinSolver::UmfpackGenLinSolver(bool doDet_)
 
 UmfpackGenLinSolver::~UmfpackGenLinSolver()
 {
+    if (Numeric != nullptr) {
+	umfpack_di_free_numeric(&Numeric);
+    }
     if (Symbolic != nullptr) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
@@ -55,6 +60,45 @@ UmfpackGenLinSolver::getDeterminant()
   return doDet? det : OpenSees::Constants::nan;
 }
 
+int
+UmfpackGenLinSolver::factor()
+{
+    int* Ap = &(theSOE->Ap[0]);
+    int* Ai = &(theSOE->Ai[0]);
+    double* Ax = &(theSOE->Ax[0]);
+
+    // check if symbolic is done
+    assert(Symbolic != 0);
+    
+    //  perform the numerical factorization if A has changed since the
+    //  last one; it is kept for solves with other B, such as those of an
+    //  eigen solver using the same A
+    if (theSOE->factored == false) {
+	if (Numeric != nullptr) {
+	    umfpack_di_free_numeric(&Numeric);
+	}
+
+	int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+
+	// check error
+	if (status!=UMFPACK_OK) {
+	  // TODO
+	  // opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
+	    if (Numeric != nullptr) {
+		umfpack_di_free_numeric(&Numeric);
+	    }
+	    return -1;
+	}
+	numNumericFactor++;
+
+	if (doDet == true)
+	  umfpack_di_get_determinant(&det, nullptr, Numeric, Info);
+
+	theSOE->factored = true;
+    }
+    return 0;
+}
+
 int
 UmfpackGenLinSolver::solve()
 {
@@ -68,35 +112,11 @@ UmfpackGenLinSolver::solve()
     double* X = &(theSOE->X(0));
     double* B = &(theSOE->B(0));
 
-    // check if symbolic is done
-    assert(Symbolic != 0);
-    // if (Symbolic == 0) {
-    //     opserr<<"WARNING: setSize has not been called -- Umfpackgenlinsolver::solve\n";
-    //     return -1;
-    // }
-    
-    //  perform the numerical factorization
-    // numerical analysis
-    void* Numeric = nullptr;
-    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
-
-    // check error
-    if (status!=UMFPACK_OK) {
-      // TODO
-      // opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
-	return -1;
-    }
+    if (this->factor() != 0)
+      return -1;
 
     // solve
-    status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
-    
-    if (doDet == true)
-      umfpack_di_get_determinant(&det, nullptr, Numeric, Info);
-
-    // delete Numeric
-    if (Numeric != nullptr) {
-	umfpack_di_free_numeric(&Numeric);
-    }
+    int status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
 
     // check error
     if (status != UMFPACK_OK) {
@@ -107,6 +127,35 @@ UmfpackGenLinSolver::solve()
     return 0;
 }
 
+int
+UmfpackGenLinSolver::solveBlock(int numRHS, double *X)
+{
+    int n = theSOE->X.Size();
+    int nnz = (int)theSOE->Ai.size();
+    if (n == 0 || nnz==0 || numRHS == 0) return 0;
+    
+    int* Ap = &(theSOE->Ap[0]);
+    int* Ai = &(theSOE->Ai[0]);
+    double* Ax = &(theSOE->Ax[0]);
+
+    if (this->factor() != 0)
+      return -1;
+
+    // umfpack does not solve in place, so each column is copied out
+    // first; the work arrays are shared by the columns
+    std::vector<double> B(n), W(5*n);
+    std::vector<int> Wi(n);
+    for (int k=0; k<numRHS; k++) {
+      double *Xk = X + (size_t)k*n;
+      std::copy(Xk, Xk+n, B.begin());
+      int status = umfpack_di_wsolve(UMFPACK_A,Ap,Ai,Ax,Xk,B.data(),Numeric,Control,Info,Wi.data(),W.data());
+      if (status != UMFPACK_OK)
+        return -1;
+    }
+
+    return 0;
+}
+
 
 int
 UmfpackGenLinSolver::setSize()
@@ -124,6 +173,11 @@ UmfpackGenLinSolver::setSize()
     int* Ai = &(theSOE->Ai[0]);
     double* Ax = &(theSOE->Ax[0]);
 
+    // the factorization is of the old symbolic analysis
+    if (Numeric != nullptr) {
+	umfpack_di_free_numeric(&Numeric);
+    }
+
     // symbolic analysis
     if (Symbolic != nullptr) {
 	umfpack_di_free_symbolic(&Symbolic);
@@ -139,6 +193,18 @@ UmfpackGenLinSolver::setSize()
 	Symbolic = 0;
 	return -1;
     }
+    numSymbolicFactor++;
+    return 0;
+}
+
+int
+UmfpackGenLinSolver::setSizeSamePattern()
+{
+    // the column pre-ordering and symbolic factorization only depend on
+    // the structure of A, so they are kept
+    if (Symbolic == nullptr)
+	return this->setSize();
+
     return 0;
 }
 
@@ -40,7 +40,10 @@ class UmfpackGenLinSolver : public LinearSOESolver
     ~UmfpackGenLinSolver();
 
     int solve(void);
+    bool canSolveBlock(void) const {return true;};
+    int solveBlock(int numRHS, double *X);
     int setSize(void);
+    int setSizeSamePattern(void);
 
     int setLinearSOE(UmfpackGenLinSOE &theSOE);
     
@@ -53,7 +56,10 @@ class UmfpackGenLinSolver : public LinearSOESolver
   protected:
 
   private:
+    int factor(void);
+
     void *Symbolic;
+    void *Numeric;
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     UmfpackGenLinSOE *theSOE;
     double det;
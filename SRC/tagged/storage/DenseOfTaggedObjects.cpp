@@ -0,0 +1,280 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of the
+// DenseOfTaggedObjects class.
+//
+#include <algorithm>
+#include <TaggedObject.h>
+#include <DenseOfTaggedObjects.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+
+// a direct table is used while the tags are less than this many times the
+// number of objects, plus a slack for small models
+static constexpr int DirectDensity = 4;
+static constexpr int DirectSlack   = 16384;
+
+DenseOfTaggedObjects::DenseOfTaggedObjects()
+:direct(true), tagOrder(true), sorted(true), lastTag(0),
+ numComponents(0), numHoles(0), myIter(*this)
+{
+
+}
+
+DenseOfTaggedObjects::~DenseOfTaggedObjects()
+{
+    this->clearAll();
+}
+
+
+int
+DenseOfTaggedObjects::setSize(int newSize)
+{
+    if (newSize < 0) {
+      opserr << "DenseOfTaggedObjects::setSize - invalid size " << newSize << "\n";
+      return -1;
+    }
+    theObjects.reserve(newSize);
+    return 0;
+}
+
+
+bool
+DenseOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+    int tag = newComponent->getTag();
+
+    if (this->find(tag) >= 0) {
+      opserr << "DenseOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: "
+             << tag << "\n";
+      return false;
+    }
+
+    if (numComponents + numHoles > 0 && tag < lastTag)
+      sorted = false;
+    lastTag = tag;
+
+    this->setPosition(tag, int(theObjects.size()));
+    theObjects.push_back(newComponent);
+    numComponents++;
+
+    return true;
+}
+
+
+TaggedObject *
+DenseOfTaggedObjects::removeComponent(int tag)
+{
+    int position = this->find(tag);
+    if (position < 0)
+      return nullptr;
+
+    TaggedObject *removed = theObjects[position];
+    this->setPosition(tag, -1);
+    numComponents--;
+
+    // the last object is removed outright; any other leaves a hole
+    if (position == int(theObjects.size()) - 1)
+      theObjects.pop_back();
+    else {
+      theObjects[position] = nullptr;
+      numHoles++;
+    }
+
+    return removed;
+}
+
+
+int
+DenseOfTaggedObjects::getNumComponents(void) const
+{
+    return numComponents;
+}
+
+
+TaggedObject *
+DenseOfTaggedObjects::getComponentPtr(int tag)
+{
+    int position = this->find(tag);
+    if (position < 0)
+      return nullptr;
+
+    return theObjects[position];
+}
+
+
+TaggedObjectIter &
+DenseOfTaggedObjects::getComponents()
+{
+    this->compact();
+    myIter.reset();
+    return myIter;
+}
+
+
+DenseOfTaggedObjectsIter
+DenseOfTaggedObjects::getIter()
+{
+    this->compact();
+    return DenseOfTaggedObjectsIter(*this);
+}
+
+
+int
+DenseOfTaggedObjects::reorder(const ID &tags)
+{
+    this->compact();
+
+    std::vector<TaggedObject *> reordered;
+    reordered.reserve(numComponents);
+
+    for (int i = 0; i < tags.Size(); i++) {
+      int position = this->find(tags(i));
+      if (position < 0 || theObjects[position] == nullptr) {
+        opserr << "DenseOfTaggedObjects::reorder - no object, or a repeated one, with tag "
+               << tags(i) << "\n";
+        // put back those already taken
+        for (TaggedObject *object : reordered)
+          theObjects[this->find(object->getTag())] = object;
+        return -1;
+      }
+      reordered.push_back(theObjects[position]);
+      theObjects[position] = nullptr;
+    }
+
+    for (TaggedObject *object : theObjects)
+      if (object != nullptr)
+        reordered.push_back(object);
+
+    theObjects.swap(reordered);
+    for (int i = 0; i < numComponents; i++)
+      this->setPosition(theObjects[i]->getTag(), i);
+
+    tagOrder = false;
+    sorted   = false;
+    return 0;
+}
+
+
+TaggedObjectStorage *
+DenseOfTaggedObjects::getEmptyCopy(void)
+{
+    return new DenseOfTaggedObjects();
+}
+
+
+void
+DenseOfTaggedObjects::clearAll(bool invokeDestructor)
+{
+    // invoke the destructor on all the tagged objects stored
+    if (invokeDestructor == true)
+      for (TaggedObject *object : theObjects)
+        delete object;
+
+    theObjects.clear();
+    thePositions.clear();
+    theHash.clear();
+    direct   = true;
+    tagOrder = true;
+    sorted   = true;
+    lastTag  = 0;
+    numComponents = 0;
+    numHoles = 0;
+}
+
+
+void
+DenseOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+    this->compact();
+
+    for (TaggedObject *object : theObjects) {
+      object->Print(s, flag);
+      if (flag == OPS_PRINT_PRINTMODEL_JSON)
+        s << ",\n";
+    }
+}
+
+
+int
+DenseOfTaggedObjects::find(int tag) const
+{
+    if (direct) {
+      if (tag < 0 || tag >= int(thePositions.size()))
+        return -1;
+      return thePositions[tag];
+    }
+
+    auto entry = theHash.find(tag);
+    if (entry == theHash.end())
+      return -1;
+    return entry->second;
+}
+
+
+void
+DenseOfTaggedObjects::setPosition(int tag, int position)
+{
+    if (direct && position >= 0 && (tag < 0 || tag >= int(thePositions.size()))) {
+      if (tag >= 0 && tag < DirectDensity*(numComponents + 1) + DirectSlack) {
+        int size = std::max(tag + 1, 2*int(thePositions.size()));
+        thePositions.resize(size, -1);
+      }
+      else {
+        // too sparse, or negative, for a direct table; move to the hash
+        direct = false;
+        theHash.reserve(numComponents + 1);
+        for (int i = 0; i < int(thePositions.size()); i++)
+          if (thePositions[i] >= 0)
+            theHash[i] = thePositions[i];
+        thePositions.clear();
+        thePositions.shrink_to_fit();
+      }
+    }
+
+    if (direct) {
+      if (tag >= 0 && tag < int(thePositions.size()))
+        thePositions[tag] = position;
+    }
+    else if (position >= 0)
+      theHash[tag] = position;
+    else
+      theHash.erase(tag);
+}
+
+
+//
+// Close up the holes left by removed objects and, if the objects are
+// iterated in order of their tags and have been added out of order, sort
+// them; the positions of the objects that move are then reset.
+//
+void
+DenseOfTaggedObjects::compact(void)
+{
+    if (numHoles == 0 && (sorted || !tagOrder))
+      return;
+
+    if (numHoles != 0) {
+      theObjects.erase(std::remove(theObjects.begin(), theObjects.end(), nullptr),
+                       theObjects.end());
+      numHoles = 0;
+    }
+
+    if (tagOrder && !sorted) {
+      std::sort(theObjects.begin(), theObjects.end(),
+                [](TaggedObject *a, TaggedObject *b) {
+                  return a->getTag() < b->getTag();
+                });
+      sorted = true;
+    }
+
+    if (!theObjects.empty())
+      lastTag = theObjects.back()->getTag();
+
+    for (int i = 0; i < numComponents; i++)
+      this->setPosition(theObjects[i]->getTag(), i);
+}
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: DenseOfTaggedObjects is a storage class that keeps the
+// pointers to its TaggedObjects contiguously in a vector, in the order in
+// which they are iterated, with the position of each tag held in a table
+// indexed directly by the tag. When the tags are too sparse for a direct
+// table, or negative, the positions are held in a hash map instead.
+//
+// The objects are iterated in ascending order of their tags, as they are
+// by a MapOfTaggedObjects, until reorder() is invoked to give some other
+// order, e.g. one in which the objects that are neighbours in the mesh
+// are neighbours in memory. Objects added after reorder() are iterated
+// after the others.
+//
+// Removing an object leaves a hole that is closed up, with the objects
+// sorted if need be, the next time the objects are iterated; an iter
+// obtained before an object is added or removed is not to be used after.
+//
+#ifndef DenseOfTaggedObjects_h
+#define DenseOfTaggedObjects_h
+
+#include <vector>
+#include <unordered_map>
+#include <TaggedObjectStorage.h>
+#include <DenseOfTaggedObjectsIter.h>
+
+class ID;
+
+class DenseOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    DenseOfTaggedObjects();
+    ~DenseOfTaggedObjects();
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);
+    int getNumComponents(void) const;
+
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    DenseOfTaggedObjectsIter getIter();
+
+    // iterate the objects with the given tags first, in the order given,
+    // followed by any others in their current order
+    int reorder(const ID &tags);
+
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+
+    void Print(OPS_Stream &s, int flag =0);
+    friend class DenseOfTaggedObjectsIter;
+
+  private:
+    int  find(int tag) const;
+    void setPosition(int tag, int position);
+    void compact(void);
+
+    std::vector<TaggedObject *> theObjects; // in iteration order, with holes
+    std::vector<int> thePositions;          // position by tag, -1 if none
+    std::unordered_map<int, int> theHash;   // position by tag, if not direct
+    bool direct;                            // thePositions is in use
+    bool tagOrder;                          // iterate in order of the tags
+    bool sorted;                            // theObjects in order of the tags
+    int  lastTag;                           // tag of the last object added
+    int  numComponents;
+    int  numHoles;
+    DenseOfTaggedObjectsIter myIter;        // the iter for this object
+};
+
+#endif
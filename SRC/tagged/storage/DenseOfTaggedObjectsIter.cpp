@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// DenseOfTaggedObjectsIter.
+//
+#include <DenseOfTaggedObjectsIter.h>
+#include <DenseOfTaggedObjects.h>
+
+DenseOfTaggedObjectsIter::DenseOfTaggedObjectsIter(DenseOfTaggedObjects &theComponents)
+:theObjects(&theComponents.theObjects), currentComponent(0)
+{
+
+}
+
+
+DenseOfTaggedObjectsIter::~DenseOfTaggedObjectsIter()
+{
+
+}
+
+void
+DenseOfTaggedObjectsIter::reset(void)
+{
+    currentComponent = 0;
+}
+
+TaggedObject *
+DenseOfTaggedObjectsIter::operator()(void)
+{
+    // skip the holes left by removed objects
+    while (currentComponent < theObjects->size()) {
+      TaggedObject *result = (*theObjects)[currentComponent++];
+      if (result != nullptr)
+        return result;
+    }
+    return nullptr;
+}
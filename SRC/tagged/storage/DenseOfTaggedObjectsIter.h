@@ -0,0 +1,32 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: DenseOfTaggedObjectsIter is an iter for returning the
+// TaggedObjects of a DenseOfTaggedObjects in its iteration order.
+//
+#ifndef DenseOfTaggedObjectsIter_h
+#define DenseOfTaggedObjectsIter_h
+
+#include <TaggedObjectIter.h>
+#include <vector>
+
+class DenseOfTaggedObjects;
+
+class DenseOfTaggedObjectsIter: public TaggedObjectIter
+{
+  public:
+    DenseOfTaggedObjectsIter(DenseOfTaggedObjects &theComponents);
+    virtual ~DenseOfTaggedObjectsIter();
+
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);
+
+  private:
+    std::vector<TaggedObject *> *theObjects;
+    std::size_t currentComponent;
+};
+
+#endif
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: A benchmark of the TaggedObjectStorage classes. For each,
+// the time to add n objects in order of their tags, to iterate over them
+// and to look each of them up in random order is reported, in nanoseconds
+// per object. The objects are tagged 1, 1+stride, 1+2*stride, ... and the
+// ArrayOfTaggedObjects is made large enough to hold each at its tag.
+//
+//     TaggedStorageBenchmark [n=100000] [stride=1] [sweeps=20]
+//
+#include <TaggedObject.h>
+#include <ArrayOfTaggedObjects.h>
+#include <MapOfTaggedObjects.h>
+#include <HashMapOfTaggedObjects.h>
+#include <DenseOfTaggedObjects.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+class Component : public TaggedObject
+{
+  public:
+    Component(int tag) : TaggedObject(tag), value(tag) {}
+    double value;
+};
+
+double
+seconds(void)
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+void
+run(const char *name, TaggedObjectStorage &theStorage,
+    const std::vector<int> &tags, int sweeps)
+{
+  const double n = tags.size();
+  std::vector<int> lookups(tags);
+  std::shuffle(lookups.begin(), lookups.end(), std::mt19937(7));
+
+  double start = seconds();
+  for (int tag : tags)
+    theStorage.addComponent(new Component(tag));
+  double add = seconds() - start;
+
+  double sum = 0.0;
+  start = seconds();
+  for (int s = 0; s < sweeps; s++) {
+    TaggedObject *object;
+    TaggedObjectIter &theObjects = theStorage.getComponents();
+    while ((object = theObjects()) != nullptr)
+      sum += static_cast<Component *>(object)->value;
+  }
+  double iterate = seconds() - start;
+
+  start = seconds();
+  for (int s = 0; s < sweeps; s++)
+    for (int tag : lookups)
+      sum += static_cast<Component *>(theStorage.getComponentPtr(tag))->value;
+  double lookup = seconds() - start;
+
+  theStorage.clearAll();
+
+  std::printf("%-24s %10.1f %10.2f %10.2f   (%g)\n", name,
+              1.0e9*add/n, 1.0e9*iterate/(n*sweeps), 1.0e9*lookup/(n*sweeps), sum);
+}
+
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  int n      = argc > 1 ? std::atoi(argv[1]) : 100000;
+  int stride = argc > 2 ? std::atoi(argv[2]) : 1;
+  int sweeps = argc > 3 ? std::atoi(argv[3]) : 20;
+
+  std::vector<int> tags(n);
+  for (int i = 0; i < n; i++)
+    tags[i] = 1 + i*stride;
+
+  std::printf("%d objects, stride %d, %d sweeps; ns per object\n", n, stride, sweeps);
+  std::printf("%-24s %10s %10s %10s\n", "storage", "add", "iterate", "lookup");
+
+  {
+    ArrayOfTaggedObjects theStorage(1 + n*stride);
+    run("ArrayOfTaggedObjects", theStorage, tags, sweeps);
+  }
+  {
+    MapOfTaggedObjects theStorage;
+    run("MapOfTaggedObjects", theStorage, tags, sweeps);
+  }
+  {
+    HashMapOfTaggedObjects theStorage;
+    run("HashMapOfTaggedObjects", theStorage, tags, sweeps);
+  }
+  {
+    DenseOfTaggedObjects theStorage;
+    run("DenseOfTaggedObjects", theStorage, tags, sweeps);
+  }
+  return 0;
+}
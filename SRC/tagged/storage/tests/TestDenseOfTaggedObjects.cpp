@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file is a driver to test DenseOfTaggedObjects. The
+// same random sequence of adds, removes and lookups is applied to it and
+// to a MapOfTaggedObjects, first with tags dense enough for the direct
+// table and then with tags that move it to the hash; the two must hold
+// and iterate the same objects. Then reorder() is checked, with objects
+// added and removed after it, and with a tag that is not stored.
+//
+#include <stdlib.h>
+#include <random>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Domain.h>
+#include <ID.h>
+#include <TaggedObject.h>
+#include <TaggedObjectIter.h>
+#include <MapOfTaggedObjects.h>
+#include <DenseOfTaggedObjects.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+thread_local Element *ops_TheActiveElement = 0;
+
+class Component : public TaggedObject
+{
+  public:
+    Component(int tag) : TaggedObject(tag) {}
+    void Print(OPS_Stream &s, int flag = 0) {s << this->getTag() << "\n";}
+};
+
+static std::vector<int>
+tagsOf(TaggedObjectStorage &theStorage)
+{
+  std::vector<int> tags;
+  TaggedObject *objectPtr;
+  TaggedObjectIter &theObjects = theStorage.getComponents();
+  while ((objectPtr = theObjects()) != nullptr)
+    tags.push_back(objectPtr->getTag());
+  return tags;
+}
+
+// applies numOps random adds, removes and lookups of tags in [low, high)
+// to both storages; false at the first difference between them
+static bool
+sameHistory(DenseOfTaggedObjects &theDense, MapOfTaggedObjects &theMap,
+            int low, int high, int numOps, std::mt19937 &generator)
+{
+  std::uniform_int_distribution<int> tag(low, high - 1);
+  std::uniform_int_distribution<int> operation(0, 9);
+  int numDuplicates = 0;
+
+  for (int n = 0; n < numOps; n++) {
+    const int t = tag(generator);
+    switch (operation(generator)) {
+      case 0: case 1: case 2: case 3: case 4: {
+        // an add, which fails for both if the tag is stored; as each
+        // failure warns, only a few are tried
+        if (theMap.getComponentPtr(t) != nullptr && numDuplicates++ > 2) {
+          if (theDense.getComponentPtr(t) == nullptr)
+            return false;
+          break;
+        }
+        Component *theDenseObject = new Component(t);
+        Component *theMapObject = new Component(t);
+        bool addedDense = theDense.addComponent(theDenseObject);
+        bool addedMap = theMap.addComponent(theMapObject);
+        if (!addedDense)
+          delete theDenseObject;
+        if (!addedMap)
+          delete theMapObject;
+        if (addedDense != addedMap)
+          return false;
+        break;
+      }
+      case 5: case 6: {
+        TaggedObject *removedDense = theDense.removeComponent(t);
+        TaggedObject *removedMap = theMap.removeComponent(t);
+        if ((removedDense == nullptr) != (removedMap == nullptr)
+            || (removedDense != nullptr && removedDense->getTag() != t))
+          return false;
+        delete removedDense;
+        delete removedMap;
+        break;
+      }
+      case 7: case 8: {
+        TaggedObject *objectPtr = theDense.getComponentPtr(t);
+        if ((objectPtr == nullptr) != (theMap.getComponentPtr(t) == nullptr)
+            || (objectPtr != nullptr && objectPtr->getTag() != t))
+          return false;
+        break;
+      }
+      case 9:
+        if (tagsOf(theDense) != tagsOf(theMap))
+          return false;
+        break;
+    }
+    if (theDense.getNumComponents() != theMap.getNumComponents())
+      return false;
+  }
+
+  return tagsOf(theDense) == tagsOf(theMap);
+}
+
+static int numFailed = 0;
+
+static void
+report(const char *test, bool passed)
+{
+  if (passed)
+    opserr << "PASS: " << test << "\n\n";
+  else {
+    opserr << "FAIL: " << test << "\n\n";
+    numFailed++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  opserr << " *******************************************************************\n";
+  opserr << "                  DenseOfTaggedObjects unit test\n";
+  opserr << " *******************************************************************\n\n";
+
+  std::mt19937 generator(12345);
+
+  //
+  // the same history as a MapOfTaggedObjects
+  //
+
+  opserr << "TEST: random adds, removes and lookups of tags in [0, 2000)\n";
+  {
+    DenseOfTaggedObjects theDense;
+    MapOfTaggedObjects theMap;
+    report("direct table agrees with MapOfTaggedObjects",
+           sameHistory(theDense, theMap, 0, 2000, 20000, generator));
+
+    opserr << "TEST: then tags in [-1000000, 1000000)\n";
+    report("hash agrees with MapOfTaggedObjects",
+           sameHistory(theDense, theMap, -1000000, 1000000, 20000, generator));
+
+    opserr << "TEST: clearAll()\n";
+    theDense.clearAll();
+    Component *objectPtr = new Component(7);
+    report("empty, and direct again",
+           theDense.getNumComponents() == 0 && tagsOf(theDense).empty()
+           && theDense.addComponent(objectPtr) && theDense.getComponentPtr(7) == objectPtr);
+  }
+
+  //
+  // reorder()
+  //
+
+  opserr << "TEST: reorder()\n";
+  {
+    DenseOfTaggedObjects theDense;
+    for (int t = 1; t <= 6; t++)
+      theDense.addComponent(new Component(t));
+
+    ID order(3);
+    order(0) = 5;
+    order(1) = 2;
+    order(2) = 4;
+    bool passed = theDense.reorder(order) == 0
+               && tagsOf(theDense) == std::vector<int>({5, 2, 4, 1, 3, 6});
+    report("the given tags first, the others after", passed);
+
+    delete theDense.removeComponent(2);
+    theDense.addComponent(new Component(0));
+    passed = tagsOf(theDense) == std::vector<int>({5, 4, 1, 3, 6, 0})
+          && theDense.getComponentPtr(4)->getTag() == 4
+          && theDense.getComponentPtr(0)->getTag() == 0
+          && theDense.getComponentPtr(2) == nullptr;
+    report("adds go last and removes close up", passed);
+
+    order(1) = 9;
+    passed = theDense.reorder(order) < 0
+          && tagsOf(theDense) == std::vector<int>({5, 4, 1, 3, 6, 0})
+          && theDense.getComponentPtr(5)->getTag() == 5;
+    report("a tag not stored leaves the order as it was", passed);
+  }
+
+  if (numFailed == 0)
+    opserr << "PASSED DenseOfTaggedObjects unit test\n";
+  else
+    opserr << "FAILED DenseOfTaggedObjects unit test: " << numFailed << " failures\n";
+
+  return numFailed == 0 ? 0 : 1;
+}
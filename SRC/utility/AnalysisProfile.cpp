@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of AnalysisProfile.
+//
+#include <AnalysisProfile.h>
+#include <map>
+#include <mutex>
+
+std::atomic<bool> AnalysisProfile::enabled{false};
+
+namespace {
+
+// times are kept in nanoseconds so that they can be summed atomically
+std::atomic<long> phaseTime[AnalysisProfile::NumPhases];
+std::atomic<long> phaseCalls[AnalysisProfile::NumPhases];
+std::atomic<long> counts[AnalysisProfile::NumCounts];
+
+std::mutex elementMutex;
+std::map<std::string, std::vector<long>> elementCalls;
+
+const char *phaseNames[AnalysisProfile::NumPhases] = {
+  "applyLoad", "update", "formTangent", "formUnbalance",
+  "solve", "test", "commit", "record"
+};
+
+const char *countNames[AnalysisProfile::NumCounts] = {
+  "steps", "factorizations", "symbolicFactorizations"
+};
+
+} // namespace
+
+
+void
+AnalysisProfile::setEnabled(bool flag)
+{
+  enabled.store(flag);
+}
+
+void
+AnalysisProfile::reset(void)
+{
+  for (int i = 0; i < NumPhases; i++) {
+    phaseTime[i]  = 0;
+    phaseCalls[i] = 0;
+  }
+  for (int i = 0; i < NumCounts; i++)
+    counts[i] = 0;
+
+  std::lock_guard<std::mutex> lock(elementMutex);
+  elementCalls.clear();
+}
+
+void
+AnalysisProfile::addTime(Phase phase, double seconds)
+{
+  phaseTime[phase].fetch_add(long(seconds*1.0e9), std::memory_order_relaxed);
+  phaseCalls[phase].fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+AnalysisProfile::addCount(Count count, long n)
+{
+  if (isEnabled())
+    counts[count].fetch_add(n, std::memory_order_relaxed);
+}
+
+void
+AnalysisProfile::addElementCalls(Phase phase, const std::vector<std::pair<const char *, int>> &classes)
+{
+  if (!isEnabled())
+    return;
+
+  std::lock_guard<std::mutex> lock(elementMutex);
+  for (const auto &entry : classes) {
+    std::vector<long> &calls = elementCalls[entry.first];
+    if (calls.empty())
+      calls.assign(NumPhases, 0);
+    calls[phase] += entry.second;
+  }
+}
+
+double
+AnalysisProfile::getTime(Phase phase)
+{
+  return phaseTime[phase].load()*1.0e-9;
+}
+
+long
+AnalysisProfile::getCalls(Phase phase)
+{
+  return phaseCalls[phase].load();
+}
+
+long
+AnalysisProfile::getCount(Count count)
+{
+  return counts[count].load();
+}
+
+std::vector<std::pair<std::string, std::vector<long>>>
+AnalysisProfile::getElementCalls(void)
+{
+  std::lock_guard<std::mutex> lock(elementMutex);
+  return std::vector<std::pair<std::string, std::vector<long>>>(elementCalls.begin(), elementCalls.end());
+}
+
+const char *
+AnalysisProfile::getName(Phase phase)
+{
+  return phaseNames[phase];
+}
+
+const char *
+AnalysisProfile::getName(Count count)
+{
+  return countNames[count];
+}
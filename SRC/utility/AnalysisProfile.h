@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: AnalysisProfile accumulates, while it is enabled, the time
+// spent in each phase of an analysis step and the number of times each
+// phase is entered, together with counts of steps, factorizations of the
+// system of equations and calls made to the elements of each class.
+//
+// A phase is timed by a Scope object placed at the top of the function that
+// carries it out; when the profile is disabled the Scope only reads one flag.
+// The number of iterations is the number of calls to the convergence test.
+// The element calls of a phase are counted by class from the number of
+// elements of each class visited by its loop, so the loops themselves are
+// not slowed down.
+//
+#ifndef AnalysisProfile_h
+#define AnalysisProfile_h
+
+#include <Timer.h>
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+class AnalysisProfile
+{
+  public:
+    enum Phase {
+      ApplyLoad,     // Domain::applyLoad
+      Update,        // Domain::update
+      FormTangent,   // assembly of the element tangents
+      FormUnbalance, // assembly of the element residuals
+      Solve,         // LinearSOE::solve
+      Test,          // ConvergenceTest::test
+      Commit,        // Domain::commit, without the recorders
+      Record,        // recorders
+      NumPhases
+    };
+
+    enum Count {
+      Steps,
+      NumericFactor,
+      SymbolicFactor,
+      NumCounts
+    };
+
+    class Scope {
+      public:
+        Scope(Phase p)
+          : phase(p), start(isEnabled() ? Timer::now() : -1.0) {}
+        ~Scope() {
+          if (start >= 0.0)
+            addTime(phase, Timer::now() - start);
+        }
+      private:
+        Phase  phase;
+        double start;
+    };
+
+    static bool isEnabled(void) {
+      return enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool);
+    static void reset(void);
+
+    static void addTime(Phase, double seconds);
+    static void addCount(Count, long n = 1);
+    // classes, with the number of elements of each, visited by a phase
+    static void addElementCalls(Phase, const std::vector<std::pair<const char *, int>> &);
+
+    static double getTime(Phase);
+    static long   getCalls(Phase);
+    static long   getCount(Count);
+    static std::vector<std::pair<std::string, std::vector<long>>> getElementCalls(void);
+
+    static const char *getName(Phase);
+    static const char *getName(Count);
+
+  private:
+    static std::atomic<bool> enabled;
+};
+
+#endif
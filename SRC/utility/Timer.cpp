@@ -37,6 +37,7 @@
 #include<Timer.h>
 
 #include <stdbool.h>
+#include <chrono>
 
 #ifndef TIMER_USE_MPIWTIME
 
@@ -162,6 +163,12 @@ Timer::getNumPageFaults(void) const
 }    
 
 
+double
+Timer::now(void)
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
 
 void 
 Timer::Print(OPS_Stream &s) const
@@ -65,6 +65,10 @@ class Timer
     double getReal(void) const;
     double getCPU(void) const;
     int getNumPageFaults(void) const;
+
+    // seconds on a monotonic clock of high resolution, for timing
+    // intervals too short for the clock ticks of start() and pause()
+    static double now(void);
     
     virtual void Print(OPS_Stream &s) const;   
     friend OPS_Stream &operator<<(OPS_Stream &s, const Timer &E);    
@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: A small fixed-size pool of worker threads.
+//
+// Loops submitted with submit_loop are split into one contiguous block per
+// worker, so the indices handled by each thread are a deterministic function
+// of the loop bounds and the pool size; submit_blocks instead takes the
+// block size, for reductions that must not depend on the pool size. The
+// returned handle is waited on with wait(), which rethrows the first
+// exception raised by a block.
+//
+// EXAMPLE:
+//
+//     OpenSees::thread_pool pool{4};
+//     pool.submit_loop<int>(0, n, [&](int i) { y[i] = f(x[i]); }).wait();
+//
+#ifndef OpenSees_thread_pool_hpp
+#define OpenSees_thread_pool_hpp
+
+#include <atomic>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace OpenSees {
+
+class multi_future {
+public:
+  multi_future() = default;
+  multi_future(multi_future&&) = default;
+
+  void push_back(std::future<void>&& f) {
+    futures.push_back(std::move(f));
+  }
+
+  void wait() {
+    for (std::future<void>& f : futures)
+      f.wait();
+    for (std::future<void>& f : futures)
+      f.get();
+    futures.clear();
+  }
+
+private:
+  std::vector<std::future<void>> futures;
+};
+
+
+class thread_pool {
+public:
+  explicit thread_pool(unsigned int n = std::thread::hardware_concurrency())
+  : done(false)
+  {
+    if (n == 0)
+      n = 1;
+    workers.reserve(n);
+    for (unsigned int i = 0; i < n; i++)
+      workers.emplace_back([this]{ this->work(); });
+    live_threads += n;
+  }
+
+  ~thread_pool() {
+    {
+      std::unique_lock<std::mutex> lock(queue_mutex);
+      done = true;
+    }
+    queue_ready.notify_all();
+    for (std::thread& t : workers)
+      t.join();
+    live_threads -= workers.size();
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  unsigned int get_thread_count() const {
+    return workers.size();
+  }
+
+  // the number of worker threads of all the pools in the process, for
+  // code that must not fork() while any of them are running
+  static unsigned int get_live_thread_count() {
+    return live_threads.load();
+  }
+
+  std::future<void> submit_task(std::function<void()> task) {
+    auto job = std::make_shared<std::packaged_task<void()>>(std::move(task));
+    std::future<void> result = job->get_future();
+    {
+      std::unique_lock<std::mutex> lock(queue_mutex);
+      tasks.emplace_back([job]{ (*job)(); });
+    }
+    queue_ready.notify_one();
+    return result;
+  }
+
+  // Call f(i) for every i in [first, last)
+  template <typename T, typename F>
+  multi_future submit_loop(T first, T last, F&& f) {
+    multi_future result;
+    if (last <= first)
+      return result;
+
+    const T total  = last - first;
+    const T blocks = total < T(workers.size()) ? total : T(workers.size());
+    for (T b = 0; b < blocks; b++) {
+      const T start = first + (total*b)/blocks,
+              end   = first + (total*(b+1))/blocks;
+      result.push_back(this->submit_task([start, end, &f]{
+        for (T i = start; i < end; i++)
+          f(i);
+      }));
+    }
+    return result;
+  }
+
+  // Call f(b, start, end) for each block b of the consecutive blocks
+  // [start, end) of size block_size that cover [first, last). Unlike
+  // submit_loop, the blocks do not depend on the size of the pool.
+  template <typename T, typename F>
+  multi_future submit_blocks(T first, T last, T block_size, F&& f) {
+    multi_future result;
+    if (last <= first || block_size <= 0)
+      return result;
+
+    T b = 0;
+    for (T start = first; start < last; start += block_size, b++) {
+      const T end = last - start < block_size ? last : start + block_size;
+      result.push_back(this->submit_task([b, start, end, &f]{
+        f(b, start, end);
+      }));
+    }
+    return result;
+  }
+
+private:
+  void work() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        queue_ready.wait(lock, [this]{ return done || !tasks.empty(); });
+        if (done && tasks.empty())
+          return;
+        task = std::move(tasks.front());
+        tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread>          workers;
+  std::deque<std::function<void()>> tasks;
+  std::mutex                        queue_mutex;
+  std::condition_variable           queue_ready;
+  bool                              done;
+
+  inline static std::atomic<unsigned int> live_threads{0};
+};
+
+} // namespace OpenSees
+
+#endif